@@ -17,17 +17,29 @@ async function jsToCHeader(inputFilename, outputFilename) {
         // Add comment to js
         let newContent = comment + content;
         await fs.writeFile(inputFilename, newContent);
-        // Convert each character in JS content to its hexadecimal value
-        const hexValues = [...newContent].map(char => `0x${char.charCodeAt(0).toString(16).padStart(2, '0')}`);
+        // Static bridge bytes, its gzip variant and ETag (served as `/webinix_bridge.js`)
+        const raw = Buffer.from(newContent, 'utf-8');
+        const gz = require('zlib').gzipSync(raw, { level: 9 });
+        const etag = require('crypto').createHash('sha256').update(raw).digest('hex').slice(0, 16);
+        // Split the hexadecimal values to make the output more readable, adding a new line every 10 values
+        const toHex = (bytes) => {
+            const hexValues = [...bytes].map(b => `0x${b.toString(16).padStart(2, '0')}`);
+            let out = '';
+            for (let i = 0; i < hexValues.length; i += 10) {
+                out += "\n    " + hexValues.slice(i, i + 10).join(', ') + ',';
+            }
+            return out;
+        };
         // Prepare the content for the C header file
         let headerContent = `${comment}// --- PLEASE DO NOT EDIT THIS FILE -------\n// --- THIS FILE IS GENERATED BY JS2C.PY --\n\n`;
         headerContent += `#ifndef WEBUI_BRIDGE_H\n#define WEBUI_BRIDGE_H\n`;
+        headerContent += `#define WEBUI_BRIDGE_ETAG "\\"${etag}\\""\n`;
         headerContent += `unsigned char webinix_javascript_bridge[] = { `;
-        // Split the hexadecimal values to make the output more readable, adding a new line every 10 values
-        for (let i = 0; i < hexValues.length; i += 10) {
-            headerContent += "\n    " + hexValues.slice(i, i + 10).join(', ') + ',';
-        }
-        headerContent += `\n    0x00\n};\n\n#endif // WEBUI_BRIDGE_H`;
+        headerContent += toHex(raw);
+        headerContent += `\n    0x00\n};\n`;
+        headerContent += `unsigned char webinix_javascript_bridge_gz[] = { `;
+        headerContent += toHex(gz).slice(0, -1);
+        headerContent += `\n};\n\n#endif // WEBUI_BRIDGE_H`;
         // Write the header content to the output file
         await fs.writeFile(outputFilename, headerContent);
     } catch (error) {
@@ -19,11 +19,57 @@ import { AsyncFunction, addRefreshableEventListener } from './utils.ts';
 
 type DataTypes = string | number | boolean | Uint8Array;
 
+// In-process transport of Linux WebView windows (`wv_in_process`),
+// a WebSocket look-alike over the `webinix` WebKit script message
+// handler. Packets are base64 encoded both ways.
+class WebuiLocalSocket {
+	binaryType: string = 'arraybuffer';
+	readyState: number = WebSocket.CONNECTING;
+	onopen: ((event: Event) => void) | null = null;
+	onmessage: ((event: MessageEvent) => void) | null = null;
+	onclose: ((event: CloseEvent) => void) | null = null;
+	onerror: ((event: Event) => void) | null = null;
+	constructor() {
+		// Called by webinix.c
+		(globalThis as any).__webinix_local_recv = (data: string) => {
+			if (this.readyState !== WebSocket.OPEN) return;
+			const bytes = Uint8Array.from(atob(data), (c) => c.charCodeAt(0));
+			this.onmessage?.(new MessageEvent('message', { data: bytes.buffer }));
+		};
+		addEventListener('pagehide', () => this.close());
+		setTimeout(() => {
+			this.#post('open');
+			this.readyState = WebSocket.OPEN;
+			this.onopen?.(new Event('open'));
+		}, 0);
+	}
+	send(data: ArrayBuffer | Uint8Array): void {
+		if (this.readyState !== WebSocket.OPEN) return;
+		const bytes = data instanceof Uint8Array ? data : new Uint8Array(data);
+		let binary = '';
+		for (let i = 0; i < bytes.length; i += 0x8000) {
+			binary += String.fromCharCode(...bytes.subarray(i, i + 0x8000));
+		}
+		this.#post(btoa(binary));
+	}
+	close(): void {
+		if (this.readyState === WebSocket.CLOSED) return;
+		this.readyState = WebSocket.CLOSED;
+		this.#post('close');
+		this.onclose?.(new CloseEvent('close', { code: 1000 }));
+	}
+	#post(message: string): void {
+		(globalThis as any).webkit.messageHandlers.webinix.postMessage(message);
+	}
+}
+
 class WebuiBridge {
 	// Webinix Settings
 	#secure: boolean;
 	#token: number;
 	#port: number;
+	#path: string;
+	#local: boolean;
 	#log: boolean;
 	#winX: number;
 	#winY: number;
@@ -87,6 +133,8 @@ class WebuiBridge {
 		secure = false,
 		token = 0,
 		port = 0,
+		path = '',
+		local = false,
 		log = false,
 		winX = 0,
 		winY = 0,
@@ -96,6 +144,8 @@ class WebuiBridge {
 		secure: boolean;
 		token: number;
 		port: number;
+		path?: string;
+		local?: boolean;
 		log?: boolean;
 		winX: number;
 		winY: number;
@@ -106,6 +156,8 @@ class WebuiBridge {
 		this.#secure = secure;
 		this.#token = token;
 		this.#port = port;
+		this.#path = path;
+		this.#local = local;
 		this.#log = log;
 		this.#winX = winX;
 		this.#winY = winY;
@@ -609,9 +661,13 @@ class WebuiBridge {
 			this.#ws.close();
 		}
 		this.#TokenAccepted = false;
-		const host = window.location.hostname;
-		const url = this.#secure ? ('wss://' + host) : ('ws://' + host);
-		this.#ws = new WebSocket(`${url}:${this.#port}/_webinix_ws_connect`);
+		if (this.#local) {
+			this.#ws = new WebuiLocalSocket() as unknown as WebSocket;
+		} else {
+			const host = window.location.hostname;
+			const url = this.#secure ? ('wss://' + host) : ('ws://' + host);
+			this.#ws = new WebSocket(`${url}:${this.#port}${this.#path}/_webinix_ws_connect`);
+		}
 		this.#ws.binaryType = 'arraybuffer';
 		this.#ws.onopen = this.#wsOnOpen.bind(this);
 		this.#ws.onmessage = this.#wsOnMessage.bind(this);
@@ -11,191 +11,294 @@
 
 #ifndef WEBUI_BRIDGE_H
 #define WEBUI_BRIDGE_H
+#define WEBUI_BRIDGE_ETAG "\"aaaee3c41ae7359b\""
 unsigned char webinix_javascript_bridge[] = { 
-    0x2f, 0x2f, 0x20, 0x57, 0x65, 0x62, 0x55, 0x49, 0x20, 0x76,
-    0x32, 0x2e, 0x35, 0x2e, 0x30, 0x2d, 0x62, 0x65, 0x74, 0x61,
-    0x2e, 0x34, 0x0a, 0x2f, 0x2f, 0x20, 0x68, 0x74, 0x74, 0x70,
-    0x73, 0x3a, 0x2f, 0x2f, 0x77, 0x65, 0x62, 0x75, 0x69, 0x2e,
-    0x6d, 0x65, 0x0a, 0x2f, 0x2f, 0x20, 0x68, 0x74, 0x74, 0x70,
-    0x73, 0x3a, 0x2f, 0x2f, 0x67, 0x69, 0x74, 0x68, 0x75, 0x62,
-    0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x77, 0x65, 0x62, 0x75, 0x69,
-    0x2d, 0x64, 0x65, 0x76, 0x2f, 0x77, 0x65, 0x62, 0x75, 0x69,
-    0x0a, 0x2f, 0x2f, 0x20, 0x43, 0x6f, 0x70, 0x79, 0x72, 0x69,
-    0x67, 0x68, 0x74, 0x20, 0x28, 0x63, 0x29, 0x20, 0x32, 0x30,
-    0x32, 0x30, 0x2d, 0x32, 0x30, 0x32, 0x35, 0x20, 0x48, 0x61,
-    0x73, 0x73, 0x61, 0x6e, 0x20, 0x44, 0x72, 0x61, 0x67, 0x61,
-    0x2e, 0x0a, 0x2f, 0x2f, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e,
-    0x73, 0x65, 0x64, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20,
-    0x4d, 0x49, 0x54, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73,
-    0x65, 0x2e, 0x0a, 0x2f, 0x2f, 0x20, 0x41, 0x6c, 0x6c, 0x20,
-    0x72, 0x69, 0x67, 0x68, 0x74, 0x73, 0x20, 0x72, 0x65, 0x73,
-    0x65, 0x72, 0x76, 0x65, 0x64, 0x2e, 0x0a, 0x2f, 0x2f, 0x20,
-    0x43, 0x61, 0x6e, 0x61, 0x64, 0x61, 0x2e, 0x0a, 0x0a, 0x22,
-    0x75, 0x73, 0x65, 0x2d, 0x73, 0x74, 0x72, 0x69, 0x63, 0x74,
-    0x22, 0x3b, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-    0x20, 0x61, 0x64, 0x64, 0x52, 0x65, 0x66, 0x72, 0x65, 0x73,
-    0x68, 0x61, 0x62, 0x6c, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74,
-    0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x72,
-    0x6f, 0x6f, 0x74, 0x2c, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74,
-    0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x2c, 0x74,
-    0x79, 0x70, 0x65, 0x2c, 0x6c, 0x69, 0x73, 0x74, 0x65, 0x6e,
-    0x65, 0x72, 0x2c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73,
-    0x29, 0x7b, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-    0x20, 0x72, 0x65, 0x62, 0x69, 0x6e, 0x64, 0x4c, 0x69, 0x73,
-    0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x6d, 0x75, 0x74, 0x61,
-    0x74, 0x69, 0x6f, 0x6e, 0x73, 0x29, 0x7b, 0x66, 0x6f, 0x72,
-    0x28, 0x6c, 0x65, 0x74, 0x20, 0x6d, 0x75, 0x74, 0x61, 0x74,
-    0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x75, 0x74,
-    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x29, 0x66, 0x6f, 0x72,
-    0x28, 0x6c, 0x65, 0x74, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20,
-    0x6f, 0x66, 0x20, 0x6d, 0x75, 0x74, 0x61, 0x74, 0x69, 0x6f,
-    0x6e, 0x2e, 0x61, 0x64, 0x64, 0x65, 0x64, 0x4e, 0x6f, 0x64,
-    0x65, 0x73, 0x29, 0x7b, 0x69, 0x66, 0x28, 0x21, 0x28, 0x6e,
-    0x6f, 0x64, 0x65, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e,
-    0x63, 0x65, 0x6f, 0x66, 0x20, 0x48, 0x54, 0x4d, 0x4c, 0x45,
-    0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x29, 0x29, 0x72, 0x65,
-    0x74, 0x75, 0x72, 0x6e, 0x3b, 0x6e, 0x6f, 0x64, 0x65, 0x2e,
-    0x6d, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x28, 0x74, 0x61,
-    0x72, 0x67, 0x65, 0x74, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74,
-    0x6f, 0x72, 0x29, 0x26, 0x26, 0x6e, 0x6f, 0x64, 0x65, 0x2e,
-    0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69,
-    0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x74, 0x79, 0x70,
+    0x2f, 0x2f, 0x20, 0x57, 0x65, 0x62, 0x69, 0x6e, 0x69, 0x78,
+    0x20, 0x76, 0x32, 0x2e, 0x35, 0x2e, 0x30, 0x2d, 0x62, 0x65,
+    0x74, 0x61, 0x2e, 0x34, 0x0a, 0x2f, 0x2f, 0x20, 0x68, 0x74,
+    0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x77, 0x65, 0x62, 0x69,
+    0x6e, 0x69, 0x78, 0x2e, 0x6d, 0x65, 0x0a, 0x2f, 0x2f, 0x20,
+    0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x67, 0x69,
+    0x74, 0x68, 0x75, 0x62, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x77,
+    0x65, 0x62, 0x69, 0x6e, 0x69, 0x78, 0x2d, 0x64, 0x65, 0x76,
+    0x2f, 0x77, 0x65, 0x62, 0x69, 0x6e, 0x69, 0x78, 0x0a, 0x2f,
+    0x2f, 0x20, 0x43, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68,
+    0x74, 0x20, 0x28, 0x63, 0x29, 0x20, 0x32, 0x30, 0x32, 0x30,
+    0x2d, 0x32, 0x30, 0x32, 0x35, 0x20, 0x48, 0x61, 0x73, 0x73,
+    0x61, 0x6e, 0x20, 0x44, 0x72, 0x61, 0x67, 0x61, 0x2e, 0x0a,
+    0x2f, 0x2f, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65,
+    0x64, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x4d, 0x49,
+    0x54, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2e,
+    0x0a, 0x2f, 0x2f, 0x20, 0x41, 0x6c, 0x6c, 0x20, 0x72, 0x69,
+    0x67, 0x68, 0x74, 0x73, 0x20, 0x72, 0x65, 0x73, 0x65, 0x72,
+    0x76, 0x65, 0x64, 0x2e, 0x0a, 0x2f, 0x2f, 0x20, 0x43, 0x61,
+    0x6e, 0x61, 0x64, 0x61, 0x2e, 0x0a, 0x0a, 0x22, 0x75, 0x73,
+    0x65, 0x2d, 0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x22, 0x3b,
+    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61,
+    0x64, 0x64, 0x52, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x61,
+    0x62, 0x6c, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69,
+    0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x72, 0x6f, 0x6f,
+    0x74, 0x2c, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x53, 0x65,
+    0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x2c, 0x74, 0x79, 0x70,
     0x65, 0x2c, 0x6c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72,
-    0x2c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x29, 0x3b,
-    0x66, 0x6f, 0x72, 0x28, 0x6c, 0x65, 0x74, 0x20, 0x63, 0x68,
-    0x69, 0x6c, 0x64, 0x20, 0x6f, 0x66, 0x20, 0x6e, 0x6f, 0x64,
-    0x65, 0x2e, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65, 0x6c,
-    0x65, 0x63, 0x74, 0x6f, 0x72, 0x41, 0x6c, 0x6c, 0x28, 0x74,
-    0x61, 0x72, 0x67, 0x65, 0x74, 0x53, 0x65, 0x6c, 0x65, 0x63,
-    0x74, 0x6f, 0x72, 0x29, 0x29, 0x63, 0x68, 0x69, 0x6c, 0x64,
+    0x2c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x29, 0x7b,
+    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72,
+    0x65, 0x62, 0x69, 0x6e, 0x64, 0x4c, 0x69, 0x73, 0x74, 0x65,
+    0x6e, 0x65, 0x72, 0x28, 0x6d, 0x75, 0x74, 0x61, 0x74, 0x69,
+    0x6f, 0x6e, 0x73, 0x29, 0x7b, 0x66, 0x6f, 0x72, 0x28, 0x6c,
+    0x65, 0x74, 0x20, 0x6d, 0x75, 0x74, 0x61, 0x74, 0x69, 0x6f,
+    0x6e, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x75, 0x74, 0x61, 0x74,
+    0x69, 0x6f, 0x6e, 0x73, 0x29, 0x66, 0x6f, 0x72, 0x28, 0x6c,
+    0x65, 0x74, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x6f, 0x66,
+    0x20, 0x6d, 0x75, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e,
+    0x61, 0x64, 0x64, 0x65, 0x64, 0x4e, 0x6f, 0x64, 0x65, 0x73,
+    0x29, 0x7b, 0x69, 0x66, 0x28, 0x21, 0x28, 0x6e, 0x6f, 0x64,
+    0x65, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x6f, 0x66, 0x20, 0x48, 0x54, 0x4d, 0x4c, 0x45, 0x6c, 0x65,
+    0x6d, 0x65, 0x6e, 0x74, 0x29, 0x29, 0x72, 0x65, 0x74, 0x75,
+    0x72, 0x6e, 0x3b, 0x6e, 0x6f, 0x64, 0x65, 0x2e, 0x6d, 0x61,
+    0x74, 0x63, 0x68, 0x65, 0x73, 0x28, 0x74, 0x61, 0x72, 0x67,
+    0x65, 0x74, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72,
+    0x29, 0x26, 0x26, 0x6e, 0x6f, 0x64, 0x65, 0x2e, 0x61, 0x64,
+    0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74,
+    0x65, 0x6e, 0x65, 0x72, 0x28, 0x74, 0x79, 0x70, 0x65, 0x2c,
+    0x6c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x2c, 0x6f,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x29, 0x3b, 0x66, 0x6f,
+    0x72, 0x28, 0x6c, 0x65, 0x74, 0x20, 0x63, 0x68, 0x69, 0x6c,
+    0x64, 0x20, 0x6f, 0x66, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x2e,
+    0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65, 0x6c, 0x65, 0x63,
+    0x74, 0x6f, 0x72, 0x41, 0x6c, 0x6c, 0x28, 0x74, 0x61, 0x72,
+    0x67, 0x65, 0x74, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f,
+    0x72, 0x29, 0x29, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x20, 0x69,
+    0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x6f, 0x66, 0x20,
+    0x48, 0x54, 0x4d, 0x4c, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+    0x74, 0x26, 0x26, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x2e, 0x61,
+    0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73,
+    0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x74, 0x79, 0x70, 0x65,
+    0x2c, 0x6c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x2c,
+    0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x29, 0x7d, 0x7d,
+    0x6c, 0x65, 0x74, 0x20, 0x6f, 0x62, 0x73, 0x65, 0x72, 0x76,
+    0x65, 0x72, 0x3d, 0x6e, 0x65, 0x77, 0x20, 0x4d, 0x75, 0x74,
+    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x4f, 0x62, 0x73, 0x65, 0x72,
+    0x76, 0x65, 0x72, 0x28, 0x72, 0x65, 0x62, 0x69, 0x6e, 0x64,
+    0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x29, 0x3b,
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6f, 0x62, 0x73,
+    0x65, 0x72, 0x76, 0x65, 0x72, 0x2e, 0x6f, 0x62, 0x73, 0x65,
+    0x72, 0x76, 0x65, 0x28, 0x72, 0x6f, 0x6f, 0x74, 0x2c, 0x7b,
+    0x73, 0x75, 0x62, 0x74, 0x72, 0x65, 0x65, 0x3a, 0x21, 0x30,
+    0x2c, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x4c, 0x69, 0x73, 0x74,
+    0x3a, 0x21, 0x30, 0x7d, 0x29, 0x2c, 0x6f, 0x62, 0x73, 0x65,
+    0x72, 0x76, 0x65, 0x72, 0x7d, 0x76, 0x61, 0x72, 0x20, 0x41,
+    0x73, 0x79, 0x6e, 0x63, 0x46, 0x75, 0x6e, 0x63, 0x74, 0x69,
+    0x6f, 0x6e, 0x3d, 0x28, 0x61, 0x73, 0x79, 0x6e, 0x63, 0x20,
+    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x29,
+    0x7b, 0x7d, 0x29, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x72,
+    0x75, 0x63, 0x74, 0x6f, 0x72, 0x3b, 0x76, 0x61, 0x72, 0x20,
+    0x57, 0x65, 0x62, 0x75, 0x69, 0x4c, 0x6f, 0x63, 0x61, 0x6c,
+    0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x3d, 0x63, 0x6c, 0x61,
+    0x73, 0x73, 0x7b, 0x62, 0x69, 0x6e, 0x61, 0x72, 0x79, 0x54,
+    0x79, 0x70, 0x65, 0x3d, 0x22, 0x61, 0x72, 0x72, 0x61, 0x79,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x22, 0x3b, 0x72, 0x65,
+    0x61, 0x64, 0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x3d, 0x57,
+    0x65, 0x62, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x43,
+    0x4f, 0x4e, 0x4e, 0x45, 0x43, 0x54, 0x49, 0x4e, 0x47, 0x3b,
+    0x6f, 0x6e, 0x6f, 0x70, 0x65, 0x6e, 0x3d, 0x6e, 0x75, 0x6c,
+    0x6c, 0x3b, 0x6f, 0x6e, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67,
+    0x65, 0x3d, 0x6e, 0x75, 0x6c, 0x6c, 0x3b, 0x6f, 0x6e, 0x63,
+    0x6c, 0x6f, 0x73, 0x65, 0x3d, 0x6e, 0x75, 0x6c, 0x6c, 0x3b,
+    0x6f, 0x6e, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x3d, 0x6e, 0x75,
+    0x6c, 0x6c, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x72, 0x75,
+    0x63, 0x74, 0x6f, 0x72, 0x28, 0x29, 0x7b, 0x67, 0x6c, 0x6f,
+    0x62, 0x61, 0x6c, 0x54, 0x68, 0x69, 0x73, 0x2e, 0x5f, 0x5f,
+    0x77, 0x65, 0x62, 0x69, 0x6e, 0x69, 0x78, 0x5f, 0x6c, 0x6f,
+    0x63, 0x61, 0x6c, 0x5f, 0x72, 0x65, 0x63, 0x76, 0x3d, 0x64,
+    0x61, 0x74, 0x61, 0x3d, 0x3e, 0x7b, 0x69, 0x66, 0x28, 0x74,
+    0x68, 0x69, 0x73, 0x2e, 0x72, 0x65, 0x61, 0x64, 0x79, 0x53,
+    0x74, 0x61, 0x74, 0x65, 0x21, 0x3d, 0x3d, 0x57, 0x65, 0x62,
+    0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x4f, 0x50, 0x45,
+    0x4e, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x6c,
+    0x65, 0x74, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x3d, 0x55,
+    0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x2e,
+    0x66, 0x72, 0x6f, 0x6d, 0x28, 0x61, 0x74, 0x6f, 0x62, 0x28,
+    0x64, 0x61, 0x74, 0x61, 0x29, 0x2c, 0x63, 0x3d, 0x3e, 0x63,
+    0x2e, 0x63, 0x68, 0x61, 0x72, 0x43, 0x6f, 0x64, 0x65, 0x41,
+    0x74, 0x28, 0x30, 0x29, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73,
+    0x2e, 0x6f, 0x6e, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65,
+    0x3f, 0x2e, 0x28, 0x6e, 0x65, 0x77, 0x20, 0x4d, 0x65, 0x73,
+    0x73, 0x61, 0x67, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x28,
+    0x22, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x22, 0x2c,
+    0x7b, 0x64, 0x61, 0x74, 0x61, 0x3a, 0x62, 0x79, 0x74, 0x65,
+    0x73, 0x2e, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x7d, 0x29,
+    0x29, 0x7d, 0x2c, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e,
+    0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28,
+    0x22, 0x70, 0x61, 0x67, 0x65, 0x68, 0x69, 0x64, 0x65, 0x22,
+    0x2c, 0x28, 0x29, 0x3d, 0x3e, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x63, 0x6c, 0x6f, 0x73, 0x65, 0x28, 0x29, 0x29, 0x2c, 0x73,
+    0x65, 0x74, 0x54, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x28,
+    0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x23, 0x70, 0x6f, 0x73, 0x74, 0x28, 0x22, 0x6f, 0x70, 0x65,
+    0x6e, 0x22, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x72,
+    0x65, 0x61, 0x64, 0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x3d,
+    0x57, 0x65, 0x62, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2e,
+    0x4f, 0x50, 0x45, 0x4e, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x6f, 0x6e, 0x6f, 0x70, 0x65, 0x6e, 0x3f, 0x2e, 0x28, 0x6e,
+    0x65, 0x77, 0x20, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x28, 0x22,
+    0x6f, 0x70, 0x65, 0x6e, 0x22, 0x29, 0x29, 0x7d, 0x2c, 0x30,
+    0x29, 0x7d, 0x73, 0x65, 0x6e, 0x64, 0x28, 0x64, 0x61, 0x74,
+    0x61, 0x29, 0x7b, 0x69, 0x66, 0x28, 0x74, 0x68, 0x69, 0x73,
+    0x2e, 0x72, 0x65, 0x61, 0x64, 0x79, 0x53, 0x74, 0x61, 0x74,
+    0x65, 0x21, 0x3d, 0x3d, 0x57, 0x65, 0x62, 0x53, 0x6f, 0x63,
+    0x6b, 0x65, 0x74, 0x2e, 0x4f, 0x50, 0x45, 0x4e, 0x29, 0x72,
+    0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x6c, 0x65, 0x74, 0x20,
+    0x62, 0x79, 0x74, 0x65, 0x73, 0x3d, 0x64, 0x61, 0x74, 0x61,
     0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x6f,
-    0x66, 0x20, 0x48, 0x54, 0x4d, 0x4c, 0x45, 0x6c, 0x65, 0x6d,
-    0x65, 0x6e, 0x74, 0x26, 0x26, 0x63, 0x68, 0x69, 0x6c, 0x64,
-    0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c,
-    0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x74, 0x79,
-    0x70, 0x65, 0x2c, 0x6c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65,
-    0x72, 0x2c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x29,
-    0x7d, 0x7d, 0x6c, 0x65, 0x74, 0x20, 0x6f, 0x62, 0x73, 0x65,
-    0x72, 0x76, 0x65, 0x72, 0x3d, 0x6e, 0x65, 0x77, 0x20, 0x4d,
-    0x75, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x4f, 0x62, 0x73,
-    0x65, 0x72, 0x76, 0x65, 0x72, 0x28, 0x72, 0x65, 0x62, 0x69,
-    0x6e, 0x64, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72,
-    0x29, 0x3b, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6f,
-    0x62, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x2e, 0x6f, 0x62,
-    0x73, 0x65, 0x72, 0x76, 0x65, 0x28, 0x72, 0x6f, 0x6f, 0x74,
-    0x2c, 0x7b, 0x73, 0x75, 0x62, 0x74, 0x72, 0x65, 0x65, 0x3a,
-    0x21, 0x30, 0x2c, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x4c, 0x69,
-    0x73, 0x74, 0x3a, 0x21, 0x30, 0x7d, 0x29, 0x2c, 0x6f, 0x62,
-    0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x7d, 0x76, 0x61, 0x72,
-    0x20, 0x41, 0x73, 0x79, 0x6e, 0x63, 0x46, 0x75, 0x6e, 0x63,
-    0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x28, 0x61, 0x73, 0x79, 0x6e,
-    0x63, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-    0x28, 0x29, 0x7b, 0x7d, 0x29, 0x2e, 0x63, 0x6f, 0x6e, 0x73,
-    0x74, 0x72, 0x75, 0x63, 0x74, 0x6f, 0x72, 0x3b, 0x76, 0x61,
+    0x66, 0x20, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72,
+    0x61, 0x79, 0x3f, 0x64, 0x61, 0x74, 0x61, 0x3a, 0x6e, 0x65,
+    0x77, 0x20, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72,
+    0x61, 0x79, 0x28, 0x64, 0x61, 0x74, 0x61, 0x29, 0x2c, 0x62,
+    0x69, 0x6e, 0x61, 0x72, 0x79, 0x3d, 0x22, 0x22, 0x3b, 0x66,
+    0x6f, 0x72, 0x28, 0x6c, 0x65, 0x74, 0x20, 0x69, 0x3d, 0x30,
+    0x3b, 0x69, 0x3c, 0x62, 0x79, 0x74, 0x65, 0x73, 0x2e, 0x6c,
+    0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b, 0x69, 0x2b, 0x3d, 0x33,
+    0x32, 0x37, 0x36, 0x38, 0x29, 0x62, 0x69, 0x6e, 0x61, 0x72,
+    0x79, 0x2b, 0x3d, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2e,
+    0x66, 0x72, 0x6f, 0x6d, 0x43, 0x68, 0x61, 0x72, 0x43, 0x6f,
+    0x64, 0x65, 0x28, 0x2e, 0x2e, 0x2e, 0x62, 0x79, 0x74, 0x65,
+    0x73, 0x2e, 0x73, 0x75, 0x62, 0x61, 0x72, 0x72, 0x61, 0x79,
+    0x28, 0x69, 0x2c, 0x69, 0x2b, 0x33, 0x32, 0x37, 0x36, 0x38,
+    0x29, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x70,
+    0x6f, 0x73, 0x74, 0x28, 0x62, 0x74, 0x6f, 0x61, 0x28, 0x62,
+    0x69, 0x6e, 0x61, 0x72, 0x79, 0x29, 0x29, 0x7d, 0x63, 0x6c,
+    0x6f, 0x73, 0x65, 0x28, 0x29, 0x7b, 0x74, 0x68, 0x69, 0x73,
+    0x2e, 0x72, 0x65, 0x61, 0x64, 0x79, 0x53, 0x74, 0x61, 0x74,
+    0x65, 0x21, 0x3d, 0x3d, 0x57, 0x65, 0x62, 0x53, 0x6f, 0x63,
+    0x6b, 0x65, 0x74, 0x2e, 0x43, 0x4c, 0x4f, 0x53, 0x45, 0x44,
+    0x26, 0x26, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x72, 0x65,
+    0x61, 0x64, 0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x3d, 0x57,
+    0x65, 0x62, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x43,
+    0x4c, 0x4f, 0x53, 0x45, 0x44, 0x2c, 0x74, 0x68, 0x69, 0x73,
+    0x2e, 0x23, 0x70, 0x6f, 0x73, 0x74, 0x28, 0x22, 0x63, 0x6c,
+    0x6f, 0x73, 0x65, 0x22, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73,
+    0x2e, 0x6f, 0x6e, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x3f, 0x2e,
+    0x28, 0x6e, 0x65, 0x77, 0x20, 0x43, 0x6c, 0x6f, 0x73, 0x65,
+    0x45, 0x76, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x63, 0x6c, 0x6f,
+    0x73, 0x65, 0x22, 0x2c, 0x7b, 0x63, 0x6f, 0x64, 0x65, 0x3a,
+    0x31, 0x65, 0x33, 0x7d, 0x29, 0x29, 0x29, 0x7d, 0x23, 0x70,
+    0x6f, 0x73, 0x74, 0x28, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67,
+    0x65, 0x29, 0x7b, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x54,
+    0x68, 0x69, 0x73, 0x2e, 0x77, 0x65, 0x62, 0x6b, 0x69, 0x74,
+    0x2e, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x48, 0x61,
+    0x6e, 0x64, 0x6c, 0x65, 0x72, 0x73, 0x2e, 0x77, 0x65, 0x62,
+    0x69, 0x6e, 0x69, 0x78, 0x2e, 0x70, 0x6f, 0x73, 0x74, 0x4d,
+    0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x28, 0x6d, 0x65, 0x73,
+    0x73, 0x61, 0x67, 0x65, 0x29, 0x7d, 0x7d, 0x3b, 0x76, 0x61,
     0x72, 0x20, 0x57, 0x65, 0x62, 0x75, 0x69, 0x42, 0x72, 0x69,
     0x64, 0x67, 0x65, 0x3d, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x7b,
     0x23, 0x73, 0x65, 0x63, 0x75, 0x72, 0x65, 0x3b, 0x23, 0x74,
     0x6f, 0x6b, 0x65, 0x6e, 0x3b, 0x23, 0x70, 0x6f, 0x72, 0x74,
-    0x3b, 0x23, 0x6c, 0x6f, 0x67, 0x3b, 0x23, 0x77, 0x69, 0x6e,
-    0x58, 0x3b, 0x23, 0x77, 0x69, 0x6e, 0x59, 0x3b, 0x23, 0x77,
-    0x69, 0x6e, 0x57, 0x3b, 0x23, 0x77, 0x69, 0x6e, 0x48, 0x3b,
-    0x23, 0x69, 0x73, 0x44, 0x72, 0x61, 0x67, 0x67, 0x69, 0x6e,
-    0x67, 0x3d, 0x21, 0x31, 0x3b, 0x23, 0x69, 0x6e, 0x69, 0x74,
-    0x69, 0x61, 0x6c, 0x4d, 0x6f, 0x75, 0x73, 0x65, 0x58, 0x3d,
+    0x3b, 0x23, 0x70, 0x61, 0x74, 0x68, 0x3b, 0x23, 0x6c, 0x6f,
+    0x63, 0x61, 0x6c, 0x3b, 0x23, 0x6c, 0x6f, 0x67, 0x3b, 0x23,
+    0x77, 0x69, 0x6e, 0x58, 0x3b, 0x23, 0x77, 0x69, 0x6e, 0x59,
+    0x3b, 0x23, 0x77, 0x69, 0x6e, 0x57, 0x3b, 0x23, 0x77, 0x69,
+    0x6e, 0x48, 0x3b, 0x23, 0x69, 0x73, 0x44, 0x72, 0x61, 0x67,
+    0x67, 0x69, 0x6e, 0x67, 0x3d, 0x21, 0x31, 0x3b, 0x23, 0x69,
+    0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x4d, 0x6f, 0x75, 0x73,
+    0x65, 0x58, 0x3d, 0x30, 0x3b, 0x23, 0x69, 0x6e, 0x69, 0x74,
+    0x69, 0x61, 0x6c, 0x4d, 0x6f, 0x75, 0x73, 0x65, 0x59, 0x3d,
     0x30, 0x3b, 0x23, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c,
-    0x4d, 0x6f, 0x75, 0x73, 0x65, 0x59, 0x3d, 0x30, 0x3b, 0x23,
-    0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x57, 0x69, 0x6e,
-    0x64, 0x6f, 0x77, 0x58, 0x3d, 0x77, 0x69, 0x6e, 0x64, 0x6f,
-    0x77, 0x2e, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x58, 0x7c,
-    0x7c, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x73, 0x63,
-    0x72, 0x65, 0x65, 0x6e, 0x4c, 0x65, 0x66, 0x74, 0x3b, 0x23,
-    0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x57, 0x69, 0x6e,
-    0x64, 0x6f, 0x77, 0x59, 0x3d, 0x77, 0x69, 0x6e, 0x64, 0x6f,
-    0x77, 0x2e, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x59, 0x7c,
-    0x7c, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x73, 0x63,
-    0x72, 0x65, 0x65, 0x6e, 0x54, 0x6f, 0x70, 0x3b, 0x23, 0x63,
-    0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x57, 0x69, 0x6e, 0x64,
-    0x6f, 0x77, 0x58, 0x3d, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77,
-    0x2e, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x58, 0x7c, 0x7c,
-    0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x73, 0x63, 0x72,
-    0x65, 0x65, 0x6e, 0x4c, 0x65, 0x66, 0x74, 0x3b, 0x23, 0x63,
-    0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x57, 0x69, 0x6e, 0x64,
-    0x6f, 0x77, 0x59, 0x3d, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77,
-    0x2e, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x59, 0x7c, 0x7c,
-    0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x73, 0x63, 0x72,
-    0x65, 0x65, 0x6e, 0x54, 0x6f, 0x70, 0x3b, 0x23, 0x77, 0x73,
-    0x3b, 0x23, 0x77, 0x73, 0x53, 0x74, 0x61, 0x79, 0x41, 0x6c,
-    0x69, 0x76, 0x65, 0x3d, 0x21, 0x30, 0x3b, 0x23, 0x77, 0x73,
-    0x53, 0x74, 0x61, 0x79, 0x41, 0x6c, 0x69, 0x76, 0x65, 0x54,
-    0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x3d, 0x35, 0x30, 0x30,
-    0x3b, 0x23, 0x77, 0x73, 0x57, 0x61, 0x73, 0x43, 0x6f, 0x6e,
-    0x6e, 0x65, 0x63, 0x74, 0x65, 0x64, 0x3d, 0x21, 0x31, 0x3b,
-    0x23, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x41, 0x63, 0x63, 0x65,
-    0x70, 0x74, 0x65, 0x64, 0x3d, 0x21, 0x31, 0x3b, 0x23, 0x63,
-    0x6c, 0x6f, 0x73, 0x65, 0x52, 0x65, 0x61, 0x73, 0x6f, 0x6e,
-    0x3d, 0x30, 0x3b, 0x23, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x56,
-    0x61, 0x6c, 0x75, 0x65, 0x3b, 0x23, 0x41, 0x6c, 0x6c, 0x45,
-    0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x21, 0x31, 0x3b, 0x23,
-    0x63, 0x61, 0x6c, 0x6c, 0x50, 0x72, 0x6f, 0x6d, 0x69, 0x73,
-    0x65, 0x49, 0x44, 0x3d, 0x6e, 0x65, 0x77, 0x20, 0x55, 0x69,
-    0x6e, 0x74, 0x31, 0x36, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28,
-    0x31, 0x29, 0x3b, 0x23, 0x63, 0x61, 0x6c, 0x6c, 0x50, 0x72,
-    0x6f, 0x6d, 0x69, 0x73, 0x65, 0x52, 0x65, 0x73, 0x6f, 0x6c,
-    0x76, 0x65, 0x3d, 0x5b, 0x5d, 0x3b, 0x23, 0x61, 0x6c, 0x6c,
-    0x6f, 0x77, 0x4e, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x69,
-    0x6f, 0x6e, 0x3d, 0x21, 0x30, 0x3b, 0x23, 0x73, 0x65, 0x6e,
-    0x64, 0x51, 0x75, 0x65, 0x75, 0x65, 0x3d, 0x5b, 0x5d, 0x3b,
-    0x23, 0x69, 0x73, 0x53, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67,
-    0x3d, 0x21, 0x31, 0x3b, 0x23, 0x62, 0x69, 0x6e, 0x64, 0x73,
-    0x4c, 0x69, 0x73, 0x74, 0x3b, 0x23, 0x57, 0x45, 0x42, 0x55,
-    0x49, 0x5f, 0x53, 0x49, 0x47, 0x4e, 0x41, 0x54, 0x55, 0x52,
-    0x45, 0x3d, 0x32, 0x32, 0x31, 0x3b, 0x23, 0x43, 0x4d, 0x44,
-    0x5f, 0x4a, 0x53, 0x3d, 0x32, 0x35, 0x34, 0x3b, 0x23, 0x43,
-    0x4d, 0x44, 0x5f, 0x4a, 0x53, 0x5f, 0x51, 0x55, 0x49, 0x43,
-    0x4b, 0x3d, 0x32, 0x35, 0x33, 0x3b, 0x23, 0x43, 0x4d, 0x44,
-    0x5f, 0x43, 0x4c, 0x49, 0x43, 0x4b, 0x3d, 0x32, 0x35, 0x32,
-    0x3b, 0x23, 0x43, 0x4d, 0x44, 0x5f, 0x4e, 0x41, 0x56, 0x49,
-    0x47, 0x41, 0x54, 0x49, 0x4f, 0x4e, 0x3d, 0x32, 0x35, 0x31,
-    0x3b, 0x23, 0x43, 0x4d, 0x44, 0x5f, 0x43, 0x4c, 0x4f, 0x53,
-    0x45, 0x3d, 0x32, 0x35, 0x30, 0x3b, 0x23, 0x43, 0x4d, 0x44,
-    0x5f, 0x43, 0x41, 0x4c, 0x4c, 0x5f, 0x46, 0x55, 0x4e, 0x43,
-    0x3d, 0x32, 0x34, 0x39, 0x3b, 0x23, 0x43, 0x4d, 0x44, 0x5f,
-    0x53, 0x45, 0x4e, 0x44, 0x5f, 0x52, 0x41, 0x57, 0x3d, 0x32,
-    0x34, 0x38, 0x3b, 0x23, 0x43, 0x4d, 0x44, 0x5f, 0x4e, 0x45,
-    0x57, 0x5f, 0x49, 0x44, 0x3d, 0x32, 0x34, 0x37, 0x3b, 0x23,
-    0x43, 0x4d, 0x44, 0x5f, 0x4d, 0x55, 0x4c, 0x54, 0x49, 0x3d,
-    0x32, 0x34, 0x36, 0x3b, 0x23, 0x43, 0x4d, 0x44, 0x5f, 0x43,
-    0x48, 0x45, 0x43, 0x4b, 0x5f, 0x54, 0x4b, 0x3d, 0x32, 0x34,
-    0x35, 0x3b, 0x23, 0x43, 0x4d, 0x44, 0x5f, 0x57, 0x49, 0x4e,
-    0x44, 0x4f, 0x57, 0x5f, 0x44, 0x52, 0x41, 0x47, 0x3d, 0x32,
-    0x34, 0x34, 0x3b, 0x23, 0x43, 0x4d, 0x44, 0x5f, 0x57, 0x49,
-    0x4e, 0x44, 0x4f, 0x57, 0x5f, 0x52, 0x45, 0x53, 0x49, 0x5a,
-    0x45, 0x44, 0x3d, 0x32, 0x34, 0x33, 0x3b, 0x23, 0x4d, 0x55,
-    0x4c, 0x54, 0x49, 0x5f, 0x43, 0x48, 0x55, 0x4e, 0x4b, 0x5f,
-    0x53, 0x49, 0x5a, 0x45, 0x3d, 0x36, 0x35, 0x35, 0x30, 0x30,
+    0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x58, 0x3d, 0x77, 0x69,
+    0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x73, 0x63, 0x72, 0x65, 0x65,
+    0x6e, 0x58, 0x7c, 0x7c, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77,
+    0x2e, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x4c, 0x65, 0x66,
+    0x74, 0x3b, 0x23, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c,
+    0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x59, 0x3d, 0x77, 0x69,
+    0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x73, 0x63, 0x72, 0x65, 0x65,
+    0x6e, 0x59, 0x7c, 0x7c, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77,
+    0x2e, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x54, 0x6f, 0x70,
+    0x3b, 0x23, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x58, 0x3d, 0x77, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x2e, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e,
+    0x58, 0x7c, 0x7c, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2e,
+    0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x4c, 0x65, 0x66, 0x74,
+    0x3b, 0x23, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x59, 0x3d, 0x77, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x2e, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e,
+    0x59, 0x7c, 0x7c, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2e,
+    0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x54, 0x6f, 0x70, 0x3b,
+    0x23, 0x77, 0x73, 0x3b, 0x23, 0x77, 0x73, 0x53, 0x74, 0x61,
+    0x79, 0x41, 0x6c, 0x69, 0x76, 0x65, 0x3d, 0x21, 0x30, 0x3b,
+    0x23, 0x77, 0x73, 0x53, 0x74, 0x61, 0x79, 0x41, 0x6c, 0x69,
+    0x76, 0x65, 0x54, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x3d,
+    0x35, 0x30, 0x30, 0x3b, 0x23, 0x77, 0x73, 0x57, 0x61, 0x73,
+    0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65, 0x64, 0x3d,
+    0x21, 0x31, 0x3b, 0x23, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x41,
+    0x63, 0x63, 0x65, 0x70, 0x74, 0x65, 0x64, 0x3d, 0x21, 0x31,
+    0x3b, 0x23, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x52, 0x65, 0x61,
+    0x73, 0x6f, 0x6e, 0x3d, 0x30, 0x3b, 0x23, 0x63, 0x6c, 0x6f,
+    0x73, 0x65, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3b, 0x23, 0x41,
+    0x6c, 0x6c, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x21,
+    0x31, 0x3b, 0x23, 0x63, 0x61, 0x6c, 0x6c, 0x50, 0x72, 0x6f,
+    0x6d, 0x69, 0x73, 0x65, 0x49, 0x44, 0x3d, 0x6e, 0x65, 0x77,
+    0x20, 0x55, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x41, 0x72, 0x72,
+    0x61, 0x79, 0x28, 0x31, 0x29, 0x3b, 0x23, 0x63, 0x61, 0x6c,
+    0x6c, 0x50, 0x72, 0x6f, 0x6d, 0x69, 0x73, 0x65, 0x52, 0x65,
+    0x73, 0x6f, 0x6c, 0x76, 0x65, 0x3d, 0x5b, 0x5d, 0x3b, 0x23,
+    0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x4e, 0x61, 0x76, 0x69, 0x67,
+    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x21, 0x30, 0x3b, 0x23,
+    0x73, 0x65, 0x6e, 0x64, 0x51, 0x75, 0x65, 0x75, 0x65, 0x3d,
+    0x5b, 0x5d, 0x3b, 0x23, 0x69, 0x73, 0x53, 0x65, 0x6e, 0x64,
+    0x69, 0x6e, 0x67, 0x3d, 0x21, 0x31, 0x3b, 0x23, 0x62, 0x69,
+    0x6e, 0x64, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x3b, 0x23, 0x57,
+    0x45, 0x42, 0x55, 0x49, 0x5f, 0x53, 0x49, 0x47, 0x4e, 0x41,
+    0x54, 0x55, 0x52, 0x45, 0x3d, 0x32, 0x32, 0x31, 0x3b, 0x23,
+    0x43, 0x4d, 0x44, 0x5f, 0x4a, 0x53, 0x3d, 0x32, 0x35, 0x34,
+    0x3b, 0x23, 0x43, 0x4d, 0x44, 0x5f, 0x4a, 0x53, 0x5f, 0x51,
+    0x55, 0x49, 0x43, 0x4b, 0x3d, 0x32, 0x35, 0x33, 0x3b, 0x23,
+    0x43, 0x4d, 0x44, 0x5f, 0x43, 0x4c, 0x49, 0x43, 0x4b, 0x3d,
+    0x32, 0x35, 0x32, 0x3b, 0x23, 0x43, 0x4d, 0x44, 0x5f, 0x4e,
+    0x41, 0x56, 0x49, 0x47, 0x41, 0x54, 0x49, 0x4f, 0x4e, 0x3d,
+    0x32, 0x35, 0x31, 0x3b, 0x23, 0x43, 0x4d, 0x44, 0x5f, 0x43,
+    0x4c, 0x4f, 0x53, 0x45, 0x3d, 0x32, 0x35, 0x30, 0x3b, 0x23,
+    0x43, 0x4d, 0x44, 0x5f, 0x43, 0x41, 0x4c, 0x4c, 0x5f, 0x46,
+    0x55, 0x4e, 0x43, 0x3d, 0x32, 0x34, 0x39, 0x3b, 0x23, 0x43,
+    0x4d, 0x44, 0x5f, 0x53, 0x45, 0x4e, 0x44, 0x5f, 0x52, 0x41,
+    0x57, 0x3d, 0x32, 0x34, 0x38, 0x3b, 0x23, 0x43, 0x4d, 0x44,
+    0x5f, 0x4e, 0x45, 0x57, 0x5f, 0x49, 0x44, 0x3d, 0x32, 0x34,
+    0x37, 0x3b, 0x23, 0x43, 0x4d, 0x44, 0x5f, 0x4d, 0x55, 0x4c,
+    0x54, 0x49, 0x3d, 0x32, 0x34, 0x36, 0x3b, 0x23, 0x43, 0x4d,
+    0x44, 0x5f, 0x43, 0x48, 0x45, 0x43, 0x4b, 0x5f, 0x54, 0x4b,
+    0x3d, 0x32, 0x34, 0x35, 0x3b, 0x23, 0x43, 0x4d, 0x44, 0x5f,
+    0x57, 0x49, 0x4e, 0x44, 0x4f, 0x57, 0x5f, 0x44, 0x52, 0x41,
+    0x47, 0x3d, 0x32, 0x34, 0x34, 0x3b, 0x23, 0x43, 0x4d, 0x44,
+    0x5f, 0x57, 0x49, 0x4e, 0x44, 0x4f, 0x57, 0x5f, 0x52, 0x45,
+    0x53, 0x49, 0x5a, 0x45, 0x44, 0x3d, 0x32, 0x34, 0x33, 0x3b,
+    0x23, 0x4d, 0x55, 0x4c, 0x54, 0x49, 0x5f, 0x43, 0x48, 0x55,
+    0x4e, 0x4b, 0x5f, 0x53, 0x49, 0x5a, 0x45, 0x3d, 0x36, 0x35,
+    0x35, 0x30, 0x30, 0x3b, 0x23, 0x50, 0x52, 0x4f, 0x54, 0x4f,
+    0x43, 0x4f, 0x4c, 0x5f, 0x53, 0x49, 0x5a, 0x45, 0x3d, 0x38,
     0x3b, 0x23, 0x50, 0x52, 0x4f, 0x54, 0x4f, 0x43, 0x4f, 0x4c,
-    0x5f, 0x53, 0x49, 0x5a, 0x45, 0x3d, 0x38, 0x3b, 0x23, 0x50,
-    0x52, 0x4f, 0x54, 0x4f, 0x43, 0x4f, 0x4c, 0x5f, 0x53, 0x49,
-    0x47, 0x4e, 0x3d, 0x30, 0x3b, 0x23, 0x50, 0x52, 0x4f, 0x54,
-    0x4f, 0x43, 0x4f, 0x4c, 0x5f, 0x54, 0x4f, 0x4b, 0x45, 0x4e,
-    0x3d, 0x31, 0x3b, 0x23, 0x50, 0x52, 0x4f, 0x54, 0x4f, 0x43,
-    0x4f, 0x4c, 0x5f, 0x49, 0x44, 0x3d, 0x35, 0x3b, 0x23, 0x50,
-    0x52, 0x4f, 0x54, 0x4f, 0x43, 0x4f, 0x4c, 0x5f, 0x43, 0x4d,
-    0x44, 0x3d, 0x37, 0x3b, 0x23, 0x50, 0x52, 0x4f, 0x54, 0x4f,
-    0x43, 0x4f, 0x4c, 0x5f, 0x44, 0x41, 0x54, 0x41, 0x3d, 0x38,
-    0x3b, 0x23, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x3d, 0x6e, 0x65,
-    0x77, 0x20, 0x55, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x41, 0x72,
-    0x72, 0x61, 0x79, 0x28, 0x31, 0x29, 0x3b, 0x23, 0x50, 0x69,
-    0x6e, 0x67, 0x3d, 0x21, 0x30, 0x3b, 0x23, 0x65, 0x76, 0x65,
-    0x6e, 0x74, 0x73, 0x43, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63,
-    0x6b, 0x3d, 0x6e, 0x75, 0x6c, 0x6c, 0x3b, 0x65, 0x76, 0x65,
-    0x6e, 0x74, 0x3d, 0x7b, 0x43, 0x4f, 0x4e, 0x4e, 0x45, 0x43,
-    0x54, 0x45, 0x44, 0x3a, 0x30, 0x2c, 0x44, 0x49, 0x53, 0x43,
-    0x4f, 0x4e, 0x4e, 0x45, 0x43, 0x54, 0x45, 0x44, 0x3a, 0x31,
-    0x7d, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x72, 0x75, 0x63,
-    0x74, 0x6f, 0x72, 0x28, 0x7b, 0x73, 0x65, 0x63, 0x75, 0x72,
-    0x65, 0x3d, 0x21, 0x31, 0x2c, 0x74, 0x6f, 0x6b, 0x65, 0x6e,
-    0x3d, 0x30, 0x2c, 0x70, 0x6f, 0x72, 0x74, 0x3d, 0x30, 0x2c,
+    0x5f, 0x53, 0x49, 0x47, 0x4e, 0x3d, 0x30, 0x3b, 0x23, 0x50,
+    0x52, 0x4f, 0x54, 0x4f, 0x43, 0x4f, 0x4c, 0x5f, 0x54, 0x4f,
+    0x4b, 0x45, 0x4e, 0x3d, 0x31, 0x3b, 0x23, 0x50, 0x52, 0x4f,
+    0x54, 0x4f, 0x43, 0x4f, 0x4c, 0x5f, 0x49, 0x44, 0x3d, 0x35,
+    0x3b, 0x23, 0x50, 0x52, 0x4f, 0x54, 0x4f, 0x43, 0x4f, 0x4c,
+    0x5f, 0x43, 0x4d, 0x44, 0x3d, 0x37, 0x3b, 0x23, 0x50, 0x52,
+    0x4f, 0x54, 0x4f, 0x43, 0x4f, 0x4c, 0x5f, 0x44, 0x41, 0x54,
+    0x41, 0x3d, 0x38, 0x3b, 0x23, 0x54, 0x6f, 0x6b, 0x65, 0x6e,
+    0x3d, 0x6e, 0x65, 0x77, 0x20, 0x55, 0x69, 0x6e, 0x74, 0x33,
+    0x32, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x31, 0x29, 0x3b,
+    0x23, 0x50, 0x69, 0x6e, 0x67, 0x3d, 0x21, 0x30, 0x3b, 0x23,
+    0x65, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x43, 0x61, 0x6c, 0x6c,
+    0x62, 0x61, 0x63, 0x6b, 0x3d, 0x6e, 0x75, 0x6c, 0x6c, 0x3b,
+    0x65, 0x76, 0x65, 0x6e, 0x74, 0x3d, 0x7b, 0x43, 0x4f, 0x4e,
+    0x4e, 0x45, 0x43, 0x54, 0x45, 0x44, 0x3a, 0x30, 0x2c, 0x44,
+    0x49, 0x53, 0x43, 0x4f, 0x4e, 0x4e, 0x45, 0x43, 0x54, 0x45,
+    0x44, 0x3a, 0x31, 0x7d, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+    0x72, 0x75, 0x63, 0x74, 0x6f, 0x72, 0x28, 0x7b, 0x73, 0x65,
+    0x63, 0x75, 0x72, 0x65, 0x3d, 0x21, 0x31, 0x2c, 0x74, 0x6f,
+    0x6b, 0x65, 0x6e, 0x3d, 0x30, 0x2c, 0x70, 0x6f, 0x72, 0x74,
+    0x3d, 0x30, 0x2c, 0x70, 0x61, 0x74, 0x68, 0x3d, 0x22, 0x22,
+    0x2c, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x3d, 0x21, 0x31, 0x2c,
     0x6c, 0x6f, 0x67, 0x3d, 0x21, 0x31, 0x2c, 0x77, 0x69, 0x6e,
     0x58, 0x3d, 0x30, 0x2c, 0x77, 0x69, 0x6e, 0x59, 0x3d, 0x30,
     0x2c, 0x77, 0x69, 0x6e, 0x57, 0x3d, 0x30, 0x2c, 0x77, 0x69,
@@ -206,619 +309,664 @@ unsigned char webinix_javascript_bridge[] = {
     0x6e, 0x3d, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x2c, 0x74, 0x68,
     0x69, 0x73, 0x2e, 0x23, 0x70, 0x6f, 0x72, 0x74, 0x3d, 0x70,
     0x6f, 0x72, 0x74, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
-    0x6c, 0x6f, 0x67, 0x3d, 0x6c, 0x6f, 0x67, 0x2c, 0x74, 0x68,
-    0x69, 0x73, 0x2e, 0x23, 0x77, 0x69, 0x6e, 0x58, 0x3d, 0x77,
-    0x69, 0x6e, 0x58, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
-    0x77, 0x69, 0x6e, 0x59, 0x3d, 0x77, 0x69, 0x6e, 0x59, 0x2c,
-    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x69, 0x6e, 0x57,
-    0x3d, 0x77, 0x69, 0x6e, 0x57, 0x2c, 0x74, 0x68, 0x69, 0x73,
-    0x2e, 0x23, 0x77, 0x69, 0x6e, 0x48, 0x3d, 0x77, 0x69, 0x6e,
-    0x48, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x54, 0x6f,
-    0x6b, 0x65, 0x6e, 0x5b, 0x30, 0x5d, 0x3d, 0x74, 0x68, 0x69,
-    0x73, 0x2e, 0x23, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x2c, 0x22,
-    0x77, 0x65, 0x62, 0x75, 0x69, 0x22, 0x69, 0x6e, 0x20, 0x67,
-    0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x54, 0x68, 0x69, 0x73, 0x29,
-    0x74, 0x68, 0x72, 0x6f, 0x77, 0x20, 0x6e, 0x65, 0x77, 0x20,
-    0x45, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x22, 0x53, 0x6f, 0x72,
-    0x72, 0x79, 0x2e, 0x20, 0x57, 0x65, 0x62, 0x55, 0x49, 0x20,
-    0x69, 0x73, 0x20, 0x61, 0x6c, 0x72, 0x65, 0x61, 0x64, 0x79,
-    0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x2c, 0x20,
-    0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x69,
-    0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x69, 0x73,
-    0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x2e, 0x22,
-    0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x69,
-    0x6e, 0x58, 0x21, 0x3d, 0x3d, 0x76, 0x6f, 0x69, 0x64, 0x20,
-    0x30, 0x26, 0x26, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77,
+    0x70, 0x61, 0x74, 0x68, 0x3d, 0x70, 0x61, 0x74, 0x68, 0x2c,
+    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f, 0x63, 0x61,
+    0x6c, 0x3d, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x2c, 0x74, 0x68,
+    0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f, 0x67, 0x3d, 0x6c, 0x6f,
+    0x67, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x69,
+    0x6e, 0x58, 0x3d, 0x77, 0x69, 0x6e, 0x58, 0x2c, 0x74, 0x68,
+    0x69, 0x73, 0x2e, 0x23, 0x77, 0x69, 0x6e, 0x59, 0x3d, 0x77,
     0x69, 0x6e, 0x59, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
-    0x77, 0x69, 0x6e, 0x57, 0x21, 0x3d, 0x3d, 0x76, 0x6f, 0x69,
-    0x64, 0x20, 0x30, 0x26, 0x26, 0x74, 0x68, 0x69, 0x73, 0x2e,
-    0x23, 0x77, 0x69, 0x6e, 0x48, 0x2c, 0x22, 0x57, 0x65, 0x62,
-    0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x22, 0x69, 0x6e, 0x20,
-    0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x7c, 0x7c, 0x28, 0x61,
-    0x6c, 0x65, 0x72, 0x74, 0x28, 0x22, 0x53, 0x6f, 0x72, 0x72,
-    0x79, 0x2e, 0x20, 0x57, 0x65, 0x62, 0x53, 0x6f, 0x63, 0x6b,
-    0x65, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20,
-    0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x65, 0x64, 0x20,
-    0x62, 0x79, 0x20, 0x79, 0x6f, 0x75, 0x72, 0x20, 0x77, 0x65,
-    0x62, 0x20, 0x62, 0x72, 0x6f, 0x77, 0x73, 0x65, 0x72, 0x2e,
-    0x22, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x6c,
-    0x6f, 0x67, 0x7c, 0x7c, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
-    0x54, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x6c, 0x6f, 0x73, 0x65,
-    0x28, 0x29, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
-    0x73, 0x74, 0x61, 0x72, 0x74, 0x28, 0x29, 0x2c, 0x22, 0x6e,
-    0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22,
+    0x77, 0x69, 0x6e, 0x57, 0x3d, 0x77, 0x69, 0x6e, 0x57, 0x2c,
+    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x69, 0x6e, 0x48,
+    0x3d, 0x77, 0x69, 0x6e, 0x48, 0x2c, 0x74, 0x68, 0x69, 0x73,
+    0x2e, 0x23, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x5b, 0x30, 0x5d,
+    0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x74, 0x6f, 0x6b,
+    0x65, 0x6e, 0x2c, 0x22, 0x77, 0x65, 0x62, 0x75, 0x69, 0x22,
     0x69, 0x6e, 0x20, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x54,
-    0x68, 0x69, 0x73, 0x3f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
-    0x54, 0x68, 0x69, 0x73, 0x2e, 0x6e, 0x61, 0x76, 0x69, 0x67,
-    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x61, 0x64, 0x64, 0x45,
-    0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e,
-    0x65, 0x72, 0x28, 0x22, 0x6e, 0x61, 0x76, 0x69, 0x67, 0x61,
-    0x74, 0x65, 0x22, 0x2c, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x3d,
-    0x3e, 0x7b, 0x69, 0x66, 0x28, 0x21, 0x74, 0x68, 0x69, 0x73,
-    0x2e, 0x23, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x4e, 0x61, 0x76,
-    0x69, 0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x26, 0x26, 0x74,
-    0x68, 0x69, 0x73, 0x2e, 0x23, 0x41, 0x6c, 0x6c, 0x45, 0x76,
-    0x65, 0x6e, 0x74, 0x73, 0x26, 0x26, 0x74, 0x68, 0x69, 0x73,
-    0x2e, 0x23, 0x77, 0x73, 0x49, 0x73, 0x43, 0x6f, 0x6e, 0x6e,
-    0x65, 0x63, 0x74, 0x65, 0x64, 0x28, 0x29, 0x29, 0x7b, 0x65,
-    0x76, 0x65, 0x6e, 0x74, 0x2e, 0x70, 0x72, 0x65, 0x76, 0x65,
-    0x6e, 0x74, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x28,
-    0x29, 0x3b, 0x6c, 0x65, 0x74, 0x20, 0x75, 0x72, 0x6c, 0x3d,
-    0x6e, 0x65, 0x77, 0x20, 0x55, 0x52, 0x4c, 0x28, 0x65, 0x76,
-    0x65, 0x6e, 0x74, 0x2e, 0x64, 0x65, 0x73, 0x74, 0x69, 0x6e,
-    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x75, 0x72, 0x6c, 0x29,
-    0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f, 0x67,
-    0x26, 0x26, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e,
-    0x6c, 0x6f, 0x67, 0x28, 0x60, 0x57, 0x65, 0x62, 0x55, 0x49,
-    0x20, 0x2d, 0x3e, 0x20, 0x44, 0x4f, 0x4d, 0x20, 0x2d, 0x3e,
-    0x20, 0x4e, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6f,
-    0x6e, 0x20, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x20, 0x5b, 0x24,
-    0x7b, 0x75, 0x72, 0x6c, 0x2e, 0x68, 0x72, 0x65, 0x66, 0x7d,
-    0x5d, 0x60, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
-    0x73, 0x65, 0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4e,
-    0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x28,
-    0x75, 0x72, 0x6c, 0x2e, 0x68, 0x72, 0x65, 0x66, 0x29, 0x7d,
-    0x7d, 0x29, 0x3a, 0x61, 0x64, 0x64, 0x52, 0x65, 0x66, 0x72,
-    0x65, 0x73, 0x68, 0x61, 0x62, 0x6c, 0x65, 0x45, 0x76, 0x65,
-    0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72,
-    0x28, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e,
-    0x62, 0x6f, 0x64, 0x79, 0x2c, 0x22, 0x61, 0x22, 0x2c, 0x22,
-    0x63, 0x6c, 0x69, 0x63, 0x6b, 0x22, 0x2c, 0x65, 0x76, 0x65,
-    0x6e, 0x74, 0x3d, 0x3e, 0x7b, 0x69, 0x66, 0x28, 0x21, 0x74,
-    0x68, 0x69, 0x73, 0x2e, 0x23, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-    0x4e, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-    0x26, 0x26, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x41, 0x6c,
-    0x6c, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x26, 0x26, 0x74,
-    0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x49, 0x73, 0x43,
-    0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65, 0x64, 0x28, 0x29,
-    0x29, 0x7b, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x2e, 0x70, 0x72,
-    0x65, 0x76, 0x65, 0x6e, 0x74, 0x44, 0x65, 0x66, 0x61, 0x75,
-    0x6c, 0x74, 0x28, 0x29, 0x3b, 0x6c, 0x65, 0x74, 0x7b, 0x68,
-    0x72, 0x65, 0x66, 0x7d, 0x3d, 0x65, 0x76, 0x65, 0x6e, 0x74,
-    0x2e, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3b, 0x74, 0x68,
-    0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f, 0x67, 0x26, 0x26, 0x63,
-    0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67,
-    0x28, 0x60, 0x57, 0x65, 0x62, 0x55, 0x49, 0x20, 0x2d, 0x3e,
-    0x20, 0x44, 0x4f, 0x4d, 0x20, 0x2d, 0x3e, 0x20, 0x4e, 0x61,
-    0x76, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x43,
-    0x6c, 0x69, 0x63, 0x6b, 0x20, 0x45, 0x76, 0x65, 0x6e, 0x74,
-    0x20, 0x5b, 0x24, 0x7b, 0x68, 0x72, 0x65, 0x66, 0x7d, 0x5d,
-    0x60, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x73,
-    0x65, 0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4e, 0x61,
-    0x76, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x68,
-    0x72, 0x65, 0x66, 0x29, 0x7d, 0x7d, 0x29, 0x2c, 0x64, 0x6f,
-    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x64, 0x64,
-    0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65,
-    0x6e, 0x65, 0x72, 0x28, 0x22, 0x6b, 0x65, 0x79, 0x64, 0x6f,
-    0x77, 0x6e, 0x22, 0x2c, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x3d,
-    0x3e, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f,
-    0x67, 0x7c, 0x7c, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x2e, 0x6b,
-    0x65, 0x79, 0x3d, 0x3d, 0x3d, 0x22, 0x46, 0x35, 0x22, 0x26,
-    0x26, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x2e, 0x70, 0x72, 0x65,
-    0x76, 0x65, 0x6e, 0x74, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c,
-    0x74, 0x28, 0x29, 0x7d, 0x29, 0x2c, 0x64, 0x6f, 0x63, 0x75,
-    0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76,
-    0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65,
-    0x72, 0x28, 0x22, 0x6d, 0x6f, 0x75, 0x73, 0x65, 0x6d, 0x6f,
-    0x76, 0x65, 0x22, 0x2c, 0x65, 0x3d, 0x3e, 0x7b, 0x69, 0x66,
-    0x28, 0x65, 0x2e, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x73,
-    0x21, 0x3d, 0x3d, 0x31, 0x29, 0x7b, 0x74, 0x68, 0x69, 0x73,
-    0x2e, 0x23, 0x69, 0x73, 0x44, 0x72, 0x61, 0x67, 0x67, 0x69,
-    0x6e, 0x67, 0x3d, 0x21, 0x31, 0x3b, 0x72, 0x65, 0x74, 0x75,
-    0x72, 0x6e, 0x7d, 0x69, 0x66, 0x28, 0x21, 0x74, 0x68, 0x69,
-    0x73, 0x2e, 0x23, 0x69, 0x73, 0x44, 0x72, 0x61, 0x67, 0x67,
-    0x69, 0x6e, 0x67, 0x29, 0x7b, 0x6c, 0x65, 0x74, 0x20, 0x74,
-    0x61, 0x72, 0x67, 0x65, 0x74, 0x3d, 0x65, 0x2e, 0x74, 0x61,
-    0x72, 0x67, 0x65, 0x74, 0x3b, 0x66, 0x6f, 0x72, 0x28, 0x3b,
-    0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3b, 0x29, 0x7b, 0x6c,
-    0x65, 0x74, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65,
-    0x64, 0x53, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x77, 0x69, 0x6e,
-    0x64, 0x6f, 0x77, 0x2e, 0x67, 0x65, 0x74, 0x43, 0x6f, 0x6d,
+    0x68, 0x69, 0x73, 0x29, 0x74, 0x68, 0x72, 0x6f, 0x77, 0x20,
+    0x6e, 0x65, 0x77, 0x20, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x28,
+    0x22, 0x53, 0x6f, 0x72, 0x72, 0x79, 0x2e, 0x20, 0x57, 0x65,
+    0x62, 0x55, 0x49, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6c, 0x72,
+    0x65, 0x61, 0x64, 0x79, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e,
+    0x65, 0x64, 0x2c, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x6f,
+    0x6e, 0x65, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63,
+    0x65, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
+    0x65, 0x64, 0x2e, 0x22, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73,
+    0x2e, 0x23, 0x77, 0x69, 0x6e, 0x58, 0x21, 0x3d, 0x3d, 0x76,
+    0x6f, 0x69, 0x64, 0x20, 0x30, 0x26, 0x26, 0x74, 0x68, 0x69,
+    0x73, 0x2e, 0x23, 0x77, 0x69, 0x6e, 0x59, 0x2c, 0x74, 0x68,
+    0x69, 0x73, 0x2e, 0x23, 0x77, 0x69, 0x6e, 0x57, 0x21, 0x3d,
+    0x3d, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x30, 0x26, 0x26, 0x74,
+    0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x69, 0x6e, 0x48, 0x2c,
+    0x22, 0x57, 0x65, 0x62, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74,
+    0x22, 0x69, 0x6e, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77,
+    0x7c, 0x7c, 0x28, 0x61, 0x6c, 0x65, 0x72, 0x74, 0x28, 0x22,
+    0x53, 0x6f, 0x72, 0x72, 0x79, 0x2e, 0x20, 0x57, 0x65, 0x62,
+    0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x69, 0x73, 0x20,
+    0x6e, 0x6f, 0x74, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72,
+    0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x79, 0x6f, 0x75,
+    0x72, 0x20, 0x77, 0x65, 0x62, 0x20, 0x62, 0x72, 0x6f, 0x77,
+    0x73, 0x65, 0x72, 0x2e, 0x22, 0x29, 0x2c, 0x74, 0x68, 0x69,
+    0x73, 0x2e, 0x23, 0x6c, 0x6f, 0x67, 0x7c, 0x7c, 0x67, 0x6c,
+    0x6f, 0x62, 0x61, 0x6c, 0x54, 0x68, 0x69, 0x73, 0x2e, 0x63,
+    0x6c, 0x6f, 0x73, 0x65, 0x28, 0x29, 0x29, 0x2c, 0x74, 0x68,
+    0x69, 0x73, 0x2e, 0x23, 0x73, 0x74, 0x61, 0x72, 0x74, 0x28,
+    0x29, 0x2c, 0x22, 0x6e, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74,
+    0x69, 0x6f, 0x6e, 0x22, 0x69, 0x6e, 0x20, 0x67, 0x6c, 0x6f,
+    0x62, 0x61, 0x6c, 0x54, 0x68, 0x69, 0x73, 0x3f, 0x67, 0x6c,
+    0x6f, 0x62, 0x61, 0x6c, 0x54, 0x68, 0x69, 0x73, 0x2e, 0x6e,
+    0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e,
+    0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69,
+    0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x6e, 0x61,
+    0x76, 0x69, 0x67, 0x61, 0x74, 0x65, 0x22, 0x2c, 0x65, 0x76,
+    0x65, 0x6e, 0x74, 0x3d, 0x3e, 0x7b, 0x69, 0x66, 0x28, 0x21,
+    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x61, 0x6c, 0x6c, 0x6f,
+    0x77, 0x4e, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6f,
+    0x6e, 0x26, 0x26, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x41,
+    0x6c, 0x6c, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x26, 0x26,
+    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x49, 0x73,
+    0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65, 0x64, 0x28,
+    0x29, 0x29, 0x7b, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x2e, 0x70,
+    0x72, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x44, 0x65, 0x66, 0x61,
+    0x75, 0x6c, 0x74, 0x28, 0x29, 0x3b, 0x6c, 0x65, 0x74, 0x20,
+    0x75, 0x72, 0x6c, 0x3d, 0x6e, 0x65, 0x77, 0x20, 0x55, 0x52,
+    0x4c, 0x28, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x2e, 0x64, 0x65,
+    0x73, 0x74, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e,
+    0x75, 0x72, 0x6c, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x23, 0x6c, 0x6f, 0x67, 0x26, 0x26, 0x63, 0x6f, 0x6e, 0x73,
+    0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x60, 0x57,
+    0x65, 0x62, 0x55, 0x49, 0x20, 0x2d, 0x3e, 0x20, 0x44, 0x4f,
+    0x4d, 0x20, 0x2d, 0x3e, 0x20, 0x4e, 0x61, 0x76, 0x69, 0x67,
+    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x45, 0x76, 0x65, 0x6e,
+    0x74, 0x20, 0x5b, 0x24, 0x7b, 0x75, 0x72, 0x6c, 0x2e, 0x68,
+    0x72, 0x65, 0x66, 0x7d, 0x5d, 0x60, 0x29, 0x2c, 0x74, 0x68,
+    0x69, 0x73, 0x2e, 0x23, 0x73, 0x65, 0x6e, 0x64, 0x45, 0x76,
+    0x65, 0x6e, 0x74, 0x4e, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74,
+    0x69, 0x6f, 0x6e, 0x28, 0x75, 0x72, 0x6c, 0x2e, 0x68, 0x72,
+    0x65, 0x66, 0x29, 0x7d, 0x7d, 0x29, 0x3a, 0x61, 0x64, 0x64,
+    0x52, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x61, 0x62, 0x6c,
+    0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74,
+    0x65, 0x6e, 0x65, 0x72, 0x28, 0x64, 0x6f, 0x63, 0x75, 0x6d,
+    0x65, 0x6e, 0x74, 0x2e, 0x62, 0x6f, 0x64, 0x79, 0x2c, 0x22,
+    0x61, 0x22, 0x2c, 0x22, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x22,
+    0x2c, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x3d, 0x3e, 0x7b, 0x69,
+    0x66, 0x28, 0x21, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x61,
+    0x6c, 0x6c, 0x6f, 0x77, 0x4e, 0x61, 0x76, 0x69, 0x67, 0x61,
+    0x74, 0x69, 0x6f, 0x6e, 0x26, 0x26, 0x74, 0x68, 0x69, 0x73,
+    0x2e, 0x23, 0x41, 0x6c, 0x6c, 0x45, 0x76, 0x65, 0x6e, 0x74,
+    0x73, 0x26, 0x26, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77,
+    0x73, 0x49, 0x73, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74,
+    0x65, 0x64, 0x28, 0x29, 0x29, 0x7b, 0x65, 0x76, 0x65, 0x6e,
+    0x74, 0x2e, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x44,
+    0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x28, 0x29, 0x3b, 0x6c,
+    0x65, 0x74, 0x7b, 0x68, 0x72, 0x65, 0x66, 0x7d, 0x3d, 0x65,
+    0x76, 0x65, 0x6e, 0x74, 0x2e, 0x74, 0x61, 0x72, 0x67, 0x65,
+    0x74, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f,
+    0x67, 0x26, 0x26, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65,
+    0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x60, 0x57, 0x65, 0x62, 0x55,
+    0x49, 0x20, 0x2d, 0x3e, 0x20, 0x44, 0x4f, 0x4d, 0x20, 0x2d,
+    0x3e, 0x20, 0x4e, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x69,
+    0x6f, 0x6e, 0x20, 0x43, 0x6c, 0x69, 0x63, 0x6b, 0x20, 0x45,
+    0x76, 0x65, 0x6e, 0x74, 0x20, 0x5b, 0x24, 0x7b, 0x68, 0x72,
+    0x65, 0x66, 0x7d, 0x5d, 0x60, 0x29, 0x2c, 0x74, 0x68, 0x69,
+    0x73, 0x2e, 0x23, 0x73, 0x65, 0x6e, 0x64, 0x45, 0x76, 0x65,
+    0x6e, 0x74, 0x4e, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x69,
+    0x6f, 0x6e, 0x28, 0x68, 0x72, 0x65, 0x66, 0x29, 0x7d, 0x7d,
+    0x29, 0x2c, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c,
+    0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x6b,
+    0x65, 0x79, 0x64, 0x6f, 0x77, 0x6e, 0x22, 0x2c, 0x65, 0x76,
+    0x65, 0x6e, 0x74, 0x3d, 0x3e, 0x7b, 0x74, 0x68, 0x69, 0x73,
+    0x2e, 0x23, 0x6c, 0x6f, 0x67, 0x7c, 0x7c, 0x65, 0x76, 0x65,
+    0x6e, 0x74, 0x2e, 0x6b, 0x65, 0x79, 0x3d, 0x3d, 0x3d, 0x22,
+    0x46, 0x35, 0x22, 0x26, 0x26, 0x65, 0x76, 0x65, 0x6e, 0x74,
+    0x2e, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x44, 0x65,
+    0x66, 0x61, 0x75, 0x6c, 0x74, 0x28, 0x29, 0x7d, 0x29, 0x2c,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61,
+    0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73,
+    0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x6d, 0x6f, 0x75,
+    0x73, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x22, 0x2c, 0x65, 0x3d,
+    0x3e, 0x7b, 0x69, 0x66, 0x28, 0x65, 0x2e, 0x62, 0x75, 0x74,
+    0x74, 0x6f, 0x6e, 0x73, 0x21, 0x3d, 0x3d, 0x31, 0x29, 0x7b,
+    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x69, 0x73, 0x44, 0x72,
+    0x61, 0x67, 0x67, 0x69, 0x6e, 0x67, 0x3d, 0x21, 0x31, 0x3b,
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x7d, 0x69, 0x66, 0x28,
+    0x21, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x69, 0x73, 0x44,
+    0x72, 0x61, 0x67, 0x67, 0x69, 0x6e, 0x67, 0x29, 0x7b, 0x6c,
+    0x65, 0x74, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3d,
+    0x65, 0x2e, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3b, 0x66,
+    0x6f, 0x72, 0x28, 0x3b, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74,
+    0x3b, 0x29, 0x7b, 0x6c, 0x65, 0x74, 0x20, 0x63, 0x6f, 0x6d,
     0x70, 0x75, 0x74, 0x65, 0x64, 0x53, 0x74, 0x79, 0x6c, 0x65,
-    0x28, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x29, 0x2c, 0x77,
-    0x65, 0x62, 0x6b, 0x69, 0x74, 0x43, 0x6f, 0x6d, 0x70, 0x75,
-    0x74, 0x65, 0x64, 0x3d, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74,
-    0x65, 0x64, 0x53, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x67, 0x65,
-    0x74, 0x50, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x56,
-    0x61, 0x6c, 0x75, 0x65, 0x28, 0x22, 0x2d, 0x77, 0x65, 0x62,
-    0x6b, 0x69, 0x74, 0x2d, 0x61, 0x70, 0x70, 0x2d, 0x72, 0x65,
-    0x67, 0x69, 0x6f, 0x6e, 0x22, 0x29, 0x2e, 0x74, 0x72, 0x69,
-    0x6d, 0x28, 0x29, 0x2c, 0x77, 0x65, 0x62, 0x75, 0x69, 0x43,
+    0x3d, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x67, 0x65,
+    0x74, 0x43, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x64, 0x53,
+    0x74, 0x79, 0x6c, 0x65, 0x28, 0x74, 0x61, 0x72, 0x67, 0x65,
+    0x74, 0x29, 0x2c, 0x77, 0x65, 0x62, 0x6b, 0x69, 0x74, 0x43,
     0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x64, 0x3d, 0x63, 0x6f,
     0x6d, 0x70, 0x75, 0x74, 0x65, 0x64, 0x53, 0x74, 0x79, 0x6c,
     0x65, 0x2e, 0x67, 0x65, 0x74, 0x50, 0x72, 0x6f, 0x70, 0x65,
     0x72, 0x74, 0x79, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x28, 0x22,
-    0x2d, 0x2d, 0x77, 0x65, 0x62, 0x75, 0x69, 0x2d, 0x61, 0x70,
+    0x2d, 0x77, 0x65, 0x62, 0x6b, 0x69, 0x74, 0x2d, 0x61, 0x70,
     0x70, 0x2d, 0x72, 0x65, 0x67, 0x69, 0x6f, 0x6e, 0x22, 0x29,
-    0x2e, 0x74, 0x72, 0x69, 0x6d, 0x28, 0x29, 0x3b, 0x69, 0x66,
-    0x28, 0x77, 0x65, 0x62, 0x6b, 0x69, 0x74, 0x43, 0x6f, 0x6d,
-    0x70, 0x75, 0x74, 0x65, 0x64, 0x3d, 0x3d, 0x3d, 0x22, 0x64,
-    0x72, 0x61, 0x67, 0x22, 0x7c, 0x7c, 0x77, 0x65, 0x62, 0x75,
-    0x69, 0x43, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x64, 0x3d,
-    0x3d, 0x3d, 0x22, 0x64, 0x72, 0x61, 0x67, 0x22, 0x29, 0x7b,
-    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x69, 0x6e, 0x69, 0x74,
-    0x69, 0x61, 0x6c, 0x4d, 0x6f, 0x75, 0x73, 0x65, 0x58, 0x3d,
-    0x65, 0x2e, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x58, 0x2c,
-    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x69, 0x6e, 0x69, 0x74,
-    0x69, 0x61, 0x6c, 0x4d, 0x6f, 0x75, 0x73, 0x65, 0x59, 0x3d,
-    0x65, 0x2e, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x59, 0x2c,
+    0x2e, 0x74, 0x72, 0x69, 0x6d, 0x28, 0x29, 0x2c, 0x77, 0x65,
+    0x62, 0x75, 0x69, 0x43, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65,
+    0x64, 0x3d, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x64,
+    0x53, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x67, 0x65, 0x74, 0x50,
+    0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x56, 0x61, 0x6c,
+    0x75, 0x65, 0x28, 0x22, 0x2d, 0x2d, 0x77, 0x65, 0x62, 0x75,
+    0x69, 0x2d, 0x61, 0x70, 0x70, 0x2d, 0x72, 0x65, 0x67, 0x69,
+    0x6f, 0x6e, 0x22, 0x29, 0x2e, 0x74, 0x72, 0x69, 0x6d, 0x28,
+    0x29, 0x3b, 0x69, 0x66, 0x28, 0x77, 0x65, 0x62, 0x6b, 0x69,
+    0x74, 0x43, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x64, 0x3d,
+    0x3d, 0x3d, 0x22, 0x64, 0x72, 0x61, 0x67, 0x22, 0x7c, 0x7c,
+    0x77, 0x65, 0x62, 0x75, 0x69, 0x43, 0x6f, 0x6d, 0x70, 0x75,
+    0x74, 0x65, 0x64, 0x3d, 0x3d, 0x3d, 0x22, 0x64, 0x72, 0x61,
+    0x67, 0x22, 0x29, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
+    0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x4d, 0x6f, 0x75,
+    0x73, 0x65, 0x58, 0x3d, 0x65, 0x2e, 0x73, 0x63, 0x72, 0x65,
+    0x65, 0x6e, 0x58, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
+    0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x4d, 0x6f, 0x75,
+    0x73, 0x65, 0x59, 0x3d, 0x65, 0x2e, 0x73, 0x63, 0x72, 0x65,
+    0x65, 0x6e, 0x59, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
+    0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x58, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x23, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x57, 0x69,
+    0x6e, 0x64, 0x6f, 0x77, 0x58, 0x2c, 0x74, 0x68, 0x69, 0x73,
+    0x2e, 0x23, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x59, 0x3d, 0x74, 0x68, 0x69,
+    0x73, 0x2e, 0x23, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74,
+    0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x59, 0x2c, 0x74, 0x68,
+    0x69, 0x73, 0x2e, 0x23, 0x69, 0x73, 0x44, 0x72, 0x61, 0x67,
+    0x67, 0x69, 0x6e, 0x67, 0x3d, 0x21, 0x30, 0x3b, 0x62, 0x72,
+    0x65, 0x61, 0x6b, 0x7d, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74,
+    0x3d, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x2e, 0x70, 0x61,
+    0x72, 0x65, 0x6e, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+    0x74, 0x7d, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x7d, 0x6c,
+    0x65, 0x74, 0x20, 0x64, 0x65, 0x6c, 0x74, 0x61, 0x58, 0x3d,
+    0x65, 0x2e, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x58, 0x2d,
     0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x69, 0x6e, 0x69, 0x74,
-    0x69, 0x61, 0x6c, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x58,
-    0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x63, 0x75, 0x72,
-    0x72, 0x65, 0x6e, 0x74, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77,
-    0x58, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x69, 0x6e,
+    0x69, 0x61, 0x6c, 0x4d, 0x6f, 0x75, 0x73, 0x65, 0x58, 0x2c,
+    0x64, 0x65, 0x6c, 0x74, 0x61, 0x59, 0x3d, 0x65, 0x2e, 0x73,
+    0x63, 0x72, 0x65, 0x65, 0x6e, 0x59, 0x2d, 0x74, 0x68, 0x69,
+    0x73, 0x2e, 0x23, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c,
+    0x4d, 0x6f, 0x75, 0x73, 0x65, 0x59, 0x2c, 0x6e, 0x65, 0x77,
+    0x58, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x69, 0x6e,
     0x69, 0x74, 0x69, 0x61, 0x6c, 0x57, 0x69, 0x6e, 0x64, 0x6f,
-    0x77, 0x59, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x63,
+    0x77, 0x58, 0x2b, 0x64, 0x65, 0x6c, 0x74, 0x61, 0x58, 0x2c,
+    0x6e, 0x65, 0x77, 0x59, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x23, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x57, 0x69,
+    0x6e, 0x64, 0x6f, 0x77, 0x59, 0x2b, 0x64, 0x65, 0x6c, 0x74,
+    0x61, 0x59, 0x3b, 0x6e, 0x65, 0x77, 0x58, 0x3c, 0x30, 0x26,
+    0x26, 0x28, 0x6e, 0x65, 0x77, 0x58, 0x3d, 0x30, 0x29, 0x2c,
+    0x6e, 0x65, 0x77, 0x59, 0x3c, 0x30, 0x26, 0x26, 0x28, 0x6e,
+    0x65, 0x77, 0x59, 0x3d, 0x30, 0x29, 0x2c, 0x74, 0x68, 0x69,
+    0x73, 0x2e, 0x23, 0x73, 0x65, 0x6e, 0x64, 0x44, 0x72, 0x61,
+    0x67, 0x28, 0x6e, 0x65, 0x77, 0x58, 0x2c, 0x6e, 0x65, 0x77,
+    0x59, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x63,
     0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x57, 0x69, 0x6e, 0x64,
-    0x6f, 0x77, 0x59, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
-    0x69, 0x73, 0x44, 0x72, 0x61, 0x67, 0x67, 0x69, 0x6e, 0x67,
-    0x3d, 0x21, 0x30, 0x3b, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x7d,
-    0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3d, 0x74, 0x61, 0x72,
-    0x67, 0x65, 0x74, 0x2e, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74,
-    0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x7d, 0x72, 0x65,
-    0x74, 0x75, 0x72, 0x6e, 0x7d, 0x6c, 0x65, 0x74, 0x20, 0x64,
-    0x65, 0x6c, 0x74, 0x61, 0x58, 0x3d, 0x65, 0x2e, 0x73, 0x63,
-    0x72, 0x65, 0x65, 0x6e, 0x58, 0x2d, 0x74, 0x68, 0x69, 0x73,
-    0x2e, 0x23, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x4d,
-    0x6f, 0x75, 0x73, 0x65, 0x58, 0x2c, 0x64, 0x65, 0x6c, 0x74,
-    0x61, 0x59, 0x3d, 0x65, 0x2e, 0x73, 0x63, 0x72, 0x65, 0x65,
-    0x6e, 0x59, 0x2d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x69,
-    0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x4d, 0x6f, 0x75, 0x73,
-    0x65, 0x59, 0x2c, 0x6e, 0x65, 0x77, 0x58, 0x3d, 0x74, 0x68,
-    0x69, 0x73, 0x2e, 0x23, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61,
-    0x6c, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x58, 0x2b, 0x64,
-    0x65, 0x6c, 0x74, 0x61, 0x58, 0x2c, 0x6e, 0x65, 0x77, 0x59,
-    0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x69, 0x6e, 0x69,
-    0x74, 0x69, 0x61, 0x6c, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77,
-    0x59, 0x2b, 0x64, 0x65, 0x6c, 0x74, 0x61, 0x59, 0x3b, 0x6e,
-    0x65, 0x77, 0x58, 0x3c, 0x30, 0x26, 0x26, 0x28, 0x6e, 0x65,
-    0x77, 0x58, 0x3d, 0x30, 0x29, 0x2c, 0x6e, 0x65, 0x77, 0x59,
-    0x3c, 0x30, 0x26, 0x26, 0x28, 0x6e, 0x65, 0x77, 0x59, 0x3d,
-    0x30, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x73,
-    0x65, 0x6e, 0x64, 0x44, 0x72, 0x61, 0x67, 0x28, 0x6e, 0x65,
-    0x77, 0x58, 0x2c, 0x6e, 0x65, 0x77, 0x59, 0x29, 0x2c, 0x74,
+    0x6f, 0x77, 0x58, 0x3d, 0x6e, 0x65, 0x77, 0x58, 0x2c, 0x74,
     0x68, 0x69, 0x73, 0x2e, 0x23, 0x63, 0x75, 0x72, 0x72, 0x65,
-    0x6e, 0x74, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x58, 0x3d,
-    0x6e, 0x65, 0x77, 0x58, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e,
-    0x23, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x57, 0x69,
-    0x6e, 0x64, 0x6f, 0x77, 0x59, 0x3d, 0x6e, 0x65, 0x77, 0x59,
-    0x7d, 0x29, 0x2c, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e,
-    0x74, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74,
-    0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22,
-    0x6d, 0x6f, 0x75, 0x73, 0x65, 0x75, 0x70, 0x22, 0x2c, 0x28,
-    0x29, 0x3d, 0x3e, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
-    0x69, 0x73, 0x44, 0x72, 0x61, 0x67, 0x67, 0x69, 0x6e, 0x67,
-    0x3d, 0x21, 0x31, 0x7d, 0x29, 0x2c, 0x6f, 0x6e, 0x62, 0x65,
-    0x66, 0x6f, 0x72, 0x65, 0x75, 0x6e, 0x6c, 0x6f, 0x61, 0x64,
-    0x3d, 0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x74, 0x68, 0x69, 0x73,
-    0x2e, 0x23, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x28, 0x29, 0x7d,
-    0x2c, 0x73, 0x65, 0x74, 0x54, 0x69, 0x6d, 0x65, 0x6f, 0x75,
-    0x74, 0x28, 0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x74, 0x68, 0x69,
-    0x73, 0x2e, 0x23, 0x77, 0x73, 0x57, 0x61, 0x73, 0x43, 0x6f,
-    0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65, 0x64, 0x7c, 0x7c, 0x61,
-    0x6c, 0x65, 0x72, 0x74, 0x28, 0x22, 0x53, 0x6f, 0x72, 0x72,
-    0x79, 0x2e, 0x20, 0x57, 0x65, 0x62, 0x55, 0x49, 0x20, 0x66,
-    0x61, 0x69, 0x6c, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x63,
-    0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x20, 0x74, 0x6f, 0x20,
-    0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x65, 0x6e,
-    0x64, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74,
-    0x69, 0x6f, 0x6e, 0x2e, 0x20, 0x50, 0x6c, 0x65, 0x61, 0x73,
-    0x65, 0x20, 0x74, 0x72, 0x79, 0x20, 0x61, 0x67, 0x61, 0x69,
-    0x6e, 0x2e, 0x22, 0x29, 0x7d, 0x2c, 0x31, 0x35, 0x30, 0x30,
-    0x29, 0x7d, 0x23, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x28, 0x72,
-    0x65, 0x61, 0x73, 0x6f, 0x6e, 0x3d, 0x30, 0x2c, 0x76, 0x61,
-    0x6c, 0x75, 0x65, 0x3d, 0x22, 0x22, 0x29, 0x7b, 0x74, 0x68,
-    0x69, 0x73, 0x2e, 0x23, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x52,
-    0x65, 0x61, 0x73, 0x6f, 0x6e, 0x3d, 0x72, 0x65, 0x61, 0x73,
-    0x6f, 0x6e, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x63,
-    0x6c, 0x6f, 0x73, 0x65, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3d,
-    0x76, 0x61, 0x6c, 0x75, 0x65, 0x2c, 0x74, 0x68, 0x69, 0x73,
-    0x2e, 0x23, 0x77, 0x73, 0x49, 0x73, 0x43, 0x6f, 0x6e, 0x6e,
-    0x65, 0x63, 0x74, 0x65, 0x64, 0x28, 0x29, 0x26, 0x26, 0x74,
-    0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x2e, 0x63, 0x6c,
-    0x6f, 0x73, 0x65, 0x28, 0x29, 0x7d, 0x23, 0x66, 0x72, 0x65,
-    0x65, 0x7a, 0x65, 0x55, 0x69, 0x28, 0x29, 0x7b, 0x73, 0x65,
-    0x74, 0x54, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x28, 0x28,
-    0x29, 0x3d, 0x3e, 0x7b, 0x69, 0x66, 0x28, 0x21, 0x74, 0x68,
-    0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x49, 0x73, 0x43, 0x6f,
-    0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65, 0x64, 0x28, 0x29, 0x29,
-    0x7b, 0x69, 0x66, 0x28, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65,
+    0x6e, 0x74, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x59, 0x3d,
+    0x6e, 0x65, 0x77, 0x59, 0x7d, 0x29, 0x2c, 0x64, 0x6f, 0x63,
+    0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x64, 0x64, 0x45,
+    0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e,
+    0x65, 0x72, 0x28, 0x22, 0x6d, 0x6f, 0x75, 0x73, 0x65, 0x75,
+    0x70, 0x22, 0x2c, 0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x74, 0x68,
+    0x69, 0x73, 0x2e, 0x23, 0x69, 0x73, 0x44, 0x72, 0x61, 0x67,
+    0x67, 0x69, 0x6e, 0x67, 0x3d, 0x21, 0x31, 0x7d, 0x29, 0x2c,
+    0x6f, 0x6e, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x75, 0x6e,
+    0x6c, 0x6f, 0x61, 0x64, 0x3d, 0x28, 0x29, 0x3d, 0x3e, 0x7b,
+    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x63, 0x6c, 0x6f, 0x73,
+    0x65, 0x28, 0x29, 0x7d, 0x2c, 0x73, 0x65, 0x74, 0x54, 0x69,
+    0x6d, 0x65, 0x6f, 0x75, 0x74, 0x28, 0x28, 0x29, 0x3d, 0x3e,
+    0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x57,
+    0x61, 0x73, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65,
+    0x64, 0x7c, 0x7c, 0x61, 0x6c, 0x65, 0x72, 0x74, 0x28, 0x22,
+    0x53, 0x6f, 0x72, 0x72, 0x79, 0x2e, 0x20, 0x57, 0x65, 0x62,
+    0x55, 0x49, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x20,
+    0x74, 0x6f, 0x20, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74,
+    0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61,
+    0x63, 0x6b, 0x65, 0x6e, 0x64, 0x20, 0x61, 0x70, 0x70, 0x6c,
+    0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x20, 0x50,
+    0x6c, 0x65, 0x61, 0x73, 0x65, 0x20, 0x74, 0x72, 0x79, 0x20,
+    0x61, 0x67, 0x61, 0x69, 0x6e, 0x2e, 0x22, 0x29, 0x7d, 0x2c,
+    0x31, 0x35, 0x30, 0x30, 0x29, 0x7d, 0x23, 0x63, 0x6c, 0x6f,
+    0x73, 0x65, 0x28, 0x72, 0x65, 0x61, 0x73, 0x6f, 0x6e, 0x3d,
+    0x30, 0x2c, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x22,
+    0x29, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x63, 0x6c,
+    0x6f, 0x73, 0x65, 0x52, 0x65, 0x61, 0x73, 0x6f, 0x6e, 0x3d,
+    0x72, 0x65, 0x61, 0x73, 0x6f, 0x6e, 0x2c, 0x74, 0x68, 0x69,
+    0x73, 0x2e, 0x23, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x56, 0x61,
+    0x6c, 0x75, 0x65, 0x3d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2c,
+    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x49, 0x73,
+    0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65, 0x64, 0x28,
+    0x29, 0x26, 0x26, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77,
+    0x73, 0x2e, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x28, 0x29, 0x7d,
+    0x23, 0x66, 0x72, 0x65, 0x65, 0x7a, 0x65, 0x55, 0x69, 0x28,
+    0x29, 0x7b, 0x73, 0x65, 0x74, 0x54, 0x69, 0x6d, 0x65, 0x6f,
+    0x75, 0x74, 0x28, 0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x69, 0x66,
+    0x28, 0x21, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73,
+    0x49, 0x73, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65,
+    0x64, 0x28, 0x29, 0x29, 0x7b, 0x69, 0x66, 0x28, 0x64, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74,
+    0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49,
+    0x64, 0x28, 0x22, 0x77, 0x65, 0x62, 0x75, 0x69, 0x2d, 0x65,
+    0x72, 0x72, 0x6f, 0x72, 0x2d, 0x63, 0x6f, 0x6e, 0x6e, 0x65,
+    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x6c, 0x6f, 0x73, 0x74,
+    0x22, 0x29, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b,
+    0x6c, 0x65, 0x74, 0x20, 0x64, 0x69, 0x76, 0x3d, 0x64, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+    0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x29, 0x3b, 0x64, 0x69,
+    0x76, 0x2e, 0x69, 0x64, 0x3d, 0x22, 0x77, 0x65, 0x62, 0x75,
+    0x69, 0x2d, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x2d, 0x63, 0x6f,
+    0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x6c,
+    0x6f, 0x73, 0x74, 0x22, 0x2c, 0x4f, 0x62, 0x6a, 0x65, 0x63,
+    0x74, 0x2e, 0x61, 0x73, 0x73, 0x69, 0x67, 0x6e, 0x28, 0x64,
+    0x69, 0x76, 0x2e, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2c, 0x7b,
+    0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x22,
+    0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x76, 0x65, 0x22, 0x2c,
+    0x74, 0x6f, 0x70, 0x3a, 0x22, 0x30, 0x22, 0x2c, 0x6c, 0x65,
+    0x66, 0x74, 0x3a, 0x22, 0x30, 0x22, 0x2c, 0x77, 0x69, 0x64,
+    0x74, 0x68, 0x3a, 0x22, 0x31, 0x30, 0x30, 0x25, 0x22, 0x2c,
+    0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64,
+    0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x22, 0x23, 0x66, 0x66,
+    0x34, 0x64, 0x34, 0x64, 0x22, 0x2c, 0x63, 0x6f, 0x6c, 0x6f,
+    0x72, 0x3a, 0x22, 0x23, 0x66, 0x66, 0x66, 0x22, 0x2c, 0x74,
+    0x65, 0x78, 0x74, 0x41, 0x6c, 0x69, 0x67, 0x6e, 0x3a, 0x22,
+    0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x22, 0x2c, 0x70, 0x61,
+    0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x22, 0x32, 0x70, 0x78,
+    0x20, 0x30, 0x22, 0x2c, 0x66, 0x6f, 0x6e, 0x74, 0x46, 0x61,
+    0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x22, 0x41, 0x72, 0x69, 0x61,
+    0x6c, 0x2c, 0x20, 0x73, 0x61, 0x6e, 0x73, 0x2d, 0x73, 0x65,
+    0x72, 0x69, 0x66, 0x22, 0x2c, 0x66, 0x6f, 0x6e, 0x74, 0x53,
+    0x69, 0x7a, 0x65, 0x3a, 0x22, 0x31, 0x34, 0x70, 0x78, 0x22,
+    0x2c, 0x7a, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x3a, 0x22, 0x31,
+    0x30, 0x30, 0x30, 0x22, 0x2c, 0x6c, 0x69, 0x6e, 0x65, 0x48,
+    0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x22, 0x31, 0x22, 0x7d,
+    0x29, 0x2c, 0x64, 0x69, 0x76, 0x2e, 0x69, 0x6e, 0x6e, 0x65,
+    0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x22, 0x57, 0x65, 0x62,
+    0x55, 0x49, 0x20, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x3a, 0x20,
+    0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x62, 0x61, 0x63, 0x6b, 0x65, 0x6e, 0x64, 0x20, 0x69, 0x73,
+    0x20, 0x6c, 0x6f, 0x73, 0x74, 0x2e, 0x22, 0x2c, 0x64, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x62, 0x6f, 0x64,
+    0x79, 0x2e, 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x42, 0x65,
+    0x66, 0x6f, 0x72, 0x65, 0x28, 0x64, 0x69, 0x76, 0x2c, 0x64,
+    0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x62, 0x6f,
+    0x64, 0x79, 0x2e, 0x66, 0x69, 0x72, 0x73, 0x74, 0x43, 0x68,
+    0x69, 0x6c, 0x64, 0x29, 0x7d, 0x7d, 0x2c, 0x31, 0x65, 0x33,
+    0x29, 0x7d, 0x23, 0x75, 0x6e, 0x66, 0x72, 0x65, 0x65, 0x7a,
+    0x65, 0x55, 0x49, 0x28, 0x29, 0x7b, 0x6c, 0x65, 0x74, 0x20,
+    0x64, 0x69, 0x76, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65,
     0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d,
     0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x77,
     0x65, 0x62, 0x75, 0x69, 0x2d, 0x65, 0x72, 0x72, 0x6f, 0x72,
     0x2d, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f,
-    0x6e, 0x2d, 0x6c, 0x6f, 0x73, 0x74, 0x22, 0x29, 0x29, 0x72,
-    0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x6c, 0x65, 0x74, 0x20,
-    0x64, 0x69, 0x76, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65,
-    0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45,
-    0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x64, 0x69,
-    0x76, 0x22, 0x29, 0x3b, 0x64, 0x69, 0x76, 0x2e, 0x69, 0x64,
-    0x3d, 0x22, 0x77, 0x65, 0x62, 0x75, 0x69, 0x2d, 0x65, 0x72,
-    0x72, 0x6f, 0x72, 0x2d, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63,
-    0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x6c, 0x6f, 0x73, 0x74, 0x22,
-    0x2c, 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x2e, 0x61, 0x73,
-    0x73, 0x69, 0x67, 0x6e, 0x28, 0x64, 0x69, 0x76, 0x2e, 0x73,
-    0x74, 0x79, 0x6c, 0x65, 0x2c, 0x7b, 0x70, 0x6f, 0x73, 0x69,
-    0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x22, 0x72, 0x65, 0x6c, 0x61,
-    0x74, 0x69, 0x76, 0x65, 0x22, 0x2c, 0x74, 0x6f, 0x70, 0x3a,
-    0x22, 0x30, 0x22, 0x2c, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x22,
-    0x30, 0x22, 0x2c, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x22,
-    0x31, 0x30, 0x30, 0x25, 0x22, 0x2c, 0x62, 0x61, 0x63, 0x6b,
-    0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x43, 0x6f, 0x6c, 0x6f,
-    0x72, 0x3a, 0x22, 0x23, 0x66, 0x66, 0x34, 0x64, 0x34, 0x64,
-    0x22, 0x2c, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x22, 0x23,
-    0x66, 0x66, 0x66, 0x22, 0x2c, 0x74, 0x65, 0x78, 0x74, 0x41,
-    0x6c, 0x69, 0x67, 0x6e, 0x3a, 0x22, 0x63, 0x65, 0x6e, 0x74,
-    0x65, 0x72, 0x22, 0x2c, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e,
-    0x67, 0x3a, 0x22, 0x32, 0x70, 0x78, 0x20, 0x30, 0x22, 0x2c,
-    0x66, 0x6f, 0x6e, 0x74, 0x46, 0x61, 0x6d, 0x69, 0x6c, 0x79,
-    0x3a, 0x22, 0x41, 0x72, 0x69, 0x61, 0x6c, 0x2c, 0x20, 0x73,
-    0x61, 0x6e, 0x73, 0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 0x22,
-    0x2c, 0x66, 0x6f, 0x6e, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x3a,
-    0x22, 0x31, 0x34, 0x70, 0x78, 0x22, 0x2c, 0x7a, 0x49, 0x6e,
-    0x64, 0x65, 0x78, 0x3a, 0x22, 0x31, 0x30, 0x30, 0x30, 0x22,
-    0x2c, 0x6c, 0x69, 0x6e, 0x65, 0x48, 0x65, 0x69, 0x67, 0x68,
-    0x74, 0x3a, 0x22, 0x31, 0x22, 0x7d, 0x29, 0x2c, 0x64, 0x69,
-    0x76, 0x2e, 0x69, 0x6e, 0x6e, 0x65, 0x72, 0x54, 0x65, 0x78,
-    0x74, 0x3d, 0x22, 0x57, 0x65, 0x62, 0x55, 0x49, 0x20, 0x45,
-    0x72, 0x72, 0x6f, 0x72, 0x3a, 0x20, 0x43, 0x6f, 0x6e, 0x6e,
-    0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x77, 0x69, 0x74,
-    0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6b,
-    0x65, 0x6e, 0x64, 0x20, 0x69, 0x73, 0x20, 0x6c, 0x6f, 0x73,
-    0x74, 0x2e, 0x22, 0x2c, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65,
-    0x6e, 0x74, 0x2e, 0x62, 0x6f, 0x64, 0x79, 0x2e, 0x69, 0x6e,
-    0x73, 0x65, 0x72, 0x74, 0x42, 0x65, 0x66, 0x6f, 0x72, 0x65,
-    0x28, 0x64, 0x69, 0x76, 0x2c, 0x64, 0x6f, 0x63, 0x75, 0x6d,
-    0x65, 0x6e, 0x74, 0x2e, 0x62, 0x6f, 0x64, 0x79, 0x2e, 0x66,
-    0x69, 0x72, 0x73, 0x74, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x29,
-    0x7d, 0x7d, 0x2c, 0x31, 0x65, 0x33, 0x29, 0x7d, 0x23, 0x75,
-    0x6e, 0x66, 0x72, 0x65, 0x65, 0x7a, 0x65, 0x55, 0x49, 0x28,
-    0x29, 0x7b, 0x6c, 0x65, 0x74, 0x20, 0x64, 0x69, 0x76, 0x3d,
-    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67,
-    0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42,
-    0x79, 0x49, 0x64, 0x28, 0x22, 0x77, 0x65, 0x62, 0x75, 0x69,
-    0x2d, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x2d, 0x63, 0x6f, 0x6e,
-    0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x6c, 0x6f,
-    0x73, 0x74, 0x22, 0x29, 0x3b, 0x64, 0x69, 0x76, 0x26, 0x26,
-    0x64, 0x69, 0x76, 0x2e, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65,
-    0x28, 0x29, 0x7d, 0x23, 0x69, 0x73, 0x54, 0x65, 0x78, 0x74,
-    0x42, 0x61, 0x73, 0x65, 0x64, 0x43, 0x6f, 0x6d, 0x6d, 0x61,
-    0x6e, 0x64, 0x28, 0x63, 0x6d, 0x64, 0x29, 0x7b, 0x72, 0x65,
-    0x74, 0x75, 0x72, 0x6e, 0x20, 0x63, 0x6d, 0x64, 0x21, 0x3d,
-    0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x43, 0x4d, 0x44,
-    0x5f, 0x53, 0x45, 0x4e, 0x44, 0x5f, 0x52, 0x41, 0x57, 0x7d,
-    0x23, 0x70, 0x61, 0x72, 0x73, 0x65, 0x44, 0x69, 0x6d, 0x65,
-    0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x28, 0x69, 0x6e, 0x70,
-    0x75, 0x74, 0x29, 0x7b, 0x74, 0x72, 0x79, 0x7b, 0x6c, 0x65,
-    0x74, 0x20, 0x70, 0x61, 0x72, 0x74, 0x73, 0x3d, 0x69, 0x6e,
-    0x70, 0x75, 0x74, 0x2e, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x28,
-    0x22, 0x2c, 0x22, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x70, 0x61,
-    0x72, 0x74, 0x73, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68,
-    0x21, 0x3d, 0x3d, 0x34, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72,
-    0x6e, 0x7b, 0x78, 0x3a, 0x30, 0x2c, 0x79, 0x3a, 0x30, 0x2c,
-    0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x30, 0x2c, 0x68, 0x65,
-    0x69, 0x67, 0x68, 0x74, 0x3a, 0x30, 0x7d, 0x3b, 0x6c, 0x65,
-    0x74, 0x20, 0x78, 0x3d, 0x70, 0x61, 0x72, 0x73, 0x65, 0x46,
-    0x6c, 0x6f, 0x61, 0x74, 0x28, 0x70, 0x61, 0x72, 0x74, 0x73,
-    0x5b, 0x30, 0x5d, 0x29, 0x2c, 0x79, 0x3d, 0x70, 0x61, 0x72,
-    0x73, 0x65, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x70, 0x61,
-    0x72, 0x74, 0x73, 0x5b, 0x31, 0x5d, 0x29, 0x2c, 0x77, 0x69,
-    0x64, 0x74, 0x68, 0x3d, 0x70, 0x61, 0x72, 0x73, 0x65, 0x46,
-    0x6c, 0x6f, 0x61, 0x74, 0x28, 0x70, 0x61, 0x72, 0x74, 0x73,
-    0x5b, 0x32, 0x5d, 0x29, 0x2c, 0x68, 0x65, 0x69, 0x67, 0x68,
-    0x74, 0x3d, 0x70, 0x61, 0x72, 0x73, 0x65, 0x46, 0x6c, 0x6f,
-    0x61, 0x74, 0x28, 0x70, 0x61, 0x72, 0x74, 0x73, 0x5b, 0x33,
-    0x5d, 0x29, 0x3b, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x5b,
-    0x78, 0x2c, 0x79, 0x2c, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2c,
-    0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x5d, 0x2e, 0x73, 0x6f,
-    0x6d, 0x65, 0x28, 0x69, 0x73, 0x4e, 0x61, 0x4e, 0x29, 0x3f,
-    0x7b, 0x78, 0x3a, 0x30, 0x2c, 0x79, 0x3a, 0x30, 0x2c, 0x77,
-    0x69, 0x64, 0x74, 0x68, 0x3a, 0x30, 0x2c, 0x68, 0x65, 0x69,
-    0x67, 0x68, 0x74, 0x3a, 0x30, 0x7d, 0x3a, 0x7b, 0x78, 0x2c,
-    0x79, 0x2c, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2c, 0x68, 0x65,
-    0x69, 0x67, 0x68, 0x74, 0x7d, 0x7d, 0x63, 0x61, 0x74, 0x63,
-    0x68, 0x7b, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x7b, 0x78,
-    0x3a, 0x30, 0x2c, 0x79, 0x3a, 0x30, 0x2c, 0x77, 0x69, 0x64,
-    0x74, 0x68, 0x3a, 0x30, 0x2c, 0x68, 0x65, 0x69, 0x67, 0x68,
-    0x74, 0x3a, 0x30, 0x7d, 0x7d, 0x7d, 0x23, 0x67, 0x65, 0x74,
-    0x44, 0x61, 0x74, 0x61, 0x53, 0x74, 0x72, 0x46, 0x72, 0x6f,
-    0x6d, 0x50, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x28, 0x62, 0x75,
-    0x66, 0x66, 0x65, 0x72, 0x2c, 0x73, 0x74, 0x61, 0x72, 0x74,
-    0x49, 0x6e, 0x64, 0x65, 0x78, 0x29, 0x7b, 0x6c, 0x65, 0x74,
-    0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x42, 0x79, 0x74,
-    0x65, 0x73, 0x3d, 0x5b, 0x5d, 0x3b, 0x66, 0x6f, 0x72, 0x28,
-    0x6c, 0x65, 0x74, 0x20, 0x69, 0x3d, 0x73, 0x74, 0x61, 0x72,
-    0x74, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x3b, 0x69, 0x3c, 0x62,
-    0x75, 0x66, 0x66, 0x65, 0x72, 0x2e, 0x6c, 0x65, 0x6e, 0x67,
-    0x74, 0x68, 0x26, 0x26, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
-    0x5b, 0x69, 0x5d, 0x21, 0x3d, 0x3d, 0x30, 0x3b, 0x69, 0x2b,
-    0x2b, 0x29, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x42, 0x79,
-    0x74, 0x65, 0x73, 0x2e, 0x70, 0x75, 0x73, 0x68, 0x28, 0x62,
-    0x75, 0x66, 0x66, 0x65, 0x72, 0x5b, 0x69, 0x5d, 0x29, 0x3b,
-    0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6e, 0x65, 0x77,
-    0x20, 0x54, 0x65, 0x78, 0x74, 0x44, 0x65, 0x63, 0x6f, 0x64,
-    0x65, 0x72, 0x28, 0x29, 0x2e, 0x64, 0x65, 0x63, 0x6f, 0x64,
-    0x65, 0x28, 0x6e, 0x65, 0x77, 0x20, 0x55, 0x69, 0x6e, 0x74,
-    0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x73, 0x74, 0x72,
-    0x69, 0x6e, 0x67, 0x42, 0x79, 0x74, 0x65, 0x73, 0x29, 0x29,
-    0x7d, 0x23, 0x67, 0x65, 0x74, 0x49, 0x44, 0x28, 0x62, 0x75,
-    0x66, 0x66, 0x65, 0x72, 0x2c, 0x69, 0x6e, 0x64, 0x65, 0x78,
-    0x29, 0x7b, 0x69, 0x66, 0x28, 0x69, 0x6e, 0x64, 0x65, 0x78,
-    0x3c, 0x30, 0x7c, 0x7c, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x3e,
-    0x3d, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2e, 0x6c, 0x65,
-    0x6e, 0x67, 0x74, 0x68, 0x2d, 0x31, 0x29, 0x74, 0x68, 0x72,
-    0x6f, 0x77, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x45, 0x72, 0x72,
-    0x6f, 0x72, 0x28, 0x22, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x20,
-    0x6f, 0x75, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x62, 0x6f, 0x75,
-    0x6e, 0x64, 0x73, 0x20, 0x6f, 0x72, 0x20, 0x69, 0x6e, 0x73,
-    0x75, 0x66, 0x66, 0x69, 0x63, 0x69, 0x65, 0x6e, 0x74, 0x20,
-    0x64, 0x61, 0x74, 0x61, 0x2e, 0x22, 0x29, 0x3b, 0x6c, 0x65,
-    0x74, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x42, 0x79, 0x74,
-    0x65, 0x3d, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5b, 0x69,
-    0x6e, 0x64, 0x65, 0x78, 0x5d, 0x3b, 0x72, 0x65, 0x74, 0x75,
-    0x72, 0x6e, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5b,
-    0x69, 0x6e, 0x64, 0x65, 0x78, 0x2b, 0x31, 0x5d, 0x3c, 0x3c,
-    0x38, 0x7c, 0x66, 0x69, 0x72, 0x73, 0x74, 0x42, 0x79, 0x74,
-    0x65, 0x7d, 0x23, 0x61, 0x64, 0x64, 0x54, 0x6f, 0x6b, 0x65,
-    0x6e, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2c, 0x76,
-    0x61, 0x6c, 0x75, 0x65, 0x2c, 0x69, 0x6e, 0x64, 0x65, 0x78,
-    0x29, 0x7b, 0x69, 0x66, 0x28, 0x76, 0x61, 0x6c, 0x75, 0x65,
-    0x3c, 0x30, 0x7c, 0x7c, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3e,
-    0x34, 0x32, 0x39, 0x34, 0x39, 0x36, 0x37, 0x32, 0x39, 0x35,
+    0x6e, 0x2d, 0x6c, 0x6f, 0x73, 0x74, 0x22, 0x29, 0x3b, 0x64,
+    0x69, 0x76, 0x26, 0x26, 0x64, 0x69, 0x76, 0x2e, 0x72, 0x65,
+    0x6d, 0x6f, 0x76, 0x65, 0x28, 0x29, 0x7d, 0x23, 0x69, 0x73,
+    0x54, 0x65, 0x78, 0x74, 0x42, 0x61, 0x73, 0x65, 0x64, 0x43,
+    0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x28, 0x63, 0x6d, 0x64,
+    0x29, 0x7b, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x63,
+    0x6d, 0x64, 0x21, 0x3d, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x23, 0x43, 0x4d, 0x44, 0x5f, 0x53, 0x45, 0x4e, 0x44, 0x5f,
+    0x52, 0x41, 0x57, 0x7d, 0x23, 0x70, 0x61, 0x72, 0x73, 0x65,
+    0x44, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x73,
+    0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x29, 0x7b, 0x74, 0x72,
+    0x79, 0x7b, 0x6c, 0x65, 0x74, 0x20, 0x70, 0x61, 0x72, 0x74,
+    0x73, 0x3d, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x70,
+    0x6c, 0x69, 0x74, 0x28, 0x22, 0x2c, 0x22, 0x29, 0x3b, 0x69,
+    0x66, 0x28, 0x70, 0x61, 0x72, 0x74, 0x73, 0x2e, 0x6c, 0x65,
+    0x6e, 0x67, 0x74, 0x68, 0x21, 0x3d, 0x3d, 0x34, 0x29, 0x72,
+    0x65, 0x74, 0x75, 0x72, 0x6e, 0x7b, 0x78, 0x3a, 0x30, 0x2c,
+    0x79, 0x3a, 0x30, 0x2c, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a,
+    0x30, 0x2c, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x30,
+    0x7d, 0x3b, 0x6c, 0x65, 0x74, 0x20, 0x78, 0x3d, 0x70, 0x61,
+    0x72, 0x73, 0x65, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x70,
+    0x61, 0x72, 0x74, 0x73, 0x5b, 0x30, 0x5d, 0x29, 0x2c, 0x79,
+    0x3d, 0x70, 0x61, 0x72, 0x73, 0x65, 0x46, 0x6c, 0x6f, 0x61,
+    0x74, 0x28, 0x70, 0x61, 0x72, 0x74, 0x73, 0x5b, 0x31, 0x5d,
+    0x29, 0x2c, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x70, 0x61,
+    0x72, 0x73, 0x65, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x70,
+    0x61, 0x72, 0x74, 0x73, 0x5b, 0x32, 0x5d, 0x29, 0x2c, 0x68,
+    0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x70, 0x61, 0x72, 0x73,
+    0x65, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x70, 0x61, 0x72,
+    0x74, 0x73, 0x5b, 0x33, 0x5d, 0x29, 0x3b, 0x72, 0x65, 0x74,
+    0x75, 0x72, 0x6e, 0x5b, 0x78, 0x2c, 0x79, 0x2c, 0x77, 0x69,
+    0x64, 0x74, 0x68, 0x2c, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74,
+    0x5d, 0x2e, 0x73, 0x6f, 0x6d, 0x65, 0x28, 0x69, 0x73, 0x4e,
+    0x61, 0x4e, 0x29, 0x3f, 0x7b, 0x78, 0x3a, 0x30, 0x2c, 0x79,
+    0x3a, 0x30, 0x2c, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x30,
+    0x2c, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x30, 0x7d,
+    0x3a, 0x7b, 0x78, 0x2c, 0x79, 0x2c, 0x77, 0x69, 0x64, 0x74,
+    0x68, 0x2c, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x7d, 0x7d,
+    0x63, 0x61, 0x74, 0x63, 0x68, 0x7b, 0x72, 0x65, 0x74, 0x75,
+    0x72, 0x6e, 0x7b, 0x78, 0x3a, 0x30, 0x2c, 0x79, 0x3a, 0x30,
+    0x2c, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x30, 0x2c, 0x68,
+    0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x30, 0x7d, 0x7d, 0x7d,
+    0x23, 0x67, 0x65, 0x74, 0x44, 0x61, 0x74, 0x61, 0x53, 0x74,
+    0x72, 0x46, 0x72, 0x6f, 0x6d, 0x50, 0x61, 0x63, 0x6b, 0x65,
+    0x74, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2c, 0x73,
+    0x74, 0x61, 0x72, 0x74, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x29,
+    0x7b, 0x6c, 0x65, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e,
+    0x67, 0x42, 0x79, 0x74, 0x65, 0x73, 0x3d, 0x5b, 0x5d, 0x3b,
+    0x66, 0x6f, 0x72, 0x28, 0x6c, 0x65, 0x74, 0x20, 0x69, 0x3d,
+    0x73, 0x74, 0x61, 0x72, 0x74, 0x49, 0x6e, 0x64, 0x65, 0x78,
+    0x3b, 0x69, 0x3c, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2e,
+    0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x26, 0x26, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x5b, 0x69, 0x5d, 0x21, 0x3d, 0x3d,
+    0x30, 0x3b, 0x69, 0x2b, 0x2b, 0x29, 0x73, 0x74, 0x72, 0x69,
+    0x6e, 0x67, 0x42, 0x79, 0x74, 0x65, 0x73, 0x2e, 0x70, 0x75,
+    0x73, 0x68, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5b,
+    0x69, 0x5d, 0x29, 0x3b, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+    0x20, 0x6e, 0x65, 0x77, 0x20, 0x54, 0x65, 0x78, 0x74, 0x44,
+    0x65, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x28, 0x29, 0x2e, 0x64,
+    0x65, 0x63, 0x6f, 0x64, 0x65, 0x28, 0x6e, 0x65, 0x77, 0x20,
+    0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79,
+    0x28, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x42, 0x79, 0x74,
+    0x65, 0x73, 0x29, 0x29, 0x7d, 0x23, 0x67, 0x65, 0x74, 0x49,
+    0x44, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2c, 0x69,
+    0x6e, 0x64, 0x65, 0x78, 0x29, 0x7b, 0x69, 0x66, 0x28, 0x69,
+    0x6e, 0x64, 0x65, 0x78, 0x3c, 0x30, 0x7c, 0x7c, 0x69, 0x6e,
+    0x64, 0x65, 0x78, 0x3e, 0x3d, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x2d, 0x31,
     0x29, 0x74, 0x68, 0x72, 0x6f, 0x77, 0x20, 0x6e, 0x65, 0x77,
-    0x20, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x22, 0x4e, 0x75,
-    0x6d, 0x62, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x6f, 0x75,
-    0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72,
-    0x61, 0x6e, 0x67, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x34,
-    0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x72, 0x65, 0x70,
-    0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f,
-    0x6e, 0x2e, 0x22, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x69, 0x6e,
-    0x64, 0x65, 0x78, 0x3c, 0x30, 0x7c, 0x7c, 0x69, 0x6e, 0x64,
-    0x65, 0x78, 0x3e, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2e,
-    0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x2d, 0x34, 0x29, 0x74,
-    0x68, 0x72, 0x6f, 0x77, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x45,
-    0x72, 0x72, 0x6f, 0x72, 0x28, 0x22, 0x49, 0x6e, 0x64, 0x65,
-    0x78, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x62,
-    0x6f, 0x75, 0x6e, 0x64, 0x73, 0x20, 0x6f, 0x72, 0x20, 0x69,
-    0x6e, 0x73, 0x75, 0x66, 0x66, 0x69, 0x63, 0x69, 0x65, 0x6e,
-    0x74, 0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x20, 0x69, 0x6e,
-    0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2e, 0x22, 0x29,
-    0x3b, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5b, 0x69, 0x6e,
-    0x64, 0x65, 0x78, 0x5d, 0x3d, 0x76, 0x61, 0x6c, 0x75, 0x65,
-    0x26, 0x32, 0x35, 0x35, 0x2c, 0x62, 0x75, 0x66, 0x66, 0x65,
-    0x72, 0x5b, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2b, 0x31, 0x5d,
-    0x3d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x3e, 0x3e, 0x38,
-    0x26, 0x32, 0x35, 0x35, 0x2c, 0x62, 0x75, 0x66, 0x66, 0x65,
-    0x72, 0x5b, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2b, 0x32, 0x5d,
-    0x3d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x3e, 0x3e, 0x31,
-    0x36, 0x26, 0x32, 0x35, 0x35, 0x2c, 0x62, 0x75, 0x66, 0x66,
-    0x65, 0x72, 0x5b, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2b, 0x33,
+    0x20, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x22, 0x49, 0x6e,
+    0x64, 0x65, 0x78, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x6f, 0x66,
+    0x20, 0x62, 0x6f, 0x75, 0x6e, 0x64, 0x73, 0x20, 0x6f, 0x72,
+    0x20, 0x69, 0x6e, 0x73, 0x75, 0x66, 0x66, 0x69, 0x63, 0x69,
+    0x65, 0x6e, 0x74, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x22,
+    0x29, 0x3b, 0x6c, 0x65, 0x74, 0x20, 0x66, 0x69, 0x72, 0x73,
+    0x74, 0x42, 0x79, 0x74, 0x65, 0x3d, 0x62, 0x75, 0x66, 0x66,
+    0x65, 0x72, 0x5b, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x5d, 0x3b,
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x62, 0x75, 0x66,
+    0x66, 0x65, 0x72, 0x5b, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2b,
+    0x31, 0x5d, 0x3c, 0x3c, 0x38, 0x7c, 0x66, 0x69, 0x72, 0x73,
+    0x74, 0x42, 0x79, 0x74, 0x65, 0x7d, 0x23, 0x61, 0x64, 0x64,
+    0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x28, 0x62, 0x75, 0x66, 0x66,
+    0x65, 0x72, 0x2c, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2c, 0x69,
+    0x6e, 0x64, 0x65, 0x78, 0x29, 0x7b, 0x69, 0x66, 0x28, 0x76,
+    0x61, 0x6c, 0x75, 0x65, 0x3c, 0x30, 0x7c, 0x7c, 0x76, 0x61,
+    0x6c, 0x75, 0x65, 0x3e, 0x34, 0x32, 0x39, 0x34, 0x39, 0x36,
+    0x37, 0x32, 0x39, 0x35, 0x29, 0x74, 0x68, 0x72, 0x6f, 0x77,
+    0x20, 0x6e, 0x65, 0x77, 0x20, 0x45, 0x72, 0x72, 0x6f, 0x72,
+    0x28, 0x22, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x69,
+    0x73, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x66,
+    0x6f, 0x72, 0x20, 0x34, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73,
+    0x20, 0x72, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74,
+    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x22, 0x29, 0x3b, 0x69,
+    0x66, 0x28, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x3c, 0x30, 0x7c,
+    0x7c, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x3e, 0x62, 0x75, 0x66,
+    0x66, 0x65, 0x72, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68,
+    0x2d, 0x34, 0x29, 0x74, 0x68, 0x72, 0x6f, 0x77, 0x20, 0x6e,
+    0x65, 0x77, 0x20, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x22,
+    0x49, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x6f, 0x75, 0x74, 0x20,
+    0x6f, 0x66, 0x20, 0x62, 0x6f, 0x75, 0x6e, 0x64, 0x73, 0x20,
+    0x6f, 0x72, 0x20, 0x69, 0x6e, 0x73, 0x75, 0x66, 0x66, 0x69,
+    0x63, 0x69, 0x65, 0x6e, 0x74, 0x20, 0x73, 0x70, 0x61, 0x63,
+    0x65, 0x20, 0x69, 0x6e, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x2e, 0x22, 0x29, 0x3b, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x5b, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x5d, 0x3d, 0x76,
+    0x61, 0x6c, 0x75, 0x65, 0x26, 0x32, 0x35, 0x35, 0x2c, 0x62,
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x5b, 0x69, 0x6e, 0x64, 0x65,
+    0x78, 0x2b, 0x31, 0x5d, 0x3d, 0x76, 0x61, 0x6c, 0x75, 0x65,
+    0x3e, 0x3e, 0x3e, 0x38, 0x26, 0x32, 0x35, 0x35, 0x2c, 0x62,
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x5b, 0x69, 0x6e, 0x64, 0x65,
+    0x78, 0x2b, 0x32, 0x5d, 0x3d, 0x76, 0x61, 0x6c, 0x75, 0x65,
+    0x3e, 0x3e, 0x3e, 0x31, 0x36, 0x26, 0x32, 0x35, 0x35, 0x2c,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5b, 0x69, 0x6e, 0x64,
+    0x65, 0x78, 0x2b, 0x33, 0x5d, 0x3d, 0x76, 0x61, 0x6c, 0x75,
+    0x65, 0x3e, 0x3e, 0x3e, 0x32, 0x34, 0x26, 0x32, 0x35, 0x35,
+    0x7d, 0x23, 0x61, 0x64, 0x64, 0x49, 0x44, 0x28, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x2c, 0x76, 0x61, 0x6c, 0x75, 0x65,
+    0x2c, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x29, 0x7b, 0x69, 0x66,
+    0x28, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3c, 0x30, 0x7c, 0x7c,
+    0x76, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x36, 0x35, 0x35, 0x33,
+    0x35, 0x29, 0x74, 0x68, 0x72, 0x6f, 0x77, 0x20, 0x6e, 0x65,
+    0x77, 0x20, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x22, 0x4e,
+    0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x6f,
+    0x75, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x72, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20,
+    0x32, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x72, 0x65,
+    0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69,
+    0x6f, 0x6e, 0x2e, 0x22, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x69,
+    0x6e, 0x64, 0x65, 0x78, 0x3c, 0x30, 0x7c, 0x7c, 0x69, 0x6e,
+    0x64, 0x65, 0x78, 0x3e, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+    0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x2d, 0x32, 0x29,
+    0x74, 0x68, 0x72, 0x6f, 0x77, 0x20, 0x6e, 0x65, 0x77, 0x20,
+    0x45, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x22, 0x49, 0x6e, 0x64,
+    0x65, 0x78, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x6f, 0x66, 0x20,
+    0x62, 0x6f, 0x75, 0x6e, 0x64, 0x73, 0x20, 0x6f, 0x72, 0x20,
+    0x69, 0x6e, 0x73, 0x75, 0x66, 0x66, 0x69, 0x63, 0x69, 0x65,
+    0x6e, 0x74, 0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x20, 0x69,
+    0x6e, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2e, 0x22,
+    0x29, 0x3b, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5b, 0x69,
+    0x6e, 0x64, 0x65, 0x78, 0x5d, 0x3d, 0x76, 0x61, 0x6c, 0x75,
+    0x65, 0x26, 0x32, 0x35, 0x35, 0x2c, 0x62, 0x75, 0x66, 0x66,
+    0x65, 0x72, 0x5b, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2b, 0x31,
     0x5d, 0x3d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x3e, 0x3e,
-    0x32, 0x34, 0x26, 0x32, 0x35, 0x35, 0x7d, 0x23, 0x61, 0x64,
-    0x64, 0x49, 0x44, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
-    0x2c, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2c, 0x69, 0x6e, 0x64,
-    0x65, 0x78, 0x29, 0x7b, 0x69, 0x66, 0x28, 0x76, 0x61, 0x6c,
-    0x75, 0x65, 0x3c, 0x30, 0x7c, 0x7c, 0x76, 0x61, 0x6c, 0x75,
-    0x65, 0x3e, 0x36, 0x35, 0x35, 0x33, 0x35, 0x29, 0x74, 0x68,
-    0x72, 0x6f, 0x77, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x45, 0x72,
-    0x72, 0x6f, 0x72, 0x28, 0x22, 0x4e, 0x75, 0x6d, 0x62, 0x65,
-    0x72, 0x20, 0x69, 0x73, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x6f,
-    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x61, 0x6e, 0x67,
-    0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x32, 0x20, 0x62, 0x79,
-    0x74, 0x65, 0x73, 0x20, 0x72, 0x65, 0x70, 0x72, 0x65, 0x73,
-    0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x22,
-    0x29, 0x3b, 0x69, 0x66, 0x28, 0x69, 0x6e, 0x64, 0x65, 0x78,
-    0x3c, 0x30, 0x7c, 0x7c, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x3e,
-    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2e, 0x6c, 0x65, 0x6e,
-    0x67, 0x74, 0x68, 0x2d, 0x32, 0x29, 0x74, 0x68, 0x72, 0x6f,
-    0x77, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x45, 0x72, 0x72, 0x6f,
-    0x72, 0x28, 0x22, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x6f,
-    0x75, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x62, 0x6f, 0x75, 0x6e,
-    0x64, 0x73, 0x20, 0x6f, 0x72, 0x20, 0x69, 0x6e, 0x73, 0x75,
-    0x66, 0x66, 0x69, 0x63, 0x69, 0x65, 0x6e, 0x74, 0x20, 0x73,
-    0x70, 0x61, 0x63, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x62, 0x75,
-    0x66, 0x66, 0x65, 0x72, 0x2e, 0x22, 0x29, 0x3b, 0x62, 0x75,
-    0x66, 0x66, 0x65, 0x72, 0x5b, 0x69, 0x6e, 0x64, 0x65, 0x78,
-    0x5d, 0x3d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x26, 0x32, 0x35,
-    0x35, 0x2c, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5b, 0x69,
-    0x6e, 0x64, 0x65, 0x78, 0x2b, 0x31, 0x5d, 0x3d, 0x76, 0x61,
-    0x6c, 0x75, 0x65, 0x3e, 0x3e, 0x3e, 0x38, 0x26, 0x32, 0x35,
-    0x35, 0x7d, 0x23, 0x73, 0x74, 0x61, 0x72, 0x74, 0x28, 0x29,
-    0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x6b, 0x65, 0x65,
-    0x70, 0x41, 0x6c, 0x69, 0x76, 0x65, 0x28, 0x29, 0x2c, 0x74,
-    0x68, 0x69, 0x73, 0x2e, 0x23, 0x63, 0x61, 0x6c, 0x6c, 0x50,
-    0x72, 0x6f, 0x6d, 0x69, 0x73, 0x65, 0x49, 0x44, 0x5b, 0x30,
-    0x5d, 0x3d, 0x30, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
-    0x77, 0x73, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x28,
-    0x29, 0x7d, 0x23, 0x6b, 0x65, 0x65, 0x70, 0x41, 0x6c, 0x69,
-    0x76, 0x65, 0x3d, 0x61, 0x73, 0x79, 0x6e, 0x63, 0x28, 0x29,
-    0x3d, 0x3e, 0x7b, 0x66, 0x6f, 0x72, 0x28, 0x3b, 0x3b, 0x29,
-    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x50, 0x69, 0x6e, 0x67,
-    0x3f, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x73, 0x65, 0x6e,
-    0x64, 0x44, 0x61, 0x74, 0x61, 0x28, 0x6e, 0x65, 0x77, 0x20,
-    0x54, 0x65, 0x78, 0x74, 0x45, 0x6e, 0x63, 0x6f, 0x64, 0x65,
-    0x72, 0x28, 0x29, 0x2e, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65,
-    0x28, 0x22, 0x70, 0x69, 0x6e, 0x67, 0x22, 0x29, 0x29, 0x3a,
-    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x50, 0x69, 0x6e, 0x67,
-    0x3d, 0x21, 0x30, 0x2c, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20,
-    0x6e, 0x65, 0x77, 0x20, 0x50, 0x72, 0x6f, 0x6d, 0x69, 0x73,
-    0x65, 0x28, 0x72, 0x65, 0x73, 0x6f, 0x6c, 0x76, 0x65, 0x3d,
-    0x3e, 0x73, 0x65, 0x74, 0x54, 0x69, 0x6d, 0x65, 0x6f, 0x75,
-    0x74, 0x28, 0x72, 0x65, 0x73, 0x6f, 0x6c, 0x76, 0x65, 0x2c,
-    0x32, 0x65, 0x34, 0x29, 0x29, 0x7d, 0x3b, 0x23, 0x63, 0x6c,
-    0x69, 0x63, 0x6b, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e,
-    0x65, 0x72, 0x28, 0x29, 0x7b, 0x64, 0x6f, 0x63, 0x75, 0x6d,
-    0x65, 0x6e, 0x74, 0x2e, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53,
-    0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x41, 0x6c, 0x6c,
-    0x28, 0x22, 0x5b, 0x69, 0x64, 0x5d, 0x22, 0x29, 0x2e, 0x66,
-    0x6f, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x65, 0x3d, 0x3e,
-    0x7b, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x41, 0x6c,
-    0x6c, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x7c, 0x7c, 0x65,
-    0x2e, 0x69, 0x64, 0x21, 0x3d, 0x3d, 0x22, 0x22, 0x26, 0x26,
-    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x62, 0x69, 0x6e, 0x64,
-    0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x69, 0x6e, 0x63, 0x6c,
-    0x75, 0x64, 0x65, 0x73, 0x28, 0x65, 0x2e, 0x69, 0x64, 0x29,
-    0x29, 0x26, 0x26, 0x65, 0x2e, 0x69, 0x64, 0x26, 0x26, 0x21,
-    0x65, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x73, 0x65, 0x74, 0x2e,
-    0x77, 0x65, 0x62, 0x75, 0x69, 0x5f, 0x63, 0x6c, 0x69, 0x63,
-    0x6b, 0x5f, 0x69, 0x73, 0x5f, 0x73, 0x65, 0x74, 0x26, 0x26,
-    0x28, 0x65, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x73, 0x65, 0x74,
-    0x2e, 0x77, 0x65, 0x62, 0x75, 0x69, 0x5f, 0x63, 0x6c, 0x69,
-    0x63, 0x6b, 0x5f, 0x69, 0x73, 0x5f, 0x73, 0x65, 0x74, 0x3d,
-    0x22, 0x74, 0x72, 0x75, 0x65, 0x22, 0x2c, 0x65, 0x2e, 0x61,
-    0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73,
-    0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 0x6c, 0x69,
-    0x63, 0x6b, 0x22, 0x2c, 0x28, 0x29, 0x3d, 0x3e, 0x74, 0x68,
-    0x69, 0x73, 0x2e, 0x23, 0x73, 0x65, 0x6e, 0x64, 0x43, 0x6c,
-    0x69, 0x63, 0x6b, 0x28, 0x65, 0x2e, 0x69, 0x64, 0x29, 0x29,
-    0x29, 0x7d, 0x29, 0x7d, 0x61, 0x73, 0x79, 0x6e, 0x63, 0x23,
-    0x73, 0x65, 0x6e, 0x64, 0x44, 0x61, 0x74, 0x61, 0x28, 0x70,
-    0x61, 0x63, 0x6b, 0x65, 0x74, 0x29, 0x7b, 0x69, 0x66, 0x28,
-    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x50, 0x69, 0x6e, 0x67,
-    0x3d, 0x21, 0x31, 0x2c, 0x21, 0x28, 0x21, 0x74, 0x68, 0x69,
-    0x73, 0x2e, 0x23, 0x77, 0x73, 0x49, 0x73, 0x43, 0x6f, 0x6e,
-    0x6e, 0x65, 0x63, 0x74, 0x65, 0x64, 0x28, 0x29, 0x7c, 0x7c,
-    0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x3d, 0x3d, 0x3d, 0x76,
-    0x6f, 0x69, 0x64, 0x20, 0x30, 0x29, 0x26, 0x26, 0x28, 0x74,
+    0x38, 0x26, 0x32, 0x35, 0x35, 0x7d, 0x23, 0x73, 0x74, 0x61,
+    0x72, 0x74, 0x28, 0x29, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x23, 0x6b, 0x65, 0x65, 0x70, 0x41, 0x6c, 0x69, 0x76, 0x65,
+    0x28, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x63,
+    0x61, 0x6c, 0x6c, 0x50, 0x72, 0x6f, 0x6d, 0x69, 0x73, 0x65,
+    0x49, 0x44, 0x5b, 0x30, 0x5d, 0x3d, 0x30, 0x2c, 0x74, 0x68,
+    0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x43, 0x6f, 0x6e, 0x6e,
+    0x65, 0x63, 0x74, 0x28, 0x29, 0x7d, 0x23, 0x6b, 0x65, 0x65,
+    0x70, 0x41, 0x6c, 0x69, 0x76, 0x65, 0x3d, 0x61, 0x73, 0x79,
+    0x6e, 0x63, 0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x66, 0x6f, 0x72,
+    0x28, 0x3b, 0x3b, 0x29, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
+    0x50, 0x69, 0x6e, 0x67, 0x3f, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x23, 0x73, 0x65, 0x6e, 0x64, 0x44, 0x61, 0x74, 0x61, 0x28,
+    0x6e, 0x65, 0x77, 0x20, 0x54, 0x65, 0x78, 0x74, 0x45, 0x6e,
+    0x63, 0x6f, 0x64, 0x65, 0x72, 0x28, 0x29, 0x2e, 0x65, 0x6e,
+    0x63, 0x6f, 0x64, 0x65, 0x28, 0x22, 0x70, 0x69, 0x6e, 0x67,
+    0x22, 0x29, 0x29, 0x3a, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
+    0x50, 0x69, 0x6e, 0x67, 0x3d, 0x21, 0x30, 0x2c, 0x61, 0x77,
+    0x61, 0x69, 0x74, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x50, 0x72,
+    0x6f, 0x6d, 0x69, 0x73, 0x65, 0x28, 0x72, 0x65, 0x73, 0x6f,
+    0x6c, 0x76, 0x65, 0x3d, 0x3e, 0x73, 0x65, 0x74, 0x54, 0x69,
+    0x6d, 0x65, 0x6f, 0x75, 0x74, 0x28, 0x72, 0x65, 0x73, 0x6f,
+    0x6c, 0x76, 0x65, 0x2c, 0x32, 0x65, 0x34, 0x29, 0x29, 0x7d,
+    0x3b, 0x23, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x73, 0x4c, 0x69,
+    0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x29, 0x7b, 0x64,
+    0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x71, 0x75,
+    0x65, 0x72, 0x79, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f,
+    0x72, 0x41, 0x6c, 0x6c, 0x28, 0x22, 0x5b, 0x69, 0x64, 0x5d,
+    0x22, 0x29, 0x2e, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63, 0x68,
+    0x28, 0x65, 0x3d, 0x3e, 0x7b, 0x28, 0x74, 0x68, 0x69, 0x73,
+    0x2e, 0x23, 0x41, 0x6c, 0x6c, 0x45, 0x76, 0x65, 0x6e, 0x74,
+    0x73, 0x7c, 0x7c, 0x65, 0x2e, 0x69, 0x64, 0x21, 0x3d, 0x3d,
+    0x22, 0x22, 0x26, 0x26, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
+    0x62, 0x69, 0x6e, 0x64, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e,
+    0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x73, 0x28, 0x65,
+    0x2e, 0x69, 0x64, 0x29, 0x29, 0x26, 0x26, 0x65, 0x2e, 0x69,
+    0x64, 0x26, 0x26, 0x21, 0x65, 0x2e, 0x64, 0x61, 0x74, 0x61,
+    0x73, 0x65, 0x74, 0x2e, 0x77, 0x65, 0x62, 0x75, 0x69, 0x5f,
+    0x63, 0x6c, 0x69, 0x63, 0x6b, 0x5f, 0x69, 0x73, 0x5f, 0x73,
+    0x65, 0x74, 0x26, 0x26, 0x28, 0x65, 0x2e, 0x64, 0x61, 0x74,
+    0x61, 0x73, 0x65, 0x74, 0x2e, 0x77, 0x65, 0x62, 0x75, 0x69,
+    0x5f, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x5f, 0x69, 0x73, 0x5f,
+    0x73, 0x65, 0x74, 0x3d, 0x22, 0x74, 0x72, 0x75, 0x65, 0x22,
+    0x2c, 0x65, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e,
+    0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28,
+    0x22, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x22, 0x2c, 0x28, 0x29,
+    0x3d, 0x3e, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x73, 0x65,
+    0x6e, 0x64, 0x43, 0x6c, 0x69, 0x63, 0x6b, 0x28, 0x65, 0x2e,
+    0x69, 0x64, 0x29, 0x29, 0x29, 0x7d, 0x29, 0x7d, 0x61, 0x73,
+    0x79, 0x6e, 0x63, 0x23, 0x73, 0x65, 0x6e, 0x64, 0x44, 0x61,
+    0x74, 0x61, 0x28, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x29,
+    0x7b, 0x69, 0x66, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
+    0x50, 0x69, 0x6e, 0x67, 0x3d, 0x21, 0x31, 0x2c, 0x21, 0x28,
+    0x21, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x49,
+    0x73, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65, 0x64,
+    0x28, 0x29, 0x7c, 0x7c, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x3d, 0x3d, 0x3d, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x30, 0x29,
+    0x26, 0x26, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x73,
+    0x65, 0x6e, 0x64, 0x51, 0x75, 0x65, 0x75, 0x65, 0x2e, 0x70,
+    0x75, 0x73, 0x68, 0x28, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x29, 0x2c, 0x21, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x69,
+    0x73, 0x53, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x29, 0x29,
+    0x7b, 0x66, 0x6f, 0x72, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x23, 0x69, 0x73, 0x53, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67,
+    0x3d, 0x21, 0x30, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
+    0x73, 0x65, 0x6e, 0x64, 0x51, 0x75, 0x65, 0x75, 0x65, 0x2e,
+    0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3e, 0x30, 0x3b, 0x29,
+    0x7b, 0x6c, 0x65, 0x74, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65,
+    0x6e, 0x74, 0x50, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x3d, 0x74,
     0x68, 0x69, 0x73, 0x2e, 0x23, 0x73, 0x65, 0x6e, 0x64, 0x51,
-    0x75, 0x65, 0x75, 0x65, 0x2e, 0x70, 0x75, 0x73, 0x68, 0x28,
-    0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x29, 0x2c, 0x21, 0x74,
-    0x68, 0x69, 0x73, 0x2e, 0x23, 0x69, 0x73, 0x53, 0x65, 0x6e,
-    0x64, 0x69, 0x6e, 0x67, 0x29, 0x29, 0x7b, 0x66, 0x6f, 0x72,
-    0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x69, 0x73, 0x53,
-    0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x3d, 0x21, 0x30, 0x3b,
-    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x73, 0x65, 0x6e, 0x64,
-    0x51, 0x75, 0x65, 0x75, 0x65, 0x2e, 0x6c, 0x65, 0x6e, 0x67,
-    0x74, 0x68, 0x3e, 0x30, 0x3b, 0x29, 0x7b, 0x6c, 0x65, 0x74,
-    0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x50, 0x61,
-    0x63, 0x6b, 0x65, 0x74, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e,
-    0x23, 0x73, 0x65, 0x6e, 0x64, 0x51, 0x75, 0x65, 0x75, 0x65,
-    0x2e, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x29, 0x3b, 0x69,
-    0x66, 0x28, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x50,
-    0x61, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x6c, 0x65, 0x6e, 0x67,
-    0x74, 0x68, 0x3c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x4d,
-    0x55, 0x4c, 0x54, 0x49, 0x5f, 0x43, 0x48, 0x55, 0x4e, 0x4b,
-    0x5f, 0x53, 0x49, 0x5a, 0x45, 0x29, 0x74, 0x68, 0x69, 0x73,
-    0x2e, 0x23, 0x77, 0x73, 0x2e, 0x73, 0x65, 0x6e, 0x64, 0x28,
-    0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x50, 0x61, 0x63,
-    0x6b, 0x65, 0x74, 0x2e, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
-    0x29, 0x3b, 0x65, 0x6c, 0x73, 0x65, 0x7b, 0x6c, 0x65, 0x74,
-    0x20, 0x70, 0x72, 0x65, 0x5f, 0x70, 0x61, 0x63, 0x6b, 0x65,
-    0x74, 0x3d, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72,
-    0x61, 0x79, 0x2e, 0x6f, 0x66, 0x28, 0x74, 0x68, 0x69, 0x73,
-    0x2e, 0x23, 0x57, 0x45, 0x42, 0x55, 0x49, 0x5f, 0x53, 0x49,
-    0x47, 0x4e, 0x41, 0x54, 0x55, 0x52, 0x45, 0x2c, 0x30, 0x2c,
-    0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2c,
-    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x43, 0x4d, 0x44, 0x5f,
-    0x4d, 0x55, 0x4c, 0x54, 0x49, 0x2c, 0x2e, 0x2e, 0x2e, 0x6e,
-    0x65, 0x77, 0x20, 0x54, 0x65, 0x78, 0x74, 0x45, 0x6e, 0x63,
-    0x6f, 0x64, 0x65, 0x72, 0x28, 0x29, 0x2e, 0x65, 0x6e, 0x63,
-    0x6f, 0x64, 0x65, 0x28, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
-    0x74, 0x50, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x6c, 0x65,
-    0x6e, 0x67, 0x74, 0x68, 0x2e, 0x74, 0x6f, 0x53, 0x74, 0x72,
-    0x69, 0x6e, 0x67, 0x28, 0x29, 0x29, 0x2c, 0x30, 0x29, 0x3b,
-    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x2e, 0x73,
-    0x65, 0x6e, 0x64, 0x28, 0x70, 0x72, 0x65, 0x5f, 0x70, 0x61,
-    0x63, 0x6b, 0x65, 0x74, 0x2e, 0x62, 0x75, 0x66, 0x66, 0x65,
-    0x72, 0x29, 0x3b, 0x6c, 0x65, 0x74, 0x20, 0x6f, 0x66, 0x66,
-    0x73, 0x65, 0x74, 0x3d, 0x30, 0x2c, 0x73, 0x65, 0x6e, 0x64,
-    0x43, 0x68, 0x75, 0x6e, 0x6b, 0x3d, 0x61, 0x73, 0x79, 0x6e,
-    0x63, 0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x69, 0x66, 0x28, 0x6f,
-    0x66, 0x66, 0x73, 0x65, 0x74, 0x3c, 0x63, 0x75, 0x72, 0x72,
+    0x75, 0x65, 0x75, 0x65, 0x2e, 0x73, 0x68, 0x69, 0x66, 0x74,
+    0x28, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x63, 0x75, 0x72, 0x72,
     0x65, 0x6e, 0x74, 0x50, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x2e,
-    0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x29, 0x7b, 0x6c, 0x65,
-    0x74, 0x20, 0x63, 0x68, 0x75, 0x6e, 0x6b, 0x53, 0x69, 0x7a,
-    0x65, 0x3d, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x6d, 0x69, 0x6e,
-    0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x4d, 0x55, 0x4c,
-    0x54, 0x49, 0x5f, 0x43, 0x48, 0x55, 0x4e, 0x4b, 0x5f, 0x53,
-    0x49, 0x5a, 0x45, 0x2c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
-    0x74, 0x50, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x6c, 0x65,
-    0x6e, 0x67, 0x74, 0x68, 0x2d, 0x6f, 0x66, 0x66, 0x73, 0x65,
-    0x74, 0x29, 0x2c, 0x63, 0x68, 0x75, 0x6e, 0x6b, 0x3d, 0x63,
-    0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x50, 0x61, 0x63, 0x6b,
-    0x65, 0x74, 0x2e, 0x73, 0x75, 0x62, 0x61, 0x72, 0x72, 0x61,
-    0x79, 0x28, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x2c, 0x6f,
-    0x66, 0x66, 0x73, 0x65, 0x74, 0x2b, 0x63, 0x68, 0x75, 0x6e,
-    0x6b, 0x53, 0x69, 0x7a, 0x65, 0x29, 0x3b, 0x74, 0x68, 0x69,
-    0x73, 0x2e, 0x23, 0x77, 0x73, 0x2e, 0x73, 0x65, 0x6e, 0x64,
-    0x28, 0x63, 0x68, 0x75, 0x6e, 0x6b, 0x29, 0x2c, 0x6f, 0x66,
-    0x66, 0x73, 0x65, 0x74, 0x2b, 0x3d, 0x63, 0x68, 0x75, 0x6e,
-    0x6b, 0x53, 0x69, 0x7a, 0x65, 0x2c, 0x61, 0x77, 0x61, 0x69,
-    0x74, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x43, 0x68, 0x75, 0x6e,
-    0x6b, 0x28, 0x29, 0x7d, 0x7d, 0x3b, 0x61, 0x77, 0x61, 0x69,
-    0x74, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x43, 0x68, 0x75, 0x6e,
-    0x6b, 0x28, 0x29, 0x7d, 0x7d, 0x74, 0x68, 0x69, 0x73, 0x2e,
-    0x23, 0x69, 0x73, 0x53, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67,
-    0x3d, 0x21, 0x31, 0x7d, 0x7d, 0x23, 0x73, 0x65, 0x6e, 0x64,
-    0x43, 0x6c, 0x69, 0x63, 0x6b, 0x28, 0x65, 0x6c, 0x65, 0x6d,
-    0x29, 0x7b, 0x69, 0x66, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e,
-    0x23, 0x77, 0x73, 0x49, 0x73, 0x43, 0x6f, 0x6e, 0x6e, 0x65,
-    0x63, 0x74, 0x65, 0x64, 0x28, 0x29, 0x29, 0x7b, 0x6c, 0x65,
-    0x74, 0x20, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x3d, 0x65,
-    0x6c, 0x65, 0x6d, 0x21, 0x3d, 0x3d, 0x22, 0x22, 0x3f, 0x55,
-    0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x2e,
-    0x6f, 0x66, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x57,
-    0x45, 0x42, 0x55, 0x49, 0x5f, 0x53, 0x49, 0x47, 0x4e, 0x41,
-    0x54, 0x55, 0x52, 0x45, 0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x30,
-    0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x74, 0x68, 0x69,
-    0x73, 0x2e, 0x23, 0x43, 0x4d, 0x44, 0x5f, 0x43, 0x4c, 0x49,
-    0x43, 0x4b, 0x2c, 0x2e, 0x2e, 0x2e, 0x6e, 0x65, 0x77, 0x20,
-    0x54, 0x65, 0x78, 0x74, 0x45, 0x6e, 0x63, 0x6f, 0x64, 0x65,
-    0x72, 0x28, 0x29, 0x2e, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65,
-    0x28, 0x65, 0x6c, 0x65, 0x6d, 0x29, 0x2c, 0x30, 0x29, 0x3a,
-    0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79,
-    0x2e, 0x6f, 0x66, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
-    0x57, 0x45, 0x42, 0x55, 0x49, 0x5f, 0x53, 0x49, 0x47, 0x4e,
-    0x41, 0x54, 0x55, 0x52, 0x45, 0x2c, 0x30, 0x2c, 0x30, 0x2c,
-    0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x74, 0x68,
-    0x69, 0x73, 0x2e, 0x23, 0x43, 0x4d, 0x44, 0x5f, 0x43, 0x4c,
-    0x49, 0x43, 0x4b, 0x2c, 0x30, 0x29, 0x3b, 0x74, 0x68, 0x69,
-    0x73, 0x2e, 0x23, 0x61, 0x64, 0x64, 0x54, 0x6f, 0x6b, 0x65,
-    0x6e, 0x28, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x2c, 0x74,
-    0x68, 0x69, 0x73, 0x2e, 0x23, 0x74, 0x6f, 0x6b, 0x65, 0x6e,
-    0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x50, 0x52, 0x4f,
-    0x54, 0x4f, 0x43, 0x4f, 0x4c, 0x5f, 0x54, 0x4f, 0x4b, 0x45,
-    0x4e, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x73,
-    0x65, 0x6e, 0x64, 0x44, 0x61, 0x74, 0x61, 0x28, 0x70, 0x61,
-    0x63, 0x6b, 0x65, 0x74, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73,
-    0x2e, 0x23, 0x6c, 0x6f, 0x67, 0x26, 0x26, 0x63, 0x6f, 0x6e,
-    0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x60,
-    0x57, 0x65, 0x62, 0x55, 0x49, 0x20, 0x2d, 0x3e, 0x20, 0x53,
-    0x65, 0x6e, 0x64, 0x20, 0x43, 0x6c, 0x69, 0x63, 0x6b, 0x20,
-    0x5b, 0x24, 0x7b, 0x65, 0x6c, 0x65, 0x6d, 0x7d, 0x5d, 0x60,
-    0x29, 0x7d, 0x7d, 0x23, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x54,
-    0x6f, 0x6b, 0x65, 0x6e, 0x28, 0x29, 0x7b, 0x69, 0x66, 0x28,
-    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x49, 0x73,
-    0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65, 0x64, 0x28,
-    0x29, 0x29, 0x7b, 0x6c, 0x65, 0x74, 0x20, 0x70, 0x61, 0x63,
-    0x6b, 0x65, 0x74, 0x3d, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x41,
+    0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3c, 0x74, 0x68, 0x69,
+    0x73, 0x2e, 0x23, 0x4d, 0x55, 0x4c, 0x54, 0x49, 0x5f, 0x43,
+    0x48, 0x55, 0x4e, 0x4b, 0x5f, 0x53, 0x49, 0x5a, 0x45, 0x29,
+    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x2e, 0x73,
+    0x65, 0x6e, 0x64, 0x28, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+    0x74, 0x50, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x29, 0x3b, 0x65, 0x6c, 0x73, 0x65,
+    0x7b, 0x6c, 0x65, 0x74, 0x20, 0x70, 0x72, 0x65, 0x5f, 0x70,
+    0x61, 0x63, 0x6b, 0x65, 0x74, 0x3d, 0x55, 0x69, 0x6e, 0x74,
+    0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x2e, 0x6f, 0x66, 0x28,
+    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x57, 0x45, 0x42, 0x55,
+    0x49, 0x5f, 0x53, 0x49, 0x47, 0x4e, 0x41, 0x54, 0x55, 0x52,
+    0x45, 0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2c,
+    0x30, 0x2c, 0x30, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
+    0x43, 0x4d, 0x44, 0x5f, 0x4d, 0x55, 0x4c, 0x54, 0x49, 0x2c,
+    0x2e, 0x2e, 0x2e, 0x6e, 0x65, 0x77, 0x20, 0x54, 0x65, 0x78,
+    0x74, 0x45, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x28, 0x29,
+    0x2e, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x28, 0x63, 0x75,
+    0x72, 0x72, 0x65, 0x6e, 0x74, 0x50, 0x61, 0x63, 0x6b, 0x65,
+    0x74, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x2e, 0x74,
+    0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x29, 0x29,
+    0x2c, 0x30, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
+    0x77, 0x73, 0x2e, 0x73, 0x65, 0x6e, 0x64, 0x28, 0x70, 0x72,
+    0x65, 0x5f, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x62,
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x29, 0x3b, 0x6c, 0x65, 0x74,
+    0x20, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3d, 0x30, 0x2c,
+    0x73, 0x65, 0x6e, 0x64, 0x43, 0x68, 0x75, 0x6e, 0x6b, 0x3d,
+    0x61, 0x73, 0x79, 0x6e, 0x63, 0x28, 0x29, 0x3d, 0x3e, 0x7b,
+    0x69, 0x66, 0x28, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3c,
+    0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x50, 0x61, 0x63,
+    0x6b, 0x65, 0x74, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68,
+    0x29, 0x7b, 0x6c, 0x65, 0x74, 0x20, 0x63, 0x68, 0x75, 0x6e,
+    0x6b, 0x53, 0x69, 0x7a, 0x65, 0x3d, 0x4d, 0x61, 0x74, 0x68,
+    0x2e, 0x6d, 0x69, 0x6e, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x23, 0x4d, 0x55, 0x4c, 0x54, 0x49, 0x5f, 0x43, 0x48, 0x55,
+    0x4e, 0x4b, 0x5f, 0x53, 0x49, 0x5a, 0x45, 0x2c, 0x63, 0x75,
+    0x72, 0x72, 0x65, 0x6e, 0x74, 0x50, 0x61, 0x63, 0x6b, 0x65,
+    0x74, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x2d, 0x6f,
+    0x66, 0x66, 0x73, 0x65, 0x74, 0x29, 0x2c, 0x63, 0x68, 0x75,
+    0x6e, 0x6b, 0x3d, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74,
+    0x50, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x73, 0x75, 0x62,
+    0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x6f, 0x66, 0x66, 0x73,
+    0x65, 0x74, 0x2c, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x2b,
+    0x63, 0x68, 0x75, 0x6e, 0x6b, 0x53, 0x69, 0x7a, 0x65, 0x29,
+    0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x2e,
+    0x73, 0x65, 0x6e, 0x64, 0x28, 0x63, 0x68, 0x75, 0x6e, 0x6b,
+    0x29, 0x2c, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x2b, 0x3d,
+    0x63, 0x68, 0x75, 0x6e, 0x6b, 0x53, 0x69, 0x7a, 0x65, 0x2c,
+    0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x73, 0x65, 0x6e, 0x64,
+    0x43, 0x68, 0x75, 0x6e, 0x6b, 0x28, 0x29, 0x7d, 0x7d, 0x3b,
+    0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x73, 0x65, 0x6e, 0x64,
+    0x43, 0x68, 0x75, 0x6e, 0x6b, 0x28, 0x29, 0x7d, 0x7d, 0x74,
+    0x68, 0x69, 0x73, 0x2e, 0x23, 0x69, 0x73, 0x53, 0x65, 0x6e,
+    0x64, 0x69, 0x6e, 0x67, 0x3d, 0x21, 0x31, 0x7d, 0x7d, 0x23,
+    0x73, 0x65, 0x6e, 0x64, 0x43, 0x6c, 0x69, 0x63, 0x6b, 0x28,
+    0x65, 0x6c, 0x65, 0x6d, 0x29, 0x7b, 0x69, 0x66, 0x28, 0x74,
+    0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x49, 0x73, 0x43,
+    0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65, 0x64, 0x28, 0x29,
+    0x29, 0x7b, 0x6c, 0x65, 0x74, 0x20, 0x70, 0x61, 0x63, 0x6b,
+    0x65, 0x74, 0x3d, 0x65, 0x6c, 0x65, 0x6d, 0x21, 0x3d, 0x3d,
+    0x22, 0x22, 0x3f, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72,
+    0x72, 0x61, 0x79, 0x2e, 0x6f, 0x66, 0x28, 0x74, 0x68, 0x69,
+    0x73, 0x2e, 0x23, 0x57, 0x45, 0x42, 0x55, 0x49, 0x5f, 0x53,
+    0x49, 0x47, 0x4e, 0x41, 0x54, 0x55, 0x52, 0x45, 0x2c, 0x30,
+    0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x30,
+    0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x43, 0x4d, 0x44,
+    0x5f, 0x43, 0x4c, 0x49, 0x43, 0x4b, 0x2c, 0x2e, 0x2e, 0x2e,
+    0x6e, 0x65, 0x77, 0x20, 0x54, 0x65, 0x78, 0x74, 0x45, 0x6e,
+    0x63, 0x6f, 0x64, 0x65, 0x72, 0x28, 0x29, 0x2e, 0x65, 0x6e,
+    0x63, 0x6f, 0x64, 0x65, 0x28, 0x65, 0x6c, 0x65, 0x6d, 0x29,
+    0x2c, 0x30, 0x29, 0x3a, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x41,
     0x72, 0x72, 0x61, 0x79, 0x2e, 0x6f, 0x66, 0x28, 0x74, 0x68,
     0x69, 0x73, 0x2e, 0x23, 0x57, 0x45, 0x42, 0x55, 0x49, 0x5f,
     0x53, 0x49, 0x47, 0x4e, 0x41, 0x54, 0x55, 0x52, 0x45, 0x2c,
     0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2c,
     0x30, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x43, 0x4d,
-    0x44, 0x5f, 0x43, 0x48, 0x45, 0x43, 0x4b, 0x5f, 0x54, 0x4b,
-    0x2c, 0x30, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
+    0x44, 0x5f, 0x43, 0x4c, 0x49, 0x43, 0x4b, 0x2c, 0x30, 0x29,
+    0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x61, 0x64, 0x64,
+    0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x28, 0x70, 0x61, 0x63, 0x6b,
+    0x65, 0x74, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x74,
+    0x6f, 0x6b, 0x65, 0x6e, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x23, 0x50, 0x52, 0x4f, 0x54, 0x4f, 0x43, 0x4f, 0x4c, 0x5f,
+    0x54, 0x4f, 0x4b, 0x45, 0x4e, 0x29, 0x2c, 0x74, 0x68, 0x69,
+    0x73, 0x2e, 0x23, 0x73, 0x65, 0x6e, 0x64, 0x44, 0x61, 0x74,
+    0x61, 0x28, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x29, 0x2c,
+    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f, 0x67, 0x26,
+    0x26, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c,
+    0x6f, 0x67, 0x28, 0x60, 0x57, 0x65, 0x62, 0x55, 0x49, 0x20,
+    0x2d, 0x3e, 0x20, 0x53, 0x65, 0x6e, 0x64, 0x20, 0x43, 0x6c,
+    0x69, 0x63, 0x6b, 0x20, 0x5b, 0x24, 0x7b, 0x65, 0x6c, 0x65,
+    0x6d, 0x7d, 0x5d, 0x60, 0x29, 0x7d, 0x7d, 0x23, 0x63, 0x68,
+    0x65, 0x63, 0x6b, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x28, 0x29,
+    0x7b, 0x69, 0x66, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
+    0x77, 0x73, 0x49, 0x73, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63,
+    0x74, 0x65, 0x64, 0x28, 0x29, 0x29, 0x7b, 0x6c, 0x65, 0x74,
+    0x20, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x3d, 0x55, 0x69,
+    0x6e, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x2e, 0x6f,
+    0x66, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x57, 0x45,
+    0x42, 0x55, 0x49, 0x5f, 0x53, 0x49, 0x47, 0x4e, 0x41, 0x54,
+    0x55, 0x52, 0x45, 0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2c,
+    0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x74, 0x68, 0x69, 0x73,
+    0x2e, 0x23, 0x43, 0x4d, 0x44, 0x5f, 0x43, 0x48, 0x45, 0x43,
+    0x4b, 0x5f, 0x54, 0x4b, 0x2c, 0x30, 0x29, 0x3b, 0x74, 0x68,
+    0x69, 0x73, 0x2e, 0x23, 0x61, 0x64, 0x64, 0x54, 0x6f, 0x6b,
+    0x65, 0x6e, 0x28, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x2c,
+    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x74, 0x6f, 0x6b, 0x65,
+    0x6e, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x50, 0x52,
+    0x4f, 0x54, 0x4f, 0x43, 0x4f, 0x4c, 0x5f, 0x54, 0x4f, 0x4b,
+    0x45, 0x4e, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
+    0x73, 0x65, 0x6e, 0x64, 0x44, 0x61, 0x74, 0x61, 0x28, 0x70,
+    0x61, 0x63, 0x6b, 0x65, 0x74, 0x29, 0x2c, 0x74, 0x68, 0x69,
+    0x73, 0x2e, 0x23, 0x6c, 0x6f, 0x67, 0x26, 0x26, 0x63, 0x6f,
+    0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x28,
+    0x60, 0x57, 0x65, 0x62, 0x55, 0x49, 0x20, 0x2d, 0x3e, 0x20,
+    0x53, 0x65, 0x6e, 0x64, 0x20, 0x54, 0x6f, 0x6b, 0x65, 0x6e,
+    0x20, 0x5b, 0x30, 0x78, 0x24, 0x7b, 0x74, 0x68, 0x69, 0x73,
+    0x2e, 0x23, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x2e, 0x74, 0x6f,
+    0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x31, 0x36, 0x29,
+    0x2e, 0x70, 0x61, 0x64, 0x53, 0x74, 0x61, 0x72, 0x74, 0x28,
+    0x38, 0x2c, 0x22, 0x30, 0x22, 0x29, 0x7d, 0x5d, 0x60, 0x29,
+    0x7d, 0x7d, 0x23, 0x73, 0x65, 0x6e, 0x64, 0x45, 0x76, 0x65,
+    0x6e, 0x74, 0x4e, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x69,
+    0x6f, 0x6e, 0x28, 0x75, 0x72, 0x6c, 0x29, 0x7b, 0x69, 0x66,
+    0x28, 0x75, 0x72, 0x6c, 0x21, 0x3d, 0x3d, 0x22, 0x22, 0x26,
+    0x26, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x49,
+    0x73, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65, 0x64,
+    0x28, 0x29, 0x29, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
+    0x6c, 0x6f, 0x67, 0x26, 0x26, 0x63, 0x6f, 0x6e, 0x73, 0x6f,
+    0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x60, 0x57, 0x65,
+    0x62, 0x55, 0x49, 0x20, 0x2d, 0x3e, 0x20, 0x53, 0x65, 0x6e,
+    0x64, 0x20, 0x4e, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x69,
+    0x6f, 0x6e, 0x20, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x20, 0x5b,
+    0x24, 0x7b, 0x75, 0x72, 0x6c, 0x7d, 0x5d, 0x60, 0x29, 0x3b,
+    0x6c, 0x65, 0x74, 0x20, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x3d, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61,
+    0x79, 0x2e, 0x6f, 0x66, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x23, 0x57, 0x45, 0x42, 0x55, 0x49, 0x5f, 0x53, 0x49, 0x47,
+    0x4e, 0x41, 0x54, 0x55, 0x52, 0x45, 0x2c, 0x30, 0x2c, 0x30,
+    0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x74,
+    0x68, 0x69, 0x73, 0x2e, 0x23, 0x43, 0x4d, 0x44, 0x5f, 0x4e,
+    0x41, 0x56, 0x49, 0x47, 0x41, 0x54, 0x49, 0x4f, 0x4e, 0x2c,
+    0x2e, 0x2e, 0x2e, 0x6e, 0x65, 0x77, 0x20, 0x54, 0x65, 0x78,
+    0x74, 0x45, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x28, 0x29,
+    0x2e, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x28, 0x75, 0x72,
+    0x6c, 0x29, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
     0x61, 0x64, 0x64, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x28, 0x70,
     0x61, 0x63, 0x6b, 0x65, 0x74, 0x2c, 0x74, 0x68, 0x69, 0x73,
     0x2e, 0x23, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x2c, 0x74, 0x68,
@@ -826,211 +974,508 @@ unsigned char webinix_javascript_bridge[] = {
     0x4f, 0x4c, 0x5f, 0x54, 0x4f, 0x4b, 0x45, 0x4e, 0x29, 0x2c,
     0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x73, 0x65, 0x6e, 0x64,
     0x44, 0x61, 0x74, 0x61, 0x28, 0x70, 0x61, 0x63, 0x6b, 0x65,
-    0x74, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x6c,
-    0x6f, 0x67, 0x26, 0x26, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c,
-    0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x60, 0x57, 0x65, 0x62,
-    0x55, 0x49, 0x20, 0x2d, 0x3e, 0x20, 0x53, 0x65, 0x6e, 0x64,
-    0x20, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x20, 0x5b, 0x30, 0x78,
-    0x24, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x74, 0x6f,
-    0x6b, 0x65, 0x6e, 0x2e, 0x74, 0x6f, 0x53, 0x74, 0x72, 0x69,
-    0x6e, 0x67, 0x28, 0x31, 0x36, 0x29, 0x2e, 0x70, 0x61, 0x64,
-    0x53, 0x74, 0x61, 0x72, 0x74, 0x28, 0x38, 0x2c, 0x22, 0x30,
-    0x22, 0x29, 0x7d, 0x5d, 0x60, 0x29, 0x7d, 0x7d, 0x23, 0x73,
-    0x65, 0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4e, 0x61,
-    0x76, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x75,
-    0x72, 0x6c, 0x29, 0x7b, 0x69, 0x66, 0x28, 0x75, 0x72, 0x6c,
-    0x21, 0x3d, 0x3d, 0x22, 0x22, 0x26, 0x26, 0x74, 0x68, 0x69,
-    0x73, 0x2e, 0x23, 0x77, 0x73, 0x49, 0x73, 0x43, 0x6f, 0x6e,
-    0x6e, 0x65, 0x63, 0x74, 0x65, 0x64, 0x28, 0x29, 0x29, 0x7b,
-    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f, 0x67, 0x26,
-    0x26, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c,
-    0x6f, 0x67, 0x28, 0x60, 0x57, 0x65, 0x62, 0x55, 0x49, 0x20,
-    0x2d, 0x3e, 0x20, 0x53, 0x65, 0x6e, 0x64, 0x20, 0x4e, 0x61,
-    0x76, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x45,
-    0x76, 0x65, 0x6e, 0x74, 0x20, 0x5b, 0x24, 0x7b, 0x75, 0x72,
-    0x6c, 0x7d, 0x5d, 0x60, 0x29, 0x3b, 0x6c, 0x65, 0x74, 0x20,
-    0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x3d, 0x55, 0x69, 0x6e,
-    0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x2e, 0x6f, 0x66,
-    0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x57, 0x45, 0x42,
-    0x55, 0x49, 0x5f, 0x53, 0x49, 0x47, 0x4e, 0x41, 0x54, 0x55,
-    0x52, 0x45, 0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x30,
-    0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e,
-    0x23, 0x43, 0x4d, 0x44, 0x5f, 0x4e, 0x41, 0x56, 0x49, 0x47,
-    0x41, 0x54, 0x49, 0x4f, 0x4e, 0x2c, 0x2e, 0x2e, 0x2e, 0x6e,
-    0x65, 0x77, 0x20, 0x54, 0x65, 0x78, 0x74, 0x45, 0x6e, 0x63,
-    0x6f, 0x64, 0x65, 0x72, 0x28, 0x29, 0x2e, 0x65, 0x6e, 0x63,
-    0x6f, 0x64, 0x65, 0x28, 0x75, 0x72, 0x6c, 0x29, 0x29, 0x3b,
-    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x61, 0x64, 0x64, 0x54,
-    0x6f, 0x6b, 0x65, 0x6e, 0x28, 0x70, 0x61, 0x63, 0x6b, 0x65,
-    0x74, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x74, 0x6f,
-    0x6b, 0x65, 0x6e, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
-    0x50, 0x52, 0x4f, 0x54, 0x4f, 0x43, 0x4f, 0x4c, 0x5f, 0x54,
-    0x4f, 0x4b, 0x45, 0x4e, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73,
-    0x2e, 0x23, 0x73, 0x65, 0x6e, 0x64, 0x44, 0x61, 0x74, 0x61,
-    0x28, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x29, 0x7d, 0x7d,
-    0x23, 0x73, 0x65, 0x6e, 0x64, 0x44, 0x72, 0x61, 0x67, 0x28,
-    0x78, 0x2c, 0x79, 0x29, 0x7b, 0x69, 0x66, 0x28, 0x74, 0x68,
-    0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x49, 0x73, 0x43, 0x6f,
-    0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65, 0x64, 0x28, 0x29, 0x29,
-    0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f, 0x67,
-    0x26, 0x26, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e,
-    0x6c, 0x6f, 0x67, 0x28, 0x60, 0x57, 0x65, 0x62, 0x55, 0x49,
-    0x20, 0x2d, 0x3e, 0x20, 0x53, 0x65, 0x6e, 0x64, 0x20, 0x44,
-    0x72, 0x61, 0x67, 0x20, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x20,
-    0x5b, 0x24, 0x7b, 0x78, 0x7d, 0x2c, 0x20, 0x24, 0x7b, 0x79,
-    0x7d, 0x5d, 0x60, 0x29, 0x3b, 0x6c, 0x65, 0x74, 0x20, 0x70,
-    0x61, 0x63, 0x6b, 0x65, 0x74, 0x3d, 0x55, 0x69, 0x6e, 0x74,
-    0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x2e, 0x6f, 0x66, 0x28,
-    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x57, 0x45, 0x42, 0x55,
-    0x49, 0x5f, 0x53, 0x49, 0x47, 0x4e, 0x41, 0x54, 0x55, 0x52,
-    0x45, 0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2c,
-    0x30, 0x2c, 0x30, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
-    0x43, 0x4d, 0x44, 0x5f, 0x57, 0x49, 0x4e, 0x44, 0x4f, 0x57,
-    0x5f, 0x44, 0x52, 0x41, 0x47, 0x2c, 0x2e, 0x2e, 0x2e, 0x6e,
+    0x74, 0x29, 0x7d, 0x7d, 0x23, 0x73, 0x65, 0x6e, 0x64, 0x44,
+    0x72, 0x61, 0x67, 0x28, 0x78, 0x2c, 0x79, 0x29, 0x7b, 0x69,
+    0x66, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73,
+    0x49, 0x73, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65,
+    0x64, 0x28, 0x29, 0x29, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x23, 0x6c, 0x6f, 0x67, 0x26, 0x26, 0x63, 0x6f, 0x6e, 0x73,
+    0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x60, 0x57,
+    0x65, 0x62, 0x55, 0x49, 0x20, 0x2d, 0x3e, 0x20, 0x53, 0x65,
+    0x6e, 0x64, 0x20, 0x44, 0x72, 0x61, 0x67, 0x20, 0x45, 0x76,
+    0x65, 0x6e, 0x74, 0x20, 0x5b, 0x24, 0x7b, 0x78, 0x7d, 0x2c,
+    0x20, 0x24, 0x7b, 0x79, 0x7d, 0x5d, 0x60, 0x29, 0x3b, 0x6c,
+    0x65, 0x74, 0x20, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x3d,
+    0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79,
+    0x2e, 0x6f, 0x66, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
+    0x57, 0x45, 0x42, 0x55, 0x49, 0x5f, 0x53, 0x49, 0x47, 0x4e,
+    0x41, 0x54, 0x55, 0x52, 0x45, 0x2c, 0x30, 0x2c, 0x30, 0x2c,
+    0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x74, 0x68,
+    0x69, 0x73, 0x2e, 0x23, 0x43, 0x4d, 0x44, 0x5f, 0x57, 0x49,
+    0x4e, 0x44, 0x4f, 0x57, 0x5f, 0x44, 0x52, 0x41, 0x47, 0x2c,
+    0x2e, 0x2e, 0x2e, 0x6e, 0x65, 0x77, 0x20, 0x55, 0x69, 0x6e,
+    0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x6e, 0x65,
+    0x77, 0x20, 0x49, 0x6e, 0x74, 0x33, 0x32, 0x41, 0x72, 0x72,
+    0x61, 0x79, 0x28, 0x5b, 0x78, 0x5d, 0x29, 0x2e, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x29, 0x2c, 0x2e, 0x2e, 0x2e, 0x6e,
     0x65, 0x77, 0x20, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72,
     0x72, 0x61, 0x79, 0x28, 0x6e, 0x65, 0x77, 0x20, 0x49, 0x6e,
     0x74, 0x33, 0x32, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x5b,
-    0x78, 0x5d, 0x29, 0x2e, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
-    0x29, 0x2c, 0x2e, 0x2e, 0x2e, 0x6e, 0x65, 0x77, 0x20, 0x55,
-    0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28,
-    0x6e, 0x65, 0x77, 0x20, 0x49, 0x6e, 0x74, 0x33, 0x32, 0x41,
-    0x72, 0x72, 0x61, 0x79, 0x28, 0x5b, 0x79, 0x5d, 0x29, 0x2e,
-    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x29, 0x29, 0x3b, 0x74,
-    0x68, 0x69, 0x73, 0x2e, 0x23, 0x61, 0x64, 0x64, 0x54, 0x6f,
-    0x6b, 0x65, 0x6e, 0x28, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
-    0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x74, 0x6f, 0x6b,
-    0x65, 0x6e, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x50,
-    0x52, 0x4f, 0x54, 0x4f, 0x43, 0x4f, 0x4c, 0x5f, 0x54, 0x4f,
-    0x4b, 0x45, 0x4e, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e,
-    0x23, 0x73, 0x65, 0x6e, 0x64, 0x44, 0x61, 0x74, 0x61, 0x28,
-    0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x29, 0x7d, 0x7d, 0x23,
-    0x63, 0x6c, 0x6f, 0x73, 0x65, 0x57, 0x69, 0x6e, 0x64, 0x6f,
-    0x77, 0x54, 0x69, 0x6d, 0x65, 0x72, 0x28, 0x29, 0x7b, 0x73,
-    0x65, 0x74, 0x54, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x28,
-    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x29,
-    0x7b, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x54, 0x68, 0x69,
-    0x73, 0x2e, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x28, 0x29, 0x7d,
-    0x2c, 0x31, 0x65, 0x33, 0x29, 0x7d, 0x23, 0x75, 0x70, 0x64,
-    0x61, 0x74, 0x65, 0x42, 0x69, 0x6e, 0x64, 0x73, 0x4c, 0x69,
-    0x73, 0x74, 0x28, 0x29, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e,
-    0x23, 0x62, 0x69, 0x6e, 0x64, 0x73, 0x4c, 0x69, 0x73, 0x74,
-    0x2e, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x73, 0x28,
-    0x22, 0x22, 0x29, 0x26, 0x26, 0x28, 0x74, 0x68, 0x69, 0x73,
-    0x2e, 0x23, 0x41, 0x6c, 0x6c, 0x45, 0x76, 0x65, 0x6e, 0x74,
-    0x73, 0x3d, 0x21, 0x30, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e,
-    0x23, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x4e, 0x61, 0x76, 0x69,
-    0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x21, 0x31, 0x29,
-    0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x67, 0x65, 0x6e,
-    0x65, 0x72, 0x61, 0x74, 0x65, 0x43, 0x61, 0x6c, 0x6c, 0x4f,
-    0x62, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x28, 0x29, 0x2c, 0x74,
-    0x68, 0x69, 0x73, 0x2e, 0x23, 0x63, 0x6c, 0x69, 0x63, 0x6b,
-    0x73, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28,
-    0x29, 0x7d, 0x23, 0x74, 0x6f, 0x55, 0x69, 0x6e, 0x74, 0x31,
-    0x36, 0x28, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x29, 0x7b, 0x72,
-    0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75,
-    0x65, 0x26, 0x36, 0x35, 0x35, 0x33, 0x35, 0x7d, 0x23, 0x67,
-    0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x43, 0x61, 0x6c,
-    0x6c, 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x28, 0x29,
-    0x7b, 0x66, 0x6f, 0x72, 0x28, 0x6c, 0x65, 0x74, 0x20, 0x62,
-    0x69, 0x6e, 0x64, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x69,
-    0x73, 0x2e, 0x23, 0x62, 0x69, 0x6e, 0x64, 0x73, 0x4c, 0x69,
-    0x73, 0x74, 0x29, 0x69, 0x66, 0x28, 0x62, 0x69, 0x6e, 0x64,
-    0x2e, 0x74, 0x72, 0x69, 0x6d, 0x28, 0x29, 0x29, 0x7b, 0x6c,
-    0x65, 0x74, 0x20, 0x66, 0x6e, 0x3d, 0x62, 0x69, 0x6e, 0x64,
-    0x3b, 0x66, 0x6e, 0x2e, 0x74, 0x72, 0x69, 0x6d, 0x28, 0x29,
-    0x26, 0x26, 0x66, 0x6e, 0x21, 0x3d, 0x3d, 0x22, 0x5f, 0x5f,
-    0x77, 0x65, 0x62, 0x75, 0x69, 0x5f, 0x63, 0x6f, 0x72, 0x65,
-    0x5f, 0x61, 0x70, 0x69, 0x5f, 0x5f, 0x22, 0x26, 0x26, 0x74,
-    0x79, 0x70, 0x65, 0x6f, 0x66, 0x20, 0x77, 0x69, 0x6e, 0x64,
-    0x6f, 0x77, 0x5b, 0x66, 0x6e, 0x5d, 0x3e, 0x22, 0x75, 0x22,
-    0x26, 0x26, 0x28, 0x74, 0x68, 0x69, 0x73, 0x5b, 0x66, 0x6e,
-    0x5d, 0x3d, 0x28, 0x2e, 0x2e, 0x2e, 0x61, 0x72, 0x67, 0x73,
-    0x29, 0x3d, 0x3e, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x61,
-    0x6c, 0x6c, 0x28, 0x66, 0x6e, 0x2c, 0x2e, 0x2e, 0x2e, 0x61,
-    0x72, 0x67, 0x73, 0x29, 0x2c, 0x77, 0x69, 0x6e, 0x64, 0x6f,
-    0x77, 0x5b, 0x66, 0x6e, 0x5d, 0x3d, 0x28, 0x2e, 0x2e, 0x2e,
+    0x79, 0x5d, 0x29, 0x2e, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+    0x29, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x61,
+    0x64, 0x64, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x28, 0x70, 0x61,
+    0x63, 0x6b, 0x65, 0x74, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x23, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x2c, 0x74, 0x68, 0x69,
+    0x73, 0x2e, 0x23, 0x50, 0x52, 0x4f, 0x54, 0x4f, 0x43, 0x4f,
+    0x4c, 0x5f, 0x54, 0x4f, 0x4b, 0x45, 0x4e, 0x29, 0x2c, 0x74,
+    0x68, 0x69, 0x73, 0x2e, 0x23, 0x73, 0x65, 0x6e, 0x64, 0x44,
+    0x61, 0x74, 0x61, 0x28, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x29, 0x7d, 0x7d, 0x23, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x54, 0x69, 0x6d, 0x65, 0x72,
+    0x28, 0x29, 0x7b, 0x73, 0x65, 0x74, 0x54, 0x69, 0x6d, 0x65,
+    0x6f, 0x75, 0x74, 0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69,
+    0x6f, 0x6e, 0x28, 0x29, 0x7b, 0x67, 0x6c, 0x6f, 0x62, 0x61,
+    0x6c, 0x54, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x6c, 0x6f, 0x73,
+    0x65, 0x28, 0x29, 0x7d, 0x2c, 0x31, 0x65, 0x33, 0x29, 0x7d,
+    0x23, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x42, 0x69, 0x6e,
+    0x64, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x28, 0x29, 0x7b, 0x74,
+    0x68, 0x69, 0x73, 0x2e, 0x23, 0x62, 0x69, 0x6e, 0x64, 0x73,
+    0x4c, 0x69, 0x73, 0x74, 0x2e, 0x69, 0x6e, 0x63, 0x6c, 0x75,
+    0x64, 0x65, 0x73, 0x28, 0x22, 0x22, 0x29, 0x26, 0x26, 0x28,
+    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x41, 0x6c, 0x6c, 0x45,
+    0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x21, 0x30, 0x2c, 0x74,
+    0x68, 0x69, 0x73, 0x2e, 0x23, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
+    0x4e, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x3d, 0x21, 0x31, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x23, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x43,
+    0x61, 0x6c, 0x6c, 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x73,
+    0x28, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x63,
+    0x6c, 0x69, 0x63, 0x6b, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x65,
+    0x6e, 0x65, 0x72, 0x28, 0x29, 0x7d, 0x23, 0x74, 0x6f, 0x55,
+    0x69, 0x6e, 0x74, 0x31, 0x36, 0x28, 0x76, 0x61, 0x6c, 0x75,
+    0x65, 0x29, 0x7b, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20,
+    0x76, 0x61, 0x6c, 0x75, 0x65, 0x26, 0x36, 0x35, 0x35, 0x33,
+    0x35, 0x7d, 0x23, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74,
+    0x65, 0x43, 0x61, 0x6c, 0x6c, 0x4f, 0x62, 0x6a, 0x65, 0x63,
+    0x74, 0x73, 0x28, 0x29, 0x7b, 0x66, 0x6f, 0x72, 0x28, 0x6c,
+    0x65, 0x74, 0x20, 0x62, 0x69, 0x6e, 0x64, 0x20, 0x6f, 0x66,
+    0x20, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x62, 0x69, 0x6e,
+    0x64, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x29, 0x69, 0x66, 0x28,
+    0x62, 0x69, 0x6e, 0x64, 0x2e, 0x74, 0x72, 0x69, 0x6d, 0x28,
+    0x29, 0x29, 0x7b, 0x6c, 0x65, 0x74, 0x20, 0x66, 0x6e, 0x3d,
+    0x62, 0x69, 0x6e, 0x64, 0x3b, 0x66, 0x6e, 0x2e, 0x74, 0x72,
+    0x69, 0x6d, 0x28, 0x29, 0x26, 0x26, 0x66, 0x6e, 0x21, 0x3d,
+    0x3d, 0x22, 0x5f, 0x5f, 0x77, 0x65, 0x62, 0x75, 0x69, 0x5f,
+    0x63, 0x6f, 0x72, 0x65, 0x5f, 0x61, 0x70, 0x69, 0x5f, 0x5f,
+    0x22, 0x26, 0x26, 0x74, 0x79, 0x70, 0x65, 0x6f, 0x66, 0x20,
+    0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5b, 0x66, 0x6e, 0x5d,
+    0x3e, 0x22, 0x75, 0x22, 0x26, 0x26, 0x28, 0x74, 0x68, 0x69,
+    0x73, 0x5b, 0x66, 0x6e, 0x5d, 0x3d, 0x28, 0x2e, 0x2e, 0x2e,
     0x61, 0x72, 0x67, 0x73, 0x29, 0x3d, 0x3e, 0x74, 0x68, 0x69,
     0x73, 0x2e, 0x63, 0x61, 0x6c, 0x6c, 0x28, 0x66, 0x6e, 0x2c,
-    0x2e, 0x2e, 0x2e, 0x61, 0x72, 0x67, 0x73, 0x29, 0x2c, 0x74,
-    0x68, 0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f, 0x67, 0x26, 0x26,
-    0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f,
-    0x67, 0x28, 0x60, 0x57, 0x65, 0x62, 0x55, 0x49, 0x20, 0x2d,
-    0x3e, 0x20, 0x42, 0x69, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20,
-    0x62, 0x61, 0x63, 0x6b, 0x65, 0x6e, 0x64, 0x20, 0x66, 0x75,
-    0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x5b, 0x24, 0x7b,
-    0x66, 0x6e, 0x7d, 0x5d, 0x60, 0x29, 0x29, 0x7d, 0x7d, 0x23,
-    0x63, 0x61, 0x6c, 0x6c, 0x50, 0x72, 0x6f, 0x6d, 0x69, 0x73,
-    0x65, 0x28, 0x66, 0x6e, 0x2c, 0x2e, 0x2e, 0x2e, 0x61, 0x72,
-    0x67, 0x73, 0x29, 0x7b, 0x2d, 0x2d, 0x74, 0x68, 0x69, 0x73,
-    0x2e, 0x23, 0x63, 0x61, 0x6c, 0x6c, 0x50, 0x72, 0x6f, 0x6d,
-    0x69, 0x73, 0x65, 0x49, 0x44, 0x5b, 0x30, 0x5d, 0x3b, 0x6c,
-    0x65, 0x74, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x49, 0x64, 0x3d,
-    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x74, 0x6f, 0x55, 0x69,
-    0x6e, 0x74, 0x31, 0x36, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e,
-    0x23, 0x63, 0x61, 0x6c, 0x6c, 0x50, 0x72, 0x6f, 0x6d, 0x69,
-    0x73, 0x65, 0x49, 0x44, 0x5b, 0x30, 0x5d, 0x29, 0x2c, 0x61,
-    0x72, 0x67, 0x73, 0x4c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x73,
-    0x3d, 0x61, 0x72, 0x67, 0x73, 0x2e, 0x6d, 0x61, 0x70, 0x28,
-    0x61, 0x72, 0x67, 0x3d, 0x3e, 0x74, 0x79, 0x70, 0x65, 0x6f,
-    0x66, 0x20, 0x61, 0x72, 0x67, 0x3d, 0x3d, 0x22, 0x6f, 0x62,
-    0x6a, 0x65, 0x63, 0x74, 0x22, 0x3f, 0x61, 0x72, 0x67, 0x2e,
-    0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3a, 0x6e, 0x65, 0x77,
+    0x2e, 0x2e, 0x2e, 0x61, 0x72, 0x67, 0x73, 0x29, 0x2c, 0x77,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5b, 0x66, 0x6e, 0x5d, 0x3d,
+    0x28, 0x2e, 0x2e, 0x2e, 0x61, 0x72, 0x67, 0x73, 0x29, 0x3d,
+    0x3e, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x61, 0x6c, 0x6c,
+    0x28, 0x66, 0x6e, 0x2c, 0x2e, 0x2e, 0x2e, 0x61, 0x72, 0x67,
+    0x73, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x6c,
+    0x6f, 0x67, 0x26, 0x26, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c,
+    0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x60, 0x57, 0x65, 0x62,
+    0x55, 0x49, 0x20, 0x2d, 0x3e, 0x20, 0x42, 0x69, 0x6e, 0x64,
+    0x69, 0x6e, 0x67, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x65, 0x6e,
+    0x64, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+    0x20, 0x5b, 0x24, 0x7b, 0x66, 0x6e, 0x7d, 0x5d, 0x60, 0x29,
+    0x29, 0x7d, 0x7d, 0x23, 0x63, 0x61, 0x6c, 0x6c, 0x50, 0x72,
+    0x6f, 0x6d, 0x69, 0x73, 0x65, 0x28, 0x66, 0x6e, 0x2c, 0x2e,
+    0x2e, 0x2e, 0x61, 0x72, 0x67, 0x73, 0x29, 0x7b, 0x2d, 0x2d,
+    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x63, 0x61, 0x6c, 0x6c,
+    0x50, 0x72, 0x6f, 0x6d, 0x69, 0x73, 0x65, 0x49, 0x44, 0x5b,
+    0x30, 0x5d, 0x3b, 0x6c, 0x65, 0x74, 0x20, 0x63, 0x61, 0x6c,
+    0x6c, 0x49, 0x64, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
+    0x74, 0x6f, 0x55, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x28, 0x74,
+    0x68, 0x69, 0x73, 0x2e, 0x23, 0x63, 0x61, 0x6c, 0x6c, 0x50,
+    0x72, 0x6f, 0x6d, 0x69, 0x73, 0x65, 0x49, 0x44, 0x5b, 0x30,
+    0x5d, 0x29, 0x2c, 0x61, 0x72, 0x67, 0x73, 0x4c, 0x65, 0x6e,
+    0x67, 0x74, 0x68, 0x73, 0x3d, 0x61, 0x72, 0x67, 0x73, 0x2e,
+    0x6d, 0x61, 0x70, 0x28, 0x61, 0x72, 0x67, 0x3d, 0x3e, 0x74,
+    0x79, 0x70, 0x65, 0x6f, 0x66, 0x20, 0x61, 0x72, 0x67, 0x3d,
+    0x3d, 0x22, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x22, 0x3f,
+    0x61, 0x72, 0x67, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68,
+    0x3a, 0x6e, 0x65, 0x77, 0x20, 0x54, 0x65, 0x78, 0x74, 0x45,
+    0x6e, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x28, 0x29, 0x2e, 0x65,
+    0x6e, 0x63, 0x6f, 0x64, 0x65, 0x28, 0x61, 0x72, 0x67, 0x2e,
+    0x74, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x29,
+    0x29, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x29, 0x2e,
+    0x6a, 0x6f, 0x69, 0x6e, 0x28, 0x22, 0x3b, 0x22, 0x29, 0x2c,
+    0x61, 0x72, 0x67, 0x73, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73,
+    0x3d, 0x6e, 0x65, 0x77, 0x20, 0x55, 0x69, 0x6e, 0x74, 0x38,
+    0x41, 0x72, 0x72, 0x61, 0x79, 0x3b, 0x66, 0x6f, 0x72, 0x28,
+    0x6c, 0x65, 0x74, 0x20, 0x61, 0x72, 0x67, 0x20, 0x6f, 0x66,
+    0x20, 0x61, 0x72, 0x67, 0x73, 0x29, 0x7b, 0x6c, 0x65, 0x74,
+    0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x3b, 0x74, 0x79,
+    0x70, 0x65, 0x6f, 0x66, 0x20, 0x61, 0x72, 0x67, 0x3d, 0x3d,
+    0x22, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x22, 0x3f, 0x62,
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x3d, 0x61, 0x72, 0x67, 0x3a,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x3d, 0x6e, 0x65, 0x77,
     0x20, 0x54, 0x65, 0x78, 0x74, 0x45, 0x6e, 0x63, 0x6f, 0x64,
     0x65, 0x72, 0x28, 0x29, 0x2e, 0x65, 0x6e, 0x63, 0x6f, 0x64,
     0x65, 0x28, 0x61, 0x72, 0x67, 0x2e, 0x74, 0x6f, 0x53, 0x74,
-    0x72, 0x69, 0x6e, 0x67, 0x28, 0x29, 0x29, 0x2e, 0x6c, 0x65,
-    0x6e, 0x67, 0x74, 0x68, 0x29, 0x2e, 0x6a, 0x6f, 0x69, 0x6e,
-    0x28, 0x22, 0x3b, 0x22, 0x29, 0x2c, 0x61, 0x72, 0x67, 0x73,
-    0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x3d, 0x6e, 0x65, 0x77,
+    0x72, 0x69, 0x6e, 0x67, 0x28, 0x29, 0x29, 0x3b, 0x6c, 0x65,
+    0x74, 0x20, 0x74, 0x65, 0x6d, 0x70, 0x3d, 0x6e, 0x65, 0x77,
     0x20, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61,
-    0x79, 0x3b, 0x66, 0x6f, 0x72, 0x28, 0x6c, 0x65, 0x74, 0x20,
-    0x61, 0x72, 0x67, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x72, 0x67,
-    0x73, 0x29, 0x7b, 0x6c, 0x65, 0x74, 0x20, 0x62, 0x75, 0x66,
-    0x66, 0x65, 0x72, 0x3b, 0x74, 0x79, 0x70, 0x65, 0x6f, 0x66,
-    0x20, 0x61, 0x72, 0x67, 0x3d, 0x3d, 0x22, 0x6f, 0x62, 0x6a,
-    0x65, 0x63, 0x74, 0x22, 0x3f, 0x62, 0x75, 0x66, 0x66, 0x65,
-    0x72, 0x3d, 0x61, 0x72, 0x67, 0x3a, 0x62, 0x75, 0x66, 0x66,
-    0x65, 0x72, 0x3d, 0x6e, 0x65, 0x77, 0x20, 0x54, 0x65, 0x78,
-    0x74, 0x45, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x28, 0x29,
-    0x2e, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x28, 0x61, 0x72,
-    0x67, 0x2e, 0x74, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67,
-    0x28, 0x29, 0x29, 0x3b, 0x6c, 0x65, 0x74, 0x20, 0x74, 0x65,
-    0x6d, 0x70, 0x3d, 0x6e, 0x65, 0x77, 0x20, 0x55, 0x69, 0x6e,
-    0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x61, 0x72,
-    0x67, 0x73, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x2e, 0x6c,
-    0x65, 0x6e, 0x67, 0x74, 0x68, 0x2b, 0x62, 0x75, 0x66, 0x66,
-    0x65, 0x72, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x2b,
-    0x31, 0x29, 0x3b, 0x74, 0x65, 0x6d, 0x70, 0x2e, 0x73, 0x65,
-    0x74, 0x28, 0x61, 0x72, 0x67, 0x73, 0x56, 0x61, 0x6c, 0x75,
-    0x65, 0x73, 0x2c, 0x30, 0x29, 0x2c, 0x74, 0x65, 0x6d, 0x70,
-    0x2e, 0x73, 0x65, 0x74, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65,
-    0x72, 0x2c, 0x61, 0x72, 0x67, 0x73, 0x56, 0x61, 0x6c, 0x75,
-    0x65, 0x73, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x29,
-    0x2c, 0x74, 0x65, 0x6d, 0x70, 0x5b, 0x61, 0x72, 0x67, 0x73,
+    0x79, 0x28, 0x61, 0x72, 0x67, 0x73, 0x56, 0x61, 0x6c, 0x75,
+    0x65, 0x73, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x2b,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2e, 0x6c, 0x65, 0x6e,
+    0x67, 0x74, 0x68, 0x2b, 0x31, 0x29, 0x3b, 0x74, 0x65, 0x6d,
+    0x70, 0x2e, 0x73, 0x65, 0x74, 0x28, 0x61, 0x72, 0x67, 0x73,
+    0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x2c, 0x30, 0x29, 0x2c,
+    0x74, 0x65, 0x6d, 0x70, 0x2e, 0x73, 0x65, 0x74, 0x28, 0x62,
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x2c, 0x61, 0x72, 0x67, 0x73,
     0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x2e, 0x6c, 0x65, 0x6e,
-    0x67, 0x74, 0x68, 0x2b, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
-    0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x5d, 0x3d, 0x30,
-    0x2c, 0x61, 0x72, 0x67, 0x73, 0x56, 0x61, 0x6c, 0x75, 0x65,
-    0x73, 0x3d, 0x74, 0x65, 0x6d, 0x70, 0x7d, 0x6c, 0x65, 0x74,
-    0x20, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x3d, 0x6e, 0x65,
-    0x77, 0x20, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72,
-    0x61, 0x79, 0x28, 0x30, 0x29, 0x2c, 0x70, 0x61, 0x63, 0x6b,
-    0x65, 0x74, 0x50, 0x75, 0x73, 0x68, 0x3d, 0x64, 0x61, 0x74,
-    0x61, 0x3d, 0x3e, 0x7b, 0x6c, 0x65, 0x74, 0x20, 0x6e, 0x65,
-    0x77, 0x50, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x3d, 0x6e, 0x65,
+    0x67, 0x74, 0x68, 0x29, 0x2c, 0x74, 0x65, 0x6d, 0x70, 0x5b,
+    0x61, 0x72, 0x67, 0x73, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73,
+    0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x2b, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74,
+    0x68, 0x5d, 0x3d, 0x30, 0x2c, 0x61, 0x72, 0x67, 0x73, 0x56,
+    0x61, 0x6c, 0x75, 0x65, 0x73, 0x3d, 0x74, 0x65, 0x6d, 0x70,
+    0x7d, 0x6c, 0x65, 0x74, 0x20, 0x70, 0x61, 0x63, 0x6b, 0x65,
+    0x74, 0x3d, 0x6e, 0x65, 0x77, 0x20, 0x55, 0x69, 0x6e, 0x74,
+    0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x30, 0x29, 0x2c,
+    0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x50, 0x75, 0x73, 0x68,
+    0x3d, 0x64, 0x61, 0x74, 0x61, 0x3d, 0x3e, 0x7b, 0x6c, 0x65,
+    0x74, 0x20, 0x6e, 0x65, 0x77, 0x50, 0x61, 0x63, 0x6b, 0x65,
+    0x74, 0x3d, 0x6e, 0x65, 0x77, 0x20, 0x55, 0x69, 0x6e, 0x74,
+    0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x70, 0x61, 0x63,
+    0x6b, 0x65, 0x74, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68,
+    0x2b, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x6c, 0x65, 0x6e, 0x67,
+    0x74, 0x68, 0x29, 0x3b, 0x6e, 0x65, 0x77, 0x50, 0x61, 0x63,
+    0x6b, 0x65, 0x74, 0x2e, 0x73, 0x65, 0x74, 0x28, 0x70, 0x61,
+    0x63, 0x6b, 0x65, 0x74, 0x29, 0x2c, 0x6e, 0x65, 0x77, 0x50,
+    0x61, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x73, 0x65, 0x74, 0x28,
+    0x64, 0x61, 0x74, 0x61, 0x2c, 0x70, 0x61, 0x63, 0x6b, 0x65,
+    0x74, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x29, 0x2c,
+    0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x3d, 0x6e, 0x65, 0x77,
+    0x50, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x7d, 0x3b, 0x72, 0x65,
+    0x74, 0x75, 0x72, 0x6e, 0x20, 0x70, 0x61, 0x63, 0x6b, 0x65,
+    0x74, 0x50, 0x75, 0x73, 0x68, 0x28, 0x6e, 0x65, 0x77, 0x20,
+    0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79,
+    0x28, 0x5b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x57, 0x45,
+    0x42, 0x55, 0x49, 0x5f, 0x53, 0x49, 0x47, 0x4e, 0x41, 0x54,
+    0x55, 0x52, 0x45, 0x5d, 0x29, 0x29, 0x2c, 0x70, 0x61, 0x63,
+    0x6b, 0x65, 0x74, 0x50, 0x75, 0x73, 0x68, 0x28, 0x6e, 0x65,
     0x77, 0x20, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72,
-    0x61, 0x79, 0x28, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x2e,
-    0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x2b, 0x64, 0x61, 0x74,
-    0x61, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x29, 0x3b,
-    0x6e, 0x65, 0x77, 0x50, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x2e,
-    0x73, 0x65, 0x74, 0x28, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
-    0x29, 0x2c, 0x6e, 0x65, 0x77, 0x50, 0x61, 0x63, 0x6b, 0x65,
-    0x74, 0x2e, 0x73, 0x65, 0x74, 0x28, 0x64, 0x61, 0x74, 0x61,
-    0x2c, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x6c, 0x65,
-    0x6e, 0x67, 0x74, 0x68, 0x29, 0x2c, 0x70, 0x61, 0x63, 0x6b,
-    0x65, 0x74, 0x3d, 0x6e, 0x65, 0x77, 0x50, 0x61, 0x63, 0x6b,
-    0x65, 0x74, 0x7d, 0x3b, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
-    0x20, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x50, 0x75, 0x73,
+    0x61, 0x79, 0x28, 0x5b, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2c,
+    0x30, 0x5d, 0x29, 0x29, 0x2c, 0x70, 0x61, 0x63, 0x6b, 0x65,
+    0x74, 0x50, 0x75, 0x73, 0x68, 0x28, 0x6e, 0x65, 0x77, 0x20,
+    0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79,
+    0x28, 0x5b, 0x30, 0x2c, 0x30, 0x5d, 0x29, 0x29, 0x2c, 0x70,
+    0x61, 0x63, 0x6b, 0x65, 0x74, 0x50, 0x75, 0x73, 0x68, 0x28,
+    0x6e, 0x65, 0x77, 0x20, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x41,
+    0x72, 0x72, 0x61, 0x79, 0x28, 0x5b, 0x74, 0x68, 0x69, 0x73,
+    0x2e, 0x23, 0x43, 0x4d, 0x44, 0x5f, 0x43, 0x41, 0x4c, 0x4c,
+    0x5f, 0x46, 0x55, 0x4e, 0x43, 0x5d, 0x29, 0x29, 0x2c, 0x70,
+    0x61, 0x63, 0x6b, 0x65, 0x74, 0x50, 0x75, 0x73, 0x68, 0x28,
+    0x6e, 0x65, 0x77, 0x20, 0x54, 0x65, 0x78, 0x74, 0x45, 0x6e,
+    0x63, 0x6f, 0x64, 0x65, 0x72, 0x28, 0x29, 0x2e, 0x65, 0x6e,
+    0x63, 0x6f, 0x64, 0x65, 0x28, 0x66, 0x6e, 0x29, 0x29, 0x2c,
+    0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x50, 0x75, 0x73, 0x68,
+    0x28, 0x6e, 0x65, 0x77, 0x20, 0x55, 0x69, 0x6e, 0x74, 0x38,
+    0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x5b, 0x30, 0x5d, 0x29,
+    0x29, 0x2c, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x50, 0x75,
+    0x73, 0x68, 0x28, 0x6e, 0x65, 0x77, 0x20, 0x54, 0x65, 0x78,
+    0x74, 0x45, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x28, 0x29,
+    0x2e, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x28, 0x61, 0x72,
+    0x67, 0x73, 0x4c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x73, 0x29,
+    0x29, 0x2c, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x50, 0x75,
+    0x73, 0x68, 0x28, 0x6e, 0x65, 0x77, 0x20, 0x55, 0x69, 0x6e,
+    0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x5b, 0x30,
+    0x5d, 0x29, 0x29, 0x2c, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x50, 0x75, 0x73, 0x68, 0x28, 0x6e, 0x65, 0x77, 0x20, 0x55,
+    0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28,
+    0x61, 0x72, 0x67, 0x73, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73,
+    0x29, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x61,
+    0x64, 0x64, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x28, 0x70, 0x61,
+    0x63, 0x6b, 0x65, 0x74, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x23, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x2c, 0x74, 0x68, 0x69,
+    0x73, 0x2e, 0x23, 0x50, 0x52, 0x4f, 0x54, 0x4f, 0x43, 0x4f,
+    0x4c, 0x5f, 0x54, 0x4f, 0x4b, 0x45, 0x4e, 0x29, 0x2c, 0x74,
+    0x68, 0x69, 0x73, 0x2e, 0x23, 0x61, 0x64, 0x64, 0x49, 0x44,
+    0x28, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x2c, 0x63, 0x61,
+    0x6c, 0x6c, 0x49, 0x64, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x23, 0x50, 0x52, 0x4f, 0x54, 0x4f, 0x43, 0x4f, 0x4c, 0x5f,
+    0x49, 0x44, 0x29, 0x2c, 0x6e, 0x65, 0x77, 0x20, 0x50, 0x72,
+    0x6f, 0x6d, 0x69, 0x73, 0x65, 0x28, 0x72, 0x65, 0x73, 0x6f,
+    0x6c, 0x76, 0x65, 0x3d, 0x3e, 0x7b, 0x74, 0x68, 0x69, 0x73,
+    0x2e, 0x23, 0x63, 0x61, 0x6c, 0x6c, 0x50, 0x72, 0x6f, 0x6d,
+    0x69, 0x73, 0x65, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x76, 0x65,
+    0x5b, 0x63, 0x61, 0x6c, 0x6c, 0x49, 0x64, 0x5d, 0x3d, 0x72,
+    0x65, 0x73, 0x6f, 0x6c, 0x76, 0x65, 0x2c, 0x74, 0x68, 0x69,
+    0x73, 0x2e, 0x23, 0x73, 0x65, 0x6e, 0x64, 0x44, 0x61, 0x74,
+    0x61, 0x28, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x29, 0x7d,
+    0x29, 0x7d, 0x61, 0x73, 0x79, 0x6e, 0x63, 0x20, 0x63, 0x61,
+    0x6c, 0x6c, 0x43, 0x6f, 0x72, 0x65, 0x28, 0x66, 0x6e, 0x2c,
+    0x2e, 0x2e, 0x2e, 0x61, 0x72, 0x67, 0x73, 0x29, 0x7b, 0x72,
+    0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x74, 0x68, 0x69, 0x73,
+    0x2e, 0x63, 0x61, 0x6c, 0x6c, 0x28, 0x22, 0x5f, 0x5f, 0x77,
+    0x65, 0x62, 0x75, 0x69, 0x5f, 0x63, 0x6f, 0x72, 0x65, 0x5f,
+    0x61, 0x70, 0x69, 0x5f, 0x5f, 0x22, 0x2c, 0x66, 0x6e, 0x2c,
+    0x2e, 0x2e, 0x2e, 0x61, 0x72, 0x67, 0x73, 0x29, 0x7d, 0x23,
+    0x77, 0x73, 0x49, 0x73, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63,
+    0x74, 0x65, 0x64, 0x28, 0x29, 0x7b, 0x72, 0x65, 0x74, 0x75,
+    0x72, 0x6e, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77,
+    0x73, 0x26, 0x26, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77,
+    0x73, 0x2e, 0x72, 0x65, 0x61, 0x64, 0x79, 0x53, 0x74, 0x61,
+    0x74, 0x65, 0x3d, 0x3d, 0x3d, 0x57, 0x65, 0x62, 0x53, 0x6f,
+    0x63, 0x6b, 0x65, 0x74, 0x2e, 0x4f, 0x50, 0x45, 0x4e, 0x7d,
+    0x23, 0x77, 0x73, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74,
+    0x28, 0x29, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77,
+    0x73, 0x49, 0x73, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74,
+    0x65, 0x64, 0x28, 0x29, 0x26, 0x26, 0x74, 0x68, 0x69, 0x73,
+    0x2e, 0x23, 0x77, 0x73, 0x2e, 0x63, 0x6c, 0x6f, 0x73, 0x65,
+    0x28, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x54,
+    0x6f, 0x6b, 0x65, 0x6e, 0x41, 0x63, 0x63, 0x65, 0x70, 0x74,
+    0x65, 0x64, 0x3d, 0x21, 0x31, 0x3b, 0x69, 0x66, 0x28, 0x74,
+    0x68, 0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
+    0x29, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x3d,
+    0x6e, 0x65, 0x77, 0x20, 0x57, 0x65, 0x62, 0x75, 0x69, 0x4c,
+    0x6f, 0x63, 0x61, 0x6c, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74,
+    0x3b, 0x65, 0x6c, 0x73, 0x65, 0x7b, 0x6c, 0x65, 0x74, 0x20,
+    0x68, 0x6f, 0x73, 0x74, 0x3d, 0x77, 0x69, 0x6e, 0x64, 0x6f,
+    0x77, 0x2e, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x2e, 0x68, 0x6f, 0x73, 0x74, 0x6e, 0x61, 0x6d, 0x65, 0x2c,
+    0x75, 0x72, 0x6c, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
+    0x73, 0x65, 0x63, 0x75, 0x72, 0x65, 0x3f, 0x22, 0x77, 0x73,
+    0x73, 0x3a, 0x2f, 0x2f, 0x22, 0x2b, 0x68, 0x6f, 0x73, 0x74,
+    0x3a, 0x22, 0x77, 0x73, 0x3a, 0x2f, 0x2f, 0x22, 0x2b, 0x68,
+    0x6f, 0x73, 0x74, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
+    0x77, 0x73, 0x3d, 0x6e, 0x65, 0x77, 0x20, 0x57, 0x65, 0x62,
+    0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x28, 0x60, 0x24, 0x7b,
+    0x75, 0x72, 0x6c, 0x7d, 0x3a, 0x24, 0x7b, 0x74, 0x68, 0x69,
+    0x73, 0x2e, 0x23, 0x70, 0x6f, 0x72, 0x74, 0x7d, 0x24, 0x7b,
+    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x70, 0x61, 0x74, 0x68,
+    0x7d, 0x2f, 0x5f, 0x77, 0x65, 0x62, 0x75, 0x69, 0x5f, 0x77,
+    0x73, 0x5f, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x60,
+    0x29, 0x7d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73,
+    0x2e, 0x62, 0x69, 0x6e, 0x61, 0x72, 0x79, 0x54, 0x79, 0x70,
+    0x65, 0x3d, 0x22, 0x61, 0x72, 0x72, 0x61, 0x79, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x22, 0x2c, 0x74, 0x68, 0x69, 0x73,
+    0x2e, 0x23, 0x77, 0x73, 0x2e, 0x6f, 0x6e, 0x6f, 0x70, 0x65,
+    0x6e, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73,
+    0x4f, 0x6e, 0x4f, 0x70, 0x65, 0x6e, 0x2e, 0x62, 0x69, 0x6e,
+    0x64, 0x28, 0x74, 0x68, 0x69, 0x73, 0x29, 0x2c, 0x74, 0x68,
+    0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x2e, 0x6f, 0x6e, 0x6d,
+    0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x3d, 0x74, 0x68, 0x69,
+    0x73, 0x2e, 0x23, 0x77, 0x73, 0x4f, 0x6e, 0x4d, 0x65, 0x73,
+    0x73, 0x61, 0x67, 0x65, 0x2e, 0x62, 0x69, 0x6e, 0x64, 0x28,
+    0x74, 0x68, 0x69, 0x73, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73,
+    0x2e, 0x23, 0x77, 0x73, 0x2e, 0x6f, 0x6e, 0x63, 0x6c, 0x6f,
+    0x73, 0x65, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77,
+    0x73, 0x4f, 0x6e, 0x43, 0x6c, 0x6f, 0x73, 0x65, 0x2e, 0x62,
+    0x69, 0x6e, 0x64, 0x28, 0x74, 0x68, 0x69, 0x73, 0x29, 0x2c,
+    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x2e, 0x6f,
+    0x6e, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x3d, 0x74, 0x68, 0x69,
+    0x73, 0x2e, 0x23, 0x77, 0x73, 0x4f, 0x6e, 0x45, 0x72, 0x72,
+    0x6f, 0x72, 0x2e, 0x62, 0x69, 0x6e, 0x64, 0x28, 0x74, 0x68,
+    0x69, 0x73, 0x29, 0x7d, 0x23, 0x77, 0x73, 0x4f, 0x6e, 0x4f,
+    0x70, 0x65, 0x6e, 0x3d, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x3d,
+    0x3e, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73,
+    0x57, 0x61, 0x73, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74,
+    0x65, 0x64, 0x3d, 0x21, 0x30, 0x2c, 0x74, 0x68, 0x69, 0x73,
+    0x2e, 0x23, 0x75, 0x6e, 0x66, 0x72, 0x65, 0x65, 0x7a, 0x65,
+    0x55, 0x49, 0x28, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x23, 0x6c, 0x6f, 0x67, 0x26, 0x26, 0x63, 0x6f, 0x6e, 0x73,
+    0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x22, 0x57,
+    0x65, 0x62, 0x55, 0x49, 0x20, 0x2d, 0x3e, 0x20, 0x43, 0x6f,
+    0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65, 0x64, 0x22, 0x29, 0x2c,
+    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x63, 0x68, 0x65, 0x63,
+    0x6b, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x28, 0x29, 0x7d, 0x3b,
+    0x23, 0x77, 0x73, 0x4f, 0x6e, 0x45, 0x72, 0x72, 0x6f, 0x72,
+    0x3d, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x3d, 0x3e, 0x7b, 0x74,
+    0x68, 0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f, 0x67, 0x26, 0x26,
+    0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f,
+    0x67, 0x28, 0x22, 0x57, 0x65, 0x62, 0x55, 0x49, 0x20, 0x2d,
+    0x3e, 0x20, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69,
+    0x6f, 0x6e, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x2e,
+    0x22, 0x29, 0x7d, 0x3b, 0x23, 0x77, 0x73, 0x4f, 0x6e, 0x43,
+    0x6c, 0x6f, 0x73, 0x65, 0x3d, 0x65, 0x76, 0x65, 0x6e, 0x74,
+    0x3d, 0x3e, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x63,
+    0x6c, 0x6f, 0x73, 0x65, 0x52, 0x65, 0x61, 0x73, 0x6f, 0x6e,
+    0x3d, 0x3d, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x43,
+    0x4d, 0x44, 0x5f, 0x4e, 0x41, 0x56, 0x49, 0x47, 0x41, 0x54,
+    0x49, 0x4f, 0x4e, 0x3f, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x23, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x52, 0x65, 0x61, 0x73,
+    0x6f, 0x6e, 0x3d, 0x30, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x23, 0x6c, 0x6f, 0x67, 0x26, 0x26, 0x63, 0x6f, 0x6e, 0x73,
+    0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x60, 0x57,
+    0x65, 0x62, 0x55, 0x49, 0x20, 0x2d, 0x3e, 0x20, 0x43, 0x6f,
+    0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6c,
+    0x6f, 0x73, 0x74, 0x2e, 0x20, 0x4e, 0x61, 0x76, 0x69, 0x67,
+    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x6f, 0x20, 0x5b,
+    0x24, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x63, 0x6c,
+    0x6f, 0x73, 0x65, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x7d, 0x5d,
+    0x60, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x61,
+    0x6c, 0x6c, 0x6f, 0x77, 0x4e, 0x61, 0x76, 0x69, 0x67, 0x61,
+    0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x21, 0x30, 0x2c, 0x67, 0x6c,
+    0x6f, 0x62, 0x61, 0x6c, 0x54, 0x68, 0x69, 0x73, 0x2e, 0x6c,
+    0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x72, 0x65,
+    0x70, 0x6c, 0x61, 0x63, 0x65, 0x28, 0x74, 0x68, 0x69, 0x73,
+    0x2e, 0x23, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x56, 0x61, 0x6c,
+    0x75, 0x65, 0x29, 0x29, 0x3a, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x23, 0x77, 0x73, 0x53, 0x74, 0x61, 0x79, 0x41, 0x6c, 0x69,
+    0x76, 0x65, 0x3f, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
+    0x6c, 0x6f, 0x67, 0x26, 0x26, 0x63, 0x6f, 0x6e, 0x73, 0x6f,
+    0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x60, 0x57, 0x65,
+    0x62, 0x55, 0x49, 0x20, 0x2d, 0x3e, 0x20, 0x43, 0x6f, 0x6e,
+    0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6c, 0x6f,
+    0x73, 0x74, 0x20, 0x28, 0x24, 0x7b, 0x65, 0x76, 0x65, 0x6e,
+    0x74, 0x2e, 0x63, 0x6f, 0x64, 0x65, 0x7d, 0x29, 0x2e, 0x20,
+    0x52, 0x65, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69,
+    0x6e, 0x67, 0x2e, 0x2e, 0x2e, 0x60, 0x29, 0x2c, 0x74, 0x68,
+    0x69, 0x73, 0x2e, 0x23, 0x66, 0x72, 0x65, 0x65, 0x7a, 0x65,
+    0x55, 0x69, 0x28, 0x29, 0x2c, 0x73, 0x65, 0x74, 0x54, 0x69,
+    0x6d, 0x65, 0x6f, 0x75, 0x74, 0x28, 0x28, 0x29, 0x3d, 0x3e,
+    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x43, 0x6f,
+    0x6e, 0x6e, 0x65, 0x63, 0x74, 0x28, 0x29, 0x2c, 0x74, 0x68,
+    0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x53, 0x74, 0x61, 0x79,
+    0x41, 0x6c, 0x69, 0x76, 0x65, 0x54, 0x69, 0x6d, 0x65, 0x6f,
+    0x75, 0x74, 0x29, 0x29, 0x3a, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x23, 0x6c, 0x6f, 0x67, 0x3f, 0x28, 0x63, 0x6f, 0x6e, 0x73,
+    0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x60, 0x57,
+    0x65, 0x62, 0x55, 0x49, 0x20, 0x2d, 0x3e, 0x20, 0x43, 0x6f,
+    0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6c,
+    0x6f, 0x73, 0x74, 0x20, 0x28, 0x24, 0x7b, 0x65, 0x76, 0x65,
+    0x6e, 0x74, 0x2e, 0x63, 0x6f, 0x64, 0x65, 0x7d, 0x29, 0x60,
+    0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x66, 0x72,
+    0x65, 0x65, 0x7a, 0x65, 0x55, 0x69, 0x28, 0x29, 0x29, 0x3a,
+    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x63, 0x6c, 0x6f, 0x73,
+    0x65, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x54, 0x69, 0x6d,
+    0x65, 0x72, 0x28, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x23, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x43, 0x61, 0x6c,
+    0x6c, 0x62, 0x61, 0x63, 0x6b, 0x26, 0x26, 0x74, 0x68, 0x69,
+    0x73, 0x2e, 0x23, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x43,
+    0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b, 0x28, 0x74, 0x68,
+    0x69, 0x73, 0x2e, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x2e, 0x44,
+    0x49, 0x53, 0x43, 0x4f, 0x4e, 0x4e, 0x45, 0x43, 0x54, 0x45,
+    0x44, 0x29, 0x7d, 0x3b, 0x23, 0x77, 0x73, 0x4f, 0x6e, 0x4d,
+    0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x3d, 0x61, 0x73, 0x79,
+    0x6e, 0x63, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x3d, 0x3e,
+    0x7b, 0x76, 0x61, 0x72, 0x20, 0x5f, 0x61, 0x2c, 0x5f, 0x62,
+    0x3b, 0x6c, 0x65, 0x74, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x38, 0x3d, 0x6e, 0x65, 0x77, 0x20, 0x55, 0x69, 0x6e,
+    0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x65, 0x76,
+    0x65, 0x6e, 0x74, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x29, 0x3b,
+    0x69, 0x66, 0x28, 0x21, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x38, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3c,
+    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x50, 0x52, 0x4f, 0x54,
+    0x4f, 0x43, 0x4f, 0x4c, 0x5f, 0x53, 0x49, 0x5a, 0x45, 0x29,
+    0x26, 0x26, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x38, 0x5b,
+    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x50, 0x52, 0x4f, 0x54,
+    0x4f, 0x43, 0x4f, 0x4c, 0x5f, 0x53, 0x49, 0x47, 0x4e, 0x5d,
+    0x3d, 0x3d, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x57,
+    0x45, 0x42, 0x55, 0x49, 0x5f, 0x53, 0x49, 0x47, 0x4e, 0x41,
+    0x54, 0x55, 0x52, 0x45, 0x29, 0x69, 0x66, 0x28, 0x74, 0x68,
+    0x69, 0x73, 0x2e, 0x23, 0x69, 0x73, 0x54, 0x65, 0x78, 0x74,
+    0x42, 0x61, 0x73, 0x65, 0x64, 0x43, 0x6f, 0x6d, 0x6d, 0x61,
+    0x6e, 0x64, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x38,
+    0x5b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x50, 0x52, 0x4f,
+    0x54, 0x4f, 0x43, 0x4f, 0x4c, 0x5f, 0x43, 0x4d, 0x44, 0x5d,
+    0x29, 0x29, 0x7b, 0x6c, 0x65, 0x74, 0x20, 0x63, 0x61, 0x6c,
+    0x6c, 0x49, 0x64, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
+    0x67, 0x65, 0x74, 0x49, 0x44, 0x28, 0x62, 0x75, 0x66, 0x66,
+    0x65, 0x72, 0x38, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
+    0x50, 0x52, 0x4f, 0x54, 0x4f, 0x43, 0x4f, 0x4c, 0x5f, 0x49,
+    0x44, 0x29, 0x3b, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x28,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x38, 0x5b, 0x74, 0x68,
+    0x69, 0x73, 0x2e, 0x23, 0x50, 0x52, 0x4f, 0x54, 0x4f, 0x43,
+    0x4f, 0x4c, 0x5f, 0x43, 0x4d, 0x44, 0x5d, 0x29, 0x7b, 0x63,
+    0x61, 0x73, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
+    0x43, 0x4d, 0x44, 0x5f, 0x4a, 0x53, 0x5f, 0x51, 0x55, 0x49,
+    0x43, 0x4b, 0x3a, 0x63, 0x61, 0x73, 0x65, 0x20, 0x74, 0x68,
+    0x69, 0x73, 0x2e, 0x23, 0x43, 0x4d, 0x44, 0x5f, 0x4a, 0x53,
+    0x3a, 0x7b, 0x6c, 0x65, 0x74, 0x20, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x53, 0x61, 0x6e, 0x69, 0x74, 0x69, 0x7a, 0x65,
+    0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x67, 0x65, 0x74,
+    0x44, 0x61, 0x74, 0x61, 0x53, 0x74, 0x72, 0x46, 0x72, 0x6f,
+    0x6d, 0x50, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x28, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x38, 0x2c, 0x74, 0x68, 0x69, 0x73,
+    0x2e, 0x23, 0x50, 0x52, 0x4f, 0x54, 0x4f, 0x43, 0x4f, 0x4c,
+    0x5f, 0x44, 0x41, 0x54, 0x41, 0x29, 0x2e, 0x72, 0x65, 0x70,
+    0x6c, 0x61, 0x63, 0x65, 0x28, 0x2f, 0x28, 0x3f, 0x3a, 0x5c,
+    0x72, 0x5c, 0x6e, 0x7c, 0x5c, 0x72, 0x7c, 0x5c, 0x6e, 0x29,
+    0x2f, 0x67, 0x2c, 0x60, 0x0a, 0x60, 0x29, 0x3b, 0x74, 0x68,
+    0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f, 0x67, 0x26, 0x26, 0x63,
+    0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67,
+    0x28, 0x60, 0x57, 0x65, 0x62, 0x55, 0x49, 0x20, 0x2d, 0x3e,
+    0x20, 0x43, 0x4d, 0x44, 0x20, 0x2d, 0x3e, 0x20, 0x4a, 0x53,
+    0x20, 0x5b, 0x24, 0x7b, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+    0x53, 0x61, 0x6e, 0x69, 0x74, 0x69, 0x7a, 0x65, 0x7d, 0x5d,
+    0x60, 0x29, 0x3b, 0x6c, 0x65, 0x74, 0x20, 0x46, 0x75, 0x6e,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3d, 0x22, 0x75, 0x6e,
+    0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x22, 0x2c, 0x46,
+    0x75, 0x6e, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x3d, 0x21, 0x31,
+    0x3b, 0x74, 0x72, 0x79, 0x7b, 0x46, 0x75, 0x6e, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6e, 0x3d, 0x61, 0x77, 0x61, 0x69, 0x74,
+    0x20, 0x41, 0x73, 0x79, 0x6e, 0x63, 0x46, 0x75, 0x6e, 0x63,
+    0x74, 0x69, 0x6f, 0x6e, 0x28, 0x73, 0x63, 0x72, 0x69, 0x70,
+    0x74, 0x53, 0x61, 0x6e, 0x69, 0x74, 0x69, 0x7a, 0x65, 0x29,
+    0x28, 0x29, 0x7d, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x65,
+    0x29, 0x7b, 0x46, 0x75, 0x6e, 0x45, 0x72, 0x72, 0x6f, 0x72,
+    0x3d, 0x21, 0x30, 0x2c, 0x46, 0x75, 0x6e, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6e, 0x3d, 0x65, 0x2e, 0x6d, 0x65, 0x73, 0x73,
+    0x61, 0x67, 0x65, 0x7d, 0x69, 0x66, 0x28, 0x62, 0x75, 0x66,
+    0x66, 0x65, 0x72, 0x38, 0x5b, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x23, 0x50, 0x52, 0x4f, 0x54, 0x4f, 0x43, 0x4f, 0x4c, 0x5f,
+    0x43, 0x4d, 0x44, 0x5d, 0x3d, 0x3d, 0x3d, 0x74, 0x68, 0x69,
+    0x73, 0x2e, 0x23, 0x43, 0x4d, 0x44, 0x5f, 0x4a, 0x53, 0x5f,
+    0x51, 0x55, 0x49, 0x43, 0x4b, 0x29, 0x72, 0x65, 0x74, 0x75,
+    0x72, 0x6e, 0x3b, 0x46, 0x75, 0x6e, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6e, 0x3d, 0x3d, 0x3d, 0x76, 0x6f, 0x69, 0x64, 0x20,
+    0x30, 0x26, 0x26, 0x28, 0x46, 0x75, 0x6e, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6e, 0x3d, 0x22, 0x75, 0x6e, 0x64, 0x65, 0x66,
+    0x69, 0x6e, 0x65, 0x64, 0x22, 0x29, 0x2c, 0x74, 0x68, 0x69,
+    0x73, 0x2e, 0x23, 0x6c, 0x6f, 0x67, 0x26, 0x26, 0x21, 0x46,
+    0x75, 0x6e, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x26, 0x26, 0x63,
+    0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67,
+    0x28, 0x60, 0x57, 0x65, 0x62, 0x55, 0x49, 0x20, 0x2d, 0x3e,
+    0x20, 0x43, 0x4d, 0x44, 0x20, 0x2d, 0x3e, 0x20, 0x4a, 0x53,
+    0x20, 0x2d, 0x3e, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e,
+    0x20, 0x53, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x5b,
+    0x24, 0x7b, 0x46, 0x75, 0x6e, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6e, 0x7d, 0x5d, 0x60, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73,
+    0x2e, 0x23, 0x6c, 0x6f, 0x67, 0x26, 0x26, 0x46, 0x75, 0x6e,
+    0x45, 0x72, 0x72, 0x6f, 0x72, 0x26, 0x26, 0x63, 0x6f, 0x6e,
+    0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x60,
+    0x57, 0x65, 0x62, 0x55, 0x49, 0x20, 0x2d, 0x3e, 0x20, 0x43,
+    0x4d, 0x44, 0x20, 0x2d, 0x3e, 0x20, 0x4a, 0x53, 0x20, 0x2d,
+    0x3e, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x45,
+    0x72, 0x72, 0x6f, 0x72, 0x20, 0x5b, 0x24, 0x7b, 0x46, 0x75,
+    0x6e, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x7d, 0x5d, 0x60,
+    0x29, 0x3b, 0x6c, 0x65, 0x74, 0x20, 0x70, 0x61, 0x63, 0x6b,
+    0x65, 0x74, 0x3d, 0x6e, 0x65, 0x77, 0x20, 0x55, 0x69, 0x6e,
+    0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x30, 0x29,
+    0x2c, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x50, 0x75, 0x73,
+    0x68, 0x3d, 0x64, 0x61, 0x74, 0x61, 0x3d, 0x3e, 0x7b, 0x6c,
+    0x65, 0x74, 0x20, 0x6e, 0x65, 0x77, 0x50, 0x61, 0x63, 0x6b,
+    0x65, 0x74, 0x3d, 0x6e, 0x65, 0x77, 0x20, 0x55, 0x69, 0x6e,
+    0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x70, 0x61,
+    0x63, 0x6b, 0x65, 0x74, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74,
+    0x68, 0x2b, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x6c, 0x65, 0x6e,
+    0x67, 0x74, 0x68, 0x29, 0x3b, 0x6e, 0x65, 0x77, 0x50, 0x61,
+    0x63, 0x6b, 0x65, 0x74, 0x2e, 0x73, 0x65, 0x74, 0x28, 0x70,
+    0x61, 0x63, 0x6b, 0x65, 0x74, 0x29, 0x2c, 0x6e, 0x65, 0x77,
+    0x50, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x73, 0x65, 0x74,
+    0x28, 0x64, 0x61, 0x74, 0x61, 0x2c, 0x70, 0x61, 0x63, 0x6b,
+    0x65, 0x74, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x29,
+    0x2c, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x3d, 0x6e, 0x65,
+    0x77, 0x50, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x7d, 0x2c, 0x70,
+    0x61, 0x63, 0x6b, 0x65, 0x74, 0x50, 0x75, 0x73, 0x68, 0x53,
+    0x74, 0x72, 0x3d, 0x64, 0x61, 0x74, 0x61, 0x3d, 0x3e, 0x7b,
+    0x69, 0x66, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x6c, 0x65,
+    0x6e, 0x67, 0x74, 0x68, 0x3e, 0x38, 0x31, 0x39, 0x32, 0x29,
+    0x7b, 0x6c, 0x65, 0x74, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64,
+    0x65, 0x72, 0x3d, 0x6e, 0x65, 0x77, 0x20, 0x54, 0x65, 0x78,
+    0x74, 0x45, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x3b, 0x66,
+    0x6f, 0x72, 0x28, 0x6c, 0x65, 0x74, 0x20, 0x69, 0x3d, 0x30,
+    0x3b, 0x69, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x6c, 0x65,
+    0x6e, 0x67, 0x74, 0x68, 0x3b, 0x69, 0x2b, 0x3d, 0x38, 0x31,
+    0x39, 0x32, 0x29, 0x7b, 0x6c, 0x65, 0x74, 0x20, 0x63, 0x68,
+    0x75, 0x6e, 0x6b, 0x3d, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x73,
+    0x75, 0x62, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x69,
+    0x2c, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x6d, 0x69, 0x6e, 0x28,
+    0x69, 0x2b, 0x38, 0x31, 0x39, 0x32, 0x2c, 0x64, 0x61, 0x74,
+    0x61, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x29, 0x29,
+    0x2c, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x64, 0x43, 0x68,
+    0x75, 0x6e, 0x6b, 0x3d, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65,
+    0x72, 0x2e, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x28, 0x63,
+    0x68, 0x75, 0x6e, 0x6b, 0x29, 0x3b, 0x70, 0x61, 0x63, 0x6b,
+    0x65, 0x74, 0x50, 0x75, 0x73, 0x68, 0x28, 0x65, 0x6e, 0x63,
+    0x6f, 0x64, 0x65, 0x64, 0x43, 0x68, 0x75, 0x6e, 0x6b, 0x29,
+    0x7d, 0x7d, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x70, 0x61, 0x63,
+    0x6b, 0x65, 0x74, 0x50, 0x75, 0x73, 0x68, 0x28, 0x6e, 0x65,
+    0x77, 0x20, 0x54, 0x65, 0x78, 0x74, 0x45, 0x6e, 0x63, 0x6f,
+    0x64, 0x65, 0x72, 0x28, 0x29, 0x2e, 0x65, 0x6e, 0x63, 0x6f,
+    0x64, 0x65, 0x28, 0x64, 0x61, 0x74, 0x61, 0x29, 0x29, 0x7d,
+    0x3b, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x50, 0x75, 0x73,
     0x68, 0x28, 0x6e, 0x65, 0x77, 0x20, 0x55, 0x69, 0x6e, 0x74,
     0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x5b, 0x74, 0x68,
     0x69, 0x73, 0x2e, 0x23, 0x57, 0x45, 0x42, 0x55, 0x49, 0x5f,
@@ -1046,738 +1491,981 @@ unsigned char webinix_javascript_bridge[] = {
     0x74, 0x50, 0x75, 0x73, 0x68, 0x28, 0x6e, 0x65, 0x77, 0x20,
     0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79,
     0x28, 0x5b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x43, 0x4d,
-    0x44, 0x5f, 0x43, 0x41, 0x4c, 0x4c, 0x5f, 0x46, 0x55, 0x4e,
-    0x43, 0x5d, 0x29, 0x29, 0x2c, 0x70, 0x61, 0x63, 0x6b, 0x65,
-    0x74, 0x50, 0x75, 0x73, 0x68, 0x28, 0x6e, 0x65, 0x77, 0x20,
-    0x54, 0x65, 0x78, 0x74, 0x45, 0x6e, 0x63, 0x6f, 0x64, 0x65,
-    0x72, 0x28, 0x29, 0x2e, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65,
-    0x28, 0x66, 0x6e, 0x29, 0x29, 0x2c, 0x70, 0x61, 0x63, 0x6b,
-    0x65, 0x74, 0x50, 0x75, 0x73, 0x68, 0x28, 0x6e, 0x65, 0x77,
-    0x20, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61,
-    0x79, 0x28, 0x5b, 0x30, 0x5d, 0x29, 0x29, 0x2c, 0x70, 0x61,
+    0x44, 0x5f, 0x4a, 0x53, 0x5d, 0x29, 0x29, 0x2c, 0x70, 0x61,
     0x63, 0x6b, 0x65, 0x74, 0x50, 0x75, 0x73, 0x68, 0x28, 0x6e,
-    0x65, 0x77, 0x20, 0x54, 0x65, 0x78, 0x74, 0x45, 0x6e, 0x63,
-    0x6f, 0x64, 0x65, 0x72, 0x28, 0x29, 0x2e, 0x65, 0x6e, 0x63,
-    0x6f, 0x64, 0x65, 0x28, 0x61, 0x72, 0x67, 0x73, 0x4c, 0x65,
-    0x6e, 0x67, 0x74, 0x68, 0x73, 0x29, 0x29, 0x2c, 0x70, 0x61,
+    0x65, 0x77, 0x20, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72,
+    0x72, 0x61, 0x79, 0x28, 0x46, 0x75, 0x6e, 0x45, 0x72, 0x72,
+    0x6f, 0x72, 0x3f, 0x5b, 0x31, 0x5d, 0x3a, 0x5b, 0x30, 0x5d,
+    0x29, 0x29, 0x2c, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x50,
+    0x75, 0x73, 0x68, 0x53, 0x74, 0x72, 0x28, 0x46, 0x75, 0x6e,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x29, 0x2c, 0x70, 0x61,
     0x63, 0x6b, 0x65, 0x74, 0x50, 0x75, 0x73, 0x68, 0x28, 0x6e,
     0x65, 0x77, 0x20, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72,
     0x72, 0x61, 0x79, 0x28, 0x5b, 0x30, 0x5d, 0x29, 0x29, 0x2c,
-    0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x50, 0x75, 0x73, 0x68,
-    0x28, 0x6e, 0x65, 0x77, 0x20, 0x55, 0x69, 0x6e, 0x74, 0x38,
-    0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x61, 0x72, 0x67, 0x73,
-    0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x29, 0x29, 0x2c, 0x74,
-    0x68, 0x69, 0x73, 0x2e, 0x23, 0x61, 0x64, 0x64, 0x54, 0x6f,
-    0x6b, 0x65, 0x6e, 0x28, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
-    0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x74, 0x6f, 0x6b,
-    0x65, 0x6e, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x50,
-    0x52, 0x4f, 0x54, 0x4f, 0x43, 0x4f, 0x4c, 0x5f, 0x54, 0x4f,
-    0x4b, 0x45, 0x4e, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e,
-    0x23, 0x61, 0x64, 0x64, 0x49, 0x44, 0x28, 0x70, 0x61, 0x63,
-    0x6b, 0x65, 0x74, 0x2c, 0x63, 0x61, 0x6c, 0x6c, 0x49, 0x64,
-    0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x50, 0x52, 0x4f,
-    0x54, 0x4f, 0x43, 0x4f, 0x4c, 0x5f, 0x49, 0x44, 0x29, 0x2c,
-    0x6e, 0x65, 0x77, 0x20, 0x50, 0x72, 0x6f, 0x6d, 0x69, 0x73,
-    0x65, 0x28, 0x72, 0x65, 0x73, 0x6f, 0x6c, 0x76, 0x65, 0x3d,
-    0x3e, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x63, 0x61,
-    0x6c, 0x6c, 0x50, 0x72, 0x6f, 0x6d, 0x69, 0x73, 0x65, 0x52,
-    0x65, 0x73, 0x6f, 0x6c, 0x76, 0x65, 0x5b, 0x63, 0x61, 0x6c,
-    0x6c, 0x49, 0x64, 0x5d, 0x3d, 0x72, 0x65, 0x73, 0x6f, 0x6c,
-    0x76, 0x65, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x73,
-    0x65, 0x6e, 0x64, 0x44, 0x61, 0x74, 0x61, 0x28, 0x70, 0x61,
-    0x63, 0x6b, 0x65, 0x74, 0x29, 0x7d, 0x29, 0x7d, 0x61, 0x73,
-    0x79, 0x6e, 0x63, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x43, 0x6f,
-    0x72, 0x65, 0x28, 0x66, 0x6e, 0x2c, 0x2e, 0x2e, 0x2e, 0x61,
-    0x72, 0x67, 0x73, 0x29, 0x7b, 0x72, 0x65, 0x74, 0x75, 0x72,
-    0x6e, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x61, 0x6c,
-    0x6c, 0x28, 0x22, 0x5f, 0x5f, 0x77, 0x65, 0x62, 0x75, 0x69,
-    0x5f, 0x63, 0x6f, 0x72, 0x65, 0x5f, 0x61, 0x70, 0x69, 0x5f,
-    0x5f, 0x22, 0x2c, 0x66, 0x6e, 0x2c, 0x2e, 0x2e, 0x2e, 0x61,
-    0x72, 0x67, 0x73, 0x29, 0x7d, 0x23, 0x77, 0x73, 0x49, 0x73,
-    0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65, 0x64, 0x28,
-    0x29, 0x7b, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x74,
-    0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x26, 0x26, 0x74,
-    0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x2e, 0x72, 0x65,
-    0x61, 0x64, 0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x3d, 0x3d,
-    0x3d, 0x57, 0x65, 0x62, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74,
-    0x2e, 0x4f, 0x50, 0x45, 0x4e, 0x7d, 0x23, 0x77, 0x73, 0x43,
-    0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x28, 0x29, 0x7b, 0x74,
-    0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x49, 0x73, 0x43,
-    0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65, 0x64, 0x28, 0x29,
-    0x26, 0x26, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73,
-    0x2e, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x28, 0x29, 0x2c, 0x74,
-    0x68, 0x69, 0x73, 0x2e, 0x23, 0x54, 0x6f, 0x6b, 0x65, 0x6e,
-    0x41, 0x63, 0x63, 0x65, 0x70, 0x74, 0x65, 0x64, 0x3d, 0x21,
-    0x31, 0x3b, 0x6c, 0x65, 0x74, 0x20, 0x68, 0x6f, 0x73, 0x74,
-    0x3d, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x6c, 0x6f,
-    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x68, 0x6f, 0x73,
-    0x74, 0x6e, 0x61, 0x6d, 0x65, 0x2c, 0x75, 0x72, 0x6c, 0x3d,
-    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x73, 0x65, 0x63, 0x75,
-    0x72, 0x65, 0x3f, 0x22, 0x77, 0x73, 0x73, 0x3a, 0x2f, 0x2f,
-    0x22, 0x2b, 0x68, 0x6f, 0x73, 0x74, 0x3a, 0x22, 0x77, 0x73,
-    0x3a, 0x2f, 0x2f, 0x22, 0x2b, 0x68, 0x6f, 0x73, 0x74, 0x3b,
-    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x3d, 0x6e,
-    0x65, 0x77, 0x20, 0x57, 0x65, 0x62, 0x53, 0x6f, 0x63, 0x6b,
-    0x65, 0x74, 0x28, 0x60, 0x24, 0x7b, 0x75, 0x72, 0x6c, 0x7d,
-    0x3a, 0x24, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x70,
-    0x6f, 0x72, 0x74, 0x7d, 0x2f, 0x5f, 0x77, 0x65, 0x62, 0x75,
-    0x69, 0x5f, 0x77, 0x73, 0x5f, 0x63, 0x6f, 0x6e, 0x6e, 0x65,
-    0x63, 0x74, 0x60, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e,
-    0x23, 0x77, 0x73, 0x2e, 0x62, 0x69, 0x6e, 0x61, 0x72, 0x79,
-    0x54, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x61, 0x72, 0x72, 0x61,
-    0x79, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x22, 0x2c, 0x74,
-    0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x2e, 0x6f, 0x6e,
-    0x6f, 0x70, 0x65, 0x6e, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e,
-    0x23, 0x77, 0x73, 0x4f, 0x6e, 0x4f, 0x70, 0x65, 0x6e, 0x2e,
-    0x62, 0x69, 0x6e, 0x64, 0x28, 0x74, 0x68, 0x69, 0x73, 0x29,
-    0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x2e,
-    0x6f, 0x6e, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x3d,
-    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x4f, 0x6e,
-    0x4d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x2e, 0x62, 0x69,
-    0x6e, 0x64, 0x28, 0x74, 0x68, 0x69, 0x73, 0x29, 0x2c, 0x74,
-    0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x2e, 0x6f, 0x6e,
-    0x63, 0x6c, 0x6f, 0x73, 0x65, 0x3d, 0x74, 0x68, 0x69, 0x73,
-    0x2e, 0x23, 0x77, 0x73, 0x4f, 0x6e, 0x43, 0x6c, 0x6f, 0x73,
-    0x65, 0x2e, 0x62, 0x69, 0x6e, 0x64, 0x28, 0x74, 0x68, 0x69,
-    0x73, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77,
-    0x73, 0x2e, 0x6f, 0x6e, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x3d,
-    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x4f, 0x6e,
-    0x45, 0x72, 0x72, 0x6f, 0x72, 0x2e, 0x62, 0x69, 0x6e, 0x64,
-    0x28, 0x74, 0x68, 0x69, 0x73, 0x29, 0x7d, 0x23, 0x77, 0x73,
-    0x4f, 0x6e, 0x4f, 0x70, 0x65, 0x6e, 0x3d, 0x65, 0x76, 0x65,
-    0x6e, 0x74, 0x3d, 0x3e, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e,
-    0x23, 0x77, 0x73, 0x57, 0x61, 0x73, 0x43, 0x6f, 0x6e, 0x6e,
-    0x65, 0x63, 0x74, 0x65, 0x64, 0x3d, 0x21, 0x30, 0x2c, 0x74,
-    0x68, 0x69, 0x73, 0x2e, 0x23, 0x75, 0x6e, 0x66, 0x72, 0x65,
-    0x65, 0x7a, 0x65, 0x55, 0x49, 0x28, 0x29, 0x2c, 0x74, 0x68,
-    0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f, 0x67, 0x26, 0x26, 0x63,
-    0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67,
-    0x28, 0x22, 0x57, 0x65, 0x62, 0x55, 0x49, 0x20, 0x2d, 0x3e,
-    0x20, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65, 0x64,
-    0x22, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x63,
-    0x68, 0x65, 0x63, 0x6b, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x28,
-    0x29, 0x7d, 0x3b, 0x23, 0x77, 0x73, 0x4f, 0x6e, 0x45, 0x72,
-    0x72, 0x6f, 0x72, 0x3d, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x3d,
-    0x3e, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f,
-    0x67, 0x26, 0x26, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65,
-    0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x22, 0x57, 0x65, 0x62, 0x55,
-    0x49, 0x20, 0x2d, 0x3e, 0x20, 0x43, 0x6f, 0x6e, 0x6e, 0x65,
-    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x66, 0x61, 0x69, 0x6c,
-    0x65, 0x64, 0x2e, 0x22, 0x29, 0x7d, 0x3b, 0x23, 0x77, 0x73,
-    0x4f, 0x6e, 0x43, 0x6c, 0x6f, 0x73, 0x65, 0x3d, 0x65, 0x76,
-    0x65, 0x6e, 0x74, 0x3d, 0x3e, 0x7b, 0x74, 0x68, 0x69, 0x73,
-    0x2e, 0x23, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x52, 0x65, 0x61,
-    0x73, 0x6f, 0x6e, 0x3d, 0x3d, 0x3d, 0x74, 0x68, 0x69, 0x73,
-    0x2e, 0x23, 0x43, 0x4d, 0x44, 0x5f, 0x4e, 0x41, 0x56, 0x49,
-    0x47, 0x41, 0x54, 0x49, 0x4f, 0x4e, 0x3f, 0x28, 0x74, 0x68,
-    0x69, 0x73, 0x2e, 0x23, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x52,
-    0x65, 0x61, 0x73, 0x6f, 0x6e, 0x3d, 0x30, 0x2c, 0x74, 0x68,
+    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x61, 0x64, 0x64, 0x54,
+    0x6f, 0x6b, 0x65, 0x6e, 0x28, 0x70, 0x61, 0x63, 0x6b, 0x65,
+    0x74, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x74, 0x6f,
+    0x6b, 0x65, 0x6e, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
+    0x50, 0x52, 0x4f, 0x54, 0x4f, 0x43, 0x4f, 0x4c, 0x5f, 0x54,
+    0x4f, 0x4b, 0x45, 0x4e, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73,
+    0x2e, 0x23, 0x61, 0x64, 0x64, 0x49, 0x44, 0x28, 0x70, 0x61,
+    0x63, 0x6b, 0x65, 0x74, 0x2c, 0x63, 0x61, 0x6c, 0x6c, 0x49,
+    0x64, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x50, 0x52,
+    0x4f, 0x54, 0x4f, 0x43, 0x4f, 0x4c, 0x5f, 0x49, 0x44, 0x29,
+    0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x73, 0x65, 0x6e,
+    0x64, 0x44, 0x61, 0x74, 0x61, 0x28, 0x70, 0x61, 0x63, 0x6b,
+    0x65, 0x74, 0x29, 0x7d, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b,
+    0x63, 0x61, 0x73, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x23, 0x43, 0x4d, 0x44, 0x5f, 0x43, 0x41, 0x4c, 0x4c, 0x5f,
+    0x46, 0x55, 0x4e, 0x43, 0x3a, 0x7b, 0x6c, 0x65, 0x74, 0x20,
+    0x63, 0x61, 0x6c, 0x6c, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e,
+    0x73, 0x65, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x67,
+    0x65, 0x74, 0x44, 0x61, 0x74, 0x61, 0x53, 0x74, 0x72, 0x46,
+    0x72, 0x6f, 0x6d, 0x50, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x28,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x38, 0x2c, 0x74, 0x68,
+    0x69, 0x73, 0x2e, 0x23, 0x50, 0x52, 0x4f, 0x54, 0x4f, 0x43,
+    0x4f, 0x4c, 0x5f, 0x44, 0x41, 0x54, 0x41, 0x29, 0x3b, 0x74,
+    0x68, 0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f, 0x67, 0x26, 0x26,
+    0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f,
+    0x67, 0x28, 0x60, 0x57, 0x65, 0x62, 0x55, 0x49, 0x20, 0x2d,
+    0x3e, 0x20, 0x43, 0x4d, 0x44, 0x20, 0x2d, 0x3e, 0x20, 0x43,
+    0x61, 0x6c, 0x6c, 0x20, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e,
+    0x73, 0x65, 0x20, 0x5b, 0x24, 0x7b, 0x63, 0x61, 0x6c, 0x6c,
+    0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x7d, 0x5d,
+    0x60, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x63,
+    0x61, 0x6c, 0x6c, 0x50, 0x72, 0x6f, 0x6d, 0x69, 0x73, 0x65,
+    0x52, 0x65, 0x73, 0x6f, 0x6c, 0x76, 0x65, 0x5b, 0x63, 0x61,
+    0x6c, 0x6c, 0x49, 0x64, 0x5d, 0x26, 0x26, 0x28, 0x74, 0x68,
     0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f, 0x67, 0x26, 0x26, 0x63,
     0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67,
     0x28, 0x60, 0x57, 0x65, 0x62, 0x55, 0x49, 0x20, 0x2d, 0x3e,
-    0x20, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f,
-    0x6e, 0x20, 0x6c, 0x6f, 0x73, 0x74, 0x2e, 0x20, 0x4e, 0x61,
-    0x76, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74,
-    0x6f, 0x20, 0x5b, 0x24, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e,
-    0x23, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x56, 0x61, 0x6c, 0x75,
-    0x65, 0x7d, 0x5d, 0x60, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73,
-    0x2e, 0x23, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x4e, 0x61, 0x76,
-    0x69, 0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x21, 0x30,
-    0x2c, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x54, 0x68, 0x69,
-    0x73, 0x2e, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-    0x2e, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x28, 0x74,
-    0x68, 0x69, 0x73, 0x2e, 0x23, 0x63, 0x6c, 0x6f, 0x73, 0x65,
-    0x56, 0x61, 0x6c, 0x75, 0x65, 0x29, 0x29, 0x3a, 0x74, 0x68,
-    0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x53, 0x74, 0x61, 0x79,
-    0x41, 0x6c, 0x69, 0x76, 0x65, 0x3f, 0x28, 0x74, 0x68, 0x69,
-    0x73, 0x2e, 0x23, 0x6c, 0x6f, 0x67, 0x26, 0x26, 0x63, 0x6f,
-    0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x28,
-    0x60, 0x57, 0x65, 0x62, 0x55, 0x49, 0x20, 0x2d, 0x3e, 0x20,
-    0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-    0x20, 0x6c, 0x6f, 0x73, 0x74, 0x20, 0x28, 0x24, 0x7b, 0x65,
-    0x76, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x6f, 0x64, 0x65, 0x7d,
-    0x29, 0x2e, 0x20, 0x52, 0x65, 0x63, 0x6f, 0x6e, 0x6e, 0x65,
-    0x63, 0x74, 0x69, 0x6e, 0x67, 0x2e, 0x2e, 0x2e, 0x60, 0x29,
-    0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x66, 0x72, 0x65,
-    0x65, 0x7a, 0x65, 0x55, 0x69, 0x28, 0x29, 0x2c, 0x73, 0x65,
-    0x74, 0x54, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x28, 0x28,
-    0x29, 0x3d, 0x3e, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77,
-    0x73, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x28, 0x29,
-    0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x53,
-    0x74, 0x61, 0x79, 0x41, 0x6c, 0x69, 0x76, 0x65, 0x54, 0x69,
-    0x6d, 0x65, 0x6f, 0x75, 0x74, 0x29, 0x29, 0x3a, 0x74, 0x68,
-    0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f, 0x67, 0x3f, 0x28, 0x63,
-    0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67,
-    0x28, 0x60, 0x57, 0x65, 0x62, 0x55, 0x49, 0x20, 0x2d, 0x3e,
-    0x20, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f,
-    0x6e, 0x20, 0x6c, 0x6f, 0x73, 0x74, 0x20, 0x28, 0x24, 0x7b,
-    0x65, 0x76, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x6f, 0x64, 0x65,
-    0x7d, 0x29, 0x60, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e,
-    0x23, 0x66, 0x72, 0x65, 0x65, 0x7a, 0x65, 0x55, 0x69, 0x28,
-    0x29, 0x29, 0x3a, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x63,
-    0x6c, 0x6f, 0x73, 0x65, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77,
-    0x54, 0x69, 0x6d, 0x65, 0x72, 0x28, 0x29, 0x2c, 0x74, 0x68,
-    0x69, 0x73, 0x2e, 0x23, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x73,
-    0x43, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b, 0x26, 0x26,
-    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x65, 0x76, 0x65, 0x6e,
-    0x74, 0x73, 0x43, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b,
-    0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x65, 0x76, 0x65, 0x6e,
-    0x74, 0x2e, 0x44, 0x49, 0x53, 0x43, 0x4f, 0x4e, 0x4e, 0x45,
-    0x43, 0x54, 0x45, 0x44, 0x29, 0x7d, 0x3b, 0x23, 0x77, 0x73,
-    0x4f, 0x6e, 0x4d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x3d,
-    0x61, 0x73, 0x79, 0x6e, 0x63, 0x20, 0x65, 0x76, 0x65, 0x6e,
-    0x74, 0x3d, 0x3e, 0x7b, 0x76, 0x61, 0x72, 0x20, 0x5f, 0x61,
-    0x2c, 0x5f, 0x62, 0x3b, 0x6c, 0x65, 0x74, 0x20, 0x62, 0x75,
-    0x66, 0x66, 0x65, 0x72, 0x38, 0x3d, 0x6e, 0x65, 0x77, 0x20,
-    0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79,
-    0x28, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x2e, 0x64, 0x61, 0x74,
-    0x61, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x21, 0x28, 0x62, 0x75,
-    0x66, 0x66, 0x65, 0x72, 0x38, 0x2e, 0x6c, 0x65, 0x6e, 0x67,
-    0x74, 0x68, 0x3c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x50,
-    0x52, 0x4f, 0x54, 0x4f, 0x43, 0x4f, 0x4c, 0x5f, 0x53, 0x49,
-    0x5a, 0x45, 0x29, 0x26, 0x26, 0x62, 0x75, 0x66, 0x66, 0x65,
-    0x72, 0x38, 0x5b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x50,
-    0x52, 0x4f, 0x54, 0x4f, 0x43, 0x4f, 0x4c, 0x5f, 0x53, 0x49,
-    0x47, 0x4e, 0x5d, 0x3d, 0x3d, 0x3d, 0x74, 0x68, 0x69, 0x73,
-    0x2e, 0x23, 0x57, 0x45, 0x42, 0x55, 0x49, 0x5f, 0x53, 0x49,
-    0x47, 0x4e, 0x41, 0x54, 0x55, 0x52, 0x45, 0x29, 0x69, 0x66,
-    0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x69, 0x73, 0x54,
-    0x65, 0x78, 0x74, 0x42, 0x61, 0x73, 0x65, 0x64, 0x43, 0x6f,
-    0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x28, 0x62, 0x75, 0x66, 0x66,
-    0x65, 0x72, 0x38, 0x5b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
-    0x50, 0x52, 0x4f, 0x54, 0x4f, 0x43, 0x4f, 0x4c, 0x5f, 0x43,
-    0x4d, 0x44, 0x5d, 0x29, 0x29, 0x7b, 0x6c, 0x65, 0x74, 0x20,
-    0x63, 0x61, 0x6c, 0x6c, 0x49, 0x64, 0x3d, 0x74, 0x68, 0x69,
-    0x73, 0x2e, 0x23, 0x67, 0x65, 0x74, 0x49, 0x44, 0x28, 0x62,
-    0x75, 0x66, 0x66, 0x65, 0x72, 0x38, 0x2c, 0x74, 0x68, 0x69,
-    0x73, 0x2e, 0x23, 0x50, 0x52, 0x4f, 0x54, 0x4f, 0x43, 0x4f,
-    0x4c, 0x5f, 0x49, 0x44, 0x29, 0x3b, 0x73, 0x77, 0x69, 0x74,
-    0x63, 0x68, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x38,
-    0x5b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x50, 0x52, 0x4f,
-    0x54, 0x4f, 0x43, 0x4f, 0x4c, 0x5f, 0x43, 0x4d, 0x44, 0x5d,
-    0x29, 0x7b, 0x63, 0x61, 0x73, 0x65, 0x20, 0x74, 0x68, 0x69,
-    0x73, 0x2e, 0x23, 0x43, 0x4d, 0x44, 0x5f, 0x4a, 0x53, 0x5f,
-    0x51, 0x55, 0x49, 0x43, 0x4b, 0x3a, 0x63, 0x61, 0x73, 0x65,
-    0x20, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x43, 0x4d, 0x44,
-    0x5f, 0x4a, 0x53, 0x3a, 0x7b, 0x6c, 0x65, 0x74, 0x20, 0x73,
-    0x63, 0x72, 0x69, 0x70, 0x74, 0x53, 0x61, 0x6e, 0x69, 0x74,
-    0x69, 0x7a, 0x65, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
+    0x20, 0x43, 0x4d, 0x44, 0x20, 0x2d, 0x3e, 0x20, 0x52, 0x65,
+    0x73, 0x6f, 0x6c, 0x76, 0x69, 0x6e, 0x67, 0x20, 0x52, 0x65,
+    0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x20, 0x23, 0x24, 0x7b,
+    0x63, 0x61, 0x6c, 0x6c, 0x49, 0x64, 0x7d, 0x2e, 0x2e, 0x2e,
+    0x60, 0x29, 0x2c, 0x28, 0x5f, 0x62, 0x3d, 0x28, 0x5f, 0x61,
+    0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x63, 0x61, 0x6c,
+    0x6c, 0x50, 0x72, 0x6f, 0x6d, 0x69, 0x73, 0x65, 0x52, 0x65,
+    0x73, 0x6f, 0x6c, 0x76, 0x65, 0x29, 0x5b, 0x63, 0x61, 0x6c,
+    0x6c, 0x49, 0x64, 0x5d, 0x29, 0x3d, 0x3d, 0x6e, 0x75, 0x6c,
+    0x6c, 0x7c, 0x7c, 0x5f, 0x62, 0x2e, 0x63, 0x61, 0x6c, 0x6c,
+    0x28, 0x5f, 0x61, 0x2c, 0x63, 0x61, 0x6c, 0x6c, 0x52, 0x65,
+    0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x29, 0x2c, 0x74, 0x68,
+    0x69, 0x73, 0x2e, 0x23, 0x63, 0x61, 0x6c, 0x6c, 0x50, 0x72,
+    0x6f, 0x6d, 0x69, 0x73, 0x65, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x76, 0x65, 0x5b, 0x63, 0x61, 0x6c, 0x6c, 0x49, 0x64, 0x5d,
+    0x3d, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x30, 0x29, 0x7d, 0x62,
+    0x72, 0x65, 0x61, 0x6b, 0x3b, 0x63, 0x61, 0x73, 0x65, 0x20,
+    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x43, 0x4d, 0x44, 0x5f,
+    0x4e, 0x41, 0x56, 0x49, 0x47, 0x41, 0x54, 0x49, 0x4f, 0x4e,
+    0x3a, 0x6c, 0x65, 0x74, 0x20, 0x75, 0x72, 0x6c, 0x3d, 0x74,
+    0x68, 0x69, 0x73, 0x2e, 0x23, 0x67, 0x65, 0x74, 0x44, 0x61,
+    0x74, 0x61, 0x53, 0x74, 0x72, 0x46, 0x72, 0x6f, 0x6d, 0x50,
+    0x61, 0x63, 0x6b, 0x65, 0x74, 0x28, 0x62, 0x75, 0x66, 0x66,
+    0x65, 0x72, 0x38, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
+    0x50, 0x52, 0x4f, 0x54, 0x4f, 0x43, 0x4f, 0x4c, 0x5f, 0x44,
+    0x41, 0x54, 0x41, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x23, 0x6c, 0x6f, 0x67, 0x26, 0x26, 0x63, 0x6f, 0x6e, 0x73,
+    0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x60, 0x57,
+    0x65, 0x62, 0x55, 0x49, 0x20, 0x2d, 0x3e, 0x20, 0x43, 0x4d,
+    0x44, 0x20, 0x2d, 0x3e, 0x20, 0x4e, 0x61, 0x76, 0x69, 0x67,
+    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x5b, 0x24, 0x7b, 0x75,
+    0x72, 0x6c, 0x7d, 0x5d, 0x60, 0x29, 0x2c, 0x74, 0x68, 0x69,
+    0x73, 0x2e, 0x23, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x28, 0x74,
+    0x68, 0x69, 0x73, 0x2e, 0x23, 0x43, 0x4d, 0x44, 0x5f, 0x4e,
+    0x41, 0x56, 0x49, 0x47, 0x41, 0x54, 0x49, 0x4f, 0x4e, 0x2c,
+    0x75, 0x72, 0x6c, 0x29, 0x3b, 0x62, 0x72, 0x65, 0x61, 0x6b,
+    0x3b, 0x63, 0x61, 0x73, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73,
+    0x2e, 0x23, 0x43, 0x4d, 0x44, 0x5f, 0x57, 0x49, 0x4e, 0x44,
+    0x4f, 0x57, 0x5f, 0x52, 0x45, 0x53, 0x49, 0x5a, 0x45, 0x44,
+    0x3a, 0x6c, 0x65, 0x74, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68,
+    0x41, 0x6e, 0x64, 0x48, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d,
+    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x67, 0x65, 0x74, 0x44,
+    0x61, 0x74, 0x61, 0x53, 0x74, 0x72, 0x46, 0x72, 0x6f, 0x6d,
+    0x50, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x28, 0x62, 0x75, 0x66,
+    0x66, 0x65, 0x72, 0x38, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x23, 0x50, 0x52, 0x4f, 0x54, 0x4f, 0x43, 0x4f, 0x4c, 0x5f,
+    0x44, 0x41, 0x54, 0x41, 0x29, 0x2c, 0x7b, 0x78, 0x2c, 0x79,
+    0x2c, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2c, 0x68, 0x65, 0x69,
+    0x67, 0x68, 0x74, 0x7d, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x23, 0x70, 0x61, 0x72, 0x73, 0x65, 0x44, 0x69, 0x6d, 0x65,
+    0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x28, 0x77, 0x69, 0x64,
+    0x74, 0x68, 0x41, 0x6e, 0x64, 0x48, 0x65, 0x69, 0x67, 0x68,
+    0x74, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x63,
+    0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x57, 0x69, 0x6e, 0x64,
+    0x6f, 0x77, 0x58, 0x3d, 0x78, 0x2c, 0x74, 0x68, 0x69, 0x73,
+    0x2e, 0x23, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x59, 0x3d, 0x79, 0x2c, 0x74,
+    0x68, 0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f, 0x67, 0x26, 0x26,
+    0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f,
+    0x67, 0x28, 0x60, 0x57, 0x65, 0x62, 0x55, 0x49, 0x20, 0x2d,
+    0x3e, 0x20, 0x43, 0x4d, 0x44, 0x20, 0x2d, 0x3e, 0x20, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x20, 0x52, 0x65, 0x73, 0x69,
+    0x7a, 0x65, 0x64, 0x20, 0x5b, 0x78, 0x3a, 0x20, 0x24, 0x7b,
+    0x78, 0x7d, 0x2c, 0x20, 0x79, 0x3a, 0x20, 0x24, 0x7b, 0x79,
+    0x7d, 0x2c, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20,
+    0x24, 0x7b, 0x77, 0x69, 0x64, 0x74, 0x68, 0x7d, 0x2c, 0x20,
+    0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x24, 0x7b,
+    0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x7d, 0x5d, 0x60, 0x29,
+    0x3b, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x63, 0x61, 0x73,
+    0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x43, 0x4d,
+    0x44, 0x5f, 0x4e, 0x45, 0x57, 0x5f, 0x49, 0x44, 0x3a, 0x6c,
+    0x65, 0x74, 0x20, 0x6e, 0x65, 0x77, 0x45, 0x6c, 0x65, 0x6d,
+    0x65, 0x6e, 0x74, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
     0x67, 0x65, 0x74, 0x44, 0x61, 0x74, 0x61, 0x53, 0x74, 0x72,
     0x46, 0x72, 0x6f, 0x6d, 0x50, 0x61, 0x63, 0x6b, 0x65, 0x74,
     0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x38, 0x2c, 0x74,
     0x68, 0x69, 0x73, 0x2e, 0x23, 0x50, 0x52, 0x4f, 0x54, 0x4f,
-    0x43, 0x4f, 0x4c, 0x5f, 0x44, 0x41, 0x54, 0x41, 0x29, 0x2e,
-    0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x28, 0x2f, 0x28,
-    0x3f, 0x3a, 0x5c, 0x72, 0x5c, 0x6e, 0x7c, 0x5c, 0x72, 0x7c,
-    0x5c, 0x6e, 0x29, 0x2f, 0x67, 0x2c, 0x60, 0x0a, 0x60, 0x29,
-    0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f, 0x67,
-    0x26, 0x26, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e,
-    0x6c, 0x6f, 0x67, 0x28, 0x60, 0x57, 0x65, 0x62, 0x55, 0x49,
-    0x20, 0x2d, 0x3e, 0x20, 0x43, 0x4d, 0x44, 0x20, 0x2d, 0x3e,
-    0x20, 0x4a, 0x53, 0x20, 0x5b, 0x24, 0x7b, 0x73, 0x63, 0x72,
-    0x69, 0x70, 0x74, 0x53, 0x61, 0x6e, 0x69, 0x74, 0x69, 0x7a,
-    0x65, 0x7d, 0x5d, 0x60, 0x29, 0x3b, 0x6c, 0x65, 0x74, 0x20,
-    0x46, 0x75, 0x6e, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3d,
-    0x22, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64,
-    0x22, 0x2c, 0x46, 0x75, 0x6e, 0x45, 0x72, 0x72, 0x6f, 0x72,
-    0x3d, 0x21, 0x31, 0x3b, 0x74, 0x72, 0x79, 0x7b, 0x46, 0x75,
-    0x6e, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3d, 0x61, 0x77,
-    0x61, 0x69, 0x74, 0x20, 0x41, 0x73, 0x79, 0x6e, 0x63, 0x46,
-    0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x73, 0x63,
-    0x72, 0x69, 0x70, 0x74, 0x53, 0x61, 0x6e, 0x69, 0x74, 0x69,
-    0x7a, 0x65, 0x29, 0x28, 0x29, 0x7d, 0x63, 0x61, 0x74, 0x63,
-    0x68, 0x28, 0x65, 0x29, 0x7b, 0x46, 0x75, 0x6e, 0x45, 0x72,
-    0x72, 0x6f, 0x72, 0x3d, 0x21, 0x30, 0x2c, 0x46, 0x75, 0x6e,
-    0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3d, 0x65, 0x2e, 0x6d,
-    0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x7d, 0x69, 0x66, 0x28,
-    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x38, 0x5b, 0x74, 0x68,
-    0x69, 0x73, 0x2e, 0x23, 0x50, 0x52, 0x4f, 0x54, 0x4f, 0x43,
-    0x4f, 0x4c, 0x5f, 0x43, 0x4d, 0x44, 0x5d, 0x3d, 0x3d, 0x3d,
-    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x43, 0x4d, 0x44, 0x5f,
-    0x4a, 0x53, 0x5f, 0x51, 0x55, 0x49, 0x43, 0x4b, 0x29, 0x72,
-    0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x46, 0x75, 0x6e, 0x52,
-    0x65, 0x74, 0x75, 0x72, 0x6e, 0x3d, 0x3d, 0x3d, 0x76, 0x6f,
-    0x69, 0x64, 0x20, 0x30, 0x26, 0x26, 0x28, 0x46, 0x75, 0x6e,
-    0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3d, 0x22, 0x75, 0x6e,
-    0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x22, 0x29, 0x2c,
+    0x43, 0x4f, 0x4c, 0x5f, 0x44, 0x41, 0x54, 0x41, 0x29, 0x3b,
     0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f, 0x67, 0x26,
-    0x26, 0x21, 0x46, 0x75, 0x6e, 0x45, 0x72, 0x72, 0x6f, 0x72,
-    0x26, 0x26, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e,
-    0x6c, 0x6f, 0x67, 0x28, 0x60, 0x57, 0x65, 0x62, 0x55, 0x49,
-    0x20, 0x2d, 0x3e, 0x20, 0x43, 0x4d, 0x44, 0x20, 0x2d, 0x3e,
-    0x20, 0x4a, 0x53, 0x20, 0x2d, 0x3e, 0x20, 0x52, 0x65, 0x74,
-    0x75, 0x72, 0x6e, 0x20, 0x53, 0x75, 0x63, 0x63, 0x65, 0x73,
-    0x73, 0x20, 0x5b, 0x24, 0x7b, 0x46, 0x75, 0x6e, 0x52, 0x65,
-    0x74, 0x75, 0x72, 0x6e, 0x7d, 0x5d, 0x60, 0x29, 0x2c, 0x74,
-    0x68, 0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f, 0x67, 0x26, 0x26,
-    0x46, 0x75, 0x6e, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x26, 0x26,
-    0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f,
-    0x67, 0x28, 0x60, 0x57, 0x65, 0x62, 0x55, 0x49, 0x20, 0x2d,
-    0x3e, 0x20, 0x43, 0x4d, 0x44, 0x20, 0x2d, 0x3e, 0x20, 0x4a,
-    0x53, 0x20, 0x2d, 0x3e, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
-    0x6e, 0x20, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x5b, 0x24,
-    0x7b, 0x46, 0x75, 0x6e, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e,
-    0x7d, 0x5d, 0x60, 0x29, 0x3b, 0x6c, 0x65, 0x74, 0x20, 0x70,
-    0x61, 0x63, 0x6b, 0x65, 0x74, 0x3d, 0x6e, 0x65, 0x77, 0x20,
-    0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79,
-    0x28, 0x30, 0x29, 0x2c, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
-    0x50, 0x75, 0x73, 0x68, 0x3d, 0x64, 0x61, 0x74, 0x61, 0x3d,
-    0x3e, 0x7b, 0x6c, 0x65, 0x74, 0x20, 0x6e, 0x65, 0x77, 0x50,
-    0x61, 0x63, 0x6b, 0x65, 0x74, 0x3d, 0x6e, 0x65, 0x77, 0x20,
-    0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79,
-    0x28, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x6c, 0x65,
-    0x6e, 0x67, 0x74, 0x68, 0x2b, 0x64, 0x61, 0x74, 0x61, 0x2e,
-    0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x29, 0x3b, 0x6e, 0x65,
-    0x77, 0x50, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x73, 0x65,
-    0x74, 0x28, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x29, 0x2c,
-    0x6e, 0x65, 0x77, 0x50, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x2e,
-    0x73, 0x65, 0x74, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2c, 0x70,
-    0x61, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x6c, 0x65, 0x6e, 0x67,
-    0x74, 0x68, 0x29, 0x2c, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
-    0x3d, 0x6e, 0x65, 0x77, 0x50, 0x61, 0x63, 0x6b, 0x65, 0x74,
-    0x7d, 0x2c, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x50, 0x75,
-    0x73, 0x68, 0x53, 0x74, 0x72, 0x3d, 0x64, 0x61, 0x74, 0x61,
-    0x3d, 0x3e, 0x7b, 0x69, 0x66, 0x28, 0x64, 0x61, 0x74, 0x61,
-    0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3e, 0x38, 0x31,
-    0x39, 0x32, 0x29, 0x7b, 0x6c, 0x65, 0x74, 0x20, 0x65, 0x6e,
-    0x63, 0x6f, 0x64, 0x65, 0x72, 0x3d, 0x6e, 0x65, 0x77, 0x20,
-    0x54, 0x65, 0x78, 0x74, 0x45, 0x6e, 0x63, 0x6f, 0x64, 0x65,
-    0x72, 0x3b, 0x66, 0x6f, 0x72, 0x28, 0x6c, 0x65, 0x74, 0x20,
-    0x69, 0x3d, 0x30, 0x3b, 0x69, 0x3c, 0x64, 0x61, 0x74, 0x61,
-    0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b, 0x69, 0x2b,
-    0x3d, 0x38, 0x31, 0x39, 0x32, 0x29, 0x7b, 0x6c, 0x65, 0x74,
-    0x20, 0x63, 0x68, 0x75, 0x6e, 0x6b, 0x3d, 0x64, 0x61, 0x74,
-    0x61, 0x2e, 0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x69, 0x6e,
-    0x67, 0x28, 0x69, 0x2c, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x6d,
-    0x69, 0x6e, 0x28, 0x69, 0x2b, 0x38, 0x31, 0x39, 0x32, 0x2c,
-    0x64, 0x61, 0x74, 0x61, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74,
-    0x68, 0x29, 0x29, 0x2c, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65,
-    0x64, 0x43, 0x68, 0x75, 0x6e, 0x6b, 0x3d, 0x65, 0x6e, 0x63,
-    0x6f, 0x64, 0x65, 0x72, 0x2e, 0x65, 0x6e, 0x63, 0x6f, 0x64,
-    0x65, 0x28, 0x63, 0x68, 0x75, 0x6e, 0x6b, 0x29, 0x3b, 0x70,
-    0x61, 0x63, 0x6b, 0x65, 0x74, 0x50, 0x75, 0x73, 0x68, 0x28,
-    0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x64, 0x43, 0x68, 0x75,
-    0x6e, 0x6b, 0x29, 0x7d, 0x7d, 0x65, 0x6c, 0x73, 0x65, 0x20,
-    0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x50, 0x75, 0x73, 0x68,
-    0x28, 0x6e, 0x65, 0x77, 0x20, 0x54, 0x65, 0x78, 0x74, 0x45,
-    0x6e, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x28, 0x29, 0x2e, 0x65,
-    0x6e, 0x63, 0x6f, 0x64, 0x65, 0x28, 0x64, 0x61, 0x74, 0x61,
-    0x29, 0x29, 0x7d, 0x3b, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
-    0x50, 0x75, 0x73, 0x68, 0x28, 0x6e, 0x65, 0x77, 0x20, 0x55,
-    0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28,
-    0x5b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x57, 0x45, 0x42,
-    0x55, 0x49, 0x5f, 0x53, 0x49, 0x47, 0x4e, 0x41, 0x54, 0x55,
-    0x52, 0x45, 0x5d, 0x29, 0x29, 0x2c, 0x70, 0x61, 0x63, 0x6b,
-    0x65, 0x74, 0x50, 0x75, 0x73, 0x68, 0x28, 0x6e, 0x65, 0x77,
-    0x20, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61,
-    0x79, 0x28, 0x5b, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x30,
-    0x5d, 0x29, 0x29, 0x2c, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
-    0x50, 0x75, 0x73, 0x68, 0x28, 0x6e, 0x65, 0x77, 0x20, 0x55,
-    0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28,
-    0x5b, 0x30, 0x2c, 0x30, 0x5d, 0x29, 0x29, 0x2c, 0x70, 0x61,
-    0x63, 0x6b, 0x65, 0x74, 0x50, 0x75, 0x73, 0x68, 0x28, 0x6e,
-    0x65, 0x77, 0x20, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72,
-    0x72, 0x61, 0x79, 0x28, 0x5b, 0x74, 0x68, 0x69, 0x73, 0x2e,
-    0x23, 0x43, 0x4d, 0x44, 0x5f, 0x4a, 0x53, 0x5d, 0x29, 0x29,
-    0x2c, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x50, 0x75, 0x73,
-    0x68, 0x28, 0x6e, 0x65, 0x77, 0x20, 0x55, 0x69, 0x6e, 0x74,
-    0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x46, 0x75, 0x6e,
-    0x45, 0x72, 0x72, 0x6f, 0x72, 0x3f, 0x5b, 0x31, 0x5d, 0x3a,
-    0x5b, 0x30, 0x5d, 0x29, 0x29, 0x2c, 0x70, 0x61, 0x63, 0x6b,
-    0x65, 0x74, 0x50, 0x75, 0x73, 0x68, 0x53, 0x74, 0x72, 0x28,
-    0x46, 0x75, 0x6e, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x29,
-    0x2c, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x50, 0x75, 0x73,
-    0x68, 0x28, 0x6e, 0x65, 0x77, 0x20, 0x55, 0x69, 0x6e, 0x74,
-    0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x5b, 0x30, 0x5d,
-    0x29, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x61,
-    0x64, 0x64, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x28, 0x70, 0x61,
-    0x63, 0x6b, 0x65, 0x74, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e,
-    0x23, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x2c, 0x74, 0x68, 0x69,
-    0x73, 0x2e, 0x23, 0x50, 0x52, 0x4f, 0x54, 0x4f, 0x43, 0x4f,
-    0x4c, 0x5f, 0x54, 0x4f, 0x4b, 0x45, 0x4e, 0x29, 0x2c, 0x74,
-    0x68, 0x69, 0x73, 0x2e, 0x23, 0x61, 0x64, 0x64, 0x49, 0x44,
-    0x28, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x2c, 0x63, 0x61,
-    0x6c, 0x6c, 0x49, 0x64, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e,
-    0x23, 0x50, 0x52, 0x4f, 0x54, 0x4f, 0x43, 0x4f, 0x4c, 0x5f,
-    0x49, 0x44, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
-    0x73, 0x65, 0x6e, 0x64, 0x44, 0x61, 0x74, 0x61, 0x28, 0x70,
-    0x61, 0x63, 0x6b, 0x65, 0x74, 0x29, 0x7d, 0x62, 0x72, 0x65,
-    0x61, 0x6b, 0x3b, 0x63, 0x61, 0x73, 0x65, 0x20, 0x74, 0x68,
-    0x69, 0x73, 0x2e, 0x23, 0x43, 0x4d, 0x44, 0x5f, 0x43, 0x41,
-    0x4c, 0x4c, 0x5f, 0x46, 0x55, 0x4e, 0x43, 0x3a, 0x7b, 0x6c,
-    0x65, 0x74, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x52, 0x65, 0x73,
-    0x70, 0x6f, 0x6e, 0x73, 0x65, 0x3d, 0x74, 0x68, 0x69, 0x73,
+    0x26, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c,
+    0x6f, 0x67, 0x28, 0x60, 0x57, 0x65, 0x62, 0x55, 0x49, 0x20,
+    0x2d, 0x3e, 0x20, 0x43, 0x4d, 0x44, 0x20, 0x2d, 0x3e, 0x20,
+    0x4e, 0x65, 0x77, 0x20, 0x42, 0x69, 0x6e, 0x64, 0x20, 0x49,
+    0x44, 0x20, 0x5b, 0x24, 0x7b, 0x6e, 0x65, 0x77, 0x45, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x7d, 0x5d, 0x60, 0x29, 0x2c,
+    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x62, 0x69, 0x6e, 0x64,
+    0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x69, 0x6e, 0x63, 0x6c,
+    0x75, 0x64, 0x65, 0x73, 0x28, 0x6e, 0x65, 0x77, 0x45, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x29, 0x7c, 0x7c, 0x74, 0x68,
+    0x69, 0x73, 0x2e, 0x23, 0x62, 0x69, 0x6e, 0x64, 0x73, 0x4c,
+    0x69, 0x73, 0x74, 0x2e, 0x70, 0x75, 0x73, 0x68, 0x28, 0x6e,
+    0x65, 0x77, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x29,
+    0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x75, 0x70, 0x64,
+    0x61, 0x74, 0x65, 0x42, 0x69, 0x6e, 0x64, 0x73, 0x4c, 0x69,
+    0x73, 0x74, 0x28, 0x29, 0x3b, 0x62, 0x72, 0x65, 0x61, 0x6b,
+    0x3b, 0x63, 0x61, 0x73, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73,
+    0x2e, 0x23, 0x43, 0x4d, 0x44, 0x5f, 0x43, 0x4c, 0x4f, 0x53,
+    0x45, 0x3a, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f,
+    0x67, 0x3f, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65,
+    0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x22, 0x57, 0x65, 0x62, 0x55,
+    0x49, 0x20, 0x2d, 0x3e, 0x20, 0x43, 0x4d, 0x44, 0x20, 0x2d,
+    0x3e, 0x20, 0x43, 0x6c, 0x6f, 0x73, 0x65, 0x22, 0x29, 0x2c,
+    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x49, 0x73,
+    0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65, 0x64, 0x28,
+    0x29, 0x26, 0x26, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
+    0x77, 0x73, 0x53, 0x74, 0x61, 0x79, 0x41, 0x6c, 0x69, 0x76,
+    0x65, 0x3d, 0x21, 0x31, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x23, 0x77, 0x73, 0x2e, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x28,
+    0x29, 0x29, 0x29, 0x3a, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
+    0x54, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x6c, 0x6f, 0x73, 0x65,
+    0x28, 0x29, 0x3b, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x63,
+    0x61, 0x73, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
+    0x43, 0x4d, 0x44, 0x5f, 0x43, 0x48, 0x45, 0x43, 0x4b, 0x5f,
+    0x54, 0x4b, 0x3a, 0x6c, 0x65, 0x74, 0x20, 0x73, 0x74, 0x61,
+    0x74, 0x75, 0x73, 0x3d, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+    0x38, 0x5b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x50, 0x52,
+    0x4f, 0x54, 0x4f, 0x43, 0x4f, 0x4c, 0x5f, 0x44, 0x41, 0x54,
+    0x41, 0x5d, 0x21, 0x3d, 0x30, 0x2c, 0x74, 0x6f, 0x6b, 0x65,
+    0x6e, 0x48, 0x65, 0x78, 0x3d, 0x60, 0x30, 0x78, 0x24, 0x7b,
+    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x74, 0x6f, 0x6b, 0x65,
+    0x6e, 0x2e, 0x74, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67,
+    0x28, 0x31, 0x36, 0x29, 0x2e, 0x70, 0x61, 0x64, 0x53, 0x74,
+    0x61, 0x72, 0x74, 0x28, 0x38, 0x2c, 0x22, 0x30, 0x22, 0x29,
+    0x7d, 0x60, 0x3b, 0x69, 0x66, 0x28, 0x73, 0x74, 0x61, 0x74,
+    0x75, 0x73, 0x29, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
+    0x6c, 0x6f, 0x67, 0x26, 0x26, 0x63, 0x6f, 0x6e, 0x73, 0x6f,
+    0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x60, 0x57, 0x65,
+    0x62, 0x55, 0x49, 0x20, 0x2d, 0x3e, 0x20, 0x43, 0x4d, 0x44,
+    0x20, 0x2d, 0x3e, 0x20, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x20,
+    0x5b, 0x24, 0x7b, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x48, 0x65,
+    0x78, 0x7d, 0x5d, 0x20, 0x41, 0x63, 0x63, 0x65, 0x70, 0x74,
+    0x65, 0x64, 0x60, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x23, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x41, 0x63, 0x63, 0x65,
+    0x70, 0x74, 0x65, 0x64, 0x3d, 0x21, 0x30, 0x3b, 0x6c, 0x65,
+    0x74, 0x20, 0x63, 0x73, 0x76, 0x3d, 0x74, 0x68, 0x69, 0x73,
     0x2e, 0x23, 0x67, 0x65, 0x74, 0x44, 0x61, 0x74, 0x61, 0x53,
     0x74, 0x72, 0x46, 0x72, 0x6f, 0x6d, 0x50, 0x61, 0x63, 0x6b,
     0x65, 0x74, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x38,
     0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x50, 0x52, 0x4f,
     0x54, 0x4f, 0x43, 0x4f, 0x4c, 0x5f, 0x44, 0x41, 0x54, 0x41,
-    0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f,
-    0x67, 0x26, 0x26, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65,
-    0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x60, 0x57, 0x65, 0x62, 0x55,
-    0x49, 0x20, 0x2d, 0x3e, 0x20, 0x43, 0x4d, 0x44, 0x20, 0x2d,
-    0x3e, 0x20, 0x43, 0x61, 0x6c, 0x6c, 0x20, 0x52, 0x65, 0x73,
-    0x70, 0x6f, 0x6e, 0x73, 0x65, 0x20, 0x5b, 0x24, 0x7b, 0x63,
-    0x61, 0x6c, 0x6c, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73,
-    0x65, 0x7d, 0x5d, 0x60, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73,
-    0x2e, 0x23, 0x63, 0x61, 0x6c, 0x6c, 0x50, 0x72, 0x6f, 0x6d,
-    0x69, 0x73, 0x65, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x76, 0x65,
-    0x5b, 0x63, 0x61, 0x6c, 0x6c, 0x49, 0x64, 0x5d, 0x26, 0x26,
-    0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f, 0x67,
+    0x2b, 0x31, 0x29, 0x3b, 0x63, 0x73, 0x76, 0x3d, 0x63, 0x73,
+    0x76, 0x2e, 0x65, 0x6e, 0x64, 0x73, 0x57, 0x69, 0x74, 0x68,
+    0x28, 0x22, 0x2c, 0x22, 0x29, 0x3f, 0x63, 0x73, 0x76, 0x2e,
+    0x73, 0x6c, 0x69, 0x63, 0x65, 0x28, 0x30, 0x2c, 0x2d, 0x31,
+    0x29, 0x3a, 0x63, 0x73, 0x76, 0x2c, 0x74, 0x68, 0x69, 0x73,
+    0x2e, 0x23, 0x62, 0x69, 0x6e, 0x64, 0x73, 0x4c, 0x69, 0x73,
+    0x74, 0x3d, 0x63, 0x73, 0x76, 0x2e, 0x73, 0x70, 0x6c, 0x69,
+    0x74, 0x28, 0x22, 0x2c, 0x22, 0x29, 0x2c, 0x74, 0x68, 0x69,
+    0x73, 0x2e, 0x23, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x42,
+    0x69, 0x6e, 0x64, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x28, 0x29,
+    0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x65, 0x76, 0x65,
+    0x6e, 0x74, 0x73, 0x43, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63,
+    0x6b, 0x26, 0x26, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x65,
+    0x76, 0x65, 0x6e, 0x74, 0x73, 0x43, 0x61, 0x6c, 0x6c, 0x62,
+    0x61, 0x63, 0x6b, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x65,
+    0x76, 0x65, 0x6e, 0x74, 0x2e, 0x43, 0x4f, 0x4e, 0x4e, 0x45,
+    0x43, 0x54, 0x45, 0x44, 0x29, 0x7d, 0x65, 0x6c, 0x73, 0x65,
+    0x20, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f, 0x67,
     0x26, 0x26, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e,
     0x6c, 0x6f, 0x67, 0x28, 0x60, 0x57, 0x65, 0x62, 0x55, 0x49,
     0x20, 0x2d, 0x3e, 0x20, 0x43, 0x4d, 0x44, 0x20, 0x2d, 0x3e,
-    0x20, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x76, 0x69, 0x6e, 0x67,
-    0x20, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x20,
-    0x23, 0x24, 0x7b, 0x63, 0x61, 0x6c, 0x6c, 0x49, 0x64, 0x7d,
-    0x2e, 0x2e, 0x2e, 0x60, 0x29, 0x2c, 0x28, 0x5f, 0x62, 0x3d,
-    0x28, 0x5f, 0x61, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
-    0x63, 0x61, 0x6c, 0x6c, 0x50, 0x72, 0x6f, 0x6d, 0x69, 0x73,
-    0x65, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x76, 0x65, 0x29, 0x5b,
-    0x63, 0x61, 0x6c, 0x6c, 0x49, 0x64, 0x5d, 0x29, 0x3d, 0x3d,
-    0x6e, 0x75, 0x6c, 0x6c, 0x7c, 0x7c, 0x5f, 0x62, 0x2e, 0x63,
-    0x61, 0x6c, 0x6c, 0x28, 0x5f, 0x61, 0x2c, 0x63, 0x61, 0x6c,
-    0x6c, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x29,
-    0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x63, 0x61, 0x6c,
-    0x6c, 0x50, 0x72, 0x6f, 0x6d, 0x69, 0x73, 0x65, 0x52, 0x65,
-    0x73, 0x6f, 0x6c, 0x76, 0x65, 0x5b, 0x63, 0x61, 0x6c, 0x6c,
-    0x49, 0x64, 0x5d, 0x3d, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x30,
-    0x29, 0x7d, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x63, 0x61,
-    0x73, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x43,
-    0x4d, 0x44, 0x5f, 0x4e, 0x41, 0x56, 0x49, 0x47, 0x41, 0x54,
-    0x49, 0x4f, 0x4e, 0x3a, 0x6c, 0x65, 0x74, 0x20, 0x75, 0x72,
-    0x6c, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x67, 0x65,
-    0x74, 0x44, 0x61, 0x74, 0x61, 0x53, 0x74, 0x72, 0x46, 0x72,
-    0x6f, 0x6d, 0x50, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x28, 0x62,
-    0x75, 0x66, 0x66, 0x65, 0x72, 0x38, 0x2c, 0x74, 0x68, 0x69,
-    0x73, 0x2e, 0x23, 0x50, 0x52, 0x4f, 0x54, 0x4f, 0x43, 0x4f,
-    0x4c, 0x5f, 0x44, 0x41, 0x54, 0x41, 0x29, 0x3b, 0x74, 0x68,
-    0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f, 0x67, 0x26, 0x26, 0x63,
-    0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67,
-    0x28, 0x60, 0x57, 0x65, 0x62, 0x55, 0x49, 0x20, 0x2d, 0x3e,
-    0x20, 0x43, 0x4d, 0x44, 0x20, 0x2d, 0x3e, 0x20, 0x4e, 0x61,
-    0x76, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x5b,
-    0x24, 0x7b, 0x75, 0x72, 0x6c, 0x7d, 0x5d, 0x60, 0x29, 0x2c,
-    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x63, 0x6c, 0x6f, 0x73,
-    0x65, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x43, 0x4d,
-    0x44, 0x5f, 0x4e, 0x41, 0x56, 0x49, 0x47, 0x41, 0x54, 0x49,
-    0x4f, 0x4e, 0x2c, 0x75, 0x72, 0x6c, 0x29, 0x3b, 0x62, 0x72,
-    0x65, 0x61, 0x6b, 0x3b, 0x63, 0x61, 0x73, 0x65, 0x20, 0x74,
-    0x68, 0x69, 0x73, 0x2e, 0x23, 0x43, 0x4d, 0x44, 0x5f, 0x57,
-    0x49, 0x4e, 0x44, 0x4f, 0x57, 0x5f, 0x52, 0x45, 0x53, 0x49,
-    0x5a, 0x45, 0x44, 0x3a, 0x6c, 0x65, 0x74, 0x20, 0x77, 0x69,
-    0x64, 0x74, 0x68, 0x41, 0x6e, 0x64, 0x48, 0x65, 0x69, 0x67,
-    0x68, 0x74, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x67,
-    0x65, 0x74, 0x44, 0x61, 0x74, 0x61, 0x53, 0x74, 0x72, 0x46,
-    0x72, 0x6f, 0x6d, 0x50, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x28,
-    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x38, 0x2c, 0x74, 0x68,
-    0x69, 0x73, 0x2e, 0x23, 0x50, 0x52, 0x4f, 0x54, 0x4f, 0x43,
-    0x4f, 0x4c, 0x5f, 0x44, 0x41, 0x54, 0x41, 0x29, 0x2c, 0x7b,
-    0x78, 0x2c, 0x79, 0x2c, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2c,
-    0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x7d, 0x3d, 0x74, 0x68,
-    0x69, 0x73, 0x2e, 0x23, 0x70, 0x61, 0x72, 0x73, 0x65, 0x44,
-    0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x28,
-    0x77, 0x69, 0x64, 0x74, 0x68, 0x41, 0x6e, 0x64, 0x48, 0x65,
-    0x69, 0x67, 0x68, 0x74, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73,
-    0x2e, 0x23, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x57,
-    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x58, 0x3d, 0x78, 0x2c, 0x74,
-    0x68, 0x69, 0x73, 0x2e, 0x23, 0x63, 0x75, 0x72, 0x72, 0x65,
-    0x6e, 0x74, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x59, 0x3d,
-    0x79, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f,
-    0x67, 0x26, 0x26, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65,
-    0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x60, 0x57, 0x65, 0x62, 0x55,
-    0x49, 0x20, 0x2d, 0x3e, 0x20, 0x43, 0x4d, 0x44, 0x20, 0x2d,
-    0x3e, 0x20, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x20, 0x52,
-    0x65, 0x73, 0x69, 0x7a, 0x65, 0x64, 0x20, 0x5b, 0x78, 0x3a,
-    0x20, 0x24, 0x7b, 0x78, 0x7d, 0x2c, 0x20, 0x79, 0x3a, 0x20,
-    0x24, 0x7b, 0x79, 0x7d, 0x2c, 0x20, 0x77, 0x69, 0x64, 0x74,
-    0x68, 0x3a, 0x20, 0x24, 0x7b, 0x77, 0x69, 0x64, 0x74, 0x68,
-    0x7d, 0x2c, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a,
-    0x20, 0x24, 0x7b, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x7d,
-    0x5d, 0x60, 0x29, 0x3b, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b,
-    0x63, 0x61, 0x73, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2e,
-    0x23, 0x43, 0x4d, 0x44, 0x5f, 0x4e, 0x45, 0x57, 0x5f, 0x49,
-    0x44, 0x3a, 0x6c, 0x65, 0x74, 0x20, 0x6e, 0x65, 0x77, 0x45,
-    0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3d, 0x74, 0x68, 0x69,
-    0x73, 0x2e, 0x23, 0x67, 0x65, 0x74, 0x44, 0x61, 0x74, 0x61,
-    0x53, 0x74, 0x72, 0x46, 0x72, 0x6f, 0x6d, 0x50, 0x61, 0x63,
-    0x6b, 0x65, 0x74, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
-    0x38, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x50, 0x52,
-    0x4f, 0x54, 0x4f, 0x43, 0x4f, 0x4c, 0x5f, 0x44, 0x41, 0x54,
-    0x41, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x6c,
-    0x6f, 0x67, 0x26, 0x26, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c,
-    0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x60, 0x57, 0x65, 0x62,
-    0x55, 0x49, 0x20, 0x2d, 0x3e, 0x20, 0x43, 0x4d, 0x44, 0x20,
-    0x2d, 0x3e, 0x20, 0x4e, 0x65, 0x77, 0x20, 0x42, 0x69, 0x6e,
-    0x64, 0x20, 0x49, 0x44, 0x20, 0x5b, 0x24, 0x7b, 0x6e, 0x65,
-    0x77, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x7d, 0x5d,
-    0x60, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x62,
-    0x69, 0x6e, 0x64, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x69,
-    0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x73, 0x28, 0x6e, 0x65,
-    0x77, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x29, 0x7c,
-    0x7c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x62, 0x69, 0x6e,
-    0x64, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x70, 0x75, 0x73,
-    0x68, 0x28, 0x6e, 0x65, 0x77, 0x45, 0x6c, 0x65, 0x6d, 0x65,
-    0x6e, 0x74, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
-    0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x42, 0x69, 0x6e, 0x64,
-    0x73, 0x4c, 0x69, 0x73, 0x74, 0x28, 0x29, 0x3b, 0x62, 0x72,
-    0x65, 0x61, 0x6b, 0x3b, 0x63, 0x61, 0x73, 0x65, 0x20, 0x74,
-    0x68, 0x69, 0x73, 0x2e, 0x23, 0x43, 0x4d, 0x44, 0x5f, 0x43,
-    0x4c, 0x4f, 0x53, 0x45, 0x3a, 0x74, 0x68, 0x69, 0x73, 0x2e,
-    0x23, 0x6c, 0x6f, 0x67, 0x3f, 0x28, 0x63, 0x6f, 0x6e, 0x73,
-    0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x22, 0x57,
-    0x65, 0x62, 0x55, 0x49, 0x20, 0x2d, 0x3e, 0x20, 0x43, 0x4d,
-    0x44, 0x20, 0x2d, 0x3e, 0x20, 0x43, 0x6c, 0x6f, 0x73, 0x65,
-    0x22, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77,
-    0x73, 0x49, 0x73, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74,
-    0x65, 0x64, 0x28, 0x29, 0x26, 0x26, 0x28, 0x74, 0x68, 0x69,
+    0x20, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x20, 0x5b, 0x24, 0x7b,
+    0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x48, 0x65, 0x78, 0x7d, 0x5d,
+    0x20, 0x4e, 0x6f, 0x74, 0x20, 0x41, 0x63, 0x63, 0x65, 0x70,
+    0x74, 0x65, 0x64, 0x2e, 0x20, 0x52, 0x65, 0x6c, 0x6f, 0x61,
+    0x64, 0x20, 0x70, 0x61, 0x67, 0x65, 0x2e, 0x2e, 0x2e, 0x60,
+    0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x61, 0x6c,
+    0x6c, 0x6f, 0x77, 0x4e, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74,
+    0x69, 0x6f, 0x6e, 0x3d, 0x21, 0x30, 0x2c, 0x74, 0x68, 0x69,
     0x73, 0x2e, 0x23, 0x77, 0x73, 0x53, 0x74, 0x61, 0x79, 0x41,
-    0x6c, 0x69, 0x76, 0x65, 0x3d, 0x21, 0x31, 0x2c, 0x74, 0x68,
-    0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x2e, 0x63, 0x6c, 0x6f,
-    0x73, 0x65, 0x28, 0x29, 0x29, 0x29, 0x3a, 0x67, 0x6c, 0x6f,
-    0x62, 0x61, 0x6c, 0x54, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x6c,
-    0x6f, 0x73, 0x65, 0x28, 0x29, 0x3b, 0x62, 0x72, 0x65, 0x61,
-    0x6b, 0x3b, 0x63, 0x61, 0x73, 0x65, 0x20, 0x74, 0x68, 0x69,
-    0x73, 0x2e, 0x23, 0x43, 0x4d, 0x44, 0x5f, 0x43, 0x48, 0x45,
-    0x43, 0x4b, 0x5f, 0x54, 0x4b, 0x3a, 0x6c, 0x65, 0x74, 0x20,
-    0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x3d, 0x62, 0x75, 0x66,
-    0x66, 0x65, 0x72, 0x38, 0x5b, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x6c, 0x69, 0x76, 0x65, 0x3d, 0x21, 0x31, 0x2c, 0x67, 0x6c,
+    0x6f, 0x62, 0x61, 0x6c, 0x54, 0x68, 0x69, 0x73, 0x2e, 0x6c,
+    0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x72, 0x65,
+    0x6c, 0x6f, 0x61, 0x64, 0x28, 0x29, 0x3b, 0x62, 0x72, 0x65,
+    0x61, 0x6b, 0x7d, 0x7d, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x73,
+    0x77, 0x69, 0x74, 0x63, 0x68, 0x28, 0x62, 0x75, 0x66, 0x66,
+    0x65, 0x72, 0x38, 0x5b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
+    0x50, 0x52, 0x4f, 0x54, 0x4f, 0x43, 0x4f, 0x4c, 0x5f, 0x43,
+    0x4d, 0x44, 0x5d, 0x29, 0x7b, 0x63, 0x61, 0x73, 0x65, 0x20,
+    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x43, 0x4d, 0x44, 0x5f,
+    0x53, 0x45, 0x4e, 0x44, 0x5f, 0x52, 0x41, 0x57, 0x3a, 0x6c,
+    0x65, 0x74, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+    0x6e, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x74, 0x68, 0x69, 0x73,
+    0x2e, 0x23, 0x67, 0x65, 0x74, 0x44, 0x61, 0x74, 0x61, 0x53,
+    0x74, 0x72, 0x46, 0x72, 0x6f, 0x6d, 0x50, 0x61, 0x63, 0x6b,
+    0x65, 0x74, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x38,
+    0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x50, 0x52, 0x4f,
+    0x54, 0x4f, 0x43, 0x4f, 0x4c, 0x5f, 0x44, 0x41, 0x54, 0x41,
+    0x29, 0x2c, 0x72, 0x61, 0x77, 0x44, 0x61, 0x74, 0x61, 0x49,
+    0x6e, 0x64, 0x65, 0x78, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e,
     0x23, 0x50, 0x52, 0x4f, 0x54, 0x4f, 0x43, 0x4f, 0x4c, 0x5f,
-    0x44, 0x41, 0x54, 0x41, 0x5d, 0x21, 0x3d, 0x30, 0x2c, 0x74,
-    0x6f, 0x6b, 0x65, 0x6e, 0x48, 0x65, 0x78, 0x3d, 0x60, 0x30,
-    0x78, 0x24, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x74,
-    0x6f, 0x6b, 0x65, 0x6e, 0x2e, 0x74, 0x6f, 0x53, 0x74, 0x72,
-    0x69, 0x6e, 0x67, 0x28, 0x31, 0x36, 0x29, 0x2e, 0x70, 0x61,
-    0x64, 0x53, 0x74, 0x61, 0x72, 0x74, 0x28, 0x38, 0x2c, 0x22,
-    0x30, 0x22, 0x29, 0x7d, 0x60, 0x3b, 0x69, 0x66, 0x28, 0x73,
-    0x74, 0x61, 0x74, 0x75, 0x73, 0x29, 0x7b, 0x74, 0x68, 0x69,
+    0x44, 0x41, 0x54, 0x41, 0x2b, 0x66, 0x75, 0x6e, 0x63, 0x74,
+    0x69, 0x6f, 0x6e, 0x4e, 0x61, 0x6d, 0x65, 0x2e, 0x6c, 0x65,
+    0x6e, 0x67, 0x74, 0x68, 0x2b, 0x31, 0x2c, 0x72, 0x61, 0x77,
+    0x44, 0x61, 0x74, 0x61, 0x53, 0x69, 0x7a, 0x65, 0x3d, 0x62,
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x38, 0x2e, 0x6c, 0x65, 0x6e,
+    0x67, 0x74, 0x68, 0x2d, 0x72, 0x61, 0x77, 0x44, 0x61, 0x74,
+    0x61, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x2d, 0x31, 0x2c, 0x75,
+    0x73, 0x65, 0x72, 0x52, 0x61, 0x77, 0x44, 0x61, 0x74, 0x61,
+    0x3d, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x38, 0x2e, 0x73,
+    0x75, 0x62, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x72, 0x61,
+    0x77, 0x44, 0x61, 0x74, 0x61, 0x49, 0x6e, 0x64, 0x65, 0x78,
+    0x2c, 0x72, 0x61, 0x77, 0x44, 0x61, 0x74, 0x61, 0x49, 0x6e,
+    0x64, 0x65, 0x78, 0x2b, 0x72, 0x61, 0x77, 0x44, 0x61, 0x74,
+    0x61, 0x53, 0x69, 0x7a, 0x65, 0x29, 0x3b, 0x74, 0x68, 0x69,
     0x73, 0x2e, 0x23, 0x6c, 0x6f, 0x67, 0x26, 0x26, 0x63, 0x6f,
     0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x28,
     0x60, 0x57, 0x65, 0x62, 0x55, 0x49, 0x20, 0x2d, 0x3e, 0x20,
-    0x43, 0x4d, 0x44, 0x20, 0x2d, 0x3e, 0x20, 0x54, 0x6f, 0x6b,
-    0x65, 0x6e, 0x20, 0x5b, 0x24, 0x7b, 0x74, 0x6f, 0x6b, 0x65,
-    0x6e, 0x48, 0x65, 0x78, 0x7d, 0x5d, 0x20, 0x41, 0x63, 0x63,
-    0x65, 0x70, 0x74, 0x65, 0x64, 0x60, 0x29, 0x2c, 0x74, 0x68,
-    0x69, 0x73, 0x2e, 0x23, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x41,
-    0x63, 0x63, 0x65, 0x70, 0x74, 0x65, 0x64, 0x3d, 0x21, 0x30,
-    0x3b, 0x6c, 0x65, 0x74, 0x20, 0x63, 0x73, 0x76, 0x3d, 0x74,
-    0x68, 0x69, 0x73, 0x2e, 0x23, 0x67, 0x65, 0x74, 0x44, 0x61,
-    0x74, 0x61, 0x53, 0x74, 0x72, 0x46, 0x72, 0x6f, 0x6d, 0x50,
-    0x61, 0x63, 0x6b, 0x65, 0x74, 0x28, 0x62, 0x75, 0x66, 0x66,
-    0x65, 0x72, 0x38, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
-    0x50, 0x52, 0x4f, 0x54, 0x4f, 0x43, 0x4f, 0x4c, 0x5f, 0x44,
-    0x41, 0x54, 0x41, 0x2b, 0x31, 0x29, 0x3b, 0x63, 0x73, 0x76,
-    0x3d, 0x63, 0x73, 0x76, 0x2e, 0x65, 0x6e, 0x64, 0x73, 0x57,
-    0x69, 0x74, 0x68, 0x28, 0x22, 0x2c, 0x22, 0x29, 0x3f, 0x63,
-    0x73, 0x76, 0x2e, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x28, 0x30,
-    0x2c, 0x2d, 0x31, 0x29, 0x3a, 0x63, 0x73, 0x76, 0x2c, 0x74,
-    0x68, 0x69, 0x73, 0x2e, 0x23, 0x62, 0x69, 0x6e, 0x64, 0x73,
-    0x4c, 0x69, 0x73, 0x74, 0x3d, 0x63, 0x73, 0x76, 0x2e, 0x73,
-    0x70, 0x6c, 0x69, 0x74, 0x28, 0x22, 0x2c, 0x22, 0x29, 0x2c,
-    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x75, 0x70, 0x64, 0x61,
-    0x74, 0x65, 0x42, 0x69, 0x6e, 0x64, 0x73, 0x4c, 0x69, 0x73,
-    0x74, 0x28, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
-    0x65, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x43, 0x61, 0x6c, 0x6c,
-    0x62, 0x61, 0x63, 0x6b, 0x26, 0x26, 0x74, 0x68, 0x69, 0x73,
-    0x2e, 0x23, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x43, 0x61,
-    0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b, 0x28, 0x74, 0x68, 0x69,
-    0x73, 0x2e, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x2e, 0x43, 0x4f,
-    0x4e, 0x4e, 0x45, 0x43, 0x54, 0x45, 0x44, 0x29, 0x7d, 0x65,
-    0x6c, 0x73, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
-    0x6c, 0x6f, 0x67, 0x26, 0x26, 0x63, 0x6f, 0x6e, 0x73, 0x6f,
-    0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x60, 0x57, 0x65,
-    0x62, 0x55, 0x49, 0x20, 0x2d, 0x3e, 0x20, 0x43, 0x4d, 0x44,
-    0x20, 0x2d, 0x3e, 0x20, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x20,
-    0x5b, 0x24, 0x7b, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x48, 0x65,
-    0x78, 0x7d, 0x5d, 0x20, 0x4e, 0x6f, 0x74, 0x20, 0x41, 0x63,
-    0x63, 0x65, 0x70, 0x74, 0x65, 0x64, 0x2e, 0x20, 0x52, 0x65,
-    0x6c, 0x6f, 0x61, 0x64, 0x20, 0x70, 0x61, 0x67, 0x65, 0x2e,
-    0x2e, 0x2e, 0x60, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e,
-    0x23, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x4e, 0x61, 0x76, 0x69,
-    0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x21, 0x30, 0x2c,
-    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x53, 0x74,
-    0x61, 0x79, 0x41, 0x6c, 0x69, 0x76, 0x65, 0x3d, 0x21, 0x31,
-    0x2c, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x54, 0x68, 0x69,
-    0x73, 0x2e, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-    0x2e, 0x72, 0x65, 0x6c, 0x6f, 0x61, 0x64, 0x28, 0x29, 0x3b,
-    0x62, 0x72, 0x65, 0x61, 0x6b, 0x7d, 0x7d, 0x65, 0x6c, 0x73,
-    0x65, 0x20, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x28, 0x62,
-    0x75, 0x66, 0x66, 0x65, 0x72, 0x38, 0x5b, 0x74, 0x68, 0x69,
-    0x73, 0x2e, 0x23, 0x50, 0x52, 0x4f, 0x54, 0x4f, 0x43, 0x4f,
-    0x4c, 0x5f, 0x43, 0x4d, 0x44, 0x5d, 0x29, 0x7b, 0x63, 0x61,
-    0x73, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x43,
-    0x4d, 0x44, 0x5f, 0x53, 0x45, 0x4e, 0x44, 0x5f, 0x52, 0x41,
-    0x57, 0x3a, 0x6c, 0x65, 0x74, 0x20, 0x66, 0x75, 0x6e, 0x63,
-    0x74, 0x69, 0x6f, 0x6e, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x74,
-    0x68, 0x69, 0x73, 0x2e, 0x23, 0x67, 0x65, 0x74, 0x44, 0x61,
-    0x74, 0x61, 0x53, 0x74, 0x72, 0x46, 0x72, 0x6f, 0x6d, 0x50,
-    0x61, 0x63, 0x6b, 0x65, 0x74, 0x28, 0x62, 0x75, 0x66, 0x66,
-    0x65, 0x72, 0x38, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
-    0x50, 0x52, 0x4f, 0x54, 0x4f, 0x43, 0x4f, 0x4c, 0x5f, 0x44,
-    0x41, 0x54, 0x41, 0x29, 0x2c, 0x72, 0x61, 0x77, 0x44, 0x61,
-    0x74, 0x61, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x3d, 0x74, 0x68,
-    0x69, 0x73, 0x2e, 0x23, 0x50, 0x52, 0x4f, 0x54, 0x4f, 0x43,
-    0x4f, 0x4c, 0x5f, 0x44, 0x41, 0x54, 0x41, 0x2b, 0x66, 0x75,
+    0x43, 0x4d, 0x44, 0x20, 0x2d, 0x3e, 0x20, 0x52, 0x65, 0x63,
+    0x65, 0x69, 0x76, 0x65, 0x64, 0x20, 0x52, 0x61, 0x77, 0x20,
+    0x24, 0x7b, 0x72, 0x61, 0x77, 0x44, 0x61, 0x74, 0x61, 0x53,
+    0x69, 0x7a, 0x65, 0x7d, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73,
+    0x20, 0x66, 0x6f, 0x72, 0x20, 0x5b, 0x24, 0x7b, 0x66, 0x75,
     0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x4e, 0x61, 0x6d, 0x65,
-    0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x2b, 0x31, 0x2c,
-    0x72, 0x61, 0x77, 0x44, 0x61, 0x74, 0x61, 0x53, 0x69, 0x7a,
-    0x65, 0x3d, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x38, 0x2e,
-    0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x2d, 0x72, 0x61, 0x77,
-    0x44, 0x61, 0x74, 0x61, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x2d,
-    0x31, 0x2c, 0x75, 0x73, 0x65, 0x72, 0x52, 0x61, 0x77, 0x44,
-    0x61, 0x74, 0x61, 0x3d, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
-    0x38, 0x2e, 0x73, 0x75, 0x62, 0x61, 0x72, 0x72, 0x61, 0x79,
-    0x28, 0x72, 0x61, 0x77, 0x44, 0x61, 0x74, 0x61, 0x49, 0x6e,
-    0x64, 0x65, 0x78, 0x2c, 0x72, 0x61, 0x77, 0x44, 0x61, 0x74,
-    0x61, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x2b, 0x72, 0x61, 0x77,
-    0x44, 0x61, 0x74, 0x61, 0x53, 0x69, 0x7a, 0x65, 0x29, 0x3b,
-    0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f, 0x67, 0x26,
-    0x26, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c,
-    0x6f, 0x67, 0x28, 0x60, 0x57, 0x65, 0x62, 0x55, 0x49, 0x20,
-    0x2d, 0x3e, 0x20, 0x43, 0x4d, 0x44, 0x20, 0x2d, 0x3e, 0x20,
-    0x52, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x20, 0x52,
-    0x61, 0x77, 0x20, 0x24, 0x7b, 0x72, 0x61, 0x77, 0x44, 0x61,
-    0x74, 0x61, 0x53, 0x69, 0x7a, 0x65, 0x7d, 0x20, 0x62, 0x79,
-    0x74, 0x65, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x5b, 0x24,
-    0x7b, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x4e,
-    0x61, 0x6d, 0x65, 0x7d, 0x28, 0x29, 0x5d, 0x60, 0x29, 0x2c,
-    0x74, 0x79, 0x70, 0x65, 0x6f, 0x66, 0x20, 0x77, 0x69, 0x6e,
+    0x7d, 0x28, 0x29, 0x5d, 0x60, 0x29, 0x2c, 0x74, 0x79, 0x70,
+    0x65, 0x6f, 0x66, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77,
+    0x5b, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x4e,
+    0x61, 0x6d, 0x65, 0x5d, 0x3d, 0x3d, 0x22, 0x66, 0x75, 0x6e,
+    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x3f, 0x77, 0x69, 0x6e,
     0x64, 0x6f, 0x77, 0x5b, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69,
-    0x6f, 0x6e, 0x4e, 0x61, 0x6d, 0x65, 0x5d, 0x3d, 0x3d, 0x22,
-    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x3f,
-    0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5b, 0x66, 0x75, 0x6e,
-    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x4e, 0x61, 0x6d, 0x65, 0x5d,
-    0x28, 0x75, 0x73, 0x65, 0x72, 0x52, 0x61, 0x77, 0x44, 0x61,
-    0x74, 0x61, 0x29, 0x3a, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20,
-    0x41, 0x73, 0x79, 0x6e, 0x63, 0x46, 0x75, 0x6e, 0x63, 0x74,
-    0x69, 0x6f, 0x6e, 0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69,
-    0x6f, 0x6e, 0x4e, 0x61, 0x6d, 0x65, 0x2b, 0x22, 0x28, 0x75,
-    0x73, 0x65, 0x72, 0x52, 0x61, 0x77, 0x44, 0x61, 0x74, 0x61,
-    0x29, 0x22, 0x29, 0x28, 0x29, 0x3b, 0x62, 0x72, 0x65, 0x61,
-    0x6b, 0x7d, 0x7d, 0x3b, 0x61, 0x73, 0x79, 0x6e, 0x63, 0x20,
-    0x63, 0x61, 0x6c, 0x6c, 0x28, 0x66, 0x6e, 0x2c, 0x2e, 0x2e,
-    0x2e, 0x61, 0x72, 0x67, 0x73, 0x29, 0x7b, 0x69, 0x66, 0x28,
-    0x21, 0x66, 0x6e, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
-    0x20, 0x50, 0x72, 0x6f, 0x6d, 0x69, 0x73, 0x65, 0x2e, 0x72,
-    0x65, 0x6a, 0x65, 0x63, 0x74, 0x28, 0x6e, 0x65, 0x77, 0x20,
-    0x53, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x45, 0x72, 0x72, 0x6f,
-    0x72, 0x28, 0x22, 0x4e, 0x6f, 0x20, 0x62, 0x69, 0x6e, 0x64,
-    0x69, 0x6e, 0x67, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x69,
-    0x73, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x64,
-    0x22, 0x29, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x21, 0x74, 0x68,
-    0x69, 0x73, 0x2e, 0x23, 0x77, 0x73, 0x49, 0x73, 0x43, 0x6f,
-    0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65, 0x64, 0x28, 0x29, 0x29,
-    0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x50, 0x72, 0x6f,
-    0x6d, 0x69, 0x73, 0x65, 0x2e, 0x72, 0x65, 0x6a, 0x65, 0x63,
-    0x74, 0x28, 0x6e, 0x65, 0x77, 0x20, 0x45, 0x72, 0x72, 0x6f,
-    0x72, 0x28, 0x22, 0x57, 0x65, 0x62, 0x53, 0x6f, 0x63, 0x6b,
-    0x65, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20,
-    0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65, 0x64, 0x22,
-    0x29, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x66, 0x6e, 0x21, 0x3d,
-    0x3d, 0x22, 0x5f, 0x5f, 0x77, 0x65, 0x62, 0x75, 0x69, 0x5f,
-    0x63, 0x6f, 0x72, 0x65, 0x5f, 0x61, 0x70, 0x69, 0x5f, 0x5f,
-    0x22, 0x26, 0x26, 0x21, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
-    0x41, 0x6c, 0x6c, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x26,
-    0x26, 0x21, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x62, 0x69,
-    0x6e, 0x64, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x69, 0x6e,
-    0x63, 0x6c, 0x75, 0x64, 0x65, 0x73, 0x28, 0x60, 0x24, 0x7b,
-    0x66, 0x6e, 0x7d, 0x60, 0x29, 0x29, 0x72, 0x65, 0x74, 0x75,
-    0x72, 0x6e, 0x20, 0x50, 0x72, 0x6f, 0x6d, 0x69, 0x73, 0x65,
-    0x2e, 0x72, 0x65, 0x6a, 0x65, 0x63, 0x74, 0x28, 0x6e, 0x65,
-    0x77, 0x20, 0x52, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x63,
-    0x65, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x60, 0x4e, 0x6f,
-    0x20, 0x62, 0x69, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x77,
-    0x61, 0x73, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x66,
-    0x6f, 0x72, 0x20, 0x22, 0x24, 0x7b, 0x66, 0x6e, 0x7d, 0x22,
-    0x60, 0x29, 0x29, 0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
-    0x6c, 0x6f, 0x67, 0x26, 0x26, 0x63, 0x6f, 0x6e, 0x73, 0x6f,
-    0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x60, 0x57, 0x65,
-    0x62, 0x55, 0x49, 0x20, 0x2d, 0x3e, 0x20, 0x43, 0x61, 0x6c,
-    0x6c, 0x69, 0x6e, 0x67, 0x20, 0x5b, 0x24, 0x7b, 0x66, 0x6e,
-    0x7d, 0x28, 0x2e, 0x2e, 0x2e, 0x29, 0x5d, 0x60, 0x29, 0x3b,
-    0x6c, 0x65, 0x74, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e,
-    0x73, 0x65, 0x3d, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x74,
-    0x68, 0x69, 0x73, 0x2e, 0x23, 0x63, 0x61, 0x6c, 0x6c, 0x50,
-    0x72, 0x6f, 0x6d, 0x69, 0x73, 0x65, 0x28, 0x66, 0x6e, 0x2c,
-    0x2e, 0x2e, 0x2e, 0x61, 0x72, 0x67, 0x73, 0x29, 0x3b, 0x72,
-    0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x74, 0x79, 0x70, 0x65,
-    0x6f, 0x66, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73,
-    0x65, 0x21, 0x3d, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
-    0x22, 0x3f, 0x22, 0x22, 0x3a, 0x72, 0x65, 0x73, 0x70, 0x6f,
-    0x6e, 0x73, 0x65, 0x7d, 0x73, 0x65, 0x74, 0x4c, 0x6f, 0x67,
-    0x67, 0x69, 0x6e, 0x67, 0x28, 0x73, 0x74, 0x61, 0x74, 0x75,
-    0x73, 0x29, 0x7b, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x3f,
-    0x28, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c,
-    0x6f, 0x67, 0x28, 0x22, 0x57, 0x65, 0x62, 0x55, 0x49, 0x20,
-    0x2d, 0x3e, 0x20, 0x4c, 0x6f, 0x67, 0x20, 0x45, 0x6e, 0x61,
+    0x6f, 0x6e, 0x4e, 0x61, 0x6d, 0x65, 0x5d, 0x28, 0x75, 0x73,
+    0x65, 0x72, 0x52, 0x61, 0x77, 0x44, 0x61, 0x74, 0x61, 0x29,
+    0x3a, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x41, 0x73, 0x79,
+    0x6e, 0x63, 0x46, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+    0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x4e,
+    0x61, 0x6d, 0x65, 0x2b, 0x22, 0x28, 0x75, 0x73, 0x65, 0x72,
+    0x52, 0x61, 0x77, 0x44, 0x61, 0x74, 0x61, 0x29, 0x22, 0x29,
+    0x28, 0x29, 0x3b, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x7d, 0x7d,
+    0x3b, 0x61, 0x73, 0x79, 0x6e, 0x63, 0x20, 0x63, 0x61, 0x6c,
+    0x6c, 0x28, 0x66, 0x6e, 0x2c, 0x2e, 0x2e, 0x2e, 0x61, 0x72,
+    0x67, 0x73, 0x29, 0x7b, 0x69, 0x66, 0x28, 0x21, 0x66, 0x6e,
+    0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x50, 0x72,
+    0x6f, 0x6d, 0x69, 0x73, 0x65, 0x2e, 0x72, 0x65, 0x6a, 0x65,
+    0x63, 0x74, 0x28, 0x6e, 0x65, 0x77, 0x20, 0x53, 0x79, 0x6e,
+    0x74, 0x61, 0x78, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x22,
+    0x4e, 0x6f, 0x20, 0x62, 0x69, 0x6e, 0x64, 0x69, 0x6e, 0x67,
+    0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x69, 0x73, 0x20, 0x70,
+    0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x64, 0x22, 0x29, 0x29,
+    0x3b, 0x69, 0x66, 0x28, 0x21, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x23, 0x77, 0x73, 0x49, 0x73, 0x43, 0x6f, 0x6e, 0x6e, 0x65,
+    0x63, 0x74, 0x65, 0x64, 0x28, 0x29, 0x29, 0x72, 0x65, 0x74,
+    0x75, 0x72, 0x6e, 0x20, 0x50, 0x72, 0x6f, 0x6d, 0x69, 0x73,
+    0x65, 0x2e, 0x72, 0x65, 0x6a, 0x65, 0x63, 0x74, 0x28, 0x6e,
+    0x65, 0x77, 0x20, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x22,
+    0x57, 0x65, 0x62, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x20,
+    0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x63, 0x6f, 0x6e,
+    0x6e, 0x65, 0x63, 0x74, 0x65, 0x64, 0x22, 0x29, 0x29, 0x3b,
+    0x69, 0x66, 0x28, 0x66, 0x6e, 0x21, 0x3d, 0x3d, 0x22, 0x5f,
+    0x5f, 0x77, 0x65, 0x62, 0x75, 0x69, 0x5f, 0x63, 0x6f, 0x72,
+    0x65, 0x5f, 0x61, 0x70, 0x69, 0x5f, 0x5f, 0x22, 0x26, 0x26,
+    0x21, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x41, 0x6c, 0x6c,
+    0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x26, 0x26, 0x21, 0x74,
+    0x68, 0x69, 0x73, 0x2e, 0x23, 0x62, 0x69, 0x6e, 0x64, 0x73,
+    0x4c, 0x69, 0x73, 0x74, 0x2e, 0x69, 0x6e, 0x63, 0x6c, 0x75,
+    0x64, 0x65, 0x73, 0x28, 0x60, 0x24, 0x7b, 0x66, 0x6e, 0x7d,
+    0x60, 0x29, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20,
+    0x50, 0x72, 0x6f, 0x6d, 0x69, 0x73, 0x65, 0x2e, 0x72, 0x65,
+    0x6a, 0x65, 0x63, 0x74, 0x28, 0x6e, 0x65, 0x77, 0x20, 0x52,
+    0x65, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x63, 0x65, 0x45, 0x72,
+    0x72, 0x6f, 0x72, 0x28, 0x60, 0x4e, 0x6f, 0x20, 0x62, 0x69,
+    0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x77, 0x61, 0x73, 0x20,
+    0x66, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20,
+    0x22, 0x24, 0x7b, 0x66, 0x6e, 0x7d, 0x22, 0x60, 0x29, 0x29,
+    0x3b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f, 0x67,
+    0x26, 0x26, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e,
+    0x6c, 0x6f, 0x67, 0x28, 0x60, 0x57, 0x65, 0x62, 0x55, 0x49,
+    0x20, 0x2d, 0x3e, 0x20, 0x43, 0x61, 0x6c, 0x6c, 0x69, 0x6e,
+    0x67, 0x20, 0x5b, 0x24, 0x7b, 0x66, 0x6e, 0x7d, 0x28, 0x2e,
+    0x2e, 0x2e, 0x29, 0x5d, 0x60, 0x29, 0x3b, 0x6c, 0x65, 0x74,
+    0x20, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x3d,
+    0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x74, 0x68, 0x69, 0x73,
+    0x2e, 0x23, 0x63, 0x61, 0x6c, 0x6c, 0x50, 0x72, 0x6f, 0x6d,
+    0x69, 0x73, 0x65, 0x28, 0x66, 0x6e, 0x2c, 0x2e, 0x2e, 0x2e,
+    0x61, 0x72, 0x67, 0x73, 0x29, 0x3b, 0x72, 0x65, 0x74, 0x75,
+    0x72, 0x6e, 0x20, 0x74, 0x79, 0x70, 0x65, 0x6f, 0x66, 0x20,
+    0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x21, 0x3d,
+    0x22, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x22, 0x3f, 0x22,
+    0x22, 0x3a, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65,
+    0x7d, 0x73, 0x65, 0x74, 0x4c, 0x6f, 0x67, 0x67, 0x69, 0x6e,
+    0x67, 0x28, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x29, 0x7b,
+    0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x3f, 0x28, 0x63, 0x6f,
+    0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x28,
+    0x22, 0x57, 0x65, 0x62, 0x55, 0x49, 0x20, 0x2d, 0x3e, 0x20,
+    0x4c, 0x6f, 0x67, 0x20, 0x45, 0x6e, 0x61, 0x62, 0x6c, 0x65,
+    0x64, 0x2e, 0x22, 0x29, 0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x23, 0x6c, 0x6f, 0x67, 0x3d, 0x21, 0x30, 0x29, 0x3a, 0x28,
+    0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f,
+    0x67, 0x28, 0x22, 0x57, 0x65, 0x62, 0x55, 0x49, 0x20, 0x2d,
+    0x3e, 0x20, 0x4c, 0x6f, 0x67, 0x20, 0x44, 0x69, 0x73, 0x61,
     0x62, 0x6c, 0x65, 0x64, 0x2e, 0x22, 0x29, 0x2c, 0x74, 0x68,
-    0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f, 0x67, 0x3d, 0x21, 0x30,
-    0x29, 0x3a, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65,
-    0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x22, 0x57, 0x65, 0x62, 0x55,
-    0x49, 0x20, 0x2d, 0x3e, 0x20, 0x4c, 0x6f, 0x67, 0x20, 0x44,
-    0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x2e, 0x22, 0x29,
-    0x2c, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f, 0x67,
-    0x3d, 0x21, 0x31, 0x29, 0x7d, 0x65, 0x6e, 0x63, 0x6f, 0x64,
-    0x65, 0x28, 0x64, 0x61, 0x74, 0x61, 0x29, 0x7b, 0x72, 0x65,
-    0x74, 0x75, 0x72, 0x6e, 0x20, 0x62, 0x74, 0x6f, 0x61, 0x28,
-    0x64, 0x61, 0x74, 0x61, 0x29, 0x7d, 0x64, 0x65, 0x63, 0x6f,
-    0x64, 0x65, 0x28, 0x64, 0x61, 0x74, 0x61, 0x29, 0x7b, 0x72,
-    0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x61, 0x74, 0x6f, 0x62,
-    0x28, 0x64, 0x61, 0x74, 0x61, 0x29, 0x7d, 0x73, 0x65, 0x74,
-    0x45, 0x76, 0x65, 0x6e, 0x74, 0x43, 0x61, 0x6c, 0x6c, 0x62,
-    0x61, 0x63, 0x6b, 0x28, 0x63, 0x61, 0x6c, 0x6c, 0x62, 0x61,
-    0x63, 0x6b, 0x29, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23,
-    0x65, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x43, 0x61, 0x6c, 0x6c,
-    0x62, 0x61, 0x63, 0x6b, 0x3d, 0x63, 0x61, 0x6c, 0x6c, 0x62,
-    0x61, 0x63, 0x6b, 0x7d, 0x69, 0x73, 0x43, 0x6f, 0x6e, 0x6e,
-    0x65, 0x63, 0x74, 0x65, 0x64, 0x28, 0x29, 0x7b, 0x72, 0x65,
+    0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f, 0x67, 0x3d, 0x21, 0x31,
+    0x29, 0x7d, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x28, 0x64,
+    0x61, 0x74, 0x61, 0x29, 0x7b, 0x72, 0x65, 0x74, 0x75, 0x72,
+    0x6e, 0x20, 0x62, 0x74, 0x6f, 0x61, 0x28, 0x64, 0x61, 0x74,
+    0x61, 0x29, 0x7d, 0x64, 0x65, 0x63, 0x6f, 0x64, 0x65, 0x28,
+    0x64, 0x61, 0x74, 0x61, 0x29, 0x7b, 0x72, 0x65, 0x74, 0x75,
+    0x72, 0x6e, 0x20, 0x61, 0x74, 0x6f, 0x62, 0x28, 0x64, 0x61,
+    0x74, 0x61, 0x29, 0x7d, 0x73, 0x65, 0x74, 0x45, 0x76, 0x65,
+    0x6e, 0x74, 0x43, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b,
+    0x28, 0x63, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b, 0x29,
+    0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x65, 0x76, 0x65,
+    0x6e, 0x74, 0x73, 0x43, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63,
+    0x6b, 0x3d, 0x63, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b,
+    0x7d, 0x69, 0x73, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74,
+    0x65, 0x64, 0x28, 0x29, 0x7b, 0x72, 0x65, 0x74, 0x75, 0x72,
+    0x6e, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x77, 0x73,
+    0x49, 0x73, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65,
+    0x64, 0x28, 0x29, 0x26, 0x26, 0x74, 0x68, 0x69, 0x73, 0x2e,
+    0x23, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x41, 0x63, 0x63, 0x65,
+    0x70, 0x74, 0x65, 0x64, 0x7d, 0x61, 0x73, 0x79, 0x6e, 0x63,
+    0x20, 0x69, 0x73, 0x48, 0x69, 0x67, 0x68, 0x43, 0x6f, 0x6e,
+    0x74, 0x72, 0x61, 0x73, 0x74, 0x28, 0x29, 0x7b, 0x6c, 0x65,
+    0x74, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65,
+    0x3d, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x74, 0x68, 0x69,
+    0x73, 0x2e, 0x63, 0x61, 0x6c, 0x6c, 0x43, 0x6f, 0x72, 0x65,
+    0x28, 0x22, 0x68, 0x69, 0x67, 0x68, 0x5f, 0x63, 0x6f, 0x6e,
+    0x74, 0x72, 0x61, 0x73, 0x74, 0x22, 0x29, 0x3b, 0x72, 0x65,
     0x74, 0x75, 0x72, 0x6e, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2e,
-    0x23, 0x77, 0x73, 0x49, 0x73, 0x43, 0x6f, 0x6e, 0x6e, 0x65,
-    0x63, 0x74, 0x65, 0x64, 0x28, 0x29, 0x26, 0x26, 0x74, 0x68,
-    0x69, 0x73, 0x2e, 0x23, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x41,
-    0x63, 0x63, 0x65, 0x70, 0x74, 0x65, 0x64, 0x7d, 0x61, 0x73,
-    0x79, 0x6e, 0x63, 0x20, 0x69, 0x73, 0x48, 0x69, 0x67, 0x68,
-    0x43, 0x6f, 0x6e, 0x74, 0x72, 0x61, 0x73, 0x74, 0x28, 0x29,
-    0x7b, 0x6c, 0x65, 0x74, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6f,
-    0x6e, 0x73, 0x65, 0x3d, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20,
-    0x74, 0x68, 0x69, 0x73, 0x2e, 0x63, 0x61, 0x6c, 0x6c, 0x43,
-    0x6f, 0x72, 0x65, 0x28, 0x22, 0x68, 0x69, 0x67, 0x68, 0x5f,
-    0x63, 0x6f, 0x6e, 0x74, 0x72, 0x61, 0x73, 0x74, 0x22, 0x29,
-    0x3b, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x74, 0x68,
-    0x69, 0x73, 0x2e, 0x23, 0x6c, 0x6f, 0x67, 0x26, 0x26, 0x63,
-    0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67,
-    0x28, 0x60, 0x43, 0x6f, 0x72, 0x65, 0x20, 0x52, 0x65, 0x73,
-    0x70, 0x6f, 0x6e, 0x73, 0x65, 0x3a, 0x20, 0x5b, 0x24, 0x7b,
-    0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x7d, 0x5d,
-    0x60, 0x29, 0x2c, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73,
-    0x65, 0x7d, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x4e, 0x61, 0x76,
-    0x69, 0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x73, 0x74,
-    0x61, 0x74, 0x75, 0x73, 0x29, 0x7b, 0x74, 0x68, 0x69, 0x73,
-    0x2e, 0x23, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x4e, 0x61, 0x76,
-    0x69, 0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x73, 0x74,
-    0x61, 0x74, 0x75, 0x73, 0x7d, 0x7d, 0x3b, 0x61, 0x64, 0x64,
+    0x23, 0x6c, 0x6f, 0x67, 0x26, 0x26, 0x63, 0x6f, 0x6e, 0x73,
+    0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x60, 0x43,
+    0x6f, 0x72, 0x65, 0x20, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e,
+    0x73, 0x65, 0x3a, 0x20, 0x5b, 0x24, 0x7b, 0x72, 0x65, 0x73,
+    0x70, 0x6f, 0x6e, 0x73, 0x65, 0x7d, 0x5d, 0x60, 0x29, 0x2c,
+    0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x7d, 0x61,
+    0x6c, 0x6c, 0x6f, 0x77, 0x4e, 0x61, 0x76, 0x69, 0x67, 0x61,
+    0x74, 0x69, 0x6f, 0x6e, 0x28, 0x73, 0x74, 0x61, 0x74, 0x75,
+    0x73, 0x29, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x23, 0x61,
+    0x6c, 0x6c, 0x6f, 0x77, 0x4e, 0x61, 0x76, 0x69, 0x67, 0x61,
+    0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x73, 0x74, 0x61, 0x74, 0x75,
+    0x73, 0x7d, 0x7d, 0x3b, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65,
+    0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72,
+    0x28, 0x22, 0x6c, 0x6f, 0x61, 0x64, 0x22, 0x2c, 0x28, 0x29,
+    0x3d, 0x3e, 0x7b, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e,
+    0x74, 0x2e, 0x62, 0x6f, 0x64, 0x79, 0x2e, 0x61, 0x64, 0x64,
     0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65,
-    0x6e, 0x65, 0x72, 0x28, 0x22, 0x6c, 0x6f, 0x61, 0x64, 0x22,
-    0x2c, 0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x64, 0x6f, 0x63, 0x75,
-    0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x62, 0x6f, 0x64, 0x79, 0x2e,
-    0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69,
-    0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 0x6f,
-    0x6e, 0x74, 0x65, 0x78, 0x74, 0x6d, 0x65, 0x6e, 0x75, 0x22,
-    0x2c, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x3d, 0x3e, 0x65, 0x76,
-    0x65, 0x6e, 0x74, 0x2e, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6e,
-    0x74, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x28, 0x29,
-    0x29, 0x2c, 0x61, 0x64, 0x64, 0x52, 0x65, 0x66, 0x72, 0x65,
-    0x73, 0x68, 0x61, 0x62, 0x6c, 0x65, 0x45, 0x76, 0x65, 0x6e,
-    0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28,
-    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x62,
-    0x6f, 0x64, 0x79, 0x2c, 0x22, 0x69, 0x6e, 0x70, 0x75, 0x74,
-    0x22, 0x2c, 0x22, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74,
-    0x6d, 0x65, 0x6e, 0x75, 0x22, 0x2c, 0x65, 0x76, 0x65, 0x6e,
-    0x74, 0x3d, 0x3e, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x2e, 0x73,
-    0x74, 0x6f, 0x70, 0x50, 0x72, 0x6f, 0x70, 0x61, 0x67, 0x61,
-    0x74, 0x69, 0x6f, 0x6e, 0x28, 0x29, 0x29, 0x7d, 0x29, 0x3b,
-    0x0a,
+    0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 0x6f, 0x6e, 0x74, 0x65,
+    0x78, 0x74, 0x6d, 0x65, 0x6e, 0x75, 0x22, 0x2c, 0x65, 0x76,
+    0x65, 0x6e, 0x74, 0x3d, 0x3e, 0x65, 0x76, 0x65, 0x6e, 0x74,
+    0x2e, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x44, 0x65,
+    0x66, 0x61, 0x75, 0x6c, 0x74, 0x28, 0x29, 0x29, 0x2c, 0x61,
+    0x64, 0x64, 0x52, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x61,
+    0x62, 0x6c, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69,
+    0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x64, 0x6f, 0x63,
+    0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x62, 0x6f, 0x64, 0x79,
+    0x2c, 0x22, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x22, 0x2c, 0x22,
+    0x63, 0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74, 0x6d, 0x65, 0x6e,
+    0x75, 0x22, 0x2c, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x3d, 0x3e,
+    0x65, 0x76, 0x65, 0x6e, 0x74, 0x2e, 0x73, 0x74, 0x6f, 0x70,
+    0x50, 0x72, 0x6f, 0x70, 0x61, 0x67, 0x61, 0x74, 0x69, 0x6f,
+    0x6e, 0x28, 0x29, 0x29, 0x7d, 0x29, 0x3b, 0x0a,
     0x00
 };
+unsigned char webinix_javascript_bridge_gz[] = { 
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03,
+    0xd5, 0x3c, 0x6b, 0x57, 0xdb, 0xb8, 0xb6, 0xdf, 0xe7, 0x57,
+    0x18, 0xd3, 0x9b, 0x65, 0x2d, 0x8c, 0x9b, 0xa4, 0xd0, 0xe9,
+    0x24, 0x15, 0x2c, 0x1a, 0xe8, 0x94, 0x33, 0x14, 0x7a, 0x80,
+    0x1e, 0x86, 0xcb, 0xb0, 0x52, 0xc5, 0x56, 0x12, 0x9d, 0x3a,
+    0x76, 0xae, 0xac, 0x10, 0x32, 0xc1, 0xff, 0xfd, 0xae, 0xad,
+    0x87, 0x2d, 0xe7, 0x01, 0x94, 0xf3, 0xba, 0x77, 0xcd, 0x1a,
+    0x62, 0x49, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0xd2, 0x7e, 0xa9,
+    0xaf, 0x5f, 0x3b, 0x57, 0xb4, 0xc7, 0x12, 0x76, 0xef, 0xdc,
+    0x35, 0x83, 0xdd, 0xa0, 0xbe, 0xdd, 0xa3, 0x82, 0x04, 0x3b,
+    0x3f, 0xbd, 0x7e, 0xed, 0x0c, 0x85, 0x18, 0x67, 0xad, 0xd7,
+    0xaf, 0xa7, 0x0a, 0x20, 0x18, 0x51, 0xbb, 0x76, 0xc0, 0xc4,
+    0x70, 0xd2, 0x0b, 0xc2, 0x74, 0x64, 0x00, 0xb6, 0x23, 0x7a,
+    0x67, 0xbe, 0x01, 0xb2, 0x93, 0x8e, 0x67, 0x9c, 0x0d, 0x86,
+    0xc2, 0xf1, 0x42, 0xe4, 0x34, 0xeb, 0xcd, 0xfa, 0x76, 0xb3,
+    0xde, 0xdc, 0x75, 0x3e, 0x91, 0x2c, 0x23, 0x89, 0x73, 0xc8,
+    0xc9, 0x80, 0x04, 0x00, 0x78, 0xc2, 0x42, 0x9a, 0x64, 0x34,
+    0x72, 0x26, 0x49, 0x44, 0xb9, 0xf3, 0xf9, 0xf8, 0xd2, 0x54,
+    0xc9, 0xe6, 0x83, 0x38, 0x76, 0x24, 0x9e, 0xcc, 0xe1, 0x34,
+    0xa3, 0xfc, 0x8e, 0x46, 0xb2, 0xbe, 0x43, 0x12, 0x12, 0x91,
+    0xe0, 0xa7, 0x9f, 0xdc, 0x49, 0x46, 0xb7, 0x33, 0xc1, 0x59,
+    0x28, 0xdc, 0x76, 0x7f, 0x92, 0x84, 0x82, 0xa5, 0x89, 0x43,
+    0xa2, 0xe8, 0x9c, 0xf6, 0x39, 0xcd, 0x86, 0xa4, 0x17, 0xd3,
+    0xa3, 0x3b, 0x9a, 0x88, 0x13, 0x96, 0x09, 0x9a, 0x50, 0xee,
+    0xf1, 0x34, 0x15, 0xbe, 0x20, 0x7c, 0x40, 0xc5, 0x05, 0x8d,
+    0x69, 0x28, 0x52, 0xee, 0x8b, 0xd9, 0x98, 0xfa, 0xb1, 0x86,
+    0xf0, 0xd3, 0x31, 0x20, 0xc9, 0xd0, 0xbc, 0xc0, 0xc7, 0x61,
+    0x66, 0x51, 0x81, 0x62, 0x34, 0x11, 0xc4, 0x80, 0xa4, 0xdc,
+    0x8b, 0xa9, 0x70, 0x4c, 0x95, 0x93, 0xf6, 0x9d, 0xb2, 0xd9,
+    0xb4, 0x26, 0x69, 0x44, 0xed, 0x96, 0x80, 0x44, 0x11, 0x8d,
+    0x4e, 0xd3, 0x88, 0x66, 0x68, 0xce, 0xfa, 0xde, 0x86, 0x27,
+    0x21, 0x58, 0x92, 0x09, 0x92, 0x84, 0x34, 0xed, 0x3b, 0x9f,
+    0x2e, 0x3f, 0x9f, 0x1c, 0xc5, 0x74, 0x44, 0x13, 0x81, 0x10,
+    0xa7, 0x62, 0xc2, 0x93, 0x36, 0xc0, 0x04, 0x23, 0x22, 0xc2,
+    0x21, 0xcd, 0xbc, 0xea, 0x0c, 0x50, 0xad, 0x26, 0x5b, 0x49,
+    0x14, 0x55, 0x67, 0xbb, 0x7a, 0x66, 0x6d, 0x43, 0x58, 0x38,
+    0x64, 0x71, 0x04, 0x94, 0xc9, 0xde, 0xff, 0x33, 0xa1, 0x7c,
+    0x66, 0x50, 0x1e, 0xc4, 0xf1, 0xe2, 0x20, 0x48, 0x81, 0xaf,
+    0x26, 0xb3, 0x56, 0x93, 0xad, 0xcf, 0x25, 0x21, 0xcf, 0x61,
+    0xfc, 0xb4, 0x27, 0x17, 0x95, 0xe3, 0x84, 0x4e, 0x9d, 0xcf,
+    0x9a, 0x3b, 0x67, 0xba, 0xd2, 0xab, 0xb2, 0x1d, 0xb5, 0x15,
+    0x1f, 0x8a, 0x4e, 0x81, 0xfe, 0x50, 0x4b, 0x3a, 0xcf, 0x26,
+    0x3d, 0xc1, 0x29, 0x6d, 0x6d, 0xd4, 0x7d, 0x49, 0x09, 0xf4,
+    0x6b, 0x6d, 0xd4, 0x73, 0xe4, 0x9b, 0x0e, 0xf9, 0x1d, 0xe1,
+    0xce, 0x41, 0x36, 0x4b, 0xc2, 0x8f, 0x7a, 0x65, 0xb1, 0x47,
+    0xa0, 0xe8, 0x98, 0x95, 0xf6, 0xd0, 0x3c, 0x47, 0x41, 0x98,
+    0x26, 0x99, 0xe0, 0x13, 0x98, 0x73, 0x1b, 0xba, 0x5c, 0xd1,
+    0xde, 0x84, 0x9d, 0xa4, 0x21, 0x89, 0x2f, 0xd2, 0xf0, 0x3b,
+    0x15, 0x38, 0x8c, 0x49, 0x96, 0xcd, 0x7b, 0x2c, 0x21, 0x7c,
+    0x76, 0x39, 0x1b, 0x53, 0xec, 0x12, 0xce, 0xc9, 0xac, 0x37,
+    0xe9, 0xf7, 0x29, 0x77, 0xdb, 0x9c, 0x92, 0x68, 0x76, 0x21,
+    0x88, 0xa0, 0xf8, 0x8a, 0xf6, 0x54, 0x9f, 0xa0, 0x73, 0x76,
+    0x7a, 0x7a, 0xd4, 0xb9, 0x3c, 0x3e, 0xfd, 0xb5, 0x9d, 0x26,
+    0xe9, 0x98, 0x26, 0x38, 0x99, 0xc4, 0x71, 0x3b, 0x4d, 0x46,
+    0x34, 0xcb, 0xc8, 0x80, 0x9a, 0x62, 0x18, 0xa7, 0x59, 0x51,
+    0xa0, 0x9c, 0xa7, 0x5c, 0x15, 0x2c, 0xa2, 0x3c, 0x34, 0x1f,
+    0xc4, 0x69, 0x8f, 0xc4, 0x97, 0x43, 0x96, 0x05, 0xdd, 0xae,
+    0xde, 0x78, 0xdd, 0x18, 0x48, 0xec, 0x72, 0x1a, 0xde, 0xe1,
+    0x88, 0x08, 0x82, 0xf7, 0x40, 0xb6, 0x04, 0xc0, 0x94, 0x14,
+    0x6d, 0x60, 0x8b, 0xa6, 0xb3, 0x2f, 0x47, 0xa7, 0x46, 0xba,
+    0x60, 0x39, 0x7a, 0x33, 0x41, 0x33, 0xfc, 0x95, 0x25, 0xe2,
+    0xdd, 0x01, 0x4c, 0x28, 0xe8, 0xf3, 0x74, 0xe4, 0x11, 0x91,
+    0xf6, 0x3c, 0x40, 0x88, 0xfc, 0x10, 0xef, 0x85, 0x41, 0x38,
+    0x24, 0xbc, 0x93, 0x46, 0xf4, 0x40, 0x78, 0x75, 0x84, 0xda,
+    0x72, 0x80, 0x62, 0x1a, 0xfb, 0x81, 0x27, 0xd7, 0x52, 0x95,
+    0xa4, 0x24, 0x78, 0xae, 0x6e, 0x73, 0xfd, 0x39, 0xa0, 0x69,
+    0xc9, 0x61, 0x02, 0xc5, 0xad, 0x1c, 0xa1, 0xdc, 0x5f, 0x92,
+    0x19, 0x77, 0x4c, 0x06, 0x74, 0xc8, 0x22, 0xea, 0xfa, 0x1e,
+    0xc2, 0x7b, 0x72, 0x08, 0xc9, 0x18, 0x0f, 0x21, 0x3f, 0xa3,
+    0xe2, 0x92, 0x8d, 0x68, 0x3a, 0x11, 0x1e, 0x34, 0xce, 0x65,
+    0xeb, 0xe6, 0x38, 0xcd, 0x84, 0xe7, 0x02, 0x63, 0x5d, 0xe4,
+    0x2f, 0x4c, 0x7a, 0x61, 0xca, 0xbe, 0x26, 0x19, 0x80, 0x35,
+    0xbd, 0x9a, 0x50, 0xd5, 0x1d, 0xe5, 0x7e, 0x1d, 0xe5, 0x19,
+    0x4d, 0x22, 0x35, 0xed, 0x97, 0xb1, 0x11, 0xba, 0xda, 0x7b,
+    0xa5, 0x64, 0xeb, 0xbe, 0xe4, 0x02, 0x0c, 0x5b, 0xd6, 0x69,
+    0x06, 0x2b, 0x99, 0xc2, 0xae, 0x5b, 0x6c, 0x51, 0x86, 0xeb,
+    0x6d, 0xf6, 0x5e, 0xb1, 0x2c, 0xa6, 0xc9, 0x40, 0x0c, 0xdb,
+    0x6c, 0x0b, 0xbf, 0x69, 0xfe, 0xfc, 0xf6, 0x1d, 0x52, 0xd0,
+    0x5b, 0xf8, 0x42, 0x70, 0x96, 0x0c, 0xe4, 0x6a, 0x75, 0xf4,
+    0xe2, 0x78, 0x41, 0x10, 0xa8, 0x4e, 0xd9, 0xa4, 0x27, 0xa5,
+    0xd3, 0x63, 0x3e, 0xdb, 0x52, 0xfd, 0xf4, 0xa2, 0x29, 0x9e,
+    0xf5, 0x44, 0x4a, 0x3c, 0x85, 0x09, 0xa1, 0x5c, 0x73, 0x79,
+    0xfe, 0xd8, 0x7c, 0x3b, 0x27, 0x67, 0x17, 0x47, 0x87, 0xb5,
+    0x9a, 0xb7, 0x9e, 0xcd, 0x0a, 0xc4, 0xb7, 0x97, 0x46, 0x62,
+    0x36, 0x6b, 0xa3, 0xe5, 0x5c, 0x73, 0xbf, 0x03, 0xdf, 0x7a,
+    0x09, 0x14, 0x98, 0x3f, 0x0f, 0xd3, 0x88, 0xb6, 0x1a, 0xf4,
+    0x4d, 0x8e, 0x10, 0xca, 0x15, 0x0a, 0x2d, 0x46, 0x15, 0xe9,
+    0x9f, 0xd2, 0xde, 0x77, 0x26, 0x02, 0xdd, 0xf4, 0x89, 0x24,
+    0x51, 0x4c, 0xb9, 0xac, 0x96, 0x17, 0x17, 0xf4, 0xd3, 0xb2,
+    0x58, 0x74, 0xcf, 0xf3, 0x72, 0x57, 0x7f, 0xe0, 0x2c, 0x1a,
+    0x50, 0xbd, 0xa1, 0x37, 0x33, 0x1a, 0x4e, 0x38, 0x6d, 0x6f,
+    0x8a, 0xf4, 0x3b, 0x4d, 0xda, 0x9b, 0xe3, 0x94, 0x8b, 0xf6,
+    0xe6, 0x98, 0x88, 0x61, 0x7b, 0x53, 0xee, 0x2d, 0xf8, 0x19,
+    0xb4, 0x37, 0xa7, 0x2c, 0xf9, 0x5d, 0xfe, 0xbd, 0x96, 0x7f,
+    0xaf, 0xe4, 0xdf, 0x4f, 0xed, 0x4d, 0x96, 0xc1, 0xc5, 0x36,
+    0x60, 0xc9, 0x00, 0x6f, 0x34, 0xda, 0x9b, 0x2c, 0x61, 0x82,
+    0x91, 0xf8, 0x73, 0x3a, 0xc9, 0xe8, 0xef, 0xb8, 0x5e, 0xad,
+    0xb8, 0xb6, 0x2a, 0xae, 0x58, 0x12, 0xa5, 0xd3, 0xdf, 0xf1,
+    0x54, 0xfe, 0x06, 0x59, 0xc8, 0x29, 0x4d, 0x7e, 0x7f, 0x78,
+    0xa8, 0x94, 0x4f, 0x68, 0x5f, 0x2c, 0xf4, 0xb8, 0xae, 0xf6,
+    0xb8, 0x5e, 0xe8, 0x71, 0x99, 0x8e, 0xdb, 0x9b, 0xe1, 0x84,
+    0x73, 0x9a, 0x88, 0x1f, 0x18, 0xa2, 0xd2, 0xe3, 0x39, 0x43,
+    0x4c, 0x33, 0xf8, 0xff, 0x42, 0x90, 0xd9, 0x41, 0xcc, 0xee,
+    0x28, 0xde, 0xa8, 0x57, 0xca, 0x7a, 0xaf, 0xe2, 0xdd, 0xba,
+    0xac, 0xbf, 0x22, 0x59, 0x27, 0x4d, 0x12, 0x1a, 0x0a, 0x1a,
+    0x49, 0x36, 0x5d, 0x02, 0xb3, 0x0f, 0xc2, 0x90, 0x8e, 0x4d,
+    0x8d, 0x14, 0x81, 0x73, 0x4a, 0xb2, 0x34, 0x01, 0x2e, 0xc9,
+    0xe2, 0xdf, 0x48, 0x3c, 0xa1, 0xed, 0xcd, 0x83, 0x38, 0x96,
+    0x72, 0x92, 0x29, 0x40, 0x12, 0xc7, 0x5f, 0x78, 0x3a, 0x62,
+    0x19, 0x3d, 0x3e, 0xc4, 0x66, 0x43, 0x35, 0xde, 0xaa, 0x1d,
+    0xd5, 0x40, 0x15, 0x88, 0x73, 0x9a, 0xa5, 0xf1, 0x1d, 0xc5,
+    0x37, 0xb7, 0xed, 0x4d, 0x12, 0xc7, 0xe9, 0xf4, 0x94, 0xdc,
+    0xb1, 0x81, 0xbc, 0x71, 0x24, 0xc9, 0xb0, 0xdf, 0xff, 0x3a,
+    0xa1, 0x13, 0x05, 0xc1, 0xb2, 0x0b, 0x9a, 0x44, 0x66, 0x29,
+    0xe1, 0x1e, 0xca, 0xe0, 0x74, 0x6a, 0x6f, 0x5e, 0x1d, 0x7d,
+    0xf8, 0x7a, 0xdc, 0xbd, 0x38, 0xfe, 0xf5, 0xf4, 0xe0, 0xf2,
+    0xeb, 0xf9, 0x11, 0x6e, 0x36, 0x1b, 0xed, 0xcd, 0xce, 0xe7,
+    0xc3, 0xee, 0x5f, 0x2e, 0x70, 0x73, 0x77, 0xc7, 0x7c, 0x77,
+    0xff, 0xfa, 0xf5, 0xb8, 0xf3, 0x1b, 0x6e, 0xee, 0xbe, 0x51,
+    0x35, 0x9d, 0x13, 0x55, 0x6c, 0xaa, 0xe2, 0xe9, 0xc1, 0xdf,
+    0x8e, 0x7f, 0x3d, 0xb8, 0x3c, 0x3e, 0x3b, 0xc5, 0xcd, 0xdd,
+    0x86, 0x01, 0x39, 0xbb, 0x38, 0xc2, 0xcd, 0xdd, 0xba, 0x2e,
+    0x1e, 0x9c, 0x9c, 0x74, 0x3f, 0x7e, 0x3d, 0xed, 0xe0, 0xe6,
+    0xce, 0x2f, 0xaa, 0xea, 0xe2, 0xe8, 0xf4, 0xb0, 0x7b, 0x7e,
+    0x70, 0x85, 0x9b, 0x3b, 0xef, 0x34, 0x9e, 0xa3, 0xab, 0xee,
+    0xf1, 0x21, 0x6e, 0xee, 0xfc, 0xac, 0xca, 0x9f, 0xbf, 0x9e,
+    0x5c, 0x1e, 0xe3, 0xe6, 0xce, 0x5b, 0x8d, 0xe3, 0xd3, 0x51,
+    0xe7, 0xb7, 0xee, 0xe5, 0x6f, 0xb8, 0xb9, 0xb3, 0xab, 0x6a,
+    0xae, 0x8e, 0x4f, 0x0f, 0xcf, 0xae, 0xba, 0x87, 0xe7, 0x07,
+    0xbf, 0xe2, 0xe6, 0xce, 0x4e, 0xa5, 0xf2, 0xfc, 0xe8, 0xe2,
+    0xf8, 0xbf, 0x8f, 0x00, 0xdb, 0x9b, 0xf6, 0xa6, 0xc4, 0xd4,
+    0xed, 0x7c, 0xfa, 0x7a, 0xfa, 0x5b, 0x17, 0xaa, 0xf1, 0xdb,
+    0x5d, 0xb9, 0x82, 0x5f, 0xce, 0xcf, 0x2e, 0xcf, 0x3a, 0x67,
+    0x27, 0xaa, 0xf2, 0x5d, 0xa5, 0xe2, 0xd7, 0x53, 0x6c, 0x43,
+    0x5c, 0x9e, 0xfd, 0x76, 0x74, 0x8a, 0x1b, 0x56, 0xcd, 0xf1,
+    0x21, 0xde, 0xb5, 0x8a, 0x9d, 0xcf, 0x87, 0xf8, 0x67, 0xab,
+    0x7c, 0x78, 0x70, 0x79, 0x00, 0x28, 0xa5, 0x48, 0x14, 0xeb,
+    0xf9, 0xa6, 0x59, 0xae, 0xe7, 0x17, 0xb9, 0x22, 0xf5, 0xf6,
+    0x26, 0x95, 0x52, 0xd0, 0x21, 0x71, 0xdc, 0x23, 0xe1, 0x77,
+    0x75, 0x45, 0xca, 0x3a, 0x3c, 0xd7, 0x37, 0xed, 0xd1, 0x61,
+    0xab, 0xee, 0x1f, 0x1e, 0x5f, 0x94, 0xc5, 0x46, 0x5e, 0xb9,
+    0x45, 0xe7, 0x6a, 0xbb, 0xe3, 0x8d, 0x86, 0x2f, 0x37, 0x3c,
+    0xae, 0xfb, 0xb0, 0xe3, 0xe1, 0x87, 0x88, 0x21, 0x76, 0x5d,
+    0x5f, 0x6e, 0x7a, 0x68, 0x8f, 0x53, 0x90, 0x03, 0x1f, 0x36,
+    0x3e, 0xae, 0xc3, 0xcf, 0xb5, 0xfa, 0xb9, 0x52, 0x3f, 0x9f,
+    0x70, 0x3d, 0x2f, 0x6f, 0x09, 0x7d, 0x8c, 0x60, 0xf5, 0xa3,
+    0xcf, 0x40, 0x35, 0x82, 0xfc, 0x5b, 0x9c, 0x8a, 0x5c, 0x60,
+    0xf8, 0x63, 0xca, 0x30, 0x28, 0xfc, 0xd1, 0x65, 0x35, 0xb8,
+    0xfc, 0x5b, 0xd4, 0x0c, 0x70, 0x9c, 0x0e, 0x74, 0x49, 0x12,
+    0x03, 0x7f, 0xca, 0xb2, 0xdc, 0xad, 0xd7, 0x65, 0xf9, 0x0a,
+    0xca, 0x57, 0x65, 0xf9, 0x13, 0x94, 0x3f, 0xe9, 0xb2, 0x64,
+    0xf2, 0x4d, 0xfd, 0x16, 0x5b, 0x04, 0xfa, 0xee, 0x14, 0x4e,
+    0x45, 0x97, 0x25, 0x4e, 0x79, 0xc6, 0x22, 0x31, 0xe4, 0xe9,
+    0xd4, 0x91, 0xd7, 0x24, 0xe8, 0x23, 0x9e, 0x7b, 0x91, 0x72,
+    0x3e, 0x0b, 0xe0, 0x04, 0xfd, 0x7a, 0xec, 0xb0, 0xcc, 0x21,
+    0xb1, 0xbc, 0x04, 0x9c, 0x88, 0xf6, 0x59, 0x42, 0x23, 0xdf,
+    0x49, 0x93, 0x78, 0xe6, 0xa4, 0x49, 0xa9, 0xd2, 0x2a, 0xa8,
+    0x38, 0x9d, 0xd2, 0x28, 0x70, 0xcd, 0xf5, 0x03, 0xc4, 0x6f,
+    0x60, 0x7c, 0x97, 0xb2, 0xc8, 0xa9, 0xd7, 0x6a, 0xe5, 0x34,
+    0xac, 0x19, 0xac, 0x6a, 0xff, 0xe4, 0xbb, 0xc5, 0x4d, 0x03,
+    0xa4, 0xaa, 0x23, 0xe9, 0xe1, 0xc1, 0x23, 0x31, 0xe5, 0xc2,
+    0x26, 0x4f, 0xc1, 0xc0, 0xe0, 0x49, 0x2a, 0x9c, 0x6c, 0x32,
+    0x06, 0x7e, 0xd3, 0xc8, 0xe9, 0xcd, 0x9c, 0x59, 0x3a, 0xe1,
+    0xce, 0x94, 0xf6, 0x9c, 0x1e, 0x4f, 0xa7, 0x19, 0xe5, 0x81,
+    0xb9, 0x9a, 0x80, 0xcd, 0x0f, 0x0f, 0xd6, 0x15, 0x53, 0x28,
+    0x1e, 0x7a, 0x75, 0x05, 0xe1, 0xc2, 0x43, 0xbe, 0x9b, 0x14,
+    0xe7, 0x47, 0x95, 0x5f, 0xfb, 0x56, 0xdf, 0x12, 0x66, 0x59,
+    0x31, 0x36, 0x08, 0xa8, 0xeb, 0x2b, 0xc9, 0x95, 0xfa, 0xda,
+    0x86, 0x1a, 0x65, 0xe1, 0x84, 0x32, 0xb3, 0x2f, 0xce, 0xbf,
+    0x82, 0x1d, 0xd9, 0x71, 0x79, 0x9e, 0x7a, 0x08, 0xcd, 0x25,
+    0xaa, 0x60, 0xcc, 0xe5, 0xef, 0x21, 0xed, 0x93, 0x49, 0x2c,
+    0x3c, 0x24, 0xf5, 0x92, 0x09, 0x8f, 0xd5, 0xa6, 0x3a, 0x3f,
+    0xf1, 0x14, 0x58, 0x44, 0x33, 0xc1, 0x12, 0x45, 0xdf, 0x84,
+    0xc7, 0x66, 0x61, 0xe2, 0x74, 0x50, 0xab, 0xc1, 0x56, 0x49,
+    0x63, 0x1a, 0xc4, 0xe9, 0xc0, 0xfb, 0xa6, 0x96, 0x7a, 0x7b,
+    0xcf, 0x39, 0x3c, 0xfb, 0x0c, 0x3f, 0x25, 0x65, 0x4a, 0x75,
+    0x72, 0x6e, 0x5e, 0xcd, 0x27, 0x3c, 0x0e, 0x86, 0x9c, 0xf6,
+    0xf3, 0xdb, 0x6f, 0x05, 0xaf, 0x68, 0xa2, 0x26, 0x5d, 0xc2,
+    0x7b, 0x06, 0x0c, 0xe5, 0x39, 0x6a, 0x3d, 0x66, 0xa9, 0x45,
+    0x69, 0x38, 0x01, 0xcb, 0x22, 0xe8, 0xa5, 0xd1, 0xcc, 0x77,
+    0x89, 0xeb, 0xbb, 0x61, 0xcc, 0xc2, 0xef, 0xff, 0x26, 0x76,
+    0xcd, 0xe5, 0x5c, 0xb0, 0x02, 0x50, 0x96, 0xd0, 0x4b, 0xd8,
+    0xd3, 0x01, 0x92, 0x4b, 0x26, 0x3d, 0x83, 0x41, 0x86, 0x39,
+    0x7e, 0xc1, 0x80, 0x65, 0xd1, 0xf9, 0x4e, 0x67, 0x51, 0x3a,
+    0x4d, 0x4a, 0x56, 0x58, 0xa2, 0xab, 0x28, 0xfe, 0x4e, 0x67,
+    0x18, 0x63, 0xf7, 0xe3, 0xae, 0x5b, 0xab, 0xad, 0x9e, 0xe4,
+    0xe3, 0x23, 0x8c, 0x40, 0x4b, 0x19, 0xa5, 0x77, 0x20, 0x9d,
+    0x8a, 0xd5, 0x34, 0xe8, 0x4d, 0x84, 0x48, 0x93, 0x6c, 0x03,
+    0xe3, 0x86, 0xd6, 0x10, 0x17, 0x74, 0x1e, 0xa5, 0x04, 0xe7,
+    0xe5, 0xba, 0x94, 0xcd, 0x68, 0x0e, 0x22, 0xa8, 0xf8, 0x88,
+    0xa9, 0x61, 0x28, 0x68, 0xb9, 0x6d, 0xfd, 0xad, 0x20, 0xc2,
+    0x74, 0x34, 0x9e, 0x08, 0x1a, 0x5d, 0x88, 0x59, 0x4c, 0x8d,
+    0xf6, 0x31, 0xa0, 0xa2, 0x63, 0xd7, 0x6b, 0xcb, 0x14, 0xf9,
+    0x4a, 0xfd, 0x33, 0x6d, 0xb8, 0xd2, 0x19, 0x7a, 0x7d, 0xe1,
+    0xe9, 0x98, 0x72, 0x31, 0x93, 0xea, 0x83, 0xe7, 0x6e, 0x2b,
+    0xf8, 0x6d, 0x32, 0x1e, 0x6f, 0x73, 0x3a, 0x80, 0xad, 0x8b,
+    0x02, 0xc1, 0xd9, 0xc8, 0x93, 0xa8, 0x26, 0xec, 0xf9, 0x98,
+    0xb6, 0x25, 0xfc, 0x2a, 0x4c, 0x6d, 0xd6, 0xf7, 0x16, 0xe8,
+    0xc2, 0xd8, 0x8d, 0x38, 0x19, 0xb8, 0x0f, 0x0f, 0xd5, 0x51,
+    0x4c, 0x7d, 0xc1, 0xcd, 0x8a, 0xca, 0x48, 0x8d, 0x9e, 0xe6,
+    0x2f, 0xb7, 0x5e, 0x17, 0xad, 0xd7, 0xd5, 0x56, 0xa3, 0xe9,
+    0xa9, 0xca, 0xaa, 0xfa, 0xb7, 0x0a, 0xf2, 0x7a, 0x15, 0x64,
+    0x81, 0xd3, 0x5a, 0xdd, 0x7a, 0xbb, 0xc7, 0x29, 0xf9, 0x9e,
+    0xeb, 0x25, 0x54, 0x3f, 0xc1, 0x98, 0x40, 0x2f, 0xed, 0x03,
+    0xc8, 0xf5, 0xfa, 0xc3, 0x3a, 0x46, 0x34, 0x16, 0xc4, 0x9a,
+    0xc3, 0xf6, 0x8a, 0x19, 0xfa, 0x12, 0xc8, 0x9a, 0xca, 0x0a,
+    0xa0, 0x6b, 0x3f, 0xa1, 0xc5, 0x74, 0xaa, 0x73, 0xdc, 0x52,
+    0x63, 0x00, 0xc0, 0xf5, 0x2a, 0x80, 0x6b, 0x05, 0x70, 0xdd,
+    0x06, 0x0c, 0xef, 0xeb, 0xb5, 0x9a, 0x27, 0x51, 0xd5, 0x91,
+    0xec, 0x61, 0x2a, 0xae, 0xa1, 0xa2, 0xdc, 0x8d, 0x30, 0x61,
+    0x09, 0x27, 0x81, 0x4c, 0xcb, 0x82, 0x1a, 0x2d, 0xdb, 0x57,
+    0xf1, 0x0d, 0x5a, 0xae, 0x9f, 0xb1, 0xb1, 0x26, 0x63, 0x65,
+    0xd9, 0xae, 0xda, 0x45, 0xe0, 0xb1, 0x48, 0x7a, 0xb4, 0x9f,
+    0x72, 0x3a, 0x49, 0xe2, 0x94, 0x44, 0xd8, 0x82, 0xd4, 0x97,
+    0x51, 0xbe, 0xc6, 0x0a, 0xae, 0xea, 0xd7, 0x0f, 0x0f, 0x4b,
+    0x37, 0xe2, 0xd7, 0x63, 0xa7, 0x4f, 0x58, 0x4c, 0x23, 0x47,
+    0xa4, 0x4e, 0xa8, 0x00, 0xe1, 0x53, 0x0c, 0xa9, 0x03, 0x9a,
+    0x14, 0x4d, 0x22, 0x87, 0x8c, 0xc7, 0x31, 0x0b, 0xd5, 0xad,
+    0xe0, 0x7c, 0x89, 0x29, 0xc9, 0xa8, 0x23, 0xf8, 0xcc, 0x21,
+    0x03, 0xc2, 0x92, 0xc0, 0x45, 0xb9, 0xdf, 0xd8, 0xad, 0xd7,
+    0x51, 0xae, 0x89, 0xe1, 0x5a, 0x53, 0xf7, 0xef, 0x60, 0x6b,
+    0x60, 0xb7, 0x90, 0x66, 0x5b, 0x8f, 0x57, 0x40, 0xbe, 0xd5,
+    0x20, 0x37, 0x12, 0x96, 0x7d, 0xfc, 0x95, 0x87, 0x73, 0x79,
+    0x66, 0x9b, 0x2b, 0x38, 0xdf, 0xec, 0x73, 0x4a, 0xff, 0xa4,
+    0x5f, 0x99, 0x87, 0xe6, 0x8b, 0x0c, 0x28, 0x0f, 0x9d, 0xa5,
+    0x43, 0x9e, 0xf5, 0xcb, 0xcb, 0x64, 0x40, 0x8d, 0xb4, 0x7e,
+    0x98, 0x1d, 0x47, 0x9e, 0x52, 0x78, 0xb6, 0xa5, 0xa3, 0x65,
+    0x5b, 0xf3, 0x83, 0xa5, 0xc9, 0x76, 0x9c, 0x66, 0xc2, 0x45,
+    0xb6, 0x55, 0x1f, 0xb1, 0x3b, 0x5c, 0x60, 0x09, 0x39, 0x25,
+    0x82, 0x6a, 0x44, 0x9e, 0x1b, 0xb1, 0x3b, 0x17, 0xb5, 0x23,
+    0x76, 0x17, 0xb0, 0x08, 0x3f, 0x8a, 0xd2, 0x3f, 0xeb, 0xfd,
+    0x9d, 0x86, 0x22, 0x20, 0x59, 0xc6, 0x06, 0x89, 0x07, 0x5d,
+    0x32, 0x38, 0x62, 0xfc, 0xf9, 0x38, 0xcd, 0x18, 0xc0, 0xb5,
+    0x5c, 0x4e, 0x63, 0x22, 0x18, 0x9c, 0xbc, 0x22, 0x1d, 0xb7,
+    0xdc, 0xba, 0xeb, 0xc7, 0xb4, 0x2f, 0xe4, 0xc7, 0x94, 0x45,
+    0x62, 0xd8, 0x72, 0x1b, 0xf5, 0xfa, 0x7f, 0xb9, 0x3e, 0xac,
+    0xd7, 0x80, 0xa7, 0x93, 0x24, 0xea, 0xa4, 0x71, 0xca, 0x5b,
+    0xee, 0x66, 0xbf, 0xbf, 0x13, 0xed, 0x44, 0xae, 0x1f, 0x16,
+    0xe5, 0xbe, 0xeb, 0x0b, 0x7a, 0x2f, 0x0e, 0x62, 0x36, 0x48,
+    0x5a, 0x6e, 0x48, 0x13, 0x41, 0xb9, 0xeb, 0x8f, 0x49, 0x04,
+    0xb6, 0x4d, 0xcb, 0x6d, 0x8e, 0xef, 0x9d, 0xba, 0xeb, 0xf7,
+    0xd3, 0x44, 0x7c, 0x24, 0x23, 0x16, 0xcf, 0x5a, 0xee, 0x01,
+    0x67, 0x24, 0xf6, 0x9d, 0x8c, 0x24, 0xd9, 0x76, 0x46, 0x39,
+    0xeb, 0xab, 0xe6, 0x0b, 0xf6, 0x27, 0x6d, 0xb9, 0x8d, 0x9d,
+    0xf1, 0xbd, 0xeb, 0xff, 0x79, 0x9c, 0x44, 0xf4, 0x5e, 0x92,
+    0x01, 0xc4, 0xb1, 0x84, 0x7e, 0xa2, 0xe0, 0xa5, 0x6d, 0xb9,
+    0x0d, 0x17, 0x84, 0x1f, 0xf8, 0x90, 0x24, 0x94, 0x5f, 0xd2,
+    0x7b, 0x81, 0x5d, 0x25, 0x75, 0x52, 0x75, 0x6c, 0x39, 0x9d,
+    0x82, 0x1f, 0xce, 0x94, 0x89, 0x61, 0x45, 0xee, 0x58, 0xe6,
+    0x00, 0x8f, 0x02, 0xd7, 0xaf, 0x5c, 0xfd, 0x01, 0x4b, 0x32,
+    0xca, 0xc5, 0x07, 0xb9, 0x23, 0x80, 0x63, 0x0b, 0xcd, 0x7d,
+    0xc6, 0x33, 0xd1, 0x01, 0x97, 0x1f, 0xca, 0x73, 0xbf, 0x41,
+    0xdf, 0xa0, 0x7c, 0x73, 0x92, 0x68, 0x49, 0x39, 0xf6, 0xd4,
+    0xb5, 0x52, 0x59, 0xbd, 0x1f, 0x92, 0x01, 0x58, 0xd6, 0x5a,
+    0x0d, 0xe6, 0xc4, 0xe5, 0x7d, 0x08, 0x62, 0xc8, 0x32, 0x98,
+    0xda, 0x07, 0x92, 0xd1, 0xa8, 0x93, 0x8e, 0x46, 0x24, 0x89,
+    0xbc, 0x70, 0x14, 0xa1, 0xb9, 0xf6, 0x50, 0x86, 0xa3, 0x68,
+    0x03, 0xeb, 0x13, 0xc9, 0xb6, 0xdb, 0xf2, 0xcd, 0x31, 0xe1,
+    0x19, 0x3d, 0x64, 0x23, 0x9a, 0x64, 0xe0, 0x06, 0xf5, 0x58,
+    0x32, 0x9e, 0x08, 0x34, 0x17, 0x7c, 0x26, 0xa9, 0x1c, 0x13,
+    0x2e, 0x32, 0x2c, 0x2b, 0x83, 0x6c, 0x1c, 0x33, 0xe1, 0xb9,
+    0xbe, 0x2b, 0x2f, 0x14, 0xd9, 0xa2, 0x1d, 0x40, 0x1b, 0x18,
+    0xef, 0x68, 0xc9, 0x9c, 0xdf, 0xb7, 0xea, 0xfe, 0xac, 0x55,
+    0xd7, 0x82, 0x51, 0xf7, 0x87, 0x6a, 0x21, 0xea, 0xb9, 0x94,
+    0xd9, 0x7b, 0x2c, 0x07, 0xfc, 0x18, 0xa7, 0x44, 0x28, 0x14,
+    0x37, 0xf5, 0x5b, 0xe4, 0xcf, 0x96, 0xab, 0x1b, 0xb7, 0x48,
+    0xe1, 0x58, 0x6e, 0x6a, 0xde, 0x22, 0x8d, 0x76, 0xb9, 0xed,
+    0xcd, 0xad, 0x71, 0xcb, 0xde, 0xdc, 0xfb, 0x33, 0x85, 0x41,
+    0x03, 0xdf, 0x06, 0x59, 0x3a, 0xa2, 0x1e, 0xcb, 0x4e, 0xc9,
+    0x29, 0xda, 0x5f, 0x4f, 0x68, 0x6b, 0xbe, 0xd8, 0x33, 0xcf,
+    0x43, 0xf0, 0x72, 0xcf, 0x9f, 0x9a, 0x62, 0x9e, 0x6f, 0x0e,
+    0xa8, 0x38, 0x24, 0x82, 0x5c, 0x08, 0xfe, 0x91, 0xa7, 0xa3,
+    0x2f, 0x20, 0x48, 0xc2, 0x53, 0x9e, 0x45, 0x5f, 0x2a, 0xea,
+    0x52, 0x52, 0x95, 0x08, 0x64, 0xd2, 0x4b, 0xf6, 0x41, 0x3a,
+    0xe7, 0x6e, 0x6e, 0x2d, 0x07, 0x5b, 0x09, 0x08, 0x9e, 0x36,
+    0xd9, 0x59, 0x73, 0xba, 0x56, 0x53, 0xc5, 0x1b, 0x76, 0xbb,
+    0x81, 0xc1, 0x11, 0xb7, 0xb5, 0x85, 0x2c, 0x34, 0xc1, 0x78,
+    0x92, 0x0d, 0xbd, 0x02, 0xa4, 0xf0, 0x50, 0x83, 0x92, 0x0d,
+    0x02, 0x72, 0x48, 0xc1, 0x8b, 0xc5, 0x3d, 0x14, 0x44, 0xf2,
+    0xcb, 0x5b, 0xf0, 0xf9, 0x59, 0xa8, 0xc0, 0xc9, 0x35, 0xa0,
+    0xe2, 0xf8, 0xd0, 0x50, 0xcf, 0x14, 0xe1, 0xac, 0xef, 0xc9,
+    0xaf, 0xf7, 0xf5, 0x87, 0x07, 0xf9, 0xb1, 0x87, 0x2b, 0x14,
+    0x6e, 0x37, 0x96, 0xcd, 0x33, 0x39, 0x15, 0x27, 0x9d, 0x08,
+    0xf0, 0xec, 0xf7, 0xe0, 0x7c, 0xc8, 0x9c, 0x94, 0x83, 0x2d,
+    0x36, 0xe9, 0xf7, 0x59, 0xc8, 0x40, 0x15, 0x05, 0x77, 0x23,
+    0x58, 0x62, 0xc0, 0x01, 0xb9, 0x81, 0x80, 0x0a, 0x6c, 0xa6,
+    0x02, 0x08, 0x6e, 0xcd, 0x6c, 0xec, 0xca, 0xad, 0xc6, 0xed,
+    0xfb, 0xf7, 0xef, 0x1e, 0x8a, 0x1e, 0xf9, 0x26, 0x89, 0x22,
+    0x69, 0x49, 0x1a, 0xba, 0xd5, 0x81, 0x5e, 0x52, 0x2f, 0xcb,
+    0x40, 0xbd, 0xfc, 0xd8, 0xdb, 0x69, 0xfe, 0xb2, 0xf3, 0xcb,
+    0xdb, 0x9f, 0x9b, 0xbf, 0xec, 0x2e, 0xd3, 0x7d, 0x3a, 0x19,
+    0xf5, 0x28, 0x87, 0x63, 0x40, 0xd3, 0x0e, 0x87, 0x03, 0x27,
+    0xc9, 0x80, 0x3a, 0xfd, 0x94, 0x3b, 0x3b, 0xca, 0xb1, 0xea,
+    0x70, 0x3a, 0x86, 0x60, 0x50, 0xa2, 0x63, 0x29, 0x6a, 0x7f,
+    0x2c, 0x30, 0xa9, 0xca, 0xa3, 0x9d, 0x97, 0xf1, 0x28, 0x1b,
+    0x13, 0xb0, 0x5c, 0x0d, 0x07, 0x60, 0xa4, 0x0a, 0x83, 0xd4,
+    0xe5, 0x55, 0x6b, 0xee, 0xee, 0xfa, 0x0b, 0x3c, 0x52, 0x2d,
+    0x7b, 0x7b, 0x7b, 0xef, 0x96, 0x5b, 0x9b, 0x65, 0x6b, 0xe3,
+    0xed, 0x72, 0xf3, 0x9b, 0xb2, 0xb9, 0xb9, 0x03, 0xcd, 0x92,
+    0xc5, 0xa5, 0x5c, 0x3c, 0xc1, 0xdf, 0xb7, 0xbb, 0xbb, 0x6f,
+    0x7e, 0x9c, 0xb5, 0xcd, 0x17, 0xb3, 0xb6, 0xf9, 0x9f, 0x65,
+    0x6d, 0x6e, 0xcc, 0x71, 0xad, 0x72, 0x7c, 0xa7, 0x74, 0x2c,
+    0xbd, 0x8e, 0x5e, 0xa1, 0xb9, 0xd9, 0x3e, 0x42, 0x70, 0x77,
+    0xd4, 0x0b, 0x6d, 0x43, 0xdf, 0x45, 0x70, 0xa0, 0x17, 0xfd,
+    0xb0, 0x0c, 0x08, 0x49, 0x85, 0x42, 0xda, 0x26, 0x6d, 0xa4,
+    0xa0, 0xc1, 0xf1, 0xb4, 0x6f, 0x69, 0x89, 0x44, 0x10, 0xcf,
+    0x6c, 0xf3, 0xa3, 0xc4, 0x6c, 0x73, 0x2a, 0xbf, 0x3c, 0x77,
+    0xcc, 0x92, 0x81, 0x8b, 0x50, 0xab, 0xec, 0x8b, 0x37, 0xea,
+    0x3e, 0x99, 0x12, 0x26, 0x24, 0xa7, 0x34, 0x41, 0x1e, 0xd7,
+    0x3e, 0xc9, 0x3d, 0x4b, 0x99, 0xd1, 0x75, 0x7e, 0x93, 0xee,
+    0x20, 0x94, 0x83, 0xfb, 0x93, 0x85, 0xdf, 0xb3, 0x42, 0x7f,
+    0x44, 0xf3, 0xe2, 0x1a, 0x5b, 0x8a, 0xd7, 0xb9, 0x37, 0x2c,
+    0xba, 0x75, 0x51, 0xd0, 0x4f, 0xf9, 0x11, 0x09, 0x87, 0x1e,
+    0x18, 0x6e, 0xde, 0x82, 0x25, 0xfc, 0xf0, 0x40, 0x03, 0x06,
+    0xd7, 0x93, 0xeb, 0x1a, 0x05, 0xab, 0xf0, 0x6e, 0x06, 0x2c,
+    0x09, 0xe3, 0x49, 0x44, 0x33, 0x0f, 0x60, 0x10, 0xaa, 0xd5,
+    0xe0, 0xb7, 0x56, 0xdb, 0xa0, 0x01, 0x9c, 0x17, 0x19, 0x15,
+    0x81, 0xbc, 0x2a, 0xbb, 0x92, 0xa6, 0x2e, 0xcb, 0xba, 0x19,
+    0x15, 0xb5, 0x9a, 0xf7, 0x58, 0x33, 0x76, 0x05, 0x9f, 0x80,
+    0x11, 0xb9, 0x42, 0x15, 0xd6, 0xe6, 0x7c, 0x11, 0xe2, 0x91,
+    0xac, 0x95, 0x06, 0xb3, 0x26, 0x00, 0xe5, 0x28, 0x97, 0x0b,
+    0x52, 0x32, 0x7d, 0x2c, 0xcf, 0x78, 0xcb, 0xdb, 0xa6, 0xb8,
+    0xdb, 0xf0, 0x37, 0xd6, 0xa8, 0x7f, 0x0f, 0x0f, 0xaa, 0x0b,
+    0x36, 0x9e, 0x24, 0x64, 0x22, 0x17, 0xa5, 0xcb, 0x57, 0x1d,
+    0xe4, 0x1a, 0xb5, 0x5f, 0xd8, 0xae, 0xda, 0x05, 0x8c, 0x54,
+    0x9c, 0x77, 0xa1, 0x16, 0x2c, 0xa2, 0x45, 0x34, 0x6a, 0x53,
+    0xec, 0xd5, 0x8d, 0x2d, 0xab, 0x6c, 0x03, 0x75, 0x2d, 0xe1,
+    0x45, 0xe0, 0x6c, 0xc8, 0xfa, 0x42, 0x99, 0x8b, 0x15, 0x40,
+    0x8d, 0xe5, 0xbd, 0x82, 0x5f, 0xf4, 0xc3, 0xa2, 0x42, 0x29,
+    0x96, 0x01, 0xaa, 0x6a, 0x4f, 0xb5, 0x57, 0x50, 0x9b, 0xc6,
+    0x19, 0x55, 0x0a, 0x05, 0xa7, 0x5d, 0x3d, 0x7d, 0x2b, 0xac,
+    0x97, 0x1a, 0xde, 0x2d, 0x38, 0xb3, 0xfd, 0xba, 0xf5, 0x5f,
+    0xa9, 0xbe, 0x48, 0x12, 0xfc, 0x20, 0x08, 0xd6, 0x0a, 0xfc,
+    0x2a, 0xfa, 0x03, 0x91, 0xaa, 0xb8, 0x14, 0xb8, 0xce, 0xea,
+    0x85, 0xcf, 0x4f, 0xd3, 0x5d, 0x12, 0x56, 0x10, 0x2d, 0x03,
+    0xc2, 0xfd, 0x3e, 0xc8, 0x4c, 0xdd, 0x97, 0x92, 0x30, 0x9c,
+    0x24, 0xdf, 0xad, 0x0d, 0xc9, 0xfa, 0x9e, 0x6a, 0x7f, 0xbf,
+    0x6a, 0x3c, 0xcd, 0x72, 0xe8, 0x03, 0xba, 0x2a, 0xfe, 0x4c,
+    0xc4, 0x30, 0x18, 0xb1, 0xc4, 0x5b, 0xcd, 0x47, 0x7f, 0x15,
+    0x8e, 0x6d, 0x85, 0x1f, 0xf9, 0x12, 0x0d, 0xae, 0x82, 0x14,
+    0x81, 0x34, 0x05, 0xe4, 0xab, 0x9f, 0xad, 0x62, 0xc4, 0xc5,
+    0x29, 0xca, 0x06, 0x64, 0xc0, 0x70, 0x01, 0xa7, 0xcf, 0x81,
+    0x62, 0x86, 0x1e, 0x44, 0xa4, 0x56, 0xd4, 0x2d, 0xc9, 0x5b,
+    0x23, 0xcf, 0xed, 0x1d, 0x12, 0xd3, 0x91, 0xb5, 0x0d, 0x96,
+    0x8c, 0x1e, 0xa5, 0x4f, 0xca, 0xa5, 0x07, 0x50, 0xb9, 0xe3,
+    0xf7, 0x5f, 0x2e, 0x04, 0x32, 0x80, 0xf1, 0xa8, 0x10, 0x48,
+    0x82, 0xfc, 0x3a, 0x6a, 0xfd, 0xa3, 0x83, 0x14, 0xc2, 0x52,
+    0xe8, 0x16, 0x6a, 0x1e, 0xb6, 0x2b, 0x5d, 0x7f, 0x57, 0x63,
+    0x0d, 0x15, 0x3b, 0xde, 0x3a, 0x2c, 0xfc, 0x27, 0xfd, 0x76,
+    0xc0, 0x63, 0xed, 0xaa, 0xbb, 0x79, 0x35, 0x87, 0x99, 0x80,
+    0x93, 0x2e, 0xcf, 0x37, 0xc3, 0x21, 0x0d, 0xbf, 0x2b, 0x22,
+    0x9e, 0xc9, 0xec, 0x7f, 0x60, 0xf6, 0x3a, 0x5a, 0xf3, 0x1f,
+    0x63, 0x80, 0x1c, 0xcb, 0xb9, 0xa9, 0xdf, 0xbf, 0x9a, 0x5b,
+    0x23, 0x95, 0x1b, 0xb9, 0xf1, 0x16, 0x05, 0x63, 0x12, 0x5d,
+    0xc8, 0x2b, 0xf7, 0x9d, 0xef, 0xd6, 0x5d, 0xa4, 0xd9, 0xb4,
+    0xc6, 0xd1, 0x2b, 0x59, 0x36, 0xe1, 0x71, 0xe5, 0xba, 0x59,
+    0x62, 0xde, 0xf3, 0x88, 0x5b, 0xe3, 0x72, 0x06, 0x02, 0xda,
+    0xff, 0x14, 0xf6, 0x97, 0x31, 0xb9, 0x47, 0xc5, 0x1c, 0xa6,
+    0xf5, 0xcf, 0x5e, 0x1f, 0xcd, 0x41, 0xe9, 0x7b, 0xba, 0xf7,
+    0x67, 0x8f, 0x49, 0xda, 0xf3, 0x98, 0x05, 0x98, 0x4a, 0x36,
+    0xdd, 0xe7, 0xbe, 0xf3, 0x6a, 0x3e, 0xfb, 0xe7, 0xb1, 0xca,
+    0x8a, 0x22, 0x1a, 0x5e, 0x59, 0x66, 0x0d, 0x14, 0x8f, 0xcb,
+    0xb8, 0xdd, 0xcd, 0xfd, 0x2d, 0x32, 0x87, 0xfc, 0x33, 0xa0,
+    0x67, 0x25, 0xf4, 0xbf, 0x80, 0xcd, 0xd2, 0x93, 0xa4, 0x9c,
+    0x75, 0xa0, 0x70, 0xf1, 0xaa, 0x23, 0xc9, 0xca, 0x03, 0x5a,
+    0x0e, 0x00, 0x15, 0xbe, 0x85, 0x71, 0x44, 0x04, 0xfd, 0x60,
+    0x94, 0xa6, 0x42, 0xf7, 0x5c, 0xa1, 0x46, 0xb9, 0x6e, 0xa9,
+    0x6c, 0x58, 0xa1, 0x6b, 0xc3, 0xca, 0xa5, 0x30, 0x74, 0xc3,
+    0x50, 0x3e, 0x00, 0x05, 0x89, 0x08, 0x0a, 0x01, 0x4e, 0xe5,
+    0x31, 0xca, 0x4a, 0x8d, 0x76, 0x41, 0x21, 0xcc, 0x37, 0x45,
+    0xaa, 0xe2, 0xde, 0xca, 0x18, 0x28, 0xdc, 0x10, 0x4a, 0x87,
+    0x96, 0x16, 0x41, 0xbe, 0x1a, 0x63, 0x91, 0xbf, 0x06, 0xb4,
+    0x2b, 0xb3, 0xa0, 0x32, 0x13, 0xc4, 0xfa, 0x90, 0x1a, 0x12,
+    0x69, 0xcf, 0xb6, 0x3a, 0xe7, 0xfa, 0x09, 0x86, 0xba, 0x76,
+    0x3f, 0xd1, 0xd5, 0xb5, 0x5a, 0x3f, 0x81, 0x1d, 0x2e, 0x33,
+    0x91, 0x40, 0xfd, 0x4b, 0x39, 0xed, 0x92, 0x31, 0xeb, 0x76,
+    0x61, 0xcf, 0xcf, 0xc6, 0x90, 0xfd, 0xa2, 0x1c, 0xf9, 0x37,
+    0xfd, 0xe4, 0x76, 0xcf, 0x9d, 0xb8, 0x9a, 0x29, 0x50, 0xc4,
+    0x90, 0xa9, 0x42, 0xf8, 0x20, 0x2b, 0xf2, 0x7c, 0x48, 0x1c,
+    0x7b, 0xfd, 0xc4, 0x37, 0xd5, 0x7e, 0xd9, 0xf5, 0x69, 0xd8,
+    0x27, 0x77, 0x07, 0x2c, 0x1b, 0x4b, 0x06, 0x85, 0xcf, 0xa9,
+    0xc8, 0xf1, 0xbb, 0x79, 0x35, 0xef, 0x27, 0xb0, 0x43, 0xa4,
+    0x94, 0x94, 0x46, 0x83, 0x8d, 0x7e, 0xbe, 0xbd, 0xbd, 0xda,
+    0xa8, 0x90, 0xbb, 0x0a, 0x2a, 0x8f, 0xa3, 0x22, 0x9c, 0xaa,
+    0x97, 0x64, 0x75, 0x07, 0xe4, 0x03, 0xc2, 0x13, 0xa9, 0x74,
+    0x64, 0x18, 0xbe, 0x83, 0x11, 0x19, 0x7b, 0x84, 0x0f, 0xf0,
+    0x9e, 0xe6, 0x18, 0x7c, 0x63, 0x37, 0x95, 0x4b, 0xe5, 0xee,
+    0x13, 0x3e, 0xd0, 0x3a, 0x4a, 0x6b, 0xed, 0xc9, 0x04, 0x30,
+    0x96, 0xd2, 0x65, 0xf4, 0xa2, 0xe0, 0xef, 0x29, 0x4b, 0x3c,
+    0xb7, 0xed, 0xaa, 0x41, 0xa5, 0xdf, 0x35, 0xc3, 0xd5, 0x5d,
+    0x58, 0x78, 0x43, 0x08, 0x1f, 0x38, 0x6a, 0xf0, 0x4c, 0xad,
+    0xb6, 0xda, 0x8a, 0xed, 0x95, 0x44, 0xa9, 0x36, 0x20, 0xbf,
+    0xa5, 0x3f, 0x9f, 0x4b, 0x9b, 0x64, 0x98, 0xa0, 0xa3, 0xf1,
+    0x02, 0x1d, 0x5e, 0x49, 0xa1, 0x26, 0x7f, 0xab, 0x62, 0x6f,
+    0x6e, 0x35, 0x50, 0x1b, 0xba, 0x05, 0x19, 0x15, 0x16, 0xac,
+    0x0f, 0x2e, 0x7c, 0x53, 0xad, 0x0d, 0xe5, 0x25, 0x4c, 0x0a,
+    0xe4, 0xe6, 0x89, 0x11, 0xc0, 0x40, 0xb4, 0xd8, 0x04, 0x5d,
+    0x72, 0xeb, 0xcc, 0x5c, 0x20, 0xb7, 0x8e, 0x7c, 0xd5, 0xf0,
+    0x65, 0x92, 0x0d, 0x4d, 0xd6, 0x9d, 0x4c, 0xf9, 0xa4, 0xd3,
+    0x2f, 0x2b, 0x7b, 0x8c, 0x6d, 0x7d, 0x73, 0x4b, 0xba, 0x61,
+    0x34, 0x79, 0xed, 0xa2, 0x8f, 0x9c, 0x86, 0xb9, 0xba, 0xab,
+    0xb5, 0xd0, 0xc1, 0xaf, 0xe0, 0x30, 0x14, 0xe0, 0x02, 0x30,
+    0x37, 0x9e, 0x9b, 0x92, 0xb4, 0x45, 0xcf, 0xd3, 0xcd, 0xca,
+    0xd3, 0xfe, 0x16, 0xd9, 0xd3, 0x59, 0xea, 0xa3, 0xef, 0x81,
+    0xa7, 0xa1, 0x9e, 0x80, 0xb0, 0x34, 0x1e, 0x93, 0xe3, 0xb2,
+    0xa2, 0xc7, 0x4a, 0x31, 0xea, 0x27, 0x4f, 0x0c, 0xfe, 0x5c,
+    0x44, 0xd6, 0xf6, 0xfb, 0x71, 0x8c, 0x2b, 0xe5, 0xb5, 0x48,
+    0x10, 0x78, 0xe9, 0x6d, 0xa5, 0xdc, 0x3c, 0xba, 0x93, 0x3a,
+    0x4c, 0x16, 0xe1, 0x8f, 0x0f, 0xa5, 0x3c, 0x2c, 0xfb, 0x0f,
+    0xe6, 0x4b, 0xc7, 0x8c, 0x4e, 0x77, 0xba, 0x51, 0x88, 0x6e,
+    0xb1, 0x71, 0x2b, 0xac, 0xb9, 0x19, 0xb5, 0x9d, 0x2d, 0x0f,
+    0xb1, 0x0e, 0xf8, 0xd9, 0xed, 0x63, 0x4f, 0x8b, 0x53, 0x79,
+    0xe4, 0xae, 0x3a, 0xea, 0x7d, 0xab, 0x47, 0xbe, 0xa8, 0xb7,
+    0x54, 0x50, 0x6c, 0x4e, 0xad, 0x78, 0xbc, 0x9d, 0x3f, 0xb8,
+    0x98, 0x54, 0x99, 0xdb, 0x4e, 0x9a, 0xf9, 0x33, 0x83, 0x44,
+    0x76, 0x7a, 0x8b, 0x9d, 0x56, 0x56, 0xa8, 0x54, 0x32, 0xa5,
+    0xa6, 0x30, 0xa3, 0xe5, 0xfe, 0x5c, 0xcc, 0xf0, 0x2d, 0x0d,
+    0xe8, 0x61, 0x9a, 0x09, 0x13, 0x85, 0x86, 0x8e, 0xd2, 0x2f,
+    0x06, 0x95, 0x09, 0x19, 0x51, 0x1f, 0x32, 0x2a, 0xec, 0x9c,
+    0x9f, 0x7d, 0x77, 0x9a, 0x41, 0x86, 0xbc, 0xbb, 0x05, 0x20,
+    0x2d, 0x77, 0x5a, 0x16, 0xda, 0x8b, 0x03, 0xaa, 0x91, 0xbc,
+    0x6f, 0x4a, 0x8b, 0x6d, 0xbd, 0x9a, 0x97, 0x69, 0x41, 0x79,
+    0x51, 0x20, 0x62, 0x98, 0xbf, 0xd6, 0xbc, 0x9e, 0x66, 0x5d,
+    0x1d, 0x9c, 0xf8, 0x86, 0xf2, 0x62, 0xd6, 0xeb, 0xb2, 0x90,
+    0x0b, 0x2f, 0x97, 0x4e, 0x74, 0xc5, 0xa6, 0x7c, 0x96, 0x9c,
+    0x8d, 0x69, 0x02, 0xfd, 0x22, 0xc9, 0x10, 0x64, 0x43, 0x9a,
+    0x64, 0xe4, 0x12, 0x58, 0x67, 0x4f, 0xae, 0x81, 0x57, 0xd9,
+    0xca, 0x25, 0xb4, 0xcc, 0xe4, 0x5c, 0x03, 0xab, 0x92, 0x99,
+    0x4b, 0x58, 0xe9, 0x2e, 0xb4, 0x60, 0xf3, 0x82, 0x38, 0x5c,
+    0xcd, 0x6a, 0x58, 0x4c, 0x1a, 0x34, 0xea, 0x93, 0x1d, 0xe4,
+    0x59, 0x77, 0xf3, 0xbb, 0xc5, 0xcd, 0x5f, 0x20, 0x28, 0x12,
+    0x7d, 0x6c, 0xdb, 0x2e, 0x6f, 0x97, 0x34, 0xe1, 0xa5, 0xa4,
+    0x8a, 0x27, 0x70, 0x82, 0xfe, 0xa0, 0xa2, 0xaa, 0x10, 0x1d,
+    0x6d, 0x97, 0x9c, 0x58, 0xc0, 0x64, 0x07, 0x44, 0xed, 0xf8,
+    0x50, 0x69, 0x79, 0xec, 0x7b, 0xcb, 0x90, 0xf5, 0xa7, 0xb5,
+    0x1a, 0x8b, 0x0e, 0x19, 0x41, 0xb3, 0x8d, 0x25, 0x91, 0x82,
+    0x6e, 0xb3, 0x18, 0x78, 0xb5, 0x72, 0x50, 0x96, 0x93, 0x21,
+    0x7d, 0x4b, 0xf9, 0x2d, 0x84, 0x9e, 0xd3, 0x71, 0x4c, 0x42,
+    0xea, 0x2d, 0x62, 0x2a, 0xdc, 0x9c, 0x56, 0xce, 0xe7, 0xbe,
+    0xf7, 0xa3, 0x24, 0x3b, 0xde, 0x2b, 0x9d, 0x8b, 0x03, 0xc7,
+    0x73, 0x8e, 0x02, 0xe7, 0x9c, 0x9a, 0x50, 0x5c, 0x32, 0x08,
+    0x82, 0xa0, 0x20, 0xb7, 0x0c, 0x01, 0x2f, 0xc6, 0xc0, 0x97,
+    0xfc, 0xba, 0xfe, 0x12, 0x61, 0x1a, 0xbc, 0xa0, 0x39, 0x4e,
+    0x07, 0xfb, 0xde, 0x8b, 0x08, 0x5c, 0x41, 0x8f, 0x41, 0xba,
+    0x6c, 0x63, 0x68, 0xd0, 0x6a, 0xd2, 0xa2, 0x39, 0xba, 0xaa,
+    0xb5, 0x8a, 0x73, 0x6a, 0x24, 0x3b, 0x7b, 0xd1, 0xc8, 0x95,
+    0xde, 0x8f, 0xca, 0x2d, 0xe6, 0x18, 0xf9, 0x82, 0x84, 0xe6,
+    0x2e, 0xf1, 0xbb, 0xbd, 0x76, 0xa9, 0xb3, 0xbd, 0x5b, 0x54,
+    0x3d, 0x74, 0xce, 0x17, 0x24, 0x9a, 0xb7, 0xe5, 0xab, 0x13,
+    0x0d, 0x57, 0x75, 0x38, 0x56, 0x12, 0x3c, 0x91, 0x89, 0x80,
+    0xbd, 0xbb, 0x59, 0x6a, 0xfd, 0xf5, 0xf4, 0xb6, 0x90, 0xe2,
+    0x05, 0x45, 0x02, 0x15, 0x87, 0xed, 0x8a, 0x48, 0xe9, 0x1a,
+    0x84, 0x9d, 0xcf, 0x87, 0xb7, 0xda, 0xc2, 0xa8, 0x68, 0xd2,
+    0x76, 0x54, 0xec, 0xdd, 0x8a, 0x0b, 0xb1, 0x9d, 0x4d, 0x99,
+    0x08, 0x87, 0x8f, 0xa2, 0x9d, 0x87, 0x32, 0x87, 0xa1, 0xd8,
+    0x70, 0x26, 0x3f, 0xb7, 0xb5, 0x54, 0xdf, 0x52, 0xa1, 0xc2,
+    0x90, 0xb3, 0xb1, 0xb8, 0x20, 0x90, 0x4d, 0xf2, 0x27, 0x2d,
+    0x09, 0x59, 0x17, 0x6b, 0x5c, 0xa2, 0x0b, 0x32, 0x59, 0x51,
+    0xb1, 0x65, 0x5e, 0x7b, 0xfb, 0xad, 0x3f, 0xf8, 0x1f, 0xc9,
+    0xc3, 0x1f, 0xfc, 0xe1, 0x8f, 0x04, 0xbd, 0x1e, 0xf8, 0xdf,
+    0x7e, 0xfa, 0xf6, 0x8c, 0x64, 0xbb, 0xce, 0xe7, 0x43, 0xf8,
+    0xf9, 0xcb, 0x05, 0xec, 0xe0, 0x2a, 0x4d, 0x85, 0x2d, 0xff,
+    0x71, 0x92, 0x9c, 0xcb, 0xbb, 0x15, 0xbb, 0xf0, 0x86, 0x4a,
+    0x26, 0x60, 0xba, 0xfe, 0xc7, 0x89, 0x3e, 0xca, 0x36, 0x1a,
+    0x6d, 0x08, 0x2e, 0x97, 0x50, 0xca, 0xd1, 0x58, 0x79, 0x05,
+    0xe3, 0x55, 0x51, 0x23, 0x0f, 0xa9, 0x00, 0xac, 0x47, 0xd1,
+    0xbc, 0x44, 0x54, 0xf7, 0x4b, 0x24, 0xd4, 0x24, 0xdc, 0x43,
+    0xaa, 0xd7, 0x23, 0x8c, 0xaf, 0x9c, 0x72, 0x86, 0xe9, 0x26,
+    0xa9, 0xa2, 0x44, 0x57, 0xe6, 0x78, 0x7a, 0x2b, 0xa7, 0x53,
+    0x39, 0xdd, 0x37, 0x0c, 0x49, 0x4f, 0x73, 0x6d, 0x7b, 0xcf,
+    0x51, 0xc8, 0x9c, 0x8b, 0x49, 0x18, 0xd2, 0x2c, 0x03, 0x3e,
+    0x16, 0x23, 0x58, 0x47, 0xa0, 0x44, 0xfc, 0x12, 0xbc, 0xb2,
+    0xc3, 0x12, 0xd6, 0xf6, 0xff, 0x37, 0x83, 0xc1, 0xa2, 0xe9,
+    0x42, 0x70, 0xeb, 0xf5, 0x90, 0x35, 0xdc, 0xde, 0xbb, 0xc6,
+    0x2f, 0x4d, 0xb5, 0x3f, 0x95, 0x0e, 0xbd, 0x64, 0xed, 0x2d,
+    0xbc, 0x59, 0xb1, 0xfa, 0xc2, 0x93, 0x95, 0xb2, 0xbb, 0x72,
+    0xae, 0xcb, 0xe6, 0x6c, 0xd2, 0x53, 0x41, 0x70, 0x8f, 0xf9,
+    0x85, 0xc3, 0x9e, 0x6d, 0x01, 0xac, 0x6f, 0x4f, 0x15, 0xf9,
+    0x6a, 0x4c, 0x1d, 0x13, 0xd0, 0x04, 0x14, 0xe1, 0x07, 0xe9,
+    0x69, 0x6f, 0x5b, 0x5a, 0xba, 0x0d, 0x8d, 0xf2, 0x1c, 0xd4,
+    0x39, 0xe7, 0x39, 0x66, 0x81, 0x3c, 0x1c, 0x51, 0xde, 0xfe,
+    0x3f, 0x6f, 0x39, 0xfd, 0xe5, 0xe2, 0x71, 0x50, 0x23, 0xcc,
+    0xfb, 0x37, 0x8d, 0xdb, 0xd6, 0xa2, 0x11, 0x73, 0x21, 0x78,
+    0xb9, 0xd1, 0x9e, 0xb6, 0x7e, 0xfe, 0x2d, 0x66, 0xcd, 0x1a,
+    0xbb, 0x44, 0xe6, 0x1c, 0xb6, 0x17, 0x8e, 0xe9, 0xc2, 0x6c,
+    0x6c, 0x15, 0xd7, 0xc5, 0x39, 0xcd, 0xc6, 0x69, 0x92, 0xbd,
+    0xf8, 0xac, 0x7e, 0xf6, 0x61, 0x0c, 0xf7, 0xb4, 0x63, 0x46,
+    0x83, 0x9d, 0x6f, 0x8f, 0x6e, 0x1d, 0x29, 0xeb, 0x4d, 0xb1,
+    0xc2, 0x23, 0xf8, 0xf4, 0x60, 0xaa, 0x27, 0xf8, 0xab, 0x8a,
+    0x11, 0x37, 0xd5, 0x88, 0xc7, 0x51, 0xae, 0x94, 0x22, 0xaf,
+    0xdb, 0xc3, 0x5e, 0x97, 0xe0, 0x75, 0xa3, 0x22, 0x33, 0x2c,
+    0xc2, 0xf2, 0x95, 0xc4, 0xc3, 0x43, 0xb7, 0xa7, 0x8c, 0xb8,
+    0x2e, 0xf1, 0x6d, 0xda, 0x9f, 0x26, 0xdc, 0xc4, 0x4f, 0x57,
+    0x2f, 0x4a, 0xa9, 0xc4, 0xb6, 0x4c, 0xb2, 0xf9, 0xbf, 0x7a,
+    0x2d, 0x2c, 0x2d, 0xb7, 0x0c, 0x06, 0xd8, 0x39, 0x86, 0xde,
+    0x4a, 0xef, 0xbe, 0xcc, 0x74, 0x5f, 0x39, 0x87, 0xea, 0x43,
+    0x18, 0x39, 0x0f, 0x99, 0x75, 0x74, 0x90, 0x44, 0x2a, 0xc3,
+    0xed, 0xa5, 0x53, 0xf2, 0x97, 0x93, 0x9c, 0xb0, 0x31, 0xf1,
+    0xaa, 0x19, 0x61, 0xd5, 0xf1, 0x0c, 0x2f, 0x16, 0xf2, 0x4f,
+    0xef, 0x57, 0x27, 0x9f, 0xce, 0xfc, 0xe7, 0x72, 0x4e, 0xf5,
+    0x00, 0xa9, 0x62, 0x7f, 0xd2, 0xc8, 0xb9, 0xb9, 0x6f, 0x39,
+    0x2a, 0x4c, 0x30, 0x6b, 0xc9, 0x48, 0x81, 0xaf, 0xe6, 0x0d,
+    0x05, 0xf9, 0x91, 0xfb, 0x8e, 0x4e, 0xbb, 0x72, 0x5e, 0xcd,
+    0xf5, 0x04, 0xe0, 0xa2, 0x5b, 0x2d, 0x09, 0xf2, 0x51, 0x52,
+    0x4b, 0xdf, 0x6a, 0x3a, 0xd3, 0xee, 0x5f, 0x2f, 0x0c, 0x74,
+    0x2a, 0xbd, 0xbb, 0xce, 0xf1, 0x21, 0x48, 0x43, 0x39, 0xb2,
+    0x25, 0x14, 0x2b, 0x5c, 0xf4, 0x25, 0x1c, 0x7a, 0x78, 0x58,
+    0x84, 0x1a, 0xeb, 0x33, 0xd1, 0x40, 0x18, 0xc3, 0x73, 0x31,
+    0x02, 0xb0, 0x9a, 0x0f, 0xf2, 0x41, 0xd7, 0x3a, 0x43, 0xc3,
+    0x5d, 0x3a, 0x58, 0xec, 0xf7, 0x91, 0xcb, 0x6e, 0x0e, 0x6f,
+    0xc9, 0x96, 0x91, 0x0f, 0x97, 0x16, 0x9c, 0x1f, 0x08, 0xb5,
+    0x96, 0x03, 0x17, 0x6b, 0xa8, 0xd3, 0xd1, 0xc6, 0x96, 0xca,
+    0x8d, 0x23, 0x62, 0x92, 0xe1, 0x35, 0xaa, 0x1c, 0x2c, 0xc4,
+    0xed, 0x06, 0x18, 0xa2, 0x70, 0xda, 0x7f, 0xa2, 0xf7, 0xf8,
+    0xdb, 0x0f, 0xc5, 0x08, 0xbf, 0x81, 0xb9, 0xa1, 0x86, 0x78,
+    0x46, 0x00, 0x4b, 0xf3, 0x43, 0x07, 0x23, 0x5f, 0xcd, 0xcd,
+    0xa0, 0xf9, 0xad, 0x63, 0xfc, 0x39, 0xdf, 0xd6, 0x78, 0x79,
+    0xea, 0xca, 0x11, 0x9f, 0xdd, 0xbd, 0x50, 0xda, 0xc0, 0xbd,
+    0x0c, 0xbd, 0xc3, 0xec, 0x2e, 0xa0, 0x49, 0x94, 0x5d, 0x31,
+    0x31, 0x94, 0x29, 0x98, 0xfb, 0x50, 0x93, 0xc5, 0x2c, 0xa4,
+    0x5e, 0xdd, 0xdf, 0x6e, 0xa0, 0x56, 0x98, 0xdd, 0x2d, 0xca,
+    0x94, 0xec, 0x55, 0x66, 0x6d, 0xae, 0x93, 0x95, 0x17, 0xda,
+    0x82, 0x96, 0x21, 0x28, 0xb5, 0x99, 0x7f, 0x84, 0x8d, 0xa7,
+    0xa9, 0x28, 0x58, 0x09, 0x86, 0x36, 0x24, 0x99, 0x3b, 0xf0,
+    0xe4, 0xda, 0xb6, 0xb3, 0x57, 0xb8, 0x05, 0x56, 0x8a, 0xe0,
+    0x6a, 0x5f, 0x01, 0xa0, 0x34, 0x92, 0xa7, 0xf5, 0xaf, 0x17,
+    0xd8, 0x69, 0x26, 0x71, 0x56, 0xca, 0xa8, 0x09, 0xd5, 0x9c,
+    0x92, 0xd1, 0x8b, 0xaf, 0x79, 0x9f, 0x93, 0x29, 0xf4, 0x90,
+    0x39, 0x6a, 0x78, 0x95, 0x04, 0xd8, 0xa3, 0x14, 0x41, 0x07,
+    0xd3, 0x4d, 0x26, 0x96, 0x54, 0xad, 0xe6, 0x6d, 0x1b, 0xe3,
+    0x76, 0xc3, 0x9f, 0x64, 0x94, 0x9f, 0xab, 0xaa, 0x02, 0xb2,
+    0xc8, 0x1c, 0xb1, 0x61, 0x2b, 0xa4, 0x6c, 0x59, 0x03, 0x3c,
+    0xff, 0xc8, 0x3b, 0xa7, 0x21, 0x65, 0x77, 0x34, 0x72, 0xce,
+    0xc9, 0xd4, 0x79, 0x35, 0xb7, 0x70, 0xe4, 0x3a, 0xa1, 0xaf,
+    0xaf, 0xac, 0x13, 0x7b, 0x52, 0xb9, 0x87, 0xe4, 0x81, 0x58,
+    0x8d, 0xcb, 0x59, 0x00, 0xb7, 0x18, 0xbb, 0xa6, 0xec, 0xee,
+    0xaf, 0x02, 0xf0, 0xac, 0x49, 0xa2, 0xd6, 0x2a, 0x8b, 0xd2,
+    0x06, 0xdf, 0x72, 0x2b, 0xf0, 0x2e, 0x2a, 0xe5, 0xa2, 0x5d,
+    0x3a, 0x9d, 0x2b, 0x0e, 0x67, 0xf0, 0x4e, 0xf4, 0x13, 0x6d,
+    0x28, 0x1a, 0x6f, 0x77, 0xc0, 0x29, 0x84, 0x9d, 0xa4, 0x8e,
+    0x7a, 0x31, 0x4b, 0x04, 0xb9, 0x37, 0xc9, 0x8d, 0xa9, 0x8c,
+    0x5f, 0x82, 0x9a, 0x04, 0x5e, 0x59, 0xc8, 0x72, 0x1c, 0xf3,
+    0xf4, 0x8e, 0x45, 0x60, 0x3a, 0x2a, 0x57, 0xc7, 0xea, 0x60,
+    0xfa, 0x7a, 0xfc, 0x1a, 0xf3, 0xd2, 0x13, 0xc2, 0xb0, 0x74,
+    0x22, 0x4a, 0xc4, 0x8f, 0x04, 0x3e, 0x37, 0x96, 0x9e, 0xa0,
+    0x6d, 0xac, 0xbd, 0x84, 0xbe, 0xc9, 0xe0, 0xe3, 0xb7, 0xc7,
+    0x28, 0x3a, 0xa7, 0x7d, 0xca, 0x69, 0x12, 0x52, 0x45, 0xda,
+    0x37, 0x6b, 0xd2, 0x53, 0x02, 0x0b, 0x3d, 0x81, 0x68, 0x66,
+    0xca, 0x1d, 0x57, 0xe2, 0x72, 0xbf, 0xa1, 0xe7, 0xc8, 0x11,
+    0x89, 0x63, 0xc0, 0xa0, 0x82, 0x9f, 0x10, 0x5d, 0x45, 0xc6,
+    0x7c, 0xe5, 0x46, 0xa1, 0x56, 0xcb, 0xbb, 0xa4, 0x1b, 0xda,
+    0xeb, 0x65, 0xe2, 0x4d, 0x5a, 0xa6, 0x4c, 0xd7, 0x0d, 0xec,
+    0x2a, 0xe3, 0xce, 0xdd, 0x77, 0xdd, 0x96, 0xa9, 0xcd, 0x33,
+    0x2a, 0x4e, 0x52, 0xf9, 0xd8, 0xa5, 0xb8, 0x13, 0xd4, 0xef,
+    0xba, 0x0b, 0xf2, 0x24, 0x1d, 0x38, 0x47, 0x09, 0x3c, 0x10,
+    0x8c, 0x2a, 0xaf, 0x34, 0xf1, 0x46, 0x1d, 0xb5, 0x1e, 0xe9,
+    0x73, 0xc8, 0xb2, 0x55, 0x9d, 0x1a, 0x28, 0xb7, 0xad, 0x3d,
+    0x13, 0x9a, 0x90, 0xff, 0x0e, 0x82, 0xac, 0xc9, 0x75, 0xb6,
+    0x76, 0xa5, 0xb9, 0xfc, 0x57, 0x30, 0x60, 0x02, 0x72, 0x49,
+    0x8b, 0x63, 0x3a, 0xd4, 0x1f, 0xe6, 0x72, 0x5b, 0x78, 0x9c,
+    0x6c, 0x9a, 0x73, 0xf6, 0x58, 0x48, 0x64, 0x65, 0x58, 0xa3,
+    0x72, 0xbf, 0xe9, 0x10, 0x0d, 0xcb, 0x3e, 0xb1, 0xc1, 0xb0,
+    0x93, 0x26, 0x82, 0x13, 0x99, 0x7e, 0xb0, 0x6e, 0xb9, 0x8a,
+    0x58, 0x8e, 0x3b, 0x64, 0x83, 0x21, 0x04, 0x0f, 0x64, 0x0f,
+    0xb7, 0x5c, 0xaf, 0x35, 0xf2, 0x01, 0x9d, 0x0a, 0x8b, 0xa3,
+    0x05, 0xd2, 0xc1, 0x6d, 0x03, 0xa7, 0x28, 0x2c, 0x5c, 0x11,
+    0x0b, 0x57, 0xfc, 0xe2, 0x05, 0xa2, 0x5a, 0x61, 0xd3, 0x2f,
+    0x25, 0x82, 0xc2, 0x6d, 0xa1, 0x1f, 0x44, 0x55, 0xdf, 0x76,
+    0xac, 0xc8, 0x19, 0x4d, 0x13, 0x78, 0xd0, 0x32, 0xa2, 0xc9,
+    0xa4, 0x78, 0xfd, 0xb8, 0xfa, 0x7d, 0x23, 0xf2, 0x7f, 0xe0,
+    0x75, 0xa9, 0x7c, 0x73, 0x01, 0x2f, 0x4c, 0xd7, 0xa2, 0xcf,
+    0x44, 0x3a, 0x86, 0x47, 0x80, 0x44, 0x4f, 0x16, 0x92, 0x53,
+    0xdb, 0x3f, 0xfd, 0x2f, 0x3d, 0xa4, 0x27, 0x3b, 0x46, 0x49,
+    0x00, 0x00
+};
 
 #endif // WEBUI_BRIDGE_H
\ No newline at end of file
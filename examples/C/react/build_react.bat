@@ -11,7 +11,7 @@ cd ..
 echo.
 echo * Embedding React's build files into 'vfs.h'
 
-python vfs.py "./webinix-react-example/build" "vfs.h"
+python ..\..\..\tools\vfs.py "./webinix-react-example/build" "vfs.h"
 
 echo.
 echo * Compiling 'main.c' into 'main.exe' using Microsoft Visual Studio...
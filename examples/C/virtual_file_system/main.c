@@ -18,16 +18,16 @@ int main() {
 	// VSF (Virtual File System) Example
 	//
 	// 1. Run Python script to generate header file of a folder
-	//    python vfs.py "/path/to/folder" "vfs.h"
+	//    python tools/vfs.py "/path/to/folder" "vfs.h"
 	//
 	// 2. Include header file in your C project
 	//    #include "vfs.h"
 	//
-	// 3. use vfs in your custom files handler `webinix_set_file_handler()`
-	//    webinix_set_file_handler(MyWindow, vfs);
+	// 3. Serve the embedded assets using `webinix_set_asset_bundle()`
+	//    webinix_set_asset_bundle(MyWindow, webinix_assets, webinix_assets_count);
 
-	// Set a custom files handler
-	webinix_set_file_handler(MyWindow, vfs);
+	// Set the embedded asset bundle
+	webinix_set_asset_bundle(MyWindow, webinix_assets, webinix_assets_count);
 
 	// Show a new window
 	// webinix_show_browser(MyWindow, "index.html", Chrome);
@@ -1,88 +1,627 @@
-#ifndef VIRTUAL_FILE_SYSTEM_H
-#define VIRTUAL_FILE_SYSTEM_H
+// Generated by Webinix `tools/vfs.py`, do not edit.
 
-typedef struct {
-    const char *path;
-    const unsigned char *data;
-    int length;
-} VirtualFile;
+#ifndef WEBUI_ASSETS_H
+#define WEBUI_ASSETS_H
 
-static const VirtualFile virtual_files[] = {
-    {
-        "/index.html",
-        (const unsigned char[]){0x3c,0x21,0x64,0x6f,0x63,0x74,0x79,0x70,0x65,0x20,0x68,0x74,0x6d,0x6c,0x3e,0x0d,0x0a,0x3c,0x68,0x74,0x6d,0x6c,0x3e,0x0d,0x0a,0x09,0x3c,0x68,0x65,0x61,0x64,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x6d,0x65,0x74,0x61,0x20,0x63,0x68,0x61,0x72,0x73,0x65,0x74,0x3d,0x22,0x55,0x54,0x46,0x2d,0x38,0x22,0x20,0x2f,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x74,0x69,0x74,0x6c,0x65,0x3e,0x57,0x65,0x62,0x55,0x49,0x20,0x2d,0x20,0x56,0x69,0x72,0x74,0x75,0x61,0x6c,0x20,0x46,0x69,0x6c,0x65,0x20,0x53,0x79,0x73,0x74,0x65,0x6d,0x3c,0x2f,0x74,0x69,0x74,0x6c,0x65,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x73,0x74,0x79,0x6c,0x65,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x62,0x6f,0x64,0x79,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x27,0x41,0x72,0x69,0x61,0x6c,0x27,0x2c,0x20,0x73,0x61,0x6e,0x73,0x2d,0x73,0x65,0x72,0x69,0x66,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x77,0x68,0x69,0x74,0x65,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x2d,0x67,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x28,0x74,0x6f,0x20,0x72,0x69,0x67,0x68,0x74,0x2c,0x20,0x23,0x35,0x30,0x37,0x64,0x39,0x31,0x2c,0x20,0x23,0x31,0x63,0x35,0x39,0x36,0x66,0x2c,0x20,0x23,0x30,0x32,0x32,0x37,0x33,0x37,0x29,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x74,0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x20,0x63,0x65,0x6e,0x74,0x65,0x72,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x38,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x7d,0x0d,0x0a,0x09,0x09,0x09,0x62,0x75,0x74,0x74,0x6f,0x6e,0x2c,0x0d,0x0a,0x09,0x09,0x09,0x69,0x6e,0x70,0x75,0x74,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x31,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x20,0x33,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x20,0x31,0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x23,0x63,0x63,0x63,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x62,0x6f,0x78,0x2d,0x73,0x68,0x61,0x64,0x6f,0x77,0x3a,0x20,0x30,0x20,0x33,0x70,0x78,0x20,0x35,0x70,0x78,0x20,0x72,0x67,0x62,0x61,0x28,0x30,0x2c,0x20,0x30,0x2c,0x20,0x30,0x2c,0x20,0x30,0x2e,0x31,0x29,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x74,0x72,0x61,0x6e,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x20,0x30,0x2e,0x32,0x73,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x7d,0x0d,0x0a,0x09,0x09,0x09,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x23,0x33,0x34,0x39,0x38,0x64,0x62,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x66,0x66,0x66,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x63,0x75,0x72,0x73,0x6f,0x72,0x3a,0x20,0x70,0x6f,0x69,0x6e,0x74,0x65,0x72,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x36,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x7d,0x0d,0x0a,0x09,0x09,0x09,0x68,0x31,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x74,0x65,0x78,0x74,0x2d,0x73,0x68,0x61,0x64,0x6f,0x77,0x3a,0x20,0x2d,0x37,0x70,0x78,0x20,0x31,0x30,0x70,0x78,0x20,0x37,0x70,0x78,0x20,0x72,0x67,0x62,0x28,0x36,0x37,0x20,0x35,0x37,0x20,0x35,0x37,0x20,0x2f,0x20,0x37,0x36,0x25,0x29,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x7d,0x0d,0x0a,0x09,0x09,0x09,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3a,0x68,0x6f,0x76,0x65,0x72,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x23,0x63,0x39,0x39,0x31,0x33,0x64,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x7d,0x0d,0x0a,0x09,0x09,0x09,0x69,0x6e,0x70,0x75,0x74,0x3a,0x66,0x6f,0x63,0x75,0x73,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x6f,0x75,0x74,0x6c,0x69,0x6e,0x65,0x3a,0x20,0x6e,0x6f,0x6e,0x65,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x33,0x34,0x39,0x38,0x64,0x62,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x7d,0x0d,0x0a,0x0d,0x0a,0x09,0x09,0x09,0x61,0x3a,0x6c,0x69,0x6e,0x6b,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x66,0x64,0x35,0x37,0x32,0x33,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x7d,0x0d,0x0a,0x09,0x09,0x09,0x61,0x3a,0x61,0x63,0x74,0x69,0x76,0x65,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x66,0x64,0x35,0x37,0x32,0x33,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x7d,0x0d,0x0a,0x09,0x09,0x09,0x61,0x3a,0x76,0x69,0x73,0x69,0x74,0x65,0x64,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x66,0x64,0x35,0x37,0x32,0x33,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x7d,0x0d,0x0a,0x09,0x09,0x09,0x61,0x3a,0x68,0x6f,0x76,0x65,0x72,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x66,0x30,0x62,0x63,0x61,0x63,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x7d,0x0d,0x0a,0x09,0x09,0x3c,0x2f,0x73,0x74,0x79,0x6c,0x65,0x3e,0x0d,0x0a,0x09,0x3c,0x2f,0x68,0x65,0x61,0x64,0x3e,0x0d,0x0a,0x09,0x3c,0x62,0x6f,0x64,0x79,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x68,0x33,0x20,0x69,0x64,0x3d,0x22,0x74,0x69,0x74,0x6c,0x65,0x22,0x3e,0x56,0x69,0x72,0x74,0x75,0x61,0x6c,0x20,0x46,0x69,0x6c,0x65,0x20,0x53,0x79,0x73,0x74,0x65,0x6d,0x20,0x45,0x78,0x61,0x6d,0x70,0x6c,0x65,0x3c,0x2f,0x68,0x33,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x62,0x72,0x20,0x2f,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x69,0x6d,0x67,0x20,0x73,0x72,0x63,0x3d,0x22,0x73,0x76,0x67,0x2f,0x77,0x65,0x62,0x75,0x69,0x2e,0x73,0x76,0x67,0x22,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x62,0x72,0x20,0x2f,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x70,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x54,0x68,0x69,0x73,0x20,0x66,0x69,0x6c,0x65,0x20,0x69,0x73,0x20,0x65,0x6d,0x62,0x65,0x64,0x64,0x65,0x64,0x20,0x69,0x6e,0x20,0x74,0x68,0x69,0x73,0x20,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2e,0x3c,0x62,0x72,0x20,0x2f,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x68,0x34,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x73,0x75,0x62,0x22,0x3e,0x2f,0x73,0x75,0x62,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x68,0x34,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x62,0x72,0x20,0x2f,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x69,0x64,0x3d,0x22,0x45,0x78,0x69,0x74,0x22,0x3e,0x45,0x78,0x69,0x74,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0x0d,0x0a,0x09,0x3c,0x2f,0x62,0x6f,0x64,0x79,0x3e,0x0d,0x0a,0x0d,0x0a,0x09,0x3c,0x21,0x2d,0x2d,0x20,0x43,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x20,0x74,0x68,0x69,0x73,0x20,0x77,0x69,0x6e,0x64,0x6f,0x77,0x20,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x20,0x61,0x70,0x70,0x20,0x2d,0x2d,0x3e,0x0d,0x0a,0x09,0x3c,0x73,0x63,0x72,0x69,0x70,0x74,0x20,0x73,0x72,0x63,0x3d,0x22,0x2f,0x77,0x65,0x62,0x75,0x69,0x2e,0x6a,0x73,0x22,0x3e,0x3c,0x2f,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0x0d,0x0a,0x0d,0x0a,0x09,0x3c,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0x0d,0x0a,0x0d,0x0a,0x09,0x09,0x2f,0x2f,0x20,0x4a,0x61,0x76,0x61,0x53,0x63,0x72,0x69,0x70,0x74,0x20,0x45,0x78,0x61,0x6d,0x70,0x6c,0x65,0x0d,0x0a,0x09,0x09,0x2f,0x2a,0x0d,0x0a,0x09,0x09,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x27,0x44,0x4f,0x4d,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x4c,0x6f,0x61,0x64,0x65,0x64,0x27,0x2c,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x29,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x09,0x2f,0x2f,0x20,0x44,0x4f,0x4d,0x20,0x69,0x73,0x20,0x6c,0x6f,0x61,0x64,0x65,0x64,0x2e,0x20,0x43,0x68,0x65,0x63,0x6b,0x20,0x69,0x66,0x20,0x60,0x77,0x65,0x62,0x75,0x69,0x60,0x20,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x69,0x73,0x20,0x61,0x76,0x61,0x69,0x6c,0x61,0x62,0x6c,0x65,0x0d,0x0a,0x09,0x09,0x09,0x69,0x66,0x20,0x28,0x74,0x79,0x70,0x65,0x6f,0x66,0x20,0x77,0x65,0x62,0x75,0x69,0x20,0x21,0x3d,0x3d,0x20,0x27,0x75,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x27,0x29,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x53,0x65,0x74,0x20,0x65,0x76,0x65,0x6e,0x74,0x73,0x20,0x63,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x77,0x65,0x62,0x75,0x69,0x2e,0x73,0x65,0x74,0x45,0x76,0x65,0x6e,0x74,0x43,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x28,0x28,0x65,0x29,0x20,0x3d,0x3e,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x09,0x69,0x66,0x20,0x28,0x65,0x20,0x3d,0x3d,0x20,0x77,0x65,0x62,0x75,0x69,0x2e,0x65,0x76,0x65,0x6e,0x74,0x2e,0x43,0x4f,0x4e,0x4e,0x45,0x43,0x54,0x45,0x44,0x29,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x43,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x69,0x6f,0x6e,0x20,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x62,0x61,0x63,0x6b,0x65,0x6e,0x64,0x20,0x69,0x73,0x20,0x65,0x73,0x74,0x61,0x62,0x6c,0x69,0x73,0x68,0x65,0x64,0x0d,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x27,0x43,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x65,0x64,0x2e,0x27,0x29,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x77,0x65,0x62,0x75,0x69,0x54,0x65,0x73,0x74,0x28,0x29,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x09,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x65,0x20,0x3d,0x3d,0x20,0x77,0x65,0x62,0x75,0x69,0x2e,0x65,0x76,0x65,0x6e,0x74,0x2e,0x44,0x49,0x53,0x43,0x4f,0x4e,0x4e,0x45,0x43,0x54,0x45,0x44,0x29,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x43,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x69,0x6f,0x6e,0x20,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x62,0x61,0x63,0x6b,0x65,0x6e,0x64,0x20,0x69,0x73,0x20,0x6c,0x6f,0x73,0x74,0x0d,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x27,0x44,0x69,0x73,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x65,0x64,0x2e,0x27,0x29,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x09,0x7d,0x0d,0x0a,0x09,0x09,0x09,0x09,0x7d,0x29,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x54,0x68,0x65,0x20,0x76,0x69,0x72,0x74,0x75,0x61,0x6c,0x20,0x66,0x69,0x6c,0x65,0x20,0x60,0x77,0x65,0x62,0x75,0x69,0x2e,0x6a,0x73,0x60,0x20,0x69,0x73,0x20,0x6e,0x6f,0x74,0x20,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x64,0x0d,0x0a,0x09,0x09,0x09,0x09,0x61,0x6c,0x65,0x72,0x74,0x28,0x27,0x50,0x6c,0x65,0x61,0x73,0x65,0x20,0x61,0x64,0x64,0x20,0x77,0x65,0x62,0x75,0x69,0x2e,0x6a,0x73,0x20,0x74,0x6f,0x20,0x79,0x6f,0x75,0x72,0x20,0x48,0x54,0x4d,0x4c,0x2e,0x27,0x29,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x7d,0x0d,0x0a,0x09,0x09,0x7d,0x29,0x3b,0x0d,0x0a,0x0d,0x0a,0x09,0x09,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x77,0x65,0x62,0x75,0x69,0x54,0x65,0x73,0x74,0x28,0x29,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x09,0x2f,0x2f,0x20,0x43,0x61,0x6c,0x6c,0x20,0x61,0x20,0x62,0x61,0x63,0x6b,0x65,0x6e,0x64,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x0d,0x0a,0x09,0x09,0x09,0x69,0x66,0x20,0x28,0x77,0x65,0x62,0x75,0x69,0x2e,0x69,0x73,0x43,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x65,0x64,0x28,0x29,0x29,0x20,0x7b,0x0d,0x0a,0x0d,0x0a,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x57,0x68,0x65,0x6e,0x20,0x79,0x6f,0x75,0x20,0x62,0x69,0x6e,0x64,0x20,0x61,0x20,0x66,0x75,0x6e,0x63,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x62,0x61,0x63,0x6b,0x65,0x6e,0x64,0x0d,0x0a,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x77,0x65,0x62,0x75,0x69,0x20,0x77,0x69,0x6c,0x6c,0x20,0x63,0x72,0x65,0x61,0x74,0x65,0x20,0x74,0x68,0x65,0x20,0x60,0x66,0x75,0x6e,0x63,0x60,0x20,0x6f,0x62,0x6a,0x65,0x63,0x74,0x0d,0x0a,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x69,0x6e,0x20,0x74,0x68,0x72,0x65,0x65,0x20,0x70,0x6c,0x61,0x63,0x65,0x73,0x3a,0x0d,0x0a,0x09,0x09,0x09,0x09,0x2f,0x2f,0x0d,0x0a,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x20,0x20,0x20,0x3a,0x20,0x66,0x75,0x6e,0x63,0x28,0x2e,0x2e,0x2e,0x29,0x0d,0x0a,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x50,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x3a,0x20,0x77,0x65,0x62,0x75,0x69,0x2e,0x66,0x75,0x6e,0x63,0x28,0x2e,0x2e,0x2e,0x29,0x0d,0x0a,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x4d,0x65,0x74,0x68,0x6f,0x64,0x20,0x20,0x20,0x3a,0x20,0x77,0x65,0x62,0x75,0x69,0x2e,0x63,0x61,0x6c,0x6c,0x28,0x27,0x66,0x75,0x6e,0x63,0x27,0x2c,0x20,0x2e,0x2e,0x2e,0x29,0x0d,0x0a,0x09,0x09,0x09,0x09,0x2f,0x2f,0x0d,0x0a,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x5b,0x21,0x5d,0x20,0x4e,0x6f,0x74,0x65,0x3a,0x20,0x4f,0x62,0x6a,0x65,0x63,0x74,0x73,0x20,0x63,0x72,0x65,0x61,0x74,0x69,0x6f,0x6e,0x20,0x66,0x61,0x69,0x6c,0x73,0x20,0x77,0x68,0x65,0x6e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x61,0x20,0x73,0x69,0x6d,0x69,0x6c,0x61,0x72,0x20,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x61,0x6c,0x72,0x65,0x61,0x64,0x79,0x20,0x65,0x78,0x69,0x73,0x74,0x2e,0x0d,0x0a,0x0d,0x0a,0x09,0x09,0x09,0x09,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6f,0x6f,0x20,0x3d,0x20,0x27,0x48,0x65,0x6c,0x6c,0x6f,0x27,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x63,0x6f,0x6e,0x73,0x74,0x20,0x62,0x61,0x72,0x20,0x3d,0x20,0x31,0x32,0x33,0x34,0x35,0x36,0x3b,0x0d,0x0a,0x0d,0x0a,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x43,0x61,0x6c,0x6c,0x69,0x6e,0x67,0x20,0x61,0x73,0x20,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x20,0x6f,0x62,0x6a,0x65,0x63,0x74,0x0d,0x0a,0x09,0x09,0x09,0x09,0x6d,0x79,0x42,0x61,0x63,0x6b,0x65,0x6e,0x64,0x46,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x66,0x6f,0x6f,0x2c,0x20,0x62,0x61,0x72,0x29,0x2e,0x74,0x68,0x65,0x6e,0x28,0x28,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x29,0x20,0x3d,0x3e,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x44,0x6f,0x20,0x73,0x6f,0x6d,0x65,0x74,0x68,0x69,0x6e,0x67,0x20,0x77,0x69,0x74,0x68,0x20,0x60,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x60,0x0d,0x0a,0x09,0x09,0x09,0x09,0x7d,0x29,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x0d,0x0a,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x43,0x61,0x6c,0x6c,0x69,0x6e,0x67,0x20,0x61,0x73,0x20,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6f,0x66,0x20,0x60,0x77,0x65,0x62,0x75,0x69,0x2e,0x60,0x20,0x6f,0x62,0x6a,0x65,0x63,0x74,0x0d,0x0a,0x09,0x09,0x09,0x09,0x77,0x65,0x62,0x75,0x69,0x2e,0x6d,0x79,0x42,0x61,0x63,0x6b,0x65,0x6e,0x64,0x46,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x66,0x6f,0x6f,0x2c,0x20,0x62,0x61,0x72,0x29,0x2e,0x74,0x68,0x65,0x6e,0x28,0x28,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x29,0x20,0x3d,0x3e,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x44,0x6f,0x20,0x73,0x6f,0x6d,0x65,0x74,0x68,0x69,0x6e,0x67,0x20,0x77,0x69,0x74,0x68,0x20,0x60,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x60,0x0d,0x0a,0x09,0x09,0x09,0x09,0x7d,0x29,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x0d,0x0a,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x43,0x61,0x6c,0x6c,0x69,0x6e,0x67,0x20,0x75,0x73,0x69,0x6e,0x67,0x20,0x74,0x68,0x65,0x20,0x6d,0x65,0x74,0x68,0x6f,0x64,0x20,0x60,0x77,0x65,0x62,0x75,0x69,0x2e,0x63,0x61,0x6c,0x6c,0x28,0x29,0x60,0x0d,0x0a,0x09,0x09,0x09,0x09,0x77,0x65,0x62,0x75,0x69,0x2e,0x63,0x61,0x6c,0x6c,0x28,0x27,0x6d,0x79,0x42,0x61,0x63,0x6b,0x65,0x6e,0x64,0x46,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x27,0x2c,0x20,0x66,0x6f,0x6f,0x2c,0x20,0x62,0x61,0x72,0x29,0x2e,0x74,0x68,0x65,0x6e,0x28,0x28,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x29,0x20,0x3d,0x3e,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x44,0x6f,0x20,0x73,0x6f,0x6d,0x65,0x74,0x68,0x69,0x6e,0x67,0x20,0x77,0x69,0x74,0x68,0x20,0x60,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x60,0x0d,0x0a,0x09,0x09,0x09,0x09,0x7d,0x29,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x0d,0x0a,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x55,0x73,0x69,0x6e,0x67,0x20,0x61,0x77,0x61,0x69,0x74,0x0d,0x0a,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x20,0x3d,0x20,0x61,0x77,0x61,0x69,0x74,0x20,0x6d,0x79,0x42,0x61,0x63,0x6b,0x65,0x6e,0x64,0x46,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x66,0x6f,0x6f,0x2c,0x20,0x62,0x61,0x72,0x29,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x20,0x3d,0x20,0x61,0x77,0x61,0x69,0x74,0x20,0x77,0x65,0x62,0x75,0x69,0x2e,0x6d,0x79,0x42,0x61,0x63,0x6b,0x65,0x6e,0x64,0x46,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x66,0x6f,0x6f,0x2c,0x20,0x62,0x61,0x72,0x29,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x20,0x3d,0x20,0x61,0x77,0x61,0x69,0x74,0x20,0x77,0x65,0x62,0x75,0x69,0x2e,0x63,0x61,0x6c,0x6c,0x28,0x27,0x6d,0x79,0x42,0x61,0x63,0x6b,0x65,0x6e,0x64,0x46,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x27,0x2c,0x20,0x66,0x6f,0x6f,0x2c,0x20,0x62,0x61,0x72,0x29,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x7d,0x0d,0x0a,0x09,0x09,0x7d,0x0d,0x0a,0x09,0x09,0x2a,0x2f,0x0d,0x0a,0x0d,0x0a,0x09,0x3c,0x2f,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0x0d,0x0a,0x3c,0x2f,0x68,0x74,0x6d,0x6c,0x3e,0x0d,0x0a},
-        3222
-    },
-    {
-        "/sub/index.html",
-        (const unsigned char[]){0x3c,0x21,0x64,0x6f,0x63,0x74,0x79,0x70,0x65,0x20,0x68,0x74,0x6d,0x6c,0x3e,0x0d,0x0a,0x3c,0x68,0x74,0x6d,0x6c,0x3e,0x0d,0x0a,0x09,0x3c,0x68,0x65,0x61,0x64,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x6d,0x65,0x74,0x61,0x20,0x63,0x68,0x61,0x72,0x73,0x65,0x74,0x3d,0x22,0x55,0x54,0x46,0x2d,0x38,0x22,0x20,0x2f,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x74,0x69,0x74,0x6c,0x65,0x3e,0x57,0x65,0x62,0x55,0x49,0x20,0x2d,0x20,0x56,0x69,0x72,0x74,0x75,0x61,0x6c,0x20,0x46,0x69,0x6c,0x65,0x20,0x53,0x79,0x73,0x74,0x65,0x6d,0x3c,0x2f,0x74,0x69,0x74,0x6c,0x65,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x73,0x74,0x79,0x6c,0x65,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x62,0x6f,0x64,0x79,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x27,0x41,0x72,0x69,0x61,0x6c,0x27,0x2c,0x20,0x73,0x61,0x6e,0x73,0x2d,0x73,0x65,0x72,0x69,0x66,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x77,0x68,0x69,0x74,0x65,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x2d,0x67,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x28,0x74,0x6f,0x20,0x72,0x69,0x67,0x68,0x74,0x2c,0x20,0x23,0x35,0x30,0x37,0x64,0x39,0x31,0x2c,0x20,0x23,0x31,0x63,0x35,0x39,0x36,0x66,0x2c,0x20,0x23,0x30,0x32,0x32,0x37,0x33,0x37,0x29,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x74,0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x20,0x63,0x65,0x6e,0x74,0x65,0x72,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x38,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x7d,0x0d,0x0a,0x09,0x09,0x09,0x62,0x75,0x74,0x74,0x6f,0x6e,0x2c,0x0d,0x0a,0x09,0x09,0x09,0x69,0x6e,0x70,0x75,0x74,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x31,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x20,0x33,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x20,0x31,0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x23,0x63,0x63,0x63,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x62,0x6f,0x78,0x2d,0x73,0x68,0x61,0x64,0x6f,0x77,0x3a,0x20,0x30,0x20,0x33,0x70,0x78,0x20,0x35,0x70,0x78,0x20,0x72,0x67,0x62,0x61,0x28,0x30,0x2c,0x20,0x30,0x2c,0x20,0x30,0x2c,0x20,0x30,0x2e,0x31,0x29,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x74,0x72,0x61,0x6e,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x20,0x30,0x2e,0x32,0x73,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x7d,0x0d,0x0a,0x09,0x09,0x09,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x23,0x33,0x34,0x39,0x38,0x64,0x62,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x66,0x66,0x66,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x63,0x75,0x72,0x73,0x6f,0x72,0x3a,0x20,0x70,0x6f,0x69,0x6e,0x74,0x65,0x72,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x36,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x7d,0x0d,0x0a,0x09,0x09,0x09,0x68,0x31,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x74,0x65,0x78,0x74,0x2d,0x73,0x68,0x61,0x64,0x6f,0x77,0x3a,0x20,0x2d,0x37,0x70,0x78,0x20,0x31,0x30,0x70,0x78,0x20,0x37,0x70,0x78,0x20,0x72,0x67,0x62,0x28,0x36,0x37,0x20,0x35,0x37,0x20,0x35,0x37,0x20,0x2f,0x20,0x37,0x36,0x25,0x29,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x7d,0x0d,0x0a,0x09,0x09,0x09,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3a,0x68,0x6f,0x76,0x65,0x72,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x23,0x63,0x39,0x39,0x31,0x33,0x64,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x7d,0x0d,0x0a,0x09,0x09,0x09,0x69,0x6e,0x70,0x75,0x74,0x3a,0x66,0x6f,0x63,0x75,0x73,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x6f,0x75,0x74,0x6c,0x69,0x6e,0x65,0x3a,0x20,0x6e,0x6f,0x6e,0x65,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x33,0x34,0x39,0x38,0x64,0x62,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x7d,0x0d,0x0a,0x0d,0x0a,0x09,0x09,0x09,0x61,0x3a,0x6c,0x69,0x6e,0x6b,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x66,0x64,0x35,0x37,0x32,0x33,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x7d,0x0d,0x0a,0x09,0x09,0x09,0x61,0x3a,0x61,0x63,0x74,0x69,0x76,0x65,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x66,0x64,0x35,0x37,0x32,0x33,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x7d,0x0d,0x0a,0x09,0x09,0x09,0x61,0x3a,0x76,0x69,0x73,0x69,0x74,0x65,0x64,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x66,0x64,0x35,0x37,0x32,0x33,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x7d,0x0d,0x0a,0x09,0x09,0x09,0x61,0x3a,0x68,0x6f,0x76,0x65,0x72,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x09,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x66,0x30,0x62,0x63,0x61,0x63,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x7d,0x0d,0x0a,0x09,0x09,0x3c,0x2f,0x73,0x74,0x79,0x6c,0x65,0x3e,0x0d,0x0a,0x09,0x3c,0x2f,0x68,0x65,0x61,0x64,0x3e,0x0d,0x0a,0x09,0x3c,0x62,0x6f,0x64,0x79,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x70,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x54,0x68,0x69,0x73,0x20,0x69,0x73,0x20,0x61,0x6e,0x6f,0x74,0x68,0x65,0x72,0x20,0x66,0x69,0x6c,0x65,0x20,0x65,0x6d,0x62,0x65,0x64,0x64,0x65,0x64,0x20,0x69,0x6e,0x20,0x74,0x68,0x69,0x73,0x20,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2e,0x3c,0x62,0x72,0x20,0x2f,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x62,0x72,0x20,0x2f,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x69,0x64,0x3d,0x22,0x45,0x78,0x69,0x74,0x22,0x3e,0x45,0x78,0x69,0x74,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0x0d,0x0a,0x09,0x3c,0x2f,0x62,0x6f,0x64,0x79,0x3e,0x0d,0x0a,0x0d,0x0a,0x09,0x3c,0x21,0x2d,0x2d,0x20,0x43,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x20,0x74,0x68,0x69,0x73,0x20,0x77,0x69,0x6e,0x64,0x6f,0x77,0x20,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x20,0x61,0x70,0x70,0x20,0x2d,0x2d,0x3e,0x0d,0x0a,0x09,0x3c,0x73,0x63,0x72,0x69,0x70,0x74,0x20,0x73,0x72,0x63,0x3d,0x22,0x2f,0x77,0x65,0x62,0x75,0x69,0x2e,0x6a,0x73,0x22,0x3e,0x3c,0x2f,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0x0d,0x0a,0x0d,0x0a,0x3c,0x2f,0x68,0x74,0x6d,0x6c,0x3e,0x0d,0x0a},
-        1216
-    },
-    {
-        "/svg/webinix.svg",
-        (const unsigned char[]){0x3c,0x73,0x76,0x67,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x31,0x32,0x30,0x70,0x78,0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x31,0x32,0x30,0x70,0x78,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,0x32,0x30,0x30,0x30,0x2f,0x73,0x76,0x67,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3a,0x62,0x78,0x3d,0x22,0x68,0x74,0x74,0x70,0x73,0x3a,0x2f,0x2f,0x62,0x6f,0x78,0x79,0x2d,0x73,0x76,0x67,0x2e,0x63,0x6f,0x6d,0x22,0x3e,0x20,0x3c,0x64,0x65,0x66,0x73,0x3e,0x20,0x3c,0x6d,0x61,0x73,0x6b,0x20,0x69,0x64,0x3d,0x22,0x63,0x69,0x72,0x63,0x6c,0x65,0x2d,0x6d,0x61,0x73,0x6b,0x22,0x3e,0x20,0x3c,0x72,0x65,0x63,0x74,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x31,0x32,0x30,0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x31,0x32,0x30,0x22,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x77,0x68,0x69,0x74,0x65,0x22,0x2f,0x3e,0x20,0x3c,0x63,0x69,0x72,0x63,0x6c,0x65,0x20,0x63,0x78,0x3d,0x22,0x31,0x32,0x30,0x22,0x20,0x63,0x79,0x3d,0x22,0x36,0x30,0x22,0x20,0x72,0x3d,0x22,0x31,0x36,0x2e,0x38,0x22,0x2f,0x3e,0x20,0x3c,0x2f,0x6d,0x61,0x73,0x6b,0x3e,0x20,0x3c,0x62,0x78,0x3a,0x67,0x72,0x69,0x64,0x20,0x78,0x3d,0x22,0x30,0x22,0x20,0x79,0x3d,0x22,0x30,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x38,0x33,0x2e,0x33,0x36,0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x39,0x36,0x2e,0x37,0x35,0x33,0x22,0x2f,0x3e,0x20,0x3c,0x2f,0x64,0x65,0x66,0x73,0x3e,0x20,0x3c,0x72,0x65,0x63,0x74,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x31,0x32,0x30,0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x31,0x32,0x30,0x22,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x32,0x61,0x36,0x36,0x39,0x39,0x22,0x20,0x6d,0x61,0x73,0x6b,0x3d,0x22,0x75,0x72,0x6c,0x28,0x23,0x63,0x69,0x72,0x63,0x6c,0x65,0x2d,0x6d,0x61,0x73,0x6b,0x29,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x22,0x2f,0x3e,0x20,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x20,0x33,0x39,0x31,0x2e,0x30,0x37,0x20,0x33,0x37,0x35,0x20,0x4c,0x20,0x33,0x38,0x36,0x2e,0x38,0x34,0x32,0x20,0x33,0x35,0x35,0x2e,0x34,0x20,0x4c,0x20,0x33,0x38,0x39,0x2e,0x30,0x32,0x36,0x20,0x33,0x35,0x35,0x2e,0x34,0x20,0x4c,0x20,0x33,0x39,0x32,0x2e,0x33,0x35,0x38,0x20,0x33,0x37,0x31,0x2e,0x35,0x38,0x34,0x20,0x4c,0x20,0x33,0x39,0x37,0x2e,0x32,0x30,0x32,0x20,0x33,0x35,0x35,0x2e,0x34,0x20,0x4c,0x20,0x33,0x39,0x39,0x2e,0x33,0x30,0x32,0x20,0x33,0x35,0x35,0x2e,0x34,0x20,0x4c,0x20,0x34,0x30,0x34,0x2e,0x31,0x34,0x36,0x20,0x33,0x37,0x31,0x2e,0x35,0x32,0x38,0x20,0x4c,0x20,0x34,0x30,0x37,0x2e,0x35,0x30,0x36,0x20,0x33,0x35,0x35,0x2e,0x34,0x20,0x4c,0x20,0x34,0x30,0x39,0x2e,0x36,0x30,0x36,0x20,0x33,0x35,0x35,0x2e,0x34,0x20,0x4c,0x20,0x34,0x30,0x35,0x2e,0x33,0x37,0x38,0x20,0x33,0x37,0x35,0x20,0x4c,0x20,0x34,0x30,0x33,0x2e,0x31,0x39,0x34,0x20,0x33,0x37,0x35,0x20,0x4c,0x20,0x33,0x39,0x38,0x2e,0x32,0x33,0x38,0x20,0x33,0x35,0x38,0x2e,0x33,0x39,0x36,0x20,0x4c,0x20,0x33,0x39,0x33,0x2e,0x32,0x35,0x34,0x20,0x33,0x37,0x35,0x20,0x5a,0x20,0x4d,0x20,0x34,0x31,0x32,0x2e,0x37,0x31,0x20,0x33,0x37,0x35,0x20,0x4c,0x20,0x34,0x31,0x32,0x2e,0x37,0x31,0x20,0x33,0x35,0x35,0x2e,0x34,0x20,0x4c,0x20,0x34,0x32,0x36,0x2e,0x37,0x33,0x38,0x20,0x33,0x35,0x35,0x2e,0x34,0x20,0x4c,0x20,0x34,0x32,0x36,0x2e,0x37,0x33,0x38,0x20,0x33,0x35,0x37,0x2e,0x33,0x30,0x34,0x20,0x4c,0x20,0x34,0x31,0x34,0x2e,0x38,0x36,0x36,0x20,0x33,0x35,0x37,0x2e,0x33,0x30,0x34,0x20,0x4c,0x20,0x34,0x31,0x34,0x2e,0x38,0x36,0x36,0x20,0x33,0x36,0x34,0x2e,0x31,0x36,0x34,0x20,0x4c,0x20,0x34,0x32,0x32,0x2e,0x36,0x32,0x32,0x20,0x33,0x36,0x34,0x2e,0x31,0x36,0x34,0x20,0x4c,0x20,0x34,0x32,0x32,0x2e,0x36,0x32,0x32,0x20,0x33,0x36,0x36,0x2e,0x30,0x34,0x20,0x4c,0x20,0x34,0x31,0x34,0x2e,0x38,0x36,0x36,0x20,0x33,0x36,0x36,0x2e,0x30,0x34,0x20,0x4c,0x20,0x34,0x31,0x34,0x2e,0x38,0x36,0x36,0x20,0x33,0x37,0x33,0x2e,0x30,0x39,0x36,0x20,0x4c,0x20,0x34,0x32,0x36,0x2e,0x38,0x35,0x20,0x33,0x37,0x33,0x2e,0x30,0x39,0x36,0x20,0x4c,0x20,0x34,0x32,0x36,0x2e,0x38,0x35,0x20,0x33,0x37,0x35,0x20,0x5a,0x20,0x4d,0x20,0x34,0x32,0x39,0x2e,0x39,0x35,0x39,0x20,0x33,0x37,0x35,0x20,0x4c,0x20,0x34,0x32,0x39,0x2e,0x39,0x35,0x39,0x20,0x33,0x35,0x35,0x2e,0x34,0x20,0x4c,0x20,0x34,0x33,0x37,0x2e,0x39,0x31,0x31,0x20,0x33,0x35,0x35,0x2e,0x34,0x20,0x51,0x20,0x34,0x33,0x39,0x2e,0x38,0x31,0x35,0x20,0x33,0x35,0x35,0x2e,0x34,0x20,0x34,0x34,0x31,0x2e,0x32,0x30,0x31,0x20,0x33,0x35,0x36,0x2e,0x30,0x31,0x36,0x20,0x51,0x20,0x34,0x34,0x32,0x2e,0x35,0x38,0x37,0x20,0x33,0x35,0x36,0x2e,0x36,0x33,0x32,0x20,0x34,0x34,0x33,0x2e,0x33,0x34,0x33,0x20,0x33,0x35,0x37,0x2e,0x37,0x36,0x36,0x20,0x51,0x20,0x34,0x34,0x34,0x2e,0x30,0x39,0x39,0x20,0x33,0x35,0x38,0x2e,0x39,0x20,0x34,0x34,0x34,0x2e,0x30,0x39,0x39,0x20,0x33,0x36,0x30,0x2e,0x34,0x34,0x20,0x51,0x20,0x34,0x34,0x34,0x2e,0x30,0x39,0x39,0x20,0x33,0x36,0x31,0x2e,0x39,0x35,0x32,0x20,0x34,0x34,0x33,0x2e,0x33,0x30,0x31,0x20,0x33,0x36,0x33,0x2e,0x30,0x37,0x32,0x20,0x51,0x20,0x34,0x34,0x32,0x2e,0x35,0x30,0x33,0x20,0x33,0x36,0x34,0x2e,0x31,0x39,0x32,0x20,0x34,0x34,0x31,0x2e,0x31,0x30,0x33,0x20,0x33,0x36,0x34,0x2e,0x37,0x38,0x20,0x51,0x20,0x34,0x34,0x32,0x2e,0x38,0x36,0x37,0x20,0x33,0x36,0x35,0x2e,0x33,0x31,0x32,0x20,0x34,0x34,0x33,0x2e,0x38,0x38,0x39,0x20,0x33,0x36,0x36,0x2e,0x35,0x34,0x34,0x20,0x51,0x20,0x34,0x34,0x34,0x2e,0x39,0x31,0x31,0x20,0x33,0x36,0x37,0x2e,0x37,0x37,0x36,0x20,0x34,0x34,0x34,0x2e,0x39,0x31,0x31,0x20,0x33,0x36,0x39,0x2e,0x34,0x38,0x34,0x20,0x51,0x20,0x34,0x34,0x34,0x2e,0x39,0x31,0x31,0x20,0x33,0x37,0x31,0x2e,0x31,0x36,0x34,0x20,0x34,0x34,0x34,0x2e,0x30,0x38,0x35,0x20,0x33,0x37,0x32,0x2e,0x34,0x31,0x20,0x51,0x20,0x34,0x34,0x33,0x2e,0x32,0x35,0x39,0x20,0x33,0x37,0x33,0x2e,0x36,0x35,0x36,0x20,0x34,0x34,0x31,0x2e,0x37,0x36,0x31,0x20,0x33,0x37,0x34,0x2e,0x33,0x32,0x38,0x20,0x51,0x20,0x34,0x34,0x30,0x2e,0x32,0x36,0x33,0x20,0x33,0x37,0x35,0x20,0x34,0x33,0x38,0x2e,0x32,0x34,0x37,0x20,0x33,0x37,0x35,0x20,0x5a,0x20,0x4d,0x20,0x34,0x33,0x32,0x2e,0x31,0x31,0x35,0x20,0x33,0x36,0x33,0x2e,0x39,0x34,0x20,0x4c,0x20,0x34,0x33,0x37,0x2e,0x37,0x39,0x39,0x20,0x33,0x36,0x33,0x2e,0x39,0x34,0x20,0x51,0x20,0x34,0x33,0x39,0x2e,0x37,0x30,0x33,0x20,0x33,0x36,0x33,0x2e,0x39,0x34,0x20,0x34,0x34,0x30,0x2e,0x38,0x33,0x37,0x20,0x33,0x36,0x33,0x2e,0x30,0x34,0x34,0x20,0x51,0x20,0x34,0x34,0x31,0x2e,0x39,0x37,0x31,0x20,0x33,0x36,0x32,0x2e,0x31,0x34,0x38,0x20,0x34,0x34,0x31,0x2e,0x39,0x37,0x31,0x20,0x33,0x36,0x30,0x2e,0x36,0x30,0x38,0x20,0x51,0x20,0x34,0x34,0x31,0x2e,0x39,0x37,0x31,0x20,0x33,0x35,0x39,0x2e,0x30,0x36,0x38,0x20,0x34,0x34,0x30,0x2e,0x38,0x33,0x37,0x20,0x33,0x35,0x38,0x2e,0x31,0x37,0x32,0x20,0x51,0x20,0x34,0x33,0x39,0x2e,0x37,0x30,0x33,0x20,0x33,0x35,0x37,0x2e,0x32,0x37,0x36,0x20,0x34,0x33,0x37,0x2e,0x37,0x39,0x39,0x20,0x33,0x35,0x37,0x2e,0x32,0x37,0x36,0x20,0x4c,0x20,0x34,0x33,0x32,0x2e,0x31,0x31,0x35,0x20,0x33,0x35,0x37,0x2e,0x32,0x37,0x36,0x20,0x5a,0x20,0x4d,0x20,0x34,0x33,0x32,0x2e,0x31,0x31,0x35,0x20,0x33,0x37,0x33,0x2e,0x31,0x32,0x34,0x20,0x4c,0x20,0x34,0x33,0x38,0x2e,0x30,0x37,0x39,0x20,0x33,0x37,0x33,0x2e,0x31,0x32,0x34,0x20,0x51,0x20,0x34,0x34,0x30,0x2e,0x32,0x30,0x37,0x20,0x33,0x37,0x33,0x2e,0x31,0x32,0x34,0x20,0x34,0x34,0x31,0x2e,0x34,0x36,0x37,0x20,0x33,0x37,0x32,0x2e,0x31,0x31,0x36,0x20,0x51,0x20,0x34,0x34,0x32,0x2e,0x37,0x32,0x37,0x20,0x33,0x37,0x31,0x2e,0x31,0x30,0x38,0x20,0x34,0x34,0x32,0x2e,0x37,0x32,0x37,0x20,0x33,0x36,0x39,0x2e,0x34,0x32,0x38,0x20,0x51,0x20,0x34,0x34,0x32,0x2e,0x37,0x32,0x37,0x20,0x33,0x36,0x37,0x2e,0x37,0x34,0x38,0x20,0x34,0x34,0x31,0x2e,0x34,0x36,0x37,0x20,0x33,0x36,0x36,0x2e,0x37,0x34,0x20,0x51,0x20,0x34,0x34,0x30,0x2e,0x32,0x30,0x37,0x20,0x33,0x36,0x35,0x2e,0x37,0x33,0x32,0x20,0x34,0x33,0x38,0x2e,0x30,0x37,0x39,0x20,0x33,0x36,0x35,0x2e,0x37,0x33,0x32,0x20,0x4c,0x20,0x34,0x33,0x32,0x2e,0x31,0x31,0x35,0x20,0x33,0x36,0x35,0x2e,0x37,0x33,0x32,0x20,0x5a,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x3d,0x22,0x6d,0x61,0x74,0x72,0x69,0x78,0x28,0x31,0x2e,0x32,0x36,0x34,0x35,0x39,0x32,0x2c,0x20,0x30,0x2c,0x20,0x30,0x2c,0x20,0x31,0x2e,0x32,0x34,0x30,0x33,0x30,0x33,0x2c,0x20,0x2d,0x34,0x38,0x33,0x2e,0x38,0x39,0x39,0x33,0x35,0x33,0x2c,0x20,0x2d,0x33,0x35,0x35,0x2e,0x38,0x34,0x35,0x31,0x35,0x34,0x29,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x3a,0x20,0x72,0x67,0x62,0x28,0x32,0x35,0x35,0x2c,0x20,0x32,0x35,0x35,0x2c,0x20,0x32,0x35,0x35,0x29,0x3b,0x22,0x2f,0x3e,0x20,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x20,0x34,0x35,0x36,0x2e,0x33,0x33,0x38,0x20,0x33,0x37,0x35,0x2e,0x32,0x38,0x20,0x51,0x20,0x34,0x35,0x33,0x2e,0x36,0x37,0x38,0x20,0x33,0x37,0x35,0x2e,0x32,0x38,0x20,0x34,0x35,0x31,0x2e,0x37,0x33,0x32,0x20,0x33,0x37,0x34,0x2e,0x32,0x31,0x36,0x20,0x51,0x20,0x34,0x34,0x39,0x2e,0x37,0x38,0x36,0x20,0x33,0x37,0x33,0x2e,0x31,0x35,0x32,0x20,0x34,0x34,0x38,0x2e,0x37,0x32,0x32,0x20,0x33,0x37,0x31,0x2e,0x31,0x37,0x38,0x20,0x51,0x20,0x34,0x34,0x37,0x2e,0x36,0x35,0x38,0x20,0x33,0x36,0x39,0x2e,0x32,0x30,0x34,0x20,0x34,0x34,0x37,0x2e,0x36,0x35,0x38,0x20,0x33,0x36,0x36,0x2e,0x35,0x34,0x34,0x20,0x4c,0x20,0x34,0x34,0x37,0x2e,0x36,0x35,0x38,0x20,0x33,0x35,0x35,0x2e,0x34,0x20,0x4c,0x20,0x34,0x35,0x31,0x2e,0x37,0x31,0x38,0x20,0x33,0x35,0x35,0x2e,0x34,0x20,0x4c,0x20,0x34,0x35,0x31,0x2e,0x37,0x31,0x38,0x20,0x33,0x36,0x36,0x2e,0x35,0x34,0x34,0x20,0x51,0x20,0x34,0x35,0x31,0x2e,0x37,0x31,0x38,0x20,0x33,0x36,0x38,0x2e,0x30,0x35,0x36,0x20,0x34,0x35,0x32,0x2e,0x32,0x39,0x32,0x20,0x33,0x36,0x39,0x2e,0x31,0x39,0x20,0x51,0x20,0x34,0x35,0x32,0x2e,0x38,0x36,0x36,0x20,0x33,0x37,0x30,0x2e,0x33,0x32,0x34,0x20,0x34,0x35,0x33,0x2e,0x39,0x31,0x36,0x20,0x33,0x37,0x30,0x2e,0x39,0x32,0x36,0x20,0x51,0x20,0x34,0x35,0x34,0x2e,0x39,0x36,0x36,0x20,0x33,0x37,0x31,0x2e,0x35,0x32,0x38,0x20,0x34,0x35,0x36,0x2e,0x33,0x36,0x36,0x20,0x33,0x37,0x31,0x2e,0x35,0x32,0x38,0x20,0x51,0x20,0x34,0x35,0x37,0x2e,0x37,0x36,0x36,0x20,0x33,0x37,0x31,0x2e,0x35,0x32,0x38,0x20,0x34,0x35,0x38,0x2e,0x38,0x30,0x32,0x20,0x33,0x37,0x30,0x2e,0x39,0x32,0x36,0x20,0x51,0x20,0x34,0x35,0x39,0x2e,0x38,0x33,0x38,0x20,0x33,0x37,0x30,0x2e,0x33,0x32,0x34,0x20,0x34,0x36,0x30,0x2e,0x34,0x31,0x32,0x20,0x33,0x36,0x39,0x2e,0x31,0x39,0x20,0x51,0x20,0x34,0x36,0x30,0x2e,0x39,0x38,0x36,0x20,0x33,0x36,0x38,0x2e,0x30,0x35,0x36,0x20,0x34,0x36,0x30,0x2e,0x39,0x38,0x36,0x20,0x33,0x36,0x36,0x2e,0x35,0x34,0x34,0x20,0x4c,0x20,0x34,0x36,0x30,0x2e,0x39,0x38,0x36,0x20,0x33,0x35,0x35,0x2e,0x34,0x20,0x4c,0x20,0x34,0x36,0x35,0x2e,0x30,0x31,0x38,0x20,0x33,0x35,0x35,0x2e,0x34,0x20,0x4c,0x20,0x34,0x36,0x35,0x2e,0x30,0x31,0x38,0x20,0x33,0x36,0x36,0x2e,0x35,0x34,0x34,0x20,0x51,0x20,0x34,0x36,0x35,0x2e,0x30,0x31,0x38,0x20,0x33,0x36,0x39,0x2e,0x31,0x37,0x36,0x20,0x34,0x36,0x33,0x2e,0x39,0x35,0x34,0x20,0x33,0x37,0x31,0x2e,0x31,0x35,0x20,0x51,0x20,0x34,0x36,0x32,0x2e,0x38,0x39,0x20,0x33,0x37,0x33,0x2e,0x31,0x32,0x34,0x20,0x34,0x36,0x30,0x2e,0x39,0x34,0x34,0x20,0x33,0x37,0x34,0x2e,0x32,0x30,0x32,0x20,0x51,0x20,0x34,0x35,0x38,0x2e,0x39,0x39,0x38,0x20,0x33,0x37,0x35,0x2e,0x32,0x38,0x20,0x34,0x35,0x36,0x2e,0x33,0x33,0x38,0x20,0x33,0x37,0x35,0x2e,0x32,0x38,0x20,0x5a,0x20,0x4d,0x20,0x34,0x36,0x38,0x2e,0x32,0x36,0x33,0x20,0x33,0x37,0x35,0x20,0x4c,0x20,0x34,0x36,0x38,0x2e,0x32,0x36,0x33,0x20,0x33,0x35,0x35,0x2e,0x34,0x20,0x4c,0x20,0x34,0x37,0x32,0x2e,0x33,0x32,0x33,0x20,0x33,0x35,0x35,0x2e,0x34,0x20,0x4c,0x20,0x34,0x37,0x32,0x2e,0x33,0x32,0x33,0x20,0x33,0x37,0x35,0x20,0x5a,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x3d,0x22,0x6d,0x61,0x74,0x72,0x69,0x78,0x28,0x31,0x2e,0x32,0x36,0x34,0x35,0x39,0x32,0x2c,0x20,0x30,0x2c,0x20,0x30,0x2c,0x20,0x31,0x2e,0x32,0x34,0x30,0x33,0x30,0x33,0x2c,0x20,0x2d,0x34,0x38,0x33,0x2e,0x38,0x39,0x39,0x33,0x35,0x33,0x2c,0x20,0x2d,0x33,0x35,0x35,0x2e,0x38,0x34,0x35,0x31,0x35,0x34,0x29,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x3a,0x20,0x72,0x67,0x62,0x28,0x32,0x35,0x35,0x2c,0x20,0x32,0x35,0x35,0x2c,0x20,0x32,0x35,0x35,0x29,0x3b,0x22,0x2f,0x3e,0x3c,0x2f,0x73,0x76,0x67,0x3e},
-        2347
-    },
-};
+#include "webinix.h"
 
-static const int virtual_files_count = sizeof(virtual_files) / sizeof(virtual_files[0]);
+// /index.html
+static const unsigned char webinix_asset_0[] = {
+    0x3c,0x21,0x64,0x6f,0x63,0x74,0x79,0x70,0x65,0x20,0x68,0x74,0x6d,0x6c,0x3e,0x0a,
+    0x3c,0x68,0x74,0x6d,0x6c,0x3e,0x0a,0x09,0x3c,0x68,0x65,0x61,0x64,0x3e,0x0a,0x09,
+    0x09,0x3c,0x6d,0x65,0x74,0x61,0x20,0x63,0x68,0x61,0x72,0x73,0x65,0x74,0x3d,0x22,
+    0x55,0x54,0x46,0x2d,0x38,0x22,0x20,0x2f,0x3e,0x0a,0x09,0x09,0x3c,0x74,0x69,0x74,
+    0x6c,0x65,0x3e,0x57,0x65,0x62,0x69,0x6e,0x69,0x78,0x20,0x2d,0x20,0x56,0x69,0x72,
+    0x74,0x75,0x61,0x6c,0x20,0x46,0x69,0x6c,0x65,0x20,0x53,0x79,0x73,0x74,0x65,0x6d,
+    0x3c,0x2f,0x74,0x69,0x74,0x6c,0x65,0x3e,0x0a,0x09,0x09,0x3c,0x73,0x74,0x79,0x6c,
+    0x65,0x3e,0x0a,0x09,0x09,0x09,0x62,0x6f,0x64,0x79,0x20,0x7b,0x0a,0x09,0x09,0x09,
+    0x09,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x27,0x41,
+    0x72,0x69,0x61,0x6c,0x27,0x2c,0x20,0x73,0x61,0x6e,0x73,0x2d,0x73,0x65,0x72,0x69,
+    0x66,0x3b,0x0a,0x09,0x09,0x09,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x77,0x68,
+    0x69,0x74,0x65,0x3b,0x0a,0x09,0x09,0x09,0x09,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,
+    0x75,0x6e,0x64,0x3a,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x2d,0x67,0x72,0x61,0x64,
+    0x69,0x65,0x6e,0x74,0x28,0x74,0x6f,0x20,0x72,0x69,0x67,0x68,0x74,0x2c,0x20,0x23,
+    0x35,0x30,0x37,0x64,0x39,0x31,0x2c,0x20,0x23,0x31,0x63,0x35,0x39,0x36,0x66,0x2c,
+    0x20,0x23,0x30,0x32,0x32,0x37,0x33,0x37,0x29,0x3b,0x0a,0x09,0x09,0x09,0x09,0x74,
+    0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x20,0x63,0x65,0x6e,0x74,0x65,
+    0x72,0x3b,0x0a,0x09,0x09,0x09,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,
+    0x3a,0x20,0x31,0x38,0x70,0x78,0x3b,0x0a,0x09,0x09,0x09,0x7d,0x0a,0x09,0x09,0x09,
+    0x62,0x75,0x74,0x74,0x6f,0x6e,0x2c,0x0a,0x09,0x09,0x09,0x69,0x6e,0x70,0x75,0x74,
+    0x20,0x7b,0x0a,0x09,0x09,0x09,0x09,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,
+    0x31,0x30,0x70,0x78,0x3b,0x0a,0x09,0x09,0x09,0x09,0x62,0x6f,0x72,0x64,0x65,0x72,
+    0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x20,0x33,0x70,0x78,0x3b,0x0a,0x09,0x09,
+    0x09,0x09,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x20,0x31,0x70,0x78,0x20,0x73,0x6f,
+    0x6c,0x69,0x64,0x20,0x23,0x63,0x63,0x63,0x3b,0x0a,0x09,0x09,0x09,0x09,0x62,0x6f,
+    0x78,0x2d,0x73,0x68,0x61,0x64,0x6f,0x77,0x3a,0x20,0x30,0x20,0x33,0x70,0x78,0x20,
+    0x35,0x70,0x78,0x20,0x72,0x67,0x62,0x61,0x28,0x30,0x2c,0x20,0x30,0x2c,0x20,0x30,
+    0x2c,0x20,0x30,0x2e,0x31,0x29,0x3b,0x0a,0x09,0x09,0x09,0x09,0x74,0x72,0x61,0x6e,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x20,0x30,0x2e,0x32,0x73,0x3b,0x0a,0x09,0x09,
+    0x09,0x7d,0x0a,0x09,0x09,0x09,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x7b,0x0a,0x09,
+    0x09,0x09,0x09,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x23,
+    0x33,0x34,0x39,0x38,0x64,0x62,0x3b,0x0a,0x09,0x09,0x09,0x09,0x63,0x6f,0x6c,0x6f,
+    0x72,0x3a,0x20,0x23,0x66,0x66,0x66,0x3b,0x0a,0x09,0x09,0x09,0x09,0x63,0x75,0x72,
+    0x73,0x6f,0x72,0x3a,0x20,0x70,0x6f,0x69,0x6e,0x74,0x65,0x72,0x3b,0x0a,0x09,0x09,
+    0x09,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x36,0x70,
+    0x78,0x3b,0x0a,0x09,0x09,0x09,0x7d,0x0a,0x09,0x09,0x09,0x68,0x31,0x20,0x7b,0x0a,
+    0x09,0x09,0x09,0x09,0x74,0x65,0x78,0x74,0x2d,0x73,0x68,0x61,0x64,0x6f,0x77,0x3a,
+    0x20,0x2d,0x37,0x70,0x78,0x20,0x31,0x30,0x70,0x78,0x20,0x37,0x70,0x78,0x20,0x72,
+    0x67,0x62,0x28,0x36,0x37,0x20,0x35,0x37,0x20,0x35,0x37,0x20,0x2f,0x20,0x37,0x36,
+    0x25,0x29,0x3b,0x0a,0x09,0x09,0x09,0x7d,0x0a,0x09,0x09,0x09,0x62,0x75,0x74,0x74,
+    0x6f,0x6e,0x3a,0x68,0x6f,0x76,0x65,0x72,0x20,0x7b,0x0a,0x09,0x09,0x09,0x09,0x62,
+    0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x23,0x63,0x39,0x39,0x31,
+    0x33,0x64,0x3b,0x0a,0x09,0x09,0x09,0x7d,0x0a,0x09,0x09,0x09,0x69,0x6e,0x70,0x75,
+    0x74,0x3a,0x66,0x6f,0x63,0x75,0x73,0x20,0x7b,0x0a,0x09,0x09,0x09,0x09,0x6f,0x75,
+    0x74,0x6c,0x69,0x6e,0x65,0x3a,0x20,0x6e,0x6f,0x6e,0x65,0x3b,0x0a,0x09,0x09,0x09,
+    0x09,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,
+    0x33,0x34,0x39,0x38,0x64,0x62,0x3b,0x0a,0x09,0x09,0x09,0x7d,0x0a,0x0a,0x09,0x09,
+    0x09,0x61,0x3a,0x6c,0x69,0x6e,0x6b,0x20,0x7b,0x0a,0x09,0x09,0x09,0x09,0x63,0x6f,
+    0x6c,0x6f,0x72,0x3a,0x20,0x23,0x66,0x64,0x35,0x37,0x32,0x33,0x3b,0x0a,0x09,0x09,
+    0x09,0x7d,0x0a,0x09,0x09,0x09,0x61,0x3a,0x61,0x63,0x74,0x69,0x76,0x65,0x20,0x7b,
+    0x0a,0x09,0x09,0x09,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x66,0x64,0x35,
+    0x37,0x32,0x33,0x3b,0x0a,0x09,0x09,0x09,0x7d,0x0a,0x09,0x09,0x09,0x61,0x3a,0x76,
+    0x69,0x73,0x69,0x74,0x65,0x64,0x20,0x7b,0x0a,0x09,0x09,0x09,0x09,0x63,0x6f,0x6c,
+    0x6f,0x72,0x3a,0x20,0x23,0x66,0x64,0x35,0x37,0x32,0x33,0x3b,0x0a,0x09,0x09,0x09,
+    0x7d,0x0a,0x09,0x09,0x09,0x61,0x3a,0x68,0x6f,0x76,0x65,0x72,0x20,0x7b,0x0a,0x09,
+    0x09,0x09,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x66,0x30,0x62,0x63,0x61,
+    0x63,0x3b,0x0a,0x09,0x09,0x09,0x7d,0x0a,0x09,0x09,0x3c,0x2f,0x73,0x74,0x79,0x6c,
+    0x65,0x3e,0x0a,0x09,0x3c,0x2f,0x68,0x65,0x61,0x64,0x3e,0x0a,0x09,0x3c,0x62,0x6f,
+    0x64,0x79,0x3e,0x0a,0x09,0x09,0x3c,0x68,0x33,0x20,0x69,0x64,0x3d,0x22,0x74,0x69,
+    0x74,0x6c,0x65,0x22,0x3e,0x56,0x69,0x72,0x74,0x75,0x61,0x6c,0x20,0x46,0x69,0x6c,
+    0x65,0x20,0x53,0x79,0x73,0x74,0x65,0x6d,0x20,0x45,0x78,0x61,0x6d,0x70,0x6c,0x65,
+    0x3c,0x2f,0x68,0x33,0x3e,0x0a,0x09,0x09,0x3c,0x62,0x72,0x20,0x2f,0x3e,0x0a,0x09,
+    0x09,0x3c,0x69,0x6d,0x67,0x20,0x73,0x72,0x63,0x3d,0x22,0x73,0x76,0x67,0x2f,0x77,
+    0x65,0x62,0x69,0x6e,0x69,0x78,0x2e,0x73,0x76,0x67,0x22,0x3e,0x0a,0x09,0x09,0x3c,
+    0x62,0x72,0x20,0x2f,0x3e,0x0a,0x09,0x09,0x3c,0x70,0x3e,0x0a,0x09,0x09,0x09,0x54,
+    0x68,0x69,0x73,0x20,0x66,0x69,0x6c,0x65,0x20,0x69,0x73,0x20,0x65,0x6d,0x62,0x65,
+    0x64,0x64,0x65,0x64,0x20,0x69,0x6e,0x20,0x74,0x68,0x69,0x73,0x20,0x61,0x70,0x70,
+    0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2e,0x3c,0x62,0x72,0x20,0x2f,0x3e,0x0a,
+    0x09,0x09,0x3c,0x2f,0x70,0x3e,0x0a,0x09,0x09,0x3c,0x68,0x34,0x3e,0x3c,0x61,0x20,
+    0x68,0x72,0x65,0x66,0x3d,0x22,0x73,0x75,0x62,0x22,0x3e,0x2f,0x73,0x75,0x62,0x3c,
+    0x2f,0x61,0x3e,0x3c,0x2f,0x68,0x34,0x3e,0x0a,0x09,0x09,0x3c,0x62,0x72,0x20,0x2f,
+    0x3e,0x0a,0x09,0x09,0x3c,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x69,0x64,0x3d,0x22,
+    0x45,0x78,0x69,0x74,0x22,0x3e,0x45,0x78,0x69,0x74,0x3c,0x2f,0x62,0x75,0x74,0x74,
+    0x6f,0x6e,0x3e,0x0a,0x09,0x3c,0x2f,0x62,0x6f,0x64,0x79,0x3e,0x0a,0x0a,0x09,0x3c,
+    0x21,0x2d,0x2d,0x20,0x43,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x20,0x74,0x68,0x69,0x73,
+    0x20,0x77,0x69,0x6e,0x64,0x6f,0x77,0x20,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x62,
+    0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x20,0x61,0x70,0x70,0x20,0x2d,0x2d,
+    0x3e,0x0a,0x09,0x3c,0x73,0x63,0x72,0x69,0x70,0x74,0x20,0x73,0x72,0x63,0x3d,0x22,
+    0x2f,0x77,0x65,0x62,0x69,0x6e,0x69,0x78,0x2e,0x6a,0x73,0x22,0x3e,0x3c,0x2f,0x73,
+    0x63,0x72,0x69,0x70,0x74,0x3e,0x0a,0x0a,0x09,0x3c,0x73,0x63,0x72,0x69,0x70,0x74,
+    0x3e,0x0a,0x0a,0x09,0x09,0x2f,0x2f,0x20,0x4a,0x61,0x76,0x61,0x53,0x63,0x72,0x69,
+    0x70,0x74,0x20,0x45,0x78,0x61,0x6d,0x70,0x6c,0x65,0x0a,0x09,0x09,0x2f,0x2a,0x0a,
+    0x09,0x09,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x61,0x64,0x64,0x45,0x76,
+    0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x27,0x44,0x4f,0x4d,
+    0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x4c,0x6f,0x61,0x64,0x65,0x64,0x27,0x2c,0x20,
+    0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x29,0x20,0x7b,0x0a,0x09,0x09,0x09,
+    0x2f,0x2f,0x20,0x44,0x4f,0x4d,0x20,0x69,0x73,0x20,0x6c,0x6f,0x61,0x64,0x65,0x64,
+    0x2e,0x20,0x43,0x68,0x65,0x63,0x6b,0x20,0x69,0x66,0x20,0x60,0x77,0x65,0x62,0x69,
+    0x6e,0x69,0x78,0x60,0x20,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x69,0x73,0x20,0x61,
+    0x76,0x61,0x69,0x6c,0x61,0x62,0x6c,0x65,0x0a,0x09,0x09,0x09,0x69,0x66,0x20,0x28,
+    0x74,0x79,0x70,0x65,0x6f,0x66,0x20,0x77,0x65,0x62,0x69,0x6e,0x69,0x78,0x20,0x21,
+    0x3d,0x3d,0x20,0x27,0x75,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x27,0x29,0x20,
+    0x7b,0x0a,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x53,0x65,0x74,0x20,0x65,0x76,0x65,
+    0x6e,0x74,0x73,0x20,0x63,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x0a,0x09,0x09,0x09,
+    0x09,0x77,0x65,0x62,0x69,0x6e,0x69,0x78,0x2e,0x73,0x65,0x74,0x45,0x76,0x65,0x6e,
+    0x74,0x43,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x28,0x28,0x65,0x29,0x20,0x3d,0x3e,
+    0x20,0x7b,0x0a,0x09,0x09,0x09,0x09,0x09,0x69,0x66,0x20,0x28,0x65,0x20,0x3d,0x3d,
+    0x20,0x77,0x65,0x62,0x69,0x6e,0x69,0x78,0x2e,0x65,0x76,0x65,0x6e,0x74,0x2e,0x43,
+    0x4f,0x4e,0x4e,0x45,0x43,0x54,0x45,0x44,0x29,0x20,0x7b,0x0a,0x09,0x09,0x09,0x09,
+    0x09,0x09,0x2f,0x2f,0x20,0x43,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x69,0x6f,0x6e,0x20,
+    0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x62,0x61,0x63,0x6b,0x65,0x6e,0x64,0x20,0x69,
+    0x73,0x20,0x65,0x73,0x74,0x61,0x62,0x6c,0x69,0x73,0x68,0x65,0x64,0x0a,0x09,0x09,
+    0x09,0x09,0x09,0x09,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,
+    0x27,0x43,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x65,0x64,0x2e,0x27,0x29,0x3b,0x0a,0x09,
+    0x09,0x09,0x09,0x09,0x09,0x77,0x65,0x62,0x69,0x6e,0x69,0x78,0x54,0x65,0x73,0x74,
+    0x28,0x29,0x3b,0x0a,0x09,0x09,0x09,0x09,0x09,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,
+    0x69,0x66,0x20,0x28,0x65,0x20,0x3d,0x3d,0x20,0x77,0x65,0x62,0x69,0x6e,0x69,0x78,
+    0x2e,0x65,0x76,0x65,0x6e,0x74,0x2e,0x44,0x49,0x53,0x43,0x4f,0x4e,0x4e,0x45,0x43,
+    0x54,0x45,0x44,0x29,0x20,0x7b,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,
+    0x43,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x69,0x6f,0x6e,0x20,0x74,0x6f,0x20,0x74,0x68,
+    0x65,0x20,0x62,0x61,0x63,0x6b,0x65,0x6e,0x64,0x20,0x69,0x73,0x20,0x6c,0x6f,0x73,
+    0x74,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,
+    0x6c,0x6f,0x67,0x28,0x27,0x44,0x69,0x73,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x65,
+    0x64,0x2e,0x27,0x29,0x3b,0x0a,0x09,0x09,0x09,0x09,0x09,0x7d,0x0a,0x09,0x09,0x09,
+    0x09,0x7d,0x29,0x3b,0x0a,0x09,0x09,0x09,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,
+    0x0a,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x54,0x68,0x65,0x20,0x76,0x69,0x72,0x74,
+    0x75,0x61,0x6c,0x20,0x66,0x69,0x6c,0x65,0x20,0x60,0x77,0x65,0x62,0x69,0x6e,0x69,
+    0x78,0x2e,0x6a,0x73,0x60,0x20,0x69,0x73,0x20,0x6e,0x6f,0x74,0x20,0x69,0x6e,0x63,
+    0x6c,0x75,0x64,0x65,0x64,0x0a,0x09,0x09,0x09,0x09,0x61,0x6c,0x65,0x72,0x74,0x28,
+    0x27,0x50,0x6c,0x65,0x61,0x73,0x65,0x20,0x61,0x64,0x64,0x20,0x77,0x65,0x62,0x69,
+    0x6e,0x69,0x78,0x2e,0x6a,0x73,0x20,0x74,0x6f,0x20,0x79,0x6f,0x75,0x72,0x20,0x48,
+    0x54,0x4d,0x4c,0x2e,0x27,0x29,0x3b,0x0a,0x09,0x09,0x09,0x7d,0x0a,0x09,0x09,0x7d,
+    0x29,0x3b,0x0a,0x0a,0x09,0x09,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x77,
+    0x65,0x62,0x69,0x6e,0x69,0x78,0x54,0x65,0x73,0x74,0x28,0x29,0x20,0x7b,0x0a,0x09,
+    0x09,0x09,0x2f,0x2f,0x20,0x43,0x61,0x6c,0x6c,0x20,0x61,0x20,0x62,0x61,0x63,0x6b,
+    0x65,0x6e,0x64,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x0a,0x09,0x09,0x09,
+    0x69,0x66,0x20,0x28,0x77,0x65,0x62,0x69,0x6e,0x69,0x78,0x2e,0x69,0x73,0x43,0x6f,
+    0x6e,0x6e,0x65,0x63,0x74,0x65,0x64,0x28,0x29,0x29,0x20,0x7b,0x0a,0x0a,0x09,0x09,
+    0x09,0x09,0x2f,0x2f,0x20,0x57,0x68,0x65,0x6e,0x20,0x79,0x6f,0x75,0x20,0x62,0x69,
+    0x6e,0x64,0x20,0x61,0x20,0x66,0x75,0x6e,0x63,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,
+    0x20,0x62,0x61,0x63,0x6b,0x65,0x6e,0x64,0x0a,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,
+    0x77,0x65,0x62,0x69,0x6e,0x69,0x78,0x20,0x77,0x69,0x6c,0x6c,0x20,0x63,0x72,0x65,
+    0x61,0x74,0x65,0x20,0x74,0x68,0x65,0x20,0x60,0x66,0x75,0x6e,0x63,0x60,0x20,0x6f,
+    0x62,0x6a,0x65,0x63,0x74,0x0a,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x69,0x6e,0x20,
+    0x74,0x68,0x72,0x65,0x65,0x20,0x70,0x6c,0x61,0x63,0x65,0x73,0x3a,0x0a,0x09,0x09,
+    0x09,0x09,0x2f,0x2f,0x0a,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x47,0x6c,0x6f,0x62,
+    0x61,0x6c,0x20,0x20,0x20,0x3a,0x20,0x66,0x75,0x6e,0x63,0x28,0x2e,0x2e,0x2e,0x29,
+    0x0a,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x50,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
+    0x20,0x3a,0x20,0x77,0x65,0x62,0x69,0x6e,0x69,0x78,0x2e,0x66,0x75,0x6e,0x63,0x28,
+    0x2e,0x2e,0x2e,0x29,0x0a,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x4d,0x65,0x74,0x68,
+    0x6f,0x64,0x20,0x20,0x20,0x3a,0x20,0x77,0x65,0x62,0x69,0x6e,0x69,0x78,0x2e,0x63,
+    0x61,0x6c,0x6c,0x28,0x27,0x66,0x75,0x6e,0x63,0x27,0x2c,0x20,0x2e,0x2e,0x2e,0x29,
+    0x0a,0x09,0x09,0x09,0x09,0x2f,0x2f,0x0a,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x5b,
+    0x21,0x5d,0x20,0x4e,0x6f,0x74,0x65,0x3a,0x20,0x4f,0x62,0x6a,0x65,0x63,0x74,0x73,
+    0x20,0x63,0x72,0x65,0x61,0x74,0x69,0x6f,0x6e,0x20,0x66,0x61,0x69,0x6c,0x73,0x20,
+    0x77,0x68,0x65,0x6e,0x0a,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x61,0x20,0x73,0x69,
+    0x6d,0x69,0x6c,0x61,0x72,0x20,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x61,0x6c,0x72,
+    0x65,0x61,0x64,0x79,0x20,0x65,0x78,0x69,0x73,0x74,0x2e,0x0a,0x0a,0x09,0x09,0x09,
+    0x09,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6f,0x6f,0x20,0x3d,0x20,0x27,0x48,0x65,
+    0x6c,0x6c,0x6f,0x27,0x3b,0x0a,0x09,0x09,0x09,0x09,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x62,0x61,0x72,0x20,0x3d,0x20,0x31,0x32,0x33,0x34,0x35,0x36,0x3b,0x0a,0x0a,0x09,
+    0x09,0x09,0x09,0x2f,0x2f,0x20,0x43,0x61,0x6c,0x6c,0x69,0x6e,0x67,0x20,0x61,0x73,
+    0x20,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x20,0x6f,0x62,0x6a,0x65,0x63,0x74,0x0a,0x09,
+    0x09,0x09,0x09,0x6d,0x79,0x42,0x61,0x63,0x6b,0x65,0x6e,0x64,0x46,0x75,0x6e,0x63,
+    0x74,0x69,0x6f,0x6e,0x28,0x66,0x6f,0x6f,0x2c,0x20,0x62,0x61,0x72,0x29,0x2e,0x74,
+    0x68,0x65,0x6e,0x28,0x28,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x29,0x20,0x3d,
+    0x3e,0x20,0x7b,0x0a,0x09,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x44,0x6f,0x20,0x73,
+    0x6f,0x6d,0x65,0x74,0x68,0x69,0x6e,0x67,0x20,0x77,0x69,0x74,0x68,0x20,0x60,0x72,
+    0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x60,0x0a,0x09,0x09,0x09,0x09,0x7d,0x29,0x3b,
+    0x0a,0x09,0x09,0x09,0x09,0x0a,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x43,0x61,0x6c,
+    0x6c,0x69,0x6e,0x67,0x20,0x61,0x73,0x20,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
+    0x20,0x6f,0x66,0x20,0x60,0x77,0x65,0x62,0x69,0x6e,0x69,0x78,0x2e,0x60,0x20,0x6f,
+    0x62,0x6a,0x65,0x63,0x74,0x0a,0x09,0x09,0x09,0x09,0x77,0x65,0x62,0x69,0x6e,0x69,
+    0x78,0x2e,0x6d,0x79,0x42,0x61,0x63,0x6b,0x65,0x6e,0x64,0x46,0x75,0x6e,0x63,0x74,
+    0x69,0x6f,0x6e,0x28,0x66,0x6f,0x6f,0x2c,0x20,0x62,0x61,0x72,0x29,0x2e,0x74,0x68,
+    0x65,0x6e,0x28,0x28,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x29,0x20,0x3d,0x3e,
+    0x20,0x7b,0x0a,0x09,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x44,0x6f,0x20,0x73,0x6f,
+    0x6d,0x65,0x74,0x68,0x69,0x6e,0x67,0x20,0x77,0x69,0x74,0x68,0x20,0x60,0x72,0x65,
+    0x73,0x70,0x6f,0x6e,0x73,0x65,0x60,0x0a,0x09,0x09,0x09,0x09,0x7d,0x29,0x3b,0x0a,
+    0x09,0x09,0x09,0x09,0x0a,0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x43,0x61,0x6c,0x6c,
+    0x69,0x6e,0x67,0x20,0x75,0x73,0x69,0x6e,0x67,0x20,0x74,0x68,0x65,0x20,0x6d,0x65,
+    0x74,0x68,0x6f,0x64,0x20,0x60,0x77,0x65,0x62,0x69,0x6e,0x69,0x78,0x2e,0x63,0x61,
+    0x6c,0x6c,0x28,0x29,0x60,0x0a,0x09,0x09,0x09,0x09,0x77,0x65,0x62,0x69,0x6e,0x69,
+    0x78,0x2e,0x63,0x61,0x6c,0x6c,0x28,0x27,0x6d,0x79,0x42,0x61,0x63,0x6b,0x65,0x6e,
+    0x64,0x46,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x27,0x2c,0x20,0x66,0x6f,0x6f,0x2c,
+    0x20,0x62,0x61,0x72,0x29,0x2e,0x74,0x68,0x65,0x6e,0x28,0x28,0x72,0x65,0x73,0x70,
+    0x6f,0x6e,0x73,0x65,0x29,0x20,0x3d,0x3e,0x20,0x7b,0x0a,0x09,0x09,0x09,0x09,0x09,
+    0x2f,0x2f,0x20,0x44,0x6f,0x20,0x73,0x6f,0x6d,0x65,0x74,0x68,0x69,0x6e,0x67,0x20,
+    0x77,0x69,0x74,0x68,0x20,0x60,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x60,0x0a,
+    0x09,0x09,0x09,0x09,0x7d,0x29,0x3b,0x0a,0x09,0x09,0x09,0x09,0x0a,0x09,0x09,0x09,
+    0x09,0x2f,0x2f,0x20,0x55,0x73,0x69,0x6e,0x67,0x20,0x61,0x77,0x61,0x69,0x74,0x0a,
+    0x09,0x09,0x09,0x09,0x2f,0x2f,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x72,0x65,0x73,
+    0x70,0x6f,0x6e,0x73,0x65,0x20,0x3d,0x20,0x61,0x77,0x61,0x69,0x74,0x20,0x6d,0x79,
+    0x42,0x61,0x63,0x6b,0x65,0x6e,0x64,0x46,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,
+    0x66,0x6f,0x6f,0x2c,0x20,0x62,0x61,0x72,0x29,0x3b,0x0a,0x09,0x09,0x09,0x09,0x2f,
+    0x2f,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,
+    0x20,0x3d,0x20,0x61,0x77,0x61,0x69,0x74,0x20,0x77,0x65,0x62,0x69,0x6e,0x69,0x78,
+    0x2e,0x6d,0x79,0x42,0x61,0x63,0x6b,0x65,0x6e,0x64,0x46,0x75,0x6e,0x63,0x74,0x69,
+    0x6f,0x6e,0x28,0x66,0x6f,0x6f,0x2c,0x20,0x62,0x61,0x72,0x29,0x3b,0x0a,0x09,0x09,
+    0x09,0x09,0x2f,0x2f,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x72,0x65,0x73,0x70,0x6f,
+    0x6e,0x73,0x65,0x20,0x3d,0x20,0x61,0x77,0x61,0x69,0x74,0x20,0x77,0x65,0x62,0x69,
+    0x6e,0x69,0x78,0x2e,0x63,0x61,0x6c,0x6c,0x28,0x27,0x6d,0x79,0x42,0x61,0x63,0x6b,
+    0x65,0x6e,0x64,0x46,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x27,0x2c,0x20,0x66,0x6f,
+    0x6f,0x2c,0x20,0x62,0x61,0x72,0x29,0x3b,0x0a,0x09,0x09,0x09,0x7d,0x0a,0x09,0x09,
+    0x7d,0x0a,0x09,0x09,0x2a,0x2f,0x0a,0x0a,0x09,0x3c,0x2f,0x73,0x63,0x72,0x69,0x70,
+    0x74,0x3e,0x0a,0x3c,0x2f,0x68,0x74,0x6d,0x6c,0x3e,0x0a,
+};
+static const unsigned char webinix_asset_0_gz[] = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xbd,0x57,0x6d,0x6f,0xdb,0x36,
+    0x10,0xfe,0xec,0xfc,0x8a,0x8b,0x83,0xc1,0x72,0x11,0x49,0x76,0x9c,0xc4,0x8d,0x62,
+    0x1b,0x58,0x93,0x74,0xdd,0xd0,0x37,0x20,0xe9,0xfa,0x61,0x18,0x60,0x4a,0xa2,0x2c,
+    0xb6,0xb4,0x28,0x90,0x94,0x5f,0x36,0xe4,0xbf,0xef,0x48,0x89,0xb2,0xdd,0x66,0x6b,
+    0x31,0x60,0x03,0x62,0x99,0x20,0x9f,0xbb,0x7b,0xee,0xe1,0xdd,0x59,0x99,0x1c,0xa7,
+    0x22,0xd1,0xdb,0x92,0x42,0xae,0x97,0x7c,0x76,0x34,0xa9,0xbf,0x3a,0x93,0x9c,0x92,
+    0x14,0xbf,0x3b,0x93,0x25,0xd5,0x04,0x92,0x9c,0x48,0x45,0xf5,0xb4,0xfb,0xe1,0xe1,
+    0xa5,0xff,0xbc,0x0b,0xa1,0x3d,0xd2,0x4c,0x73,0x3a,0xfb,0x48,0x63,0x56,0xb0,0x0d,
+    0xf8,0xf0,0x2b,0x93,0xba,0x22,0x1c,0x5e,0x32,0x4e,0xe1,0x7e,0xab,0x34,0x5d,0x4e,
+    0xc2,0x1a,0x64,0xe0,0x4a,0x6f,0xeb,0x55,0x27,0x16,0xe9,0x16,0xfe,0x34,0xab,0x4e,
+    0x26,0x0a,0xed,0x67,0x64,0xc9,0xf8,0x36,0x82,0xde,0x8f,0x92,0x11,0xde,0x3b,0x05,
+    0x45,0x0a,0xe5,0x2b,0x2a,0x59,0x76,0x6d,0x51,0x89,0xe0,0x42,0x46,0xb0,0xce,0x99,
+    0xa6,0xf5,0x4e,0x4c,0x92,0xcf,0x0b,0x29,0xaa,0x22,0x8d,0x80,0xb3,0x82,0x12,0xe9,
+    0x2f,0x24,0x49,0x19,0x2d,0xb4,0xa7,0x05,0x48,0xb6,0xc8,0xf5,0x29,0x9c,0x5c,0x0c,
+    0xc6,0xe9,0xd5,0x10,0x17,0xc3,0xe4,0xe2,0xea,0x32,0xc3,0xc5,0xe0,0xec,0x6c,0x3c,
+    0x1a,0xf7,0x6b,0x2f,0x9a,0x6e,0xb4,0x4f,0x38,0x5b,0x14,0x11,0x24,0x68,0x4a,0xe5,
+    0xf5,0x8e,0x95,0x62,0x7f,0xd0,0x08,0x86,0xcf,0xcb,0x8d,0xdd,0x7c,0xb4,0xcc,0x2b,
+    0xad,0x45,0x71,0x6a,0x96,0xac,0x28,0x2b,0xdd,0x64,0x51,0x92,0x34,0x65,0xc5,0x02,
+    0xd1,0x83,0x06,0x8d,0x39,0xca,0x94,0x4a,0xdf,0x70,0xaa,0x54,0x04,0xa3,0xc3,0x7d,
+    0x44,0x96,0x1b,0x50,0x82,0xb3,0x14,0x4e,0x92,0x24,0x71,0x67,0x1b,0x5f,0xe5,0x24,
+    0x15,0xeb,0x08,0x06,0xc6,0x04,0x2e,0xf0,0x23,0x17,0x31,0xf1,0x06,0xa7,0xd0,0xfc,
+    0x05,0x43,0x47,0x5e,0xa2,0x4a,0x4c,0x33,0x81,0xe4,0x07,0xc1,0x99,0xfa,0x92,0x65,
+    0xc3,0x6d,0x5f,0xa9,0x93,0xd1,0xf9,0xd5,0xf3,0x34,0x3e,0x10,0xf5,0x24,0xcb,0x9c,
+    0xca,0x95,0x54,0x66,0xa7,0x14,0xec,0x69,0x29,0x2e,0xf7,0xa5,0xc8,0x87,0x4d,0x00,
+    0x2b,0xa2,0xa3,0xed,0x8f,0x91,0xb1,0x51,0x01,0xc6,0x35,0x75,0xef,0x72,0x0c,0x17,
+    0xf6,0x2f,0x84,0xf1,0xe5,0x0f,0xfd,0x2f,0x59,0x46,0xb9,0x58,0x51,0xf9,0x14,0xd7,
+    0xe4,0xea,0x6a,0x38,0x4a,0x77,0x78,0x2b,0x78,0x94,0x89,0xa4,0x52,0x0d,0x5c,0x54,
+    0xda,0xdc,0x7d,0x04,0x85,0x28,0xe8,0x81,0xec,0x2e,0xb7,0xbd,0x7c,0x1f,0x8f,0xcc,
+    0x93,0x44,0x68,0xf1,0xb9,0xb1,0x6f,0x15,0x48,0x2f,0xc6,0x67,0xa3,0x5d,0x24,0x12,
+    0x91,0x44,0xb3,0x15,0xfd,0x26,0x6c,0xc5,0xf0,0x02,0x68,0xfa,0x4d,0xdc,0x7e,0x8e,
+    0x2d,0x6a,0x10,0x27,0x24,0x69,0x51,0x93,0xd0,0xf5,0xc7,0x24,0x6c,0x9a,0x6f,0x62,
+    0xfa,0xc4,0xb6,0x4e,0x3e,0x02,0x96,0x4e,0xbb,0xb6,0x97,0xba,0xb3,0x27,0xfa,0x0c,
+    0xee,0x36,0x64,0x59,0x72,0x8a,0xb6,0x23,0x6b,0x11,0xcb,0xa6,0x49,0xd9,0x72,0x01,
+    0x4a,0x26,0xd3,0xae,0x5a,0x2d,0xc2,0x75,0xdd,0xab,0x01,0xae,0xbb,0x87,0xb0,0xd2,
+    0x36,0xe6,0x43,0xce,0x14,0x64,0xc6,0x2d,0x7e,0xd3,0x65,0x4c,0xd3,0x14,0xb3,0x63,
+    0x05,0x68,0x73,0x40,0xca,0x92,0xb3,0x84,0x98,0x8a,0x0b,0x76,0x96,0x61,0x59,0x53,
+    0x3c,0x9f,0x4d,0x08,0xe4,0x92,0x66,0x18,0xaa,0x8a,0xbb,0xb3,0x10,0x9f,0x93,0x90,
+    0xcc,0x90,0xd2,0xf9,0x61,0xac,0xa6,0x3c,0x4d,0x46,0x77,0x1b,0xa6,0xbb,0x33,0xf3,
+    0x9c,0x84,0xf5,0xb6,0x15,0xa0,0x4e,0x1c,0x57,0xc7,0xbe,0x0f,0x37,0xa2,0x28,0x68,
+    0xa2,0x6b,0x0e,0x6b,0x56,0x60,0x9d,0x01,0xb6,0xb8,0xce,0x29,0xec,0xea,0xc5,0x90,
+    0x03,0xdf,0x37,0xd6,0x2a,0x91,0xac,0xd4,0x75,0xd2,0x6d,0xc6,0x9f,0x54,0x17,0x99,
+    0xd4,0x47,0xd6,0xf3,0x6e,0xd9,0x09,0x43,0xf8,0x85,0xac,0xc8,0x7d,0x6d,0xd7,0x28,
+    0x69,0xf6,0x9f,0xe1,0x03,0xe7,0x63,0xb5,0xc4,0xd1,0x10,0x60,0x8b,0xdf,0xad,0x70,
+    0xf1,0x9a,0xa1,0xe0,0x05,0x95,0x5e,0xef,0xf6,0xdd,0x1b,0xe4,0xa6,0xcd,0x9e,0x20,
+    0x28,0x14,0x0e,0xae,0xac,0x2a,0x12,0xa3,0x8f,0xd7,0xaf,0x6f,0x1b,0x5d,0x23,0xca,
+    0xa8,0xc9,0x2d,0x24,0x80,0x9b,0x9c,0x26,0x9f,0x81,0x65,0x30,0x6f,0xa8,0xcd,0x41,
+    0xc4,0x9f,0x4c,0x7e,0x46,0xe1,0x15,0x61,0x9c,0xc4,0x36,0x7a,0x07,0x31,0x9e,0x19,
+    0xcd,0x22,0x83,0x06,0x0a,0xc7,0xd3,0x29,0xf4,0x30,0x5b,0x9a,0x61,0xd9,0xa7,0xbd,
+    0x26,0x88,0x89,0x72,0x4f,0x35,0x50,0x43,0x4f,0x41,0x42,0x38,0x37,0xc2,0xd8,0xa3,
+    0xf6,0xc6,0xa9,0xb6,0xec,0x6f,0x9a,0x43,0xcf,0xa3,0x7d,0x98,0xce,0x1a,0x07,0x36,
+    0x16,0x05,0xf4,0xee,0xf0,0xd6,0x57,0x70,0xf3,0xee,0xed,0xdb,0xbb,0x9b,0x87,0xbb,
+    0x5b,0x17,0xc9,0xc6,0x6a,0x2e,0x04,0xd3,0xdc,0xbf,0x07,0x8a,0x97,0x60,0xaa,0x46,
+    0x69,0x4c,0x80,0xa9,0x9c,0xa6,0x8d,0x45,0x22,0x0a,0x1c,0x74,0x34,0xe0,0x62,0xe1,
+    0xf5,0x1a,0x5b,0x54,0xa2,0xd7,0x8c,0xb1,0x96,0xe3,0x03,0x9a,0x7a,0x6e,0xf3,0x11,
+    0x28,0x57,0x14,0xfe,0x86,0xd7,0xed,0xcf,0xf7,0xff,0x82,0x1a,0x17,0x4a,0x3f,0xc5,
+    0xe9,0x96,0xa9,0xe4,0x6b,0x5a,0xb6,0x75,0x3b,0x8f,0xcd,0xc0,0xaa,0xe9,0xb4,0x72,
+    0x3f,0xa0,0xe7,0x55,0xd3,0x86,0xb6,0x5f,0xe6,0xbb,0x42,0x9b,0x9b,0x58,0x85,0xc0,
+    0x0b,0x2d,0x12,0x5e,0xa5,0x8d,0x0e,0x84,0x53,0xa9,0xbd,0xde,0x7b,0x4e,0x09,0x3a,
+    0xc2,0x62,0x82,0x9d,0x85,0xe1,0xba,0x15,0x95,0x84,0x57,0x0f,0x6f,0x5e,0x3b,0x06,
+    0x26,0xbe,0x89,0x8e,0x5f,0xae,0xaa,0xe0,0x40,0xa9,0xb6,0xc2,0xcc,0x9d,0x02,0x69,
+    0x33,0x75,0x68,0x57,0x43,0x2e,0x0e,0x53,0xad,0xf8,0x5e,0xdf,0x58,0xbb,0x64,0x3e,
+    0xe6,0xb4,0x30,0xf1,0x01,0x71,0xd8,0x48,0xd6,0x41,0xdd,0xf4,0xad,0x7c,0x0e,0xea,
+    0x0a,0x71,0xcd,0x30,0x64,0x22,0x29,0xd1,0xd4,0xc2,0xe6,0xc6,0xc6,0x55,0xb2,0x03,
+    0x5b,0x17,0x92,0x52,0x28,0x39,0x49,0xa8,0x8a,0x9a,0x7d,0x77,0xfc,0x13,0x17,0x31,
+    0xca,0x07,0x10,0xd9,0x88,0x5e,0x10,0x04,0x7d,0x77,0xf6,0x5e,0x8a,0x12,0xf5,0xda,
+    0xe2,0x99,0xa3,0xff,0x15,0xe6,0x0d,0xd5,0xb9,0x48,0xad,0xbd,0xc3,0x98,0xd2,0xf7,
+    0x7a,0x06,0x89,0xbd,0xb8,0x87,0x75,0x26,0xbf,0x1d,0xff,0x0e,0x6f,0x85,0xc6,0x5f,
+    0x8c,0x77,0x96,0xa9,0xaa,0x73,0x30,0xd2,0x66,0xd8,0x79,0x38,0x5e,0x50,0x0a,0x07,
+    0x26,0xa0,0x18,0xbe,0x97,0x10,0xe9,0x1a,0x94,0x70,0x04,0xe3,0x9b,0x0b,0xdd,0xe0,
+    0x08,0x08,0x8e,0x8e,0x5c,0x21,0x69,0xc8,0x84,0x00,0xec,0xcc,0x57,0x94,0x73,0xd1,
+    0xbb,0xde,0x3b,0x88,0xd1,0x7a,0x0a,0xc3,0xb3,0xd1,0xf9,0xc5,0xe5,0x75,0x2b,0xb8,
+    0xb9,0x30,0x7c,0x5d,0x00,0xa2,0x60,0x51,0x8b,0xb0,0x27,0xdc,0x72,0xfb,0xa2,0xd6,
+    0xfc,0xa5,0x9b,0x25,0xe8,0xfd,0xd4,0x78,0xea,0x07,0x28,0x75,0xe1,0x79,0x92,0xaa,
+    0x12,0xbd,0x1f,0x34,0xb0,0x19,0x34,0x02,0x5f,0x28,0xf0,0x75,0x2d,0x37,0xae,0xd7,
+    0x4c,0xe7,0x30,0x77,0xc8,0xf9,0x7e,0x2d,0x77,0x9e,0xa0,0x51,0x3a,0xbd,0xc5,0x6e,
+    0x30,0x05,0x07,0xf7,0xe9,0x36,0xff,0x7f,0x7a,0x95,0x32,0x4f,0x53,0x65,0xcb,0xfa,
+    0xc6,0xe7,0x07,0xd7,0xdd,0x9f,0x1f,0xf0,0xab,0x4b,0xe0,0x2b,0x96,0x66,0x36,0xff,
+    0x47,0x3c,0x3f,0x58,0x7e,0x64,0x4d,0x58,0x5b,0xf9,0xf5,0xe5,0x3b,0x33,0xac,0x00,
+    0x7b,0x0a,0xff,0xa0,0xdd,0xf5,0x37,0x4c,0xbf,0x43,0xfe,0xef,0x75,0xf1,0x1d,0x0a,
+    0xed,0x06,0x10,0x7e,0x9e,0x85,0xe6,0xf7,0xb2,0xfd,0xed,0xc4,0xdf,0x73,0xfb,0x3f,
+    0xc2,0x5f,0x46,0x9e,0xda,0x81,0x3b,0x0c,0x00,0x00,
+};
 
-static const char* index_files[] = {
-    "//", "/index.html",
-    "/sub/", "/sub/index.html",
-    NULL
+// /sub/index.html
+static const unsigned char webinix_asset_1[] = {
+    0x3c,0x21,0x64,0x6f,0x63,0x74,0x79,0x70,0x65,0x20,0x68,0x74,0x6d,0x6c,0x3e,0x0a,
+    0x3c,0x68,0x74,0x6d,0x6c,0x3e,0x0a,0x09,0x3c,0x68,0x65,0x61,0x64,0x3e,0x0a,0x09,
+    0x09,0x3c,0x6d,0x65,0x74,0x61,0x20,0x63,0x68,0x61,0x72,0x73,0x65,0x74,0x3d,0x22,
+    0x55,0x54,0x46,0x2d,0x38,0x22,0x20,0x2f,0x3e,0x0a,0x09,0x09,0x3c,0x74,0x69,0x74,
+    0x6c,0x65,0x3e,0x57,0x65,0x62,0x69,0x6e,0x69,0x78,0x20,0x2d,0x20,0x56,0x69,0x72,
+    0x74,0x75,0x61,0x6c,0x20,0x46,0x69,0x6c,0x65,0x20,0x53,0x79,0x73,0x74,0x65,0x6d,
+    0x3c,0x2f,0x74,0x69,0x74,0x6c,0x65,0x3e,0x0a,0x09,0x09,0x3c,0x73,0x74,0x79,0x6c,
+    0x65,0x3e,0x0a,0x09,0x09,0x09,0x62,0x6f,0x64,0x79,0x20,0x7b,0x0a,0x09,0x09,0x09,
+    0x09,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x27,0x41,
+    0x72,0x69,0x61,0x6c,0x27,0x2c,0x20,0x73,0x61,0x6e,0x73,0x2d,0x73,0x65,0x72,0x69,
+    0x66,0x3b,0x0a,0x09,0x09,0x09,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x77,0x68,
+    0x69,0x74,0x65,0x3b,0x0a,0x09,0x09,0x09,0x09,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,
+    0x75,0x6e,0x64,0x3a,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x2d,0x67,0x72,0x61,0x64,
+    0x69,0x65,0x6e,0x74,0x28,0x74,0x6f,0x20,0x72,0x69,0x67,0x68,0x74,0x2c,0x20,0x23,
+    0x35,0x30,0x37,0x64,0x39,0x31,0x2c,0x20,0x23,0x31,0x63,0x35,0x39,0x36,0x66,0x2c,
+    0x20,0x23,0x30,0x32,0x32,0x37,0x33,0x37,0x29,0x3b,0x0a,0x09,0x09,0x09,0x09,0x74,
+    0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x20,0x63,0x65,0x6e,0x74,0x65,
+    0x72,0x3b,0x0a,0x09,0x09,0x09,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,
+    0x3a,0x20,0x31,0x38,0x70,0x78,0x3b,0x0a,0x09,0x09,0x09,0x7d,0x0a,0x09,0x09,0x09,
+    0x62,0x75,0x74,0x74,0x6f,0x6e,0x2c,0x0a,0x09,0x09,0x09,0x69,0x6e,0x70,0x75,0x74,
+    0x20,0x7b,0x0a,0x09,0x09,0x09,0x09,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,
+    0x31,0x30,0x70,0x78,0x3b,0x0a,0x09,0x09,0x09,0x09,0x62,0x6f,0x72,0x64,0x65,0x72,
+    0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x20,0x33,0x70,0x78,0x3b,0x0a,0x09,0x09,
+    0x09,0x09,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x20,0x31,0x70,0x78,0x20,0x73,0x6f,
+    0x6c,0x69,0x64,0x20,0x23,0x63,0x63,0x63,0x3b,0x0a,0x09,0x09,0x09,0x09,0x62,0x6f,
+    0x78,0x2d,0x73,0x68,0x61,0x64,0x6f,0x77,0x3a,0x20,0x30,0x20,0x33,0x70,0x78,0x20,
+    0x35,0x70,0x78,0x20,0x72,0x67,0x62,0x61,0x28,0x30,0x2c,0x20,0x30,0x2c,0x20,0x30,
+    0x2c,0x20,0x30,0x2e,0x31,0x29,0x3b,0x0a,0x09,0x09,0x09,0x09,0x74,0x72,0x61,0x6e,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x20,0x30,0x2e,0x32,0x73,0x3b,0x0a,0x09,0x09,
+    0x09,0x7d,0x0a,0x09,0x09,0x09,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x7b,0x0a,0x09,
+    0x09,0x09,0x09,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x23,
+    0x33,0x34,0x39,0x38,0x64,0x62,0x3b,0x0a,0x09,0x09,0x09,0x09,0x63,0x6f,0x6c,0x6f,
+    0x72,0x3a,0x20,0x23,0x66,0x66,0x66,0x3b,0x0a,0x09,0x09,0x09,0x09,0x63,0x75,0x72,
+    0x73,0x6f,0x72,0x3a,0x20,0x70,0x6f,0x69,0x6e,0x74,0x65,0x72,0x3b,0x0a,0x09,0x09,
+    0x09,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x36,0x70,
+    0x78,0x3b,0x0a,0x09,0x09,0x09,0x7d,0x0a,0x09,0x09,0x09,0x68,0x31,0x20,0x7b,0x0a,
+    0x09,0x09,0x09,0x09,0x74,0x65,0x78,0x74,0x2d,0x73,0x68,0x61,0x64,0x6f,0x77,0x3a,
+    0x20,0x2d,0x37,0x70,0x78,0x20,0x31,0x30,0x70,0x78,0x20,0x37,0x70,0x78,0x20,0x72,
+    0x67,0x62,0x28,0x36,0x37,0x20,0x35,0x37,0x20,0x35,0x37,0x20,0x2f,0x20,0x37,0x36,
+    0x25,0x29,0x3b,0x0a,0x09,0x09,0x09,0x7d,0x0a,0x09,0x09,0x09,0x62,0x75,0x74,0x74,
+    0x6f,0x6e,0x3a,0x68,0x6f,0x76,0x65,0x72,0x20,0x7b,0x0a,0x09,0x09,0x09,0x09,0x62,
+    0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x23,0x63,0x39,0x39,0x31,
+    0x33,0x64,0x3b,0x0a,0x09,0x09,0x09,0x7d,0x0a,0x09,0x09,0x09,0x69,0x6e,0x70,0x75,
+    0x74,0x3a,0x66,0x6f,0x63,0x75,0x73,0x20,0x7b,0x0a,0x09,0x09,0x09,0x09,0x6f,0x75,
+    0x74,0x6c,0x69,0x6e,0x65,0x3a,0x20,0x6e,0x6f,0x6e,0x65,0x3b,0x0a,0x09,0x09,0x09,
+    0x09,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,
+    0x33,0x34,0x39,0x38,0x64,0x62,0x3b,0x0a,0x09,0x09,0x09,0x7d,0x0a,0x0a,0x09,0x09,
+    0x09,0x61,0x3a,0x6c,0x69,0x6e,0x6b,0x20,0x7b,0x0a,0x09,0x09,0x09,0x09,0x63,0x6f,
+    0x6c,0x6f,0x72,0x3a,0x20,0x23,0x66,0x64,0x35,0x37,0x32,0x33,0x3b,0x0a,0x09,0x09,
+    0x09,0x7d,0x0a,0x09,0x09,0x09,0x61,0x3a,0x61,0x63,0x74,0x69,0x76,0x65,0x20,0x7b,
+    0x0a,0x09,0x09,0x09,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x66,0x64,0x35,
+    0x37,0x32,0x33,0x3b,0x0a,0x09,0x09,0x09,0x7d,0x0a,0x09,0x09,0x09,0x61,0x3a,0x76,
+    0x69,0x73,0x69,0x74,0x65,0x64,0x20,0x7b,0x0a,0x09,0x09,0x09,0x09,0x63,0x6f,0x6c,
+    0x6f,0x72,0x3a,0x20,0x23,0x66,0x64,0x35,0x37,0x32,0x33,0x3b,0x0a,0x09,0x09,0x09,
+    0x7d,0x0a,0x09,0x09,0x09,0x61,0x3a,0x68,0x6f,0x76,0x65,0x72,0x20,0x7b,0x0a,0x09,
+    0x09,0x09,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x66,0x30,0x62,0x63,0x61,
+    0x63,0x3b,0x0a,0x09,0x09,0x09,0x7d,0x0a,0x09,0x09,0x3c,0x2f,0x73,0x74,0x79,0x6c,
+    0x65,0x3e,0x0a,0x09,0x3c,0x2f,0x68,0x65,0x61,0x64,0x3e,0x0a,0x09,0x3c,0x62,0x6f,
+    0x64,0x79,0x3e,0x0a,0x09,0x09,0x3c,0x70,0x3e,0x0a,0x09,0x09,0x09,0x54,0x68,0x69,
+    0x73,0x20,0x69,0x73,0x20,0x61,0x6e,0x6f,0x74,0x68,0x65,0x72,0x20,0x66,0x69,0x6c,
+    0x65,0x20,0x65,0x6d,0x62,0x65,0x64,0x64,0x65,0x64,0x20,0x69,0x6e,0x20,0x74,0x68,
+    0x69,0x73,0x20,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2e,0x3c,
+    0x62,0x72,0x20,0x2f,0x3e,0x0a,0x09,0x09,0x3c,0x2f,0x70,0x3e,0x0a,0x09,0x09,0x3c,
+    0x62,0x72,0x20,0x2f,0x3e,0x0a,0x09,0x09,0x3c,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,
+    0x69,0x64,0x3d,0x22,0x45,0x78,0x69,0x74,0x22,0x3e,0x45,0x78,0x69,0x74,0x3c,0x2f,
+    0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0x0a,0x09,0x3c,0x2f,0x62,0x6f,0x64,0x79,0x3e,
+    0x0a,0x0a,0x09,0x3c,0x21,0x2d,0x2d,0x20,0x43,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x20,
+    0x74,0x68,0x69,0x73,0x20,0x77,0x69,0x6e,0x64,0x6f,0x77,0x20,0x74,0x6f,0x20,0x74,
+    0x68,0x65,0x20,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x20,0x61,0x70,
+    0x70,0x20,0x2d,0x2d,0x3e,0x0a,0x09,0x3c,0x73,0x63,0x72,0x69,0x70,0x74,0x20,0x73,
+    0x72,0x63,0x3d,0x22,0x2f,0x77,0x65,0x62,0x69,0x6e,0x69,0x78,0x2e,0x6a,0x73,0x22,
+    0x3e,0x3c,0x2f,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0x0a,0x0a,0x3c,0x2f,0x68,0x74,
+    0x6d,0x6c,0x3e,0x0a,
+};
+static const unsigned char webinix_asset_1_gz[] = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x85,0x54,0x61,0x6f,0xda,0x30,
+    0x10,0xfd,0x4c,0x7f,0xc5,0x15,0x34,0xb5,0x95,0x30,0x09,0x30,0x48,0x49,0x53,0xa4,
+    0x69,0x5a,0xff,0xc0,0xba,0xed,0xb3,0x63,0x3b,0xe4,0xd6,0x60,0x47,0xf6,0xa5,0xc0,
+    0xa6,0xfe,0xf7,0xd9,0x49,0x28,0xb4,0x9a,0x54,0xc9,0xb1,0x2f,0xe7,0x77,0xbe,0x77,
+    0xcf,0xb9,0x64,0x97,0xd2,0x08,0x3a,0xd4,0x0a,0x4a,0xda,0x56,0xeb,0x8b,0xac,0x5b,
+    0x06,0x59,0xa9,0xb8,0xf4,0xeb,0x20,0xdb,0x2a,0xe2,0x20,0x4a,0x6e,0x9d,0xa2,0xfb,
+    0xe1,0x8f,0xc7,0x07,0x76,0x3b,0x84,0xa8,0xdd,0x22,0xa4,0x4a,0xad,0x7f,0xa9,0x1c,
+    0x35,0xee,0x81,0xc1,0x4f,0xb4,0xd4,0xf0,0x0a,0x1e,0xb0,0x52,0xf0,0xfd,0xe0,0x48,
+    0x6d,0xb3,0xa8,0x03,0x05,0xb8,0xa3,0x43,0x67,0x0d,0x72,0x23,0x0f,0xf0,0x37,0x58,
+    0x83,0xc2,0x68,0x62,0x05,0xdf,0x62,0x75,0x48,0xe1,0xea,0x8b,0x45,0x5e,0x5d,0x8d,
+    0xc1,0x71,0xed,0x98,0x53,0x16,0x8b,0xbb,0x16,0x25,0x4c,0x65,0x6c,0x0a,0xbb,0x12,
+    0x49,0x75,0x9e,0x9c,0x8b,0xa7,0x8d,0x35,0x8d,0x96,0x29,0x54,0xa8,0x15,0xb7,0x6c,
+    0x63,0xb9,0x44,0xa5,0xe9,0x9a,0x0c,0x58,0xdc,0x94,0x34,0x86,0xd1,0x22,0x4e,0xe4,
+    0x6a,0xea,0x8d,0xa9,0x58,0xac,0x96,0x85,0x37,0xe2,0xd9,0x2c,0x99,0x27,0x37,0xdd,
+    0x29,0xa4,0xf6,0xc4,0x78,0x85,0x1b,0x9d,0x82,0xf0,0xa1,0xca,0xde,0x9d,0x58,0x39,
+    0xfc,0xa3,0x52,0x98,0xde,0xd6,0xfb,0xd6,0xf9,0xd2,0x32,0x6f,0x88,0x8c,0x1e,0x07,
+    0x13,0x75,0xdd,0x50,0x5f,0x45,0xcd,0xa5,0x44,0xbd,0xf1,0xe8,0xb8,0x47,0xfb,0x1a,
+    0xad,0x54,0x96,0x05,0x4e,0x8d,0x4b,0x61,0xfe,0xd6,0xef,0x91,0xf5,0x1e,0x9c,0xa9,
+    0x50,0xc2,0x48,0x08,0x71,0xdc,0xdb,0x33,0x57,0x72,0x69,0x76,0x29,0xc4,0x21,0x04,
+    0x16,0xfe,0xb1,0x9b,0x9c,0x5f,0xc7,0x63,0xe8,0xc7,0x64,0x7a,0x24,0x6f,0xbd,0x4a,
+    0x48,0x68,0x3c,0xf9,0x78,0x32,0x73,0xef,0x59,0xf6,0xdc,0xce,0x95,0x1a,0xcd,0x3f,
+    0xaf,0x6e,0x65,0xfe,0x46,0xd4,0x51,0x51,0x1c,0x55,0x6e,0xac,0x0b,0x9e,0xda,0xe0,
+    0xff,0xa5,0x58,0x9e,0x4b,0x51,0x4e,0xfb,0x04,0xad,0x88,0x47,0xda,0x2c,0xf1,0x8c,
+    0x83,0x0a,0x90,0x74,0xd4,0xaf,0x97,0x09,0x2c,0xda,0x11,0x41,0xb2,0xfc,0x74,0xf3,
+    0x9e,0x65,0x5a,0x9a,0x67,0x65,0xff,0xc7,0x55,0xac,0x56,0xd3,0xb9,0x3c,0xe1,0x5b,
+    0xc1,0xd3,0xc2,0x88,0xc6,0xf5,0x70,0xd3,0x50,0xb8,0xfb,0x14,0xb4,0xd1,0xea,0x8d,
+    0xec,0xc7,0xda,0xce,0xea,0x7d,0xb9,0x08,0x33,0x4f,0x7d,0xc4,0x53,0x1f,0xff,0xaa,
+    0x80,0x5c,0x24,0xb3,0xf9,0x29,0x13,0x4f,0xb9,0x20,0x7c,0x56,0x1f,0xc2,0x9e,0xd1,
+    0x5f,0x80,0x92,0x1f,0xe2,0xce,0x6b,0x7c,0x45,0xc5,0xb9,0xe0,0xe2,0x15,0x95,0x45,
+    0xc7,0xfe,0xc8,0xa2,0xbe,0xf9,0xb2,0xd0,0x27,0x6d,0xeb,0xd4,0x6d,0xdb,0x3c,0x96,
+    0xe8,0xc0,0x0f,0xae,0x0d,0x95,0xfe,0xbc,0x22,0xf4,0x99,0xda,0xe6,0x4a,0x4a,0xcf,
+    0x01,0x35,0x50,0x00,0xf0,0xba,0xae,0x50,0xf0,0xf0,0x5d,0x4c,0xb2,0xdc,0xf6,0xbd,
+    0x1a,0xb5,0x47,0x9c,0xde,0xfb,0x4f,0x04,0xe5,0xfd,0xf0,0xdb,0x1e,0x69,0xb8,0x0e,
+    0x73,0x16,0x75,0xee,0x96,0x44,0x97,0xdc,0x5b,0x97,0x8c,0xc1,0x57,0xa3,0xb5,0x12,
+    0xd4,0x65,0xd8,0xa1,0xf6,0x77,0x0d,0xbe,0xcd,0x3c,0x0d,0x38,0xdd,0x59,0x48,0x0d,
+    0x8c,0x85,0x68,0x27,0x2c,0xd6,0x04,0xce,0x8a,0xfb,0x61,0xb4,0xeb,0xfe,0x10,0x93,
+    0xdf,0x6e,0xb8,0xf6,0x65,0xb6,0x5b,0xfe,0x64,0x5f,0x67,0xfb,0xb3,0xf9,0x07,0xcf,
+    0xd2,0x51,0x03,0x84,0x04,0x00,0x00,
 };
 
-bool virtual_file_system(const char* path, const unsigned char** file, int* length) {
-    for (int i = 0; i < virtual_files_count; ++i) {
-        if (strcmp(virtual_files[i].path, path) == 0) {
-            *file = virtual_files[i].data;
-            *length = virtual_files[i].length;
-            return true;
-        }
-    }
-    return false;
-}
+// /svg/webinix.svg
+static const unsigned char webinix_asset_2[] = {
+    0x3c,0x73,0x76,0x67,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x31,0x32,0x30,0x70,
+    0x78,0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x31,0x32,0x30,0x70,0x78,
+    0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,
+    0x77,0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,0x32,0x30,0x30,0x30,0x2f,
+    0x73,0x76,0x67,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3a,0x62,0x78,0x3d,0x22,0x68,
+    0x74,0x74,0x70,0x73,0x3a,0x2f,0x2f,0x62,0x6f,0x78,0x79,0x2d,0x73,0x76,0x67,0x2e,
+    0x63,0x6f,0x6d,0x22,0x3e,0x20,0x3c,0x64,0x65,0x66,0x73,0x3e,0x20,0x3c,0x6d,0x61,
+    0x73,0x6b,0x20,0x69,0x64,0x3d,0x22,0x63,0x69,0x72,0x63,0x6c,0x65,0x2d,0x6d,0x61,
+    0x73,0x6b,0x22,0x3e,0x20,0x3c,0x72,0x65,0x63,0x74,0x20,0x77,0x69,0x64,0x74,0x68,
+    0x3d,0x22,0x31,0x32,0x30,0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x31,
+    0x32,0x30,0x22,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x77,0x68,0x69,0x74,0x65,0x22,
+    0x2f,0x3e,0x20,0x3c,0x63,0x69,0x72,0x63,0x6c,0x65,0x20,0x63,0x78,0x3d,0x22,0x31,
+    0x32,0x30,0x22,0x20,0x63,0x79,0x3d,0x22,0x36,0x30,0x22,0x20,0x72,0x3d,0x22,0x31,
+    0x36,0x2e,0x38,0x22,0x2f,0x3e,0x20,0x3c,0x2f,0x6d,0x61,0x73,0x6b,0x3e,0x20,0x3c,
+    0x62,0x78,0x3a,0x67,0x72,0x69,0x64,0x20,0x78,0x3d,0x22,0x30,0x22,0x20,0x79,0x3d,
+    0x22,0x30,0x22,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x38,0x33,0x2e,0x33,0x36,
+    0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x39,0x36,0x2e,0x37,0x35,0x33,
+    0x22,0x2f,0x3e,0x20,0x3c,0x2f,0x64,0x65,0x66,0x73,0x3e,0x20,0x3c,0x72,0x65,0x63,
+    0x74,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x31,0x32,0x30,0x22,0x20,0x68,0x65,
+    0x69,0x67,0x68,0x74,0x3d,0x22,0x31,0x32,0x30,0x22,0x20,0x66,0x69,0x6c,0x6c,0x3d,
+    0x22,0x23,0x32,0x61,0x36,0x36,0x39,0x39,0x22,0x20,0x6d,0x61,0x73,0x6b,0x3d,0x22,
+    0x75,0x72,0x6c,0x28,0x23,0x63,0x69,0x72,0x63,0x6c,0x65,0x2d,0x6d,0x61,0x73,0x6b,
+    0x29,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x22,0x2f,0x3e,0x20,0x3c,0x70,
+    0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x20,0x33,0x39,0x31,0x2e,0x30,0x37,0x20,
+    0x33,0x37,0x35,0x20,0x4c,0x20,0x33,0x38,0x36,0x2e,0x38,0x34,0x32,0x20,0x33,0x35,
+    0x35,0x2e,0x34,0x20,0x4c,0x20,0x33,0x38,0x39,0x2e,0x30,0x32,0x36,0x20,0x33,0x35,
+    0x35,0x2e,0x34,0x20,0x4c,0x20,0x33,0x39,0x32,0x2e,0x33,0x35,0x38,0x20,0x33,0x37,
+    0x31,0x2e,0x35,0x38,0x34,0x20,0x4c,0x20,0x33,0x39,0x37,0x2e,0x32,0x30,0x32,0x20,
+    0x33,0x35,0x35,0x2e,0x34,0x20,0x4c,0x20,0x33,0x39,0x39,0x2e,0x33,0x30,0x32,0x20,
+    0x33,0x35,0x35,0x2e,0x34,0x20,0x4c,0x20,0x34,0x30,0x34,0x2e,0x31,0x34,0x36,0x20,
+    0x33,0x37,0x31,0x2e,0x35,0x32,0x38,0x20,0x4c,0x20,0x34,0x30,0x37,0x2e,0x35,0x30,
+    0x36,0x20,0x33,0x35,0x35,0x2e,0x34,0x20,0x4c,0x20,0x34,0x30,0x39,0x2e,0x36,0x30,
+    0x36,0x20,0x33,0x35,0x35,0x2e,0x34,0x20,0x4c,0x20,0x34,0x30,0x35,0x2e,0x33,0x37,
+    0x38,0x20,0x33,0x37,0x35,0x20,0x4c,0x20,0x34,0x30,0x33,0x2e,0x31,0x39,0x34,0x20,
+    0x33,0x37,0x35,0x20,0x4c,0x20,0x33,0x39,0x38,0x2e,0x32,0x33,0x38,0x20,0x33,0x35,
+    0x38,0x2e,0x33,0x39,0x36,0x20,0x4c,0x20,0x33,0x39,0x33,0x2e,0x32,0x35,0x34,0x20,
+    0x33,0x37,0x35,0x20,0x5a,0x20,0x4d,0x20,0x34,0x31,0x32,0x2e,0x37,0x31,0x20,0x33,
+    0x37,0x35,0x20,0x4c,0x20,0x34,0x31,0x32,0x2e,0x37,0x31,0x20,0x33,0x35,0x35,0x2e,
+    0x34,0x20,0x4c,0x20,0x34,0x32,0x36,0x2e,0x37,0x33,0x38,0x20,0x33,0x35,0x35,0x2e,
+    0x34,0x20,0x4c,0x20,0x34,0x32,0x36,0x2e,0x37,0x33,0x38,0x20,0x33,0x35,0x37,0x2e,
+    0x33,0x30,0x34,0x20,0x4c,0x20,0x34,0x31,0x34,0x2e,0x38,0x36,0x36,0x20,0x33,0x35,
+    0x37,0x2e,0x33,0x30,0x34,0x20,0x4c,0x20,0x34,0x31,0x34,0x2e,0x38,0x36,0x36,0x20,
+    0x33,0x36,0x34,0x2e,0x31,0x36,0x34,0x20,0x4c,0x20,0x34,0x32,0x32,0x2e,0x36,0x32,
+    0x32,0x20,0x33,0x36,0x34,0x2e,0x31,0x36,0x34,0x20,0x4c,0x20,0x34,0x32,0x32,0x2e,
+    0x36,0x32,0x32,0x20,0x33,0x36,0x36,0x2e,0x30,0x34,0x20,0x4c,0x20,0x34,0x31,0x34,
+    0x2e,0x38,0x36,0x36,0x20,0x33,0x36,0x36,0x2e,0x30,0x34,0x20,0x4c,0x20,0x34,0x31,
+    0x34,0x2e,0x38,0x36,0x36,0x20,0x33,0x37,0x33,0x2e,0x30,0x39,0x36,0x20,0x4c,0x20,
+    0x34,0x32,0x36,0x2e,0x38,0x35,0x20,0x33,0x37,0x33,0x2e,0x30,0x39,0x36,0x20,0x4c,
+    0x20,0x34,0x32,0x36,0x2e,0x38,0x35,0x20,0x33,0x37,0x35,0x20,0x5a,0x20,0x4d,0x20,
+    0x34,0x32,0x39,0x2e,0x39,0x35,0x39,0x20,0x33,0x37,0x35,0x20,0x4c,0x20,0x34,0x32,
+    0x39,0x2e,0x39,0x35,0x39,0x20,0x33,0x35,0x35,0x2e,0x34,0x20,0x4c,0x20,0x34,0x33,
+    0x37,0x2e,0x39,0x31,0x31,0x20,0x33,0x35,0x35,0x2e,0x34,0x20,0x51,0x20,0x34,0x33,
+    0x39,0x2e,0x38,0x31,0x35,0x20,0x33,0x35,0x35,0x2e,0x34,0x20,0x34,0x34,0x31,0x2e,
+    0x32,0x30,0x31,0x20,0x33,0x35,0x36,0x2e,0x30,0x31,0x36,0x20,0x51,0x20,0x34,0x34,
+    0x32,0x2e,0x35,0x38,0x37,0x20,0x33,0x35,0x36,0x2e,0x36,0x33,0x32,0x20,0x34,0x34,
+    0x33,0x2e,0x33,0x34,0x33,0x20,0x33,0x35,0x37,0x2e,0x37,0x36,0x36,0x20,0x51,0x20,
+    0x34,0x34,0x34,0x2e,0x30,0x39,0x39,0x20,0x33,0x35,0x38,0x2e,0x39,0x20,0x34,0x34,
+    0x34,0x2e,0x30,0x39,0x39,0x20,0x33,0x36,0x30,0x2e,0x34,0x34,0x20,0x51,0x20,0x34,
+    0x34,0x34,0x2e,0x30,0x39,0x39,0x20,0x33,0x36,0x31,0x2e,0x39,0x35,0x32,0x20,0x34,
+    0x34,0x33,0x2e,0x33,0x30,0x31,0x20,0x33,0x36,0x33,0x2e,0x30,0x37,0x32,0x20,0x51,
+    0x20,0x34,0x34,0x32,0x2e,0x35,0x30,0x33,0x20,0x33,0x36,0x34,0x2e,0x31,0x39,0x32,
+    0x20,0x34,0x34,0x31,0x2e,0x31,0x30,0x33,0x20,0x33,0x36,0x34,0x2e,0x37,0x38,0x20,
+    0x51,0x20,0x34,0x34,0x32,0x2e,0x38,0x36,0x37,0x20,0x33,0x36,0x35,0x2e,0x33,0x31,
+    0x32,0x20,0x34,0x34,0x33,0x2e,0x38,0x38,0x39,0x20,0x33,0x36,0x36,0x2e,0x35,0x34,
+    0x34,0x20,0x51,0x20,0x34,0x34,0x34,0x2e,0x39,0x31,0x31,0x20,0x33,0x36,0x37,0x2e,
+    0x37,0x37,0x36,0x20,0x34,0x34,0x34,0x2e,0x39,0x31,0x31,0x20,0x33,0x36,0x39,0x2e,
+    0x34,0x38,0x34,0x20,0x51,0x20,0x34,0x34,0x34,0x2e,0x39,0x31,0x31,0x20,0x33,0x37,
+    0x31,0x2e,0x31,0x36,0x34,0x20,0x34,0x34,0x34,0x2e,0x30,0x38,0x35,0x20,0x33,0x37,
+    0x32,0x2e,0x34,0x31,0x20,0x51,0x20,0x34,0x34,0x33,0x2e,0x32,0x35,0x39,0x20,0x33,
+    0x37,0x33,0x2e,0x36,0x35,0x36,0x20,0x34,0x34,0x31,0x2e,0x37,0x36,0x31,0x20,0x33,
+    0x37,0x34,0x2e,0x33,0x32,0x38,0x20,0x51,0x20,0x34,0x34,0x30,0x2e,0x32,0x36,0x33,
+    0x20,0x33,0x37,0x35,0x20,0x34,0x33,0x38,0x2e,0x32,0x34,0x37,0x20,0x33,0x37,0x35,
+    0x20,0x5a,0x20,0x4d,0x20,0x34,0x33,0x32,0x2e,0x31,0x31,0x35,0x20,0x33,0x36,0x33,
+    0x2e,0x39,0x34,0x20,0x4c,0x20,0x34,0x33,0x37,0x2e,0x37,0x39,0x39,0x20,0x33,0x36,
+    0x33,0x2e,0x39,0x34,0x20,0x51,0x20,0x34,0x33,0x39,0x2e,0x37,0x30,0x33,0x20,0x33,
+    0x36,0x33,0x2e,0x39,0x34,0x20,0x34,0x34,0x30,0x2e,0x38,0x33,0x37,0x20,0x33,0x36,
+    0x33,0x2e,0x30,0x34,0x34,0x20,0x51,0x20,0x34,0x34,0x31,0x2e,0x39,0x37,0x31,0x20,
+    0x33,0x36,0x32,0x2e,0x31,0x34,0x38,0x20,0x34,0x34,0x31,0x2e,0x39,0x37,0x31,0x20,
+    0x33,0x36,0x30,0x2e,0x36,0x30,0x38,0x20,0x51,0x20,0x34,0x34,0x31,0x2e,0x39,0x37,
+    0x31,0x20,0x33,0x35,0x39,0x2e,0x30,0x36,0x38,0x20,0x34,0x34,0x30,0x2e,0x38,0x33,
+    0x37,0x20,0x33,0x35,0x38,0x2e,0x31,0x37,0x32,0x20,0x51,0x20,0x34,0x33,0x39,0x2e,
+    0x37,0x30,0x33,0x20,0x33,0x35,0x37,0x2e,0x32,0x37,0x36,0x20,0x34,0x33,0x37,0x2e,
+    0x37,0x39,0x39,0x20,0x33,0x35,0x37,0x2e,0x32,0x37,0x36,0x20,0x4c,0x20,0x34,0x33,
+    0x32,0x2e,0x31,0x31,0x35,0x20,0x33,0x35,0x37,0x2e,0x32,0x37,0x36,0x20,0x5a,0x20,
+    0x4d,0x20,0x34,0x33,0x32,0x2e,0x31,0x31,0x35,0x20,0x33,0x37,0x33,0x2e,0x31,0x32,
+    0x34,0x20,0x4c,0x20,0x34,0x33,0x38,0x2e,0x30,0x37,0x39,0x20,0x33,0x37,0x33,0x2e,
+    0x31,0x32,0x34,0x20,0x51,0x20,0x34,0x34,0x30,0x2e,0x32,0x30,0x37,0x20,0x33,0x37,
+    0x33,0x2e,0x31,0x32,0x34,0x20,0x34,0x34,0x31,0x2e,0x34,0x36,0x37,0x20,0x33,0x37,
+    0x32,0x2e,0x31,0x31,0x36,0x20,0x51,0x20,0x34,0x34,0x32,0x2e,0x37,0x32,0x37,0x20,
+    0x33,0x37,0x31,0x2e,0x31,0x30,0x38,0x20,0x34,0x34,0x32,0x2e,0x37,0x32,0x37,0x20,
+    0x33,0x36,0x39,0x2e,0x34,0x32,0x38,0x20,0x51,0x20,0x34,0x34,0x32,0x2e,0x37,0x32,
+    0x37,0x20,0x33,0x36,0x37,0x2e,0x37,0x34,0x38,0x20,0x34,0x34,0x31,0x2e,0x34,0x36,
+    0x37,0x20,0x33,0x36,0x36,0x2e,0x37,0x34,0x20,0x51,0x20,0x34,0x34,0x30,0x2e,0x32,
+    0x30,0x37,0x20,0x33,0x36,0x35,0x2e,0x37,0x33,0x32,0x20,0x34,0x33,0x38,0x2e,0x30,
+    0x37,0x39,0x20,0x33,0x36,0x35,0x2e,0x37,0x33,0x32,0x20,0x4c,0x20,0x34,0x33,0x32,
+    0x2e,0x31,0x31,0x35,0x20,0x33,0x36,0x35,0x2e,0x37,0x33,0x32,0x20,0x5a,0x22,0x20,
+    0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x3d,0x22,0x6d,0x61,0x74,0x72,0x69,
+    0x78,0x28,0x31,0x2e,0x32,0x36,0x34,0x35,0x39,0x32,0x2c,0x20,0x30,0x2c,0x20,0x30,
+    0x2c,0x20,0x31,0x2e,0x32,0x34,0x30,0x33,0x30,0x33,0x2c,0x20,0x2d,0x34,0x38,0x33,
+    0x2e,0x38,0x39,0x39,0x33,0x35,0x33,0x2c,0x20,0x2d,0x33,0x35,0x35,0x2e,0x38,0x34,
+    0x35,0x31,0x35,0x34,0x29,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x69,
+    0x6c,0x6c,0x3a,0x20,0x72,0x67,0x62,0x28,0x32,0x35,0x35,0x2c,0x20,0x32,0x35,0x35,
+    0x2c,0x20,0x32,0x35,0x35,0x29,0x3b,0x22,0x2f,0x3e,0x20,0x3c,0x70,0x61,0x74,0x68,
+    0x20,0x64,0x3d,0x22,0x4d,0x20,0x34,0x35,0x36,0x2e,0x33,0x33,0x38,0x20,0x33,0x37,
+    0x35,0x2e,0x32,0x38,0x20,0x51,0x20,0x34,0x35,0x33,0x2e,0x36,0x37,0x38,0x20,0x33,
+    0x37,0x35,0x2e,0x32,0x38,0x20,0x34,0x35,0x31,0x2e,0x37,0x33,0x32,0x20,0x33,0x37,
+    0x34,0x2e,0x32,0x31,0x36,0x20,0x51,0x20,0x34,0x34,0x39,0x2e,0x37,0x38,0x36,0x20,
+    0x33,0x37,0x33,0x2e,0x31,0x35,0x32,0x20,0x34,0x34,0x38,0x2e,0x37,0x32,0x32,0x20,
+    0x33,0x37,0x31,0x2e,0x31,0x37,0x38,0x20,0x51,0x20,0x34,0x34,0x37,0x2e,0x36,0x35,
+    0x38,0x20,0x33,0x36,0x39,0x2e,0x32,0x30,0x34,0x20,0x34,0x34,0x37,0x2e,0x36,0x35,
+    0x38,0x20,0x33,0x36,0x36,0x2e,0x35,0x34,0x34,0x20,0x4c,0x20,0x34,0x34,0x37,0x2e,
+    0x36,0x35,0x38,0x20,0x33,0x35,0x35,0x2e,0x34,0x20,0x4c,0x20,0x34,0x35,0x31,0x2e,
+    0x37,0x31,0x38,0x20,0x33,0x35,0x35,0x2e,0x34,0x20,0x4c,0x20,0x34,0x35,0x31,0x2e,
+    0x37,0x31,0x38,0x20,0x33,0x36,0x36,0x2e,0x35,0x34,0x34,0x20,0x51,0x20,0x34,0x35,
+    0x31,0x2e,0x37,0x31,0x38,0x20,0x33,0x36,0x38,0x2e,0x30,0x35,0x36,0x20,0x34,0x35,
+    0x32,0x2e,0x32,0x39,0x32,0x20,0x33,0x36,0x39,0x2e,0x31,0x39,0x20,0x51,0x20,0x34,
+    0x35,0x32,0x2e,0x38,0x36,0x36,0x20,0x33,0x37,0x30,0x2e,0x33,0x32,0x34,0x20,0x34,
+    0x35,0x33,0x2e,0x39,0x31,0x36,0x20,0x33,0x37,0x30,0x2e,0x39,0x32,0x36,0x20,0x51,
+    0x20,0x34,0x35,0x34,0x2e,0x39,0x36,0x36,0x20,0x33,0x37,0x31,0x2e,0x35,0x32,0x38,
+    0x20,0x34,0x35,0x36,0x2e,0x33,0x36,0x36,0x20,0x33,0x37,0x31,0x2e,0x35,0x32,0x38,
+    0x20,0x51,0x20,0x34,0x35,0x37,0x2e,0x37,0x36,0x36,0x20,0x33,0x37,0x31,0x2e,0x35,
+    0x32,0x38,0x20,0x34,0x35,0x38,0x2e,0x38,0x30,0x32,0x20,0x33,0x37,0x30,0x2e,0x39,
+    0x32,0x36,0x20,0x51,0x20,0x34,0x35,0x39,0x2e,0x38,0x33,0x38,0x20,0x33,0x37,0x30,
+    0x2e,0x33,0x32,0x34,0x20,0x34,0x36,0x30,0x2e,0x34,0x31,0x32,0x20,0x33,0x36,0x39,
+    0x2e,0x31,0x39,0x20,0x51,0x20,0x34,0x36,0x30,0x2e,0x39,0x38,0x36,0x20,0x33,0x36,
+    0x38,0x2e,0x30,0x35,0x36,0x20,0x34,0x36,0x30,0x2e,0x39,0x38,0x36,0x20,0x33,0x36,
+    0x36,0x2e,0x35,0x34,0x34,0x20,0x4c,0x20,0x34,0x36,0x30,0x2e,0x39,0x38,0x36,0x20,
+    0x33,0x35,0x35,0x2e,0x34,0x20,0x4c,0x20,0x34,0x36,0x35,0x2e,0x30,0x31,0x38,0x20,
+    0x33,0x35,0x35,0x2e,0x34,0x20,0x4c,0x20,0x34,0x36,0x35,0x2e,0x30,0x31,0x38,0x20,
+    0x33,0x36,0x36,0x2e,0x35,0x34,0x34,0x20,0x51,0x20,0x34,0x36,0x35,0x2e,0x30,0x31,
+    0x38,0x20,0x33,0x36,0x39,0x2e,0x31,0x37,0x36,0x20,0x34,0x36,0x33,0x2e,0x39,0x35,
+    0x34,0x20,0x33,0x37,0x31,0x2e,0x31,0x35,0x20,0x51,0x20,0x34,0x36,0x32,0x2e,0x38,
+    0x39,0x20,0x33,0x37,0x33,0x2e,0x31,0x32,0x34,0x20,0x34,0x36,0x30,0x2e,0x39,0x34,
+    0x34,0x20,0x33,0x37,0x34,0x2e,0x32,0x30,0x32,0x20,0x51,0x20,0x34,0x35,0x38,0x2e,
+    0x39,0x39,0x38,0x20,0x33,0x37,0x35,0x2e,0x32,0x38,0x20,0x34,0x35,0x36,0x2e,0x33,
+    0x33,0x38,0x20,0x33,0x37,0x35,0x2e,0x32,0x38,0x20,0x5a,0x20,0x4d,0x20,0x34,0x36,
+    0x38,0x2e,0x32,0x36,0x33,0x20,0x33,0x37,0x35,0x20,0x4c,0x20,0x34,0x36,0x38,0x2e,
+    0x32,0x36,0x33,0x20,0x33,0x35,0x35,0x2e,0x34,0x20,0x4c,0x20,0x34,0x37,0x32,0x2e,
+    0x33,0x32,0x33,0x20,0x33,0x35,0x35,0x2e,0x34,0x20,0x4c,0x20,0x34,0x37,0x32,0x2e,
+    0x33,0x32,0x33,0x20,0x33,0x37,0x35,0x20,0x5a,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,
+    0x66,0x6f,0x72,0x6d,0x3d,0x22,0x6d,0x61,0x74,0x72,0x69,0x78,0x28,0x31,0x2e,0x32,
+    0x36,0x34,0x35,0x39,0x32,0x2c,0x20,0x30,0x2c,0x20,0x30,0x2c,0x20,0x31,0x2e,0x32,
+    0x34,0x30,0x33,0x30,0x33,0x2c,0x20,0x2d,0x34,0x38,0x33,0x2e,0x38,0x39,0x39,0x33,
+    0x35,0x33,0x2c,0x20,0x2d,0x33,0x35,0x35,0x2e,0x38,0x34,0x35,0x31,0x35,0x34,0x29,
+    0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x3a,0x20,0x72,
+    0x67,0x62,0x28,0x32,0x35,0x35,0x2c,0x20,0x32,0x35,0x35,0x2c,0x20,0x32,0x35,0x35,
+    0x29,0x3b,0x22,0x2f,0x3e,0x3c,0x2f,0x73,0x76,0x67,0x3e,
+};
+static const unsigned char webinix_asset_2_gz[] = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xbd,0x56,0xcb,0x6e,0x1b,0x31,
+    0x0c,0xfc,0x15,0x61,0x7b,0x49,0x81,0x84,0x96,0xa8,0x77,0x1a,0xf7,0x0b,0xd2,0x43,
+    0xaf,0xbd,0x39,0x8e,0x63,0x1b,0xb5,0x9b,0x60,0xbd,0xad,0x9d,0xbf,0x2f,0x49,0x49,
+    0xde,0x75,0xe0,0x43,0x4f,0x05,0x02,0x2f,0x86,0xa2,0xc4,0xe1,0xf0,0x81,0x3c,0x1c,
+    0xfe,0xac,0xd5,0x71,0xfb,0x3c,0x6c,0xe6,0x9d,0x41,0xfd,0x76,0xea,0xd4,0x66,0xb5,
+    0x5d,0x6f,0x86,0x33,0x3c,0xed,0x77,0xbf,0x0e,0xf3,0x6e,0x33,0x0c,0x6f,0xf7,0xb3,
+    0xd9,0xf1,0x78,0x84,0xa3,0x85,0xd7,0x7e,0x3d,0x43,0xad,0xf5,0x8c,0xae,0x57,0x97,
+    0xfb,0xa7,0x53,0xf1,0x3a,0x90,0xdb,0xd3,0xeb,0xe9,0xfd,0x8e,0xce,0x60,0xf9,0xba,
+    0xef,0xbe,0xaa,0x87,0xe7,0xd5,0xcb,0x81,0x3e,0xfb,0xc5,0xe1,0xa7,0xda,0x3e,0xcf,
+    0xbb,0xe5,0xb6,0x5f,0xee,0x56,0x77,0x8c,0xf9,0xb8,0x5f,0x2d,0x87,0x09,0x8b,0x0b,
+    0x0e,0x9d,0x7a,0xd9,0xee,0x76,0xf3,0xee,0xb8,0xd9,0x0e,0xab,0x6e,0x46,0xde,0xe5,
+    0xb2,0x5a,0x9e,0xea,0xf9,0xf2,0x7d,0xde,0x05,0xfa,0xf6,0x84,0x03,0x24,0xf1,0x99,
+    0xf1,0xd3,0xf4,0x7d,0x3a,0xdd,0xaf,0xfb,0xed,0xb3,0x22,0x5f,0xf2,0x78,0x97,0xdf,
+    0x1a,0x28,0x59,0xb0,0x61,0x0c,0x95,0x03,0x44,0x6f,0xcb,0xe5,0x4a,0xf7,0x5f,0x68,
+    0x7d,0xc2,0x45,0x08,0x39,0x77,0x8a,0x03,0xce,0xbb,0xdf,0xfd,0xee,0xe6,0xd3,0x24,
+    0xbb,0xcf,0x9d,0x3a,0x0c,0xef,0xbb,0xd5,0xbc,0x93,0x97,0xdf,0x16,0xc3,0x46,0x51,
+    0xfe,0xdf,0x94,0xcd,0x06,0x74,0x54,0x36,0x7a,0xf5,0xa8,0x6c,0x22,0xde,0x0e,0x95,
+    0xf5,0x1e,0x9c,0xe0,0x0c,0x1a,0xc3,0x88,0x33,0x82,0xf5,0x89,0xbc,0x0d,0xf8,0x54,
+    0x2c,0x11,0x50,0x4f,0x6e,0xe4,0x0c,0x76,0x82,0x9d,0x76,0x60,0x5c,0x28,0x37,0x30,
+    0x89,0x25,0x82,0xd7,0x61,0xe2,0x91,0x21,0x5c,0x60,0x0f,0x36,0xa6,0xca,0xc8,0x69,
+    0x0b,0x26,0xbb,0xc6,0x2f,0x27,0x40,0x4b,0x67,0x3e,0x81,0xcd,0x41,0x2c,0x16,0xd0,
+    0x97,0xf3,0x1f,0xea,0x9b,0x72,0x06,0x21,0x9a,0x76,0xb9,0x82,0xf6,0x32,0x92,0xb4,
+    0x72,0xfb,0x23,0x8e,0xc4,0x59,0x2c,0xc6,0x41,0x0a,0xe1,0x9a,0x25,0x50,0x1e,0xa1,
+    0xdc,0x42,0x08,0x88,0x57,0x2d,0x01,0x3e,0x5c,0xfa,0x68,0x88,0x16,0xb4,0xf0,0xe6,
+    0xd8,0xc9,0x5f,0x33,0xd4,0x3c,0x30,0x43,0xf6,0xb9,0x25,0xd2,0x50,0x63,0x6e,0x23,
+    0x64,0xd3,0x32,0xfb,0x4e,0x38,0x43,0x32,0xbe,0x62,0xe7,0x0c,0xd5,0x84,0x4f,0x29,
+    0xbc,0x09,0x7c,0xee,0x90,0xea,0x15,0xc5,0x12,0x2c,0x12,0xa6,0x9e,0x73,0x56,0xf2,
+    0x8c,0xa1,0x78,0x38,0x22,0x92,0x45,0xd9,0x3c,0xa2,0xa0,0xc1,0xb9,0xe9,0x71,0x30,
+    0x44,0xa4,0x3e,0xc0,0x21,0x02,0xf1,0x8f,0xd8,0x42,0x68,0x5b,0x64,0xc9,0x28,0x24,
+    0x4c,0xc5,0x54,0xcd,0xe2,0x90,0x02,0x71,0x08,0x54,0x5f,0x53,0x9e,0x48,0x29,0x8b,
+    0x48,0xfe,0x1c,0x44,0xb2,0x0a,0xc4,0x2a,0x86,0x09,0xce,0xe0,0xd2,0x85,0x07,0x75,
+    0x13,0x6b,0x2f,0xb4,0x44,0x35,0x04,0x67,0xc4,0x81,0xdb,0x21,0x8b,0xae,0xc1,0x07,
+    0x61,0x11,0x03,0x5f,0x70,0x60,0xb1,0xd0,0xd0,0x80,0xc1,0x8a,0xb0,0xce,0x52,0x3b,
+    0xb9,0x38,0x8a,0x6e,0x11,0x0c,0xcb,0x48,0x59,0xe5,0xa6,0x73,0x94,0xb4,0xc5,0x50,
+    0x84,0x8e,0x92,0x95,0x18,0xf8,0xb1,0x64,0x63,0x91,0xa1,0xe6,0x40,0x02,0x71,0xcf,
+    0x05,0x7a,0xca,0xa5,0x09,0xd6,0xd4,0xe5,0x69,0xea,0xe1,0x69,0xb6,0x42,0x1a,0xdf,
+    0x20,0xe5,0x4d,0x91,0xb2,0x05,0xa1,0xea,0x20,0xeb,0xd0,0x58,0x54,0xfc,0x38,0x12,
+    0xad,0x96,0x0b,0xf2,0x94,0xba,0xc1,0xc2,0x3e,0x51,0x71,0xf2,0xd9,0x52,0x93,0x97,
+    0x69,0x2f,0x16,0xe6,0xe2,0xb8,0x26,0x91,0xef,0xb6,0x4e,0x89,0x18,0x8b,0xc2,0x3a,
+    0x8d,0x98,0x6b,0x80,0x69,0xea,0xc1,0x55,0xaa,0x19,0xca,0x1b,0x54,0xc7,0x78,0x11,
+    0x84,0x0a,0x1d,0xb9,0xd9,0x1a,0x8d,0x8a,0x27,0xf4,0xab,0xe5,0x47,0xa7,0x86,0x7e,
+    0xf1,0xeb,0xf0,0xf2,0xda,0xef,0xe7,0xdd,0x7e,0x31,0xf4,0xdb,0xd3,0x0d,0xf5,0x70,
+    0x70,0x3e,0xe3,0xad,0xd2,0xf2,0x47,0x98,0x96,0x81,0xb6,0xb7,0xea,0xce,0xd1,0xca,
+    0x4c,0x39,0x5b,0xcf,0x80,0x7b,0x3e,0x39,0x6f,0xbc,0x1b,0x77,0x1c,0xaf,0xc4,0x7b,
+    0xd5,0xaf,0x9f,0x6e,0xd0,0xfb,0x5b,0xd5,0x7e,0x3e,0x7f,0xf9,0xb0,0xfc,0x1c,0xcd,
+    0x83,0xb5,0xb2,0x6b,0xa0,0x24,0xe7,0xa9,0x6f,0xe2,0xd9,0x40,0xcf,0x0a,0x41,0x6e,
+    0x1f,0xac,0xfa,0x50,0x6d,0x52,0x99,0x64,0x23,0x83,0x90,0x48,0x0d,0x2c,0x7a,0xd5,
+    0x3e,0x8f,0xd4,0x7a,0x49,0x14,0x43,0xed,0x26,0xb8,0xf4,0xf9,0xe3,0x68,0x69,0xd3,
+    0xcc,0x51,0xcc,0x15,0x3c,0x4e,0xc6,0xd9,0x42,0x52,0x72,0x5b,0x7b,0x04,0xcc,0x28,
+    0x31,0x4c,0x16,0x07,0xac,0x0b,0x46,0x53,0x9f,0x3b,0xc9,0x23,0x9b,0x82,0x33,0x0a,
+    0x71,0x4f,0xa3,0x13,0xc6,0x45,0x2c,0xa9,0x4f,0x30,0x7b,0x94,0x65,0x30,0x7a,0x24,
+    0x48,0xbc,0xca,0x27,0x6f,0xd0,0x9a,0x11,0xb9,0x6a,0x14,0x5e,0x0f,0x66,0x4a,0x83,
+    0x0c,0x99,0xd5,0x69,0x3c,0xcf,0xf8,0x9c,0x7b,0xb3,0xb4,0x5c,0xa9,0x05,0xf4,0x34,
+    0xf7,0x86,0xc7,0xdc,0xcf,0x16,0x0a,0xc2,0xd3,0xc0,0xa3,0x27,0x1b,0x9f,0x14,0xf7,
+    0xe2,0x40,0xb9,0x8f,0x5d,0x2e,0x11,0x9c,0x2b,0x35,0xd3,0x32,0x4f,0xbc,0xd3,0xf2,
+    0xa4,0xa8,0x17,0x45,0x97,0xd9,0x21,0xbe,0x6d,0x29,0x3c,0x8e,0xa8,0x71,0xa2,0xe9,
+    0xb0,0x78,0x05,0xf3,0xda,0xf8,0x9f,0xad,0xfb,0xc0,0xff,0xe6,0x7c,0xfd,0x0b,0x77,
+    0xaa,0x9c,0x24,0x2b,0x09,0x00,0x00,
+};
 
-const void* vfs(const char* path, int* length) {
-    const unsigned char* file_data;
-    int file_length;
+static const webinix_asset_t webinix_assets[] = {
+    {"/index.html", "text/html", "\"b6dd721a0731f056\"", webinix_asset_0, 3131, webinix_asset_0_gz, 1290},
+    {"/sub/index.html", "text/html", "\"319a0142100354eb\"", webinix_asset_1, 1156, webinix_asset_1_gz, 599},
+    {"/svg/webinix.svg", "image/svg+xml", "\"23a15bd9742134c0\"", webinix_asset_2, 2347, webinix_asset_2_gz, 919},
+};
 
-    if (virtual_file_system(path, &file_data, &file_length)) {
-        const char* content_type = webinix_get_mime_type(path);
-        const char* http_header_template = "HTTP/1.1 200 OK\r\n"
-                                            "Content-Type: %s\r\n"
-                                            "Content-Length: %d\r\n"
-                                            "Cache-Control: no-cache\r\n\r\n";
-        int header_length = snprintf(NULL, 0, http_header_template, content_type, file_length);
-        *length = header_length + file_length;
-        unsigned char* response = (unsigned char*) webinix_malloc(*length);
-        snprintf((char*) response, header_length + 1, http_header_template, content_type, file_length);
-        memcpy(response + header_length, file_data, file_length);
-        return response;
-    } else {
-        // Check for index file redirection
-        char redirect_path[1024];
-        snprintf(redirect_path, sizeof(redirect_path), "%s", path);
-        size_t len = strlen(redirect_path);
-        if (redirect_path[len - 1] != '/') {
-            redirect_path[len] = '/';
-            redirect_path[len + 1] = '\0';
-        }
-        for (int i = 0; index_files[i] != NULL; i += 2) {
-            if (strcmp(index_files[i], redirect_path) == 0) {
-                const char* location_header = "HTTP/1.1 302 Found\r\n"
-                                            "Location: %s\r\n"
-                                            "Cache-Control: no-cache\r\n\r\n";
-                int header_length = snprintf(NULL, 0, location_header, index_files[i + 1]);
-                *length = header_length;
-                unsigned char* response = (unsigned char*) webinix_malloc(*length);
-                snprintf((char*) response, header_length + 1, location_header, index_files[i + 1]);
-                return response;
-            }
-        }
-        return NULL;
-    }
-}
+static const size_t webinix_assets_count = sizeof(webinix_assets) / sizeof(webinix_assets[0]);
 
-#endif // VIRTUAL_FILE_SYSTEM_H
+#endif // WEBUI_ASSETS_H
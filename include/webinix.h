@@ -13,7 +13,8 @@
 
 #define WEBUI_VERSION "2.5.0-beta.4"
 
-// Max windows, servers and threads
+// Initial size of the windows and clients tables (they grow),
+// max bindings, events and `webinix_run()` scripts per window
 #define WEBUI_MAX_IDS (256)
 
 // Max allowed argument's index
@@ -62,10 +63,12 @@
     #endif
     #include <windows.h>
     #include <direct.h>
+    #include <fcntl.h>
     #include <io.h>
     #include <shellapi.h>
     #include <tchar.h>
     #include <tlhelp32.h>
+    #include <sys/stat.h>
     #define WEBUI_GET_CURRENT_DIR _getcwd
     #define WEBUI_FILE_EXIST      _access
     #define WEBUI_POPEN           _popen
@@ -81,9 +84,12 @@
     #include <poll.h>
     #include <pthread.h>
     #include <signal.h>
+    #include <sys/mman.h>
     #include <sys/socket.h>
+    #include <sys/stat.h>
     #include <sys/time.h>
     #include <sys/inotify.h>
+    #include <sys/wait.h>
     #include <unistd.h>
     #define WEBUI_GET_CURRENT_DIR getcwd
     #define WEBUI_FILE_EXIST      access
@@ -100,12 +106,15 @@
     #include <poll.h>
     #include <pthread.h>
     #include <signal.h>
+    #include <sys/mman.h>
     #include <sys/socket.h>
+    #include <sys/stat.h>
     #include <sys/sysctl.h>
     #include <sys/syslimits.h>
     #include <sys/time.h>
     #include <sys/types.h>
     #include <sys/event.h>
+    #include <sys/wait.h>
     #include <unistd.h>
     #include <CoreGraphics/CoreGraphics.h>
     #define WEBUI_GET_CURRENT_DIR getcwd
@@ -185,7 +194,54 @@ typedef enum {
     // If the backend uses asynchronous operations, set this 
     // option to `True`. This will make webinix wait until the 
     // backend sets a response using `webinix_return_x()`.
-    asynchronous_response
+    asynchronous_response,
+    // Send a `103 Early Hints` response with the preload links
+    // (see `webinix_set_preload()`) before the HTML, so the browser
+    // starts fetching them before the document is ready.
+    //
+    // Default: False
+    early_hints,
+    // Serve all windows from a single HTTP/WebSocket server,
+    // each window under its own `/_webinix/<window number>/`
+    // path, instead of one server (and port) per window. The
+    // first window started decides the port and public access.
+    // Please use relative URLs (`webinix.js`) in the HTML,
+    // absolute ones are routed by the `Referer` header, which
+    // browsers may omit.
+    //
+    // Default: False
+    shared_server,
+    // Hand idle WebSocket connections over to a few epoll
+    // threads, instead of one web-server thread each, so a
+    // public `multi_client` window can hold thousands of
+    // connected browsers. Linux only, non-TLS connections.
+    // With `ui_event_blocking`, events run on those threads.
+    //
+    // Default: False
+    ws_reactor,
+    // Run this process as one worker of a cluster, all workers
+    // listening on the same port (`webinix_set_port()`) with
+    // `SO_REUSEPORT`. Packets sent to all clients (`webinix_run()`,
+    // `webinix_navigate()`...) and new auth cookies are relayed to
+    // the other workers over a local Unix socket bus, so any worker
+    // reaches every client. A packet larger than 64 KB is not
+    // relayed, only the clients of this worker get it. The bus
+    // directory is in `XDG_RUNTIME_DIR` (or `TMPDIR`), it must be
+    // owned by the user with `0700` permissions. Not available on
+    // Windows.
+    //
+    // Default: False
+    cluster,
+    // Let Linux WebView windows talk to Webinix in-process. The
+    // page and its assets are served through a `webinix://` URI
+    // scheme, and the bridge packets go through a WebKit script
+    // message handler, instead of the local HTTP/WebSocket server.
+    // Windows with a custom files handler or a runtime keep using
+    // the server. With `ui_event_blocking`, events run on the GTK
+    // thread, so they should not wait for a script response.
+    //
+    // Default: False
+    wv_in_process
 } webinix_config;
 
 // -- Structs -------------------------
@@ -195,11 +251,63 @@ typedef struct webinix_event_t {
     char* element;          // HTML element ID
     size_t event_number;    // Internal Webinix
     size_t bind_id;         // Bind ID
-    size_t client_id;       // Client's unique ID
+    size_t client_id;       // Client's unique ID, reused once its session is gone
     size_t connection_id;   // Client's connection ID
     char* cookies;          // Client's full cookies
 } webinix_event_t;
 
+typedef struct webinix_asset_t {
+    const char* path;                // URL path (e.g. "/index.html")
+    const char* mime_type;           // MIME type, `NULL` to guess it from the path
+    const char* etag;                // Quoted ETag, `NULL` to let Webinix compute one
+    const unsigned char* data;       // Content
+    size_t length;                   // Content size in bytes
+    const unsigned char* data_gzip;  // Gzip compressed content, or `NULL`
+    size_t length_gzip;              // Gzip compressed content size in bytes
+} webinix_asset_t;
+
+// Startup phases of the last `webinix_show()`, in microseconds since
+// it was called, `0` when the phase was not reached
+typedef struct webinix_show_timeline_t {
+    size_t tls;             // TLS certificate ready
+    size_t port;            // Network port ready
+    size_t server;          // Web server listening
+    size_t browser;         // Web browser or WebView started
+    size_t connected;       // First WebSocket connection
+    size_t total;           // `webinix_show()` returned
+} webinix_show_timeline_t;
+
+// Heap memory held by Webinix, live and peak bytes since start
+// (see `webinix_get_memory_stats()`)
+typedef struct webinix_memory_stats_t {
+    size_t total;           // All Webinix allocations
+    size_t total_peak;
+    size_t packets;         // Protocol buffers (pooled packets, multi-packet messages)
+    size_t packets_peak;
+    size_t events;          // Event arenas (received packets, event data, small responses)
+    size_t events_peak;
+    size_t cookies;         // Client authentication cookies
+    size_t cookies_peak;
+    size_t responses;       // Event responses too big for their arena
+    size_t responses_peak;
+    size_t assets;          // Asset bundle indexes and the path cache
+    size_t assets_peak;
+    size_t blocks;          // Live allocations
+} webinix_memory_stats_t;
+
+// Client sessions (authentication cookies) since start
+// (see `webinix_get_session_stats()`)
+typedef struct webinix_session_stats_t {
+    size_t active;          // Live sessions
+    size_t peak;            // Most live sessions at once
+    size_t created;         // New sessions
+    size_t expired;         // Sessions removed after their idle timeout
+    size_t evicted;         // Least recently used sessions removed to make room
+} webinix_session_stats_t;
+
+// Streaming response (see `webinix_set_file_handler_stream()`)
+typedef struct webinix_response_t webinix_response_t;
+
 // -- Definitions ---------------------
 
 /**
@@ -214,7 +322,7 @@ WEBUI_EXPORT size_t webinix_new_window(void);
 /**
  * @brief Create a new webinix window object using a specified window number.
  *
- * @param window_number The window number (should be > 0, and < WEBUI_MAX_IDS)
+ * @param window_number The window number (should be > 0, and < 65536)
  *
  * @return Returns the same window number if success.
  *
@@ -485,10 +593,13 @@ WEBUI_EXPORT void webinix_destroy(size_t window);
 WEBUI_EXPORT void webinix_exit(void);
 
 /**
- * @brief Set the web-server root folder path for a specific window.
+ * @brief Set the web-server root folder path for a specific window. The path
+ * can also be a `.zip` or `.tar` archive, which is memory-mapped and served
+ * directly. Deflated zip entries are served only to clients accepting gzip.
+ * When a tar archive has a path more than once, its last entry is served.
  *
  * @param window The window number
- * @param path The local folder full path
+ * @param path The local folder full path, or archive full path
  *
  * @example webinix_set_root_folder(myWindow, "/home/Foo/Bar/");
  */
@@ -513,10 +624,41 @@ WEBUI_EXPORT void webinix_set_browser_folder(const char* path);
  */
 WEBUI_EXPORT bool webinix_set_default_root_folder(const char* path);
 
+/**
+ * @brief Set a web-server (civetweb) option of a window, like `num_threads`,
+ * `listen_backlog`, `connection_queue`, `request_timeout_ms` or
+ * `websocket_timeout_ms`. Overrides the global default and takes effect the
+ * next time the window server starts. The port and the root folder are set
+ * by their own APIs and can't be changed this way.
+ *
+ * @param window The window number
+ * @param name The civetweb option name
+ * @param value The option value, or `NULL` to restore the default
+ *
+ * @return Returns True if the option is valid
+ *
+ * @example webinix_set_server_option(myWindow, "num_threads", "2");
+ */
+WEBUI_EXPORT bool webinix_set_server_option(size_t window, const char* name, const char* value);
+
+/**
+ * @brief Set a web-server (civetweb) option for all windows. Should be used
+ * before `webinix_show()`. See `webinix_set_server_option()`.
+ *
+ * @param name The civetweb option name
+ * @param value The option value, or `NULL` to restore the default
+ *
+ * @return Returns True if the option is valid
+ *
+ * @example webinix_set_default_server_option("listen_backlog", "1024");
+ */
+WEBUI_EXPORT bool webinix_set_default_server_option(const char* name, const char* value);
+
 /**
  * @brief Set a custom handler to serve files. This custom handler should
  * return full HTTP header and body.
  * This deactivates any previous handler set with `webinix_set_file_handler_window`
+ * or `webinix_set_file_handler_stream`
  *
  * @param window The window number
  * @param handler The handler function: `void myHandler(const char* filename,
@@ -530,6 +672,7 @@ WEBUI_EXPORT void webinix_set_file_handler(size_t window, const void* (*handler)
  * @brief Set a custom handler to serve files. This custom handler should
  * return full HTTP header and body.
  * This deactivates any previous handler set with `webinix_set_file_handler`
+ * or `webinix_set_file_handler_stream`
  *
  * @param window The window number
  * @param handler The handler function: `void myHandler(size_t window, const char* filename,
@@ -539,9 +682,119 @@ WEBUI_EXPORT void webinix_set_file_handler(size_t window, const void* (*handler)
  */
 WEBUI_EXPORT void webinix_set_file_handler_window(size_t window, const void* (*handler)(size_t window, const char* filename, int* length));
 
+/**
+ * @brief Set a custom handler that streams files. Instead of returning one
+ * buffer, the handler writes the response in chunks using
+ * `webinix_response_begin()`, `webinix_response_write()` and
+ * `webinix_response_end()`. Writes block while the client is not reading,
+ * so large responses are never fully held in memory. Other requests are
+ * served meanwhile, so the handler can run on several threads at once. The handler returns
+ * false, without beginning a response, to let Webinix look for the file
+ * locally. This deactivates any previous handler set with
+ * `webinix_set_file_handler` or `webinix_set_file_handler_window`.
+ *
+ * @param window The window number
+ * @param handler The handler function: `bool myHandler(size_t window, const char* filename,
+ * webinix_response_t* response)`
+ *
+ * @example webinix_set_file_handler_stream(myWindow, myHandlerFunction);
+ */
+WEBUI_EXPORT void webinix_set_file_handler_stream(size_t window, bool (*handler)(size_t window, const char* filename, webinix_response_t* response));
+
+/**
+ * @brief Send the HTTP header of a streaming response. A negative length
+ * means the size is unknown, and the body is sent using chunked transfer
+ * encoding. The response is not cached (`no-cache, no-store`), unless
+ * `headers` has its own `Cache-Control`.
+ *
+ * @param response The response object
+ * @param status The HTTP status code, `0` for `200`
+ * @param mime_type The content type, `NULL` for `application/octet-stream`
+ * @param length The body size in bytes, or `-1` if unknown
+ * @param headers Extra headers, each one ending with `\r\n`, or `NULL`
+ *
+ * @return Returns True if the header is sent.
+ *
+ * @example webinix_response_begin(response, 200, "text/csv", -1,
+ * "Cache-Control: private, max-age=60\r\n");
+ */
+WEBUI_EXPORT bool webinix_response_begin(webinix_response_t* response, int status, const char* mime_type, long long length, const char* headers);
+
+/**
+ * @brief Write a chunk of a streaming response body. This blocks until the
+ * data is sent. Stop writing once this returns false (client disconnected).
+ *
+ * @param response The response object
+ * @param data The data to send
+ * @param length The data size in bytes
+ *
+ * @return Returns True if the data is sent.
+ *
+ * @example webinix_response_write(response, line, strlen(line));
+ */
+WEBUI_EXPORT bool webinix_response_write(webinix_response_t* response, const void* data, size_t length);
+
+/**
+ * @brief Finish a streaming response. This is done automatically when the
+ * handler returns.
+ *
+ * @param response The response object
+ *
+ * @return Returns True if the whole response is sent.
+ *
+ * @example webinix_response_end(response);
+ */
+WEBUI_EXPORT bool webinix_response_end(webinix_response_t* response);
+
+/**
+ * @brief Serve files from an in-memory asset bundle. Assets are indexed once,
+ * then served with their precomputed MIME type, ETag and gzip variant without
+ * any per-request allocation. Files not found in the bundle are looked up in
+ * the root folder as usual. The assets array and its content must stay valid
+ * until the window is destroyed. Use `tools/vfs.py` to generate a bundle.
+ *
+ * @param window The window number
+ * @param assets The assets array, `NULL` to remove the current bundle
+ * @param count The number of assets
+ *
+ * @return Returns True if the bundle is set successfully.
+ *
+ * @example webinix_set_asset_bundle(myWindow, webinix_assets, webinix_assets_count);
+ */
+WEBUI_EXPORT bool webinix_set_asset_bundle(size_t window, const webinix_asset_t* assets, size_t count);
+
+/**
+ * @brief Serve files from a binary asset bundle file generated by `tools/vfs.py`.
+ * The file is memory-mapped, and assets are served directly from the mapping.
+ *
+ * @param window The window number
+ * @param path The bundle file path
+ *
+ * @return Returns True if the bundle is loaded successfully.
+ *
+ * @example webinix_set_asset_bundle_file(myWindow, "/home/Foo/Bar/ui.bundle");
+ */
+WEBUI_EXPORT bool webinix_set_asset_bundle_file(size_t window, const char* path);
+
+/**
+ * @brief Set critical assets the browser should fetch in parallel with the
+ * window HTML. HTML responses carry `Link: rel=preload` headers for them and
+ * for the Webinix bridge (and `103 Early Hints` if the `early_hints` option
+ * is enabled). The `as` type is guessed from each file extension.
+ *
+ * @param window The window number
+ * @param assets Comma-separated list of absolute URLs, or `NULL` to clear
+ *
+ * @example webinix_set_preload(myWindow, "/style.css, /app.js, /fonts/main.woff2");
+ */
+WEBUI_EXPORT void webinix_set_preload(size_t window, const char* assets);
+
 /**
  * @brief Use this API to set a file handler response if your backend need async 
- * response for `webinix_set_file_handler()`.
+ * response for `webinix_set_file_handler()`. Requests answered this way are
+ * served one at a time. Use `webinix_interface_get_file_handler_request()` and
+ * `webinix_interface_set_response_file_handler_request()` to answer concurrent
+ * requests in any order.
  *
  * @param window The window number
  * @param response The response buffer
@@ -551,6 +804,30 @@ WEBUI_EXPORT void webinix_set_file_handler_window(size_t window, const void* (*h
  */
 WEBUI_EXPORT void webinix_interface_set_response_file_handler(size_t window, const void* response, int length);
 
+/**
+ * @brief Get the handle of the HTTP request being served. Call this from
+ * inside the file handler when `asynchronous_response` is enabled, then
+ * answer later with `webinix_interface_set_response_file_handler_request()`.
+ *
+ * @return Returns the request handle, or `0` if called outside a file handler.
+ *
+ * @example size_t request = webinix_interface_get_file_handler_request();
+ */
+WEBUI_EXPORT size_t webinix_interface_get_file_handler_request(void);
+
+/**
+ * @brief Set the asynchronous response of a specific file handler request.
+ * Requests can be answered concurrently and in any order.
+ *
+ * @param request The request handle
+ * @param response The response buffer (full HTTP header and body), or `NULL`
+ * if the file is not found
+ * @param length The response size
+ *
+ * @example webinix_interface_set_response_file_handler_request(request, buffer, 1024);
+ */
+WEBUI_EXPORT void webinix_interface_set_response_file_handler_request(size_t request, const void* response, int length);
+
 /**
  * @brief Check if the specified window is still running.
  *
@@ -605,6 +882,8 @@ WEBUI_EXPORT char* webinix_decode(const char* str);
 
 /**
  * @brief Safely free a buffer allocated by Webinix using `webinix_malloc()`.
+ * Any other pointer, or a buffer already freed, is ignored. Buffers still
+ * allocated are freed by `webinix_clean()`.
  *
  * @param ptr The buffer to be freed
  *
@@ -633,6 +912,55 @@ WEBUI_EXPORT void* webinix_malloc(size_t size);
  */
 WEBUI_EXPORT void webinix_memcpy(void* dest, void* src, size_t count);
 
+/**
+ * @brief Get the heap memory held by Webinix, by category.
+ *
+ * @param stats The stats to fill
+ *
+ * @example webinix_memory_stats_t stats;
+ * webinix_get_memory_stats(&stats);
+ */
+WEBUI_EXPORT void webinix_get_memory_stats(webinix_memory_stats_t* stats);
+
+/**
+ * @brief Set the memory limits for client data. A message (WebSocket packet
+ * or multi-packet) bigger than `message_size`, or one that would make
+ * Webinix hold more than `total_size` bytes, closes the client connection.
+ * Servers started after this call refuse a bigger WebSocket frame as soon
+ * as its header is received, before reading or allocating its payload.
+ *
+ * @param message_size Biggest message in bytes, `0` for the default (64 MB)
+ * @param total_size Most heap bytes Webinix may hold, `0` for no limit
+ *
+ * @example webinix_set_memory_limits(1024 * 1024, 256 * 1024 * 1024);
+ */
+WEBUI_EXPORT void webinix_set_memory_limits(size_t message_size, size_t total_size);
+
+/**
+ * @brief Get the client sessions (authentication cookies) counters.
+ *
+ * @param stats The stats to fill
+ *
+ * @example webinix_session_stats_t stats;
+ * webinix_get_session_stats(&stats);
+ */
+WEBUI_EXPORT void webinix_get_session_stats(webinix_session_stats_t* stats);
+
+/**
+ * @brief Set the client sessions (authentication cookies) limits. A session
+ * not used for `idle_timeout` seconds expires, and when `max_sessions` are
+ * live the least recently used one is evicted. Sessions with a connected
+ * client are never expired or evicted. A browser whose session is gone is
+ * treated as a new client, and its `client_id` may then be reused by another
+ * browser.
+ *
+ * @param max_sessions Most live sessions, `0` for the default (16384)
+ * @param idle_timeout Seconds, `0` for no expiry. The default is one day
+ *
+ * @example webinix_set_session_limits(1000, 3600);
+ */
+WEBUI_EXPORT void webinix_set_session_limits(size_t max_sessions, size_t idle_timeout);
+
 /**
  * @brief Safely send raw data to the UI. All clients.
  *
@@ -868,6 +1196,20 @@ WEBUI_EXPORT void* webinix_win32_get_hwnd(size_t window);
  */
 WEBUI_EXPORT size_t webinix_get_port(size_t window);
 
+/**
+ * @brief Get the startup timeline of the last `webinix_show()` of a window,
+ * to see where the time-to-first-window is spent.
+ *
+ * @param window The window number
+ * @param timeline The timeline to fill
+ *
+ * @return Returns True if `webinix_show()` was called for this window
+ *
+ * @example webinix_show_timeline_t timeline;
+ * webinix_get_show_timeline(myWindow, &timeline);
+ */
+WEBUI_EXPORT bool webinix_get_show_timeline(size_t window, webinix_show_timeline_t* timeline);
+
 /**
  * @brief Set a custom web-server/websocket network port to be used by Webinix.
  * This can be useful to determine the HTTP link of `webinix.js` in case
@@ -1026,6 +1368,33 @@ WEBUI_EXPORT bool webinix_script_client(webinix_event_t* e, const char* script,
  */
 WEBUI_EXPORT void webinix_set_runtime(size_t window, size_t runtime);
 
+/**
+ * @brief Serve .js and .ts files with a pool of long-lived runtime processes
+ * instead of starting a new process for every request. Each worker runs one
+ * script at a time, so `count` is the number of scripts that can run
+ * concurrently. Scripts still get the query as their first argument, but
+ * global state set by a script persists in the worker between requests.
+ * Crashed workers are restarted on the next request. A count of `0`
+ * (default) disables the pool.
+ *
+ * @param runtime Deno | Bun | Nodejs
+ * @param count The number of workers (concurrency)
+ *
+ * @example webinix_set_runtime_workers(NodeJS, 4);
+ */
+WEBUI_EXPORT void webinix_set_runtime_workers(size_t runtime, size_t count);
+
+/**
+ * @brief Set the maximum time a runtime worker may take to run a script. A
+ * worker still running when the timeout is reached is killed, and started
+ * again on the next request. The client gets a `504` if nothing was sent yet.
+ *
+ * @param second The timeout in seconds, `0` for no timeout. The default is 30
+ *
+ * @example webinix_set_runtime_timeout(10);
+ */
+WEBUI_EXPORT void webinix_set_runtime_timeout(size_t second);
+
 /**
  * @brief Get how many arguments there are in an event.
  *
@@ -283,6 +283,11 @@ namespace webinix {
             return webinix_get_port(webinix_window);
         }
 
+        // Get the startup timeline of the last `show()`, to see where the time-to-first-window is spent
+        bool get_show_timeline(webinix_show_timeline_t* timeline) const {
+            return webinix_get_show_timeline(webinix_window, timeline);
+        }
+
         // Set a custom web-server network port to be used by Webinix. This can be useful to determine the HTTP
         // link of `webinix.js` in case you are trying to use Webinix with an external web-server like NGNIX
         bool set_port(size_t port) const {
@@ -313,7 +318,7 @@ namespace webinix {
             return webinix_get_best_browser(webinix_window);
         }
 
-        // Set the web-server root folder path for this specific window.
+        // Set the web-server root folder path for this specific window (folder, `.zip` or `.tar`).
         bool set_root_folder(const std::string_view path) const {
             return webinix_set_root_folder(webinix_window, path.data());
         }
@@ -330,6 +335,33 @@ namespace webinix {
             webinix_set_file_handler_window(webinix_window, handler);
         }
 
+        // Set a custom handler that streams files using `webinix_response_write()`.
+        // Resets previous handler set with `set_file_handler` or `set_file_handler_window`.
+        void set_file_handler_stream(bool (*handler)(size_t window, const char* filename, webinix_response_t* response)) const {
+            webinix_set_file_handler_stream(webinix_window, handler);
+        }
+
+        // Serve files from an in-memory asset bundle (see `tools/vfs.py`).
+        bool set_asset_bundle(const webinix_asset_t* assets, size_t count) const {
+            return webinix_set_asset_bundle(webinix_window, assets, count);
+        }
+
+        // Serve files from a memory-mapped binary asset bundle file (see `tools/vfs.py`).
+        bool set_asset_bundle_file(const std::string_view path) const {
+            return webinix_set_asset_bundle_file(webinix_window, path.data());
+        }
+
+        // Set critical assets (comma-separated URLs) to preload with the window HTML.
+        void set_preload(const std::string_view assets) const {
+            webinix_set_preload(webinix_window, assets.data());
+        }
+
+        // Set a web-server (civetweb) option, like `num_threads`. Takes effect the next
+        // time the window server starts. An empty `value` restores the default.
+        bool set_server_option(const std::string_view name, const std::string_view value) const {
+            return webinix_set_server_option(webinix_window, name.data(), value.data());
+        }
+
         // Set the web browser profile to use. An empty `name` and `path` means the default user profile. Need
         // to be called before `webinix_show()`.
         void set_profile(const std::string_view name = {""}, const std::string_view path = {""}) const {
@@ -449,6 +481,11 @@ namespace webinix {
         return webinix_set_default_root_folder(path.data());
     }
 
+    // Set a web-server (civetweb) option for all windows. An empty `value` restores the default.
+    inline bool set_default_server_option(const std::string_view name, const std::string_view value) {
+        return webinix_set_default_server_option(name.data(), value.data());
+    }
+
     // Get OS high contrast preference.
     inline bool is_high_contrast() {
         return webinix_is_high_contrast();
@@ -459,6 +496,16 @@ namespace webinix {
         return webinix_browser_exist(browser);
     }
 
+    // Serve .js and .ts files with a pool of `count` long-lived runtime processes. `0` disables the pool.
+    inline void set_runtime_workers(unsigned int runtime, size_t count) {
+        webinix_set_runtime_workers(runtime, count);
+    }
+
+    // Set the maximum time in seconds a runtime worker may take to run a script. `0` for no timeout.
+    inline void set_runtime_timeout(size_t second) {
+        webinix_set_runtime_timeout(second);
+    }
+
     // Set the maximum time in seconds to wait for browser to start
     inline void set_timeout(unsigned int second) {
         webinix_set_timeout(second);
@@ -526,6 +573,26 @@ namespace webinix {
         webinix_memcpy(dest, const_cast<void*>(src), count);
     }
 
+    // Get the heap memory held by Webinix, by category.
+    inline void get_memory_stats(webinix_memory_stats_t* stats) {
+        webinix_get_memory_stats(stats);
+    }
+
+    // Set the biggest client message, and the most heap bytes Webinix may hold (`0` for no limit).
+    inline void set_memory_limits(size_t message_size, size_t total_size) {
+        webinix_set_memory_limits(message_size, total_size);
+    }
+
+    // Get the client sessions (authentication cookies) counters.
+    inline void get_session_stats(webinix_session_stats_t* stats) {
+        webinix_get_session_stats(stats);
+    }
+
+    // Set the most live client sessions, and their idle timeout in seconds (`0` for no expiry).
+    inline void set_session_limits(size_t max_sessions, size_t idle_timeout) {
+        webinix_set_session_limits(max_sessions, idle_timeout);
+    }
+
 } // namespace webinix
 
 #endif /* _WEBUI_HPP */
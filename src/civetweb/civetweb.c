@@ -1957,6 +1957,22 @@ struct socket {
 };
 
 
+/* Websocket reactor (Webinix local change): a few epoll threads hold
+ * the idle websocket connections, instead of one worker thread each.
+ * Enabled at runtime with the "websocket_reactor_threads" option. */
+#if defined(USE_WEBSOCKET) && defined(__linux__)                               \
+    && !(defined(USE_ZLIB) && defined(MG_EXPERIMENTAL_INTERFACES))              \
+    && !defined(NO_WEBSOCKET_REACTOR)
+#define USE_WEBSOCKET_REACTOR
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#if !defined(MAX_WEBSOCKET_REACTORS)
+#define MAX_WEBSOCKET_REACTORS (64)
+#endif
+struct mg_ws_reactor;
+#endif
+
+
 /* Enum const for all options must be in sync with
  * static struct mg_option config_options[]
  * This is tested in the unit test (test/private.c)
@@ -1974,6 +1990,8 @@ enum {
 	LINGER_TIMEOUT,
 	CONNECTION_QUEUE_SIZE,
 	LISTEN_BACKLOG_SIZE,
+	LISTEN_REUSE_PORT,
+	LISTEN_SOCKET,
 #if defined(__linux__)
 	ALLOW_SENDFILE_CALL,
 #endif
@@ -1987,6 +2005,10 @@ enum {
 #if defined(USE_WEBSOCKET)
 	WEBSOCKET_TIMEOUT,
 	ENABLE_WEBSOCKET_PING_PONG,
+	WEBSOCKET_MAX_FRAME_SIZE,
+#endif
+#if defined(USE_WEBSOCKET_REACTOR)
+	WEBSOCKET_REACTOR_THREADS,
 #endif
 	DECODE_URL,
 	DECODE_QUERY_STRING,
@@ -2123,6 +2145,8 @@ static const struct mg_option config_options[] = {
     {"linger_timeout_ms", MG_CONFIG_TYPE_NUMBER, NULL},
     {"connection_queue", MG_CONFIG_TYPE_NUMBER, "20"},
     {"listen_backlog", MG_CONFIG_TYPE_NUMBER, "200"},
+    {"reuse_port", MG_CONFIG_TYPE_BOOLEAN, "no"},
+    {"listening_socket", MG_CONFIG_TYPE_NUMBER, NULL},
 #if defined(__linux__)
     {"allow_sendfile_call", MG_CONFIG_TYPE_BOOLEAN, "yes"},
 #endif
@@ -2136,6 +2160,10 @@ static const struct mg_option config_options[] = {
 #if defined(USE_WEBSOCKET)
     {"websocket_timeout_ms", MG_CONFIG_TYPE_NUMBER, NULL},
     {"enable_websocket_ping_pong", MG_CONFIG_TYPE_BOOLEAN, "no"},
+    {"websocket_max_frame_size", MG_CONFIG_TYPE_NUMBER, "0"},
+#endif
+#if defined(USE_WEBSOCKET_REACTOR)
+    {"websocket_reactor_threads", MG_CONFIG_TYPE_NUMBER, "0"},
 #endif
     {"decode_url", MG_CONFIG_TYPE_BOOLEAN, "yes"},
     {"decode_query_string", MG_CONFIG_TYPE_BOOLEAN, "no"},
@@ -2444,6 +2472,12 @@ struct mg_context {
 	pthread_t *worker_threadids;      /* The worker thread IDs */
 	unsigned long starter_thread_idx; /* thread index which called mg_start */
 
+#if defined(USE_WEBSOCKET_REACTOR)
+	struct mg_ws_reactor *ws_reactors; /* Websocket reactor threads */
+	unsigned int ws_reactor_count;
+	volatile ptrdiff_t ws_reactor_next; /* Round robin, new connections */
+#endif
+
 	/* Connection to thread dispatching */
 #if defined(ALTERNATIVE_QUEUE)
 	struct socket *client_socks;
@@ -2608,6 +2642,9 @@ struct mg_connection {
 #if defined(USE_WEBSOCKET)
 	int in_websocket_handling; /* 1 if in read_websocket */
 #endif
+#if defined(USE_WEBSOCKET_REACTOR)
+	int in_websocket_reactor; /* 1 if handed over to a websocket reactor */
+#endif
 #if defined(USE_ZLIB) && defined(USE_WEBSOCKET)                                \
     && defined(MG_EXPERIMENTAL_INTERFACES)
 	/* Parameters for websocket data compression according to rfc7692 */
@@ -10756,6 +10793,30 @@ mg_send_file_body(struct mg_connection *conn, const char *path)
 	(void)mg_fclose(&file.access); /* Ignore errors for readonly files */
 	return 0;                      /* >= 0 for OK */
 }
+
+
+CIVETWEB_API int
+mg_send_file_body_range(struct mg_connection *conn,
+                        const char *path,
+                        long long offset,
+                        long long len)
+{
+	struct mg_file file = STRUCT_FILE_INITIALIZER;
+	if ((offset < 0) || (len < 0)) {
+		return -1;
+	}
+	if (!mg_fopen(conn, path, MG_FOPEN_MODE_READ, &file)) {
+		return -1;
+	}
+	fclose_on_exec(&file.access, conn);
+	send_file_data(conn,
+	               &file,
+	               (int64_t)offset,
+	               (int64_t)len,
+	               0); /* send static file range */
+	(void)mg_fclose(&file.access); /* Ignore errors for readonly files */
+	return 0;                      /* >= 0 for OK */
+}
 #endif /* NO_FILESYSTEMS */
 
 
@@ -13424,10 +13485,17 @@ send_websocket_handshake(struct mg_connection *conn, const char *websock_key)
 #endif
 
 
-static void
-read_websocket(struct mg_connection *conn,
-               mg_websocket_data_handler ws_data_handler,
-               void *callback_data)
+/* Process the first complete frame of the websocket message queue.
+ * Returns 1 if a frame was processed, 0 if more data is needed, and -1
+ * if the connection must be closed. Shared by the read loop of a worker
+ * thread (read_websocket) and the websocket reactor. */
+static int
+websocket_process_frame(struct mg_connection *conn,
+                        mg_websocket_data_handler ws_data_handler,
+                        void *callback_data,
+                        double timeout,
+                        int enable_ping_pong,
+                        int *ping_count)
 {
 	/* Pointer to the beginning of the portion of the incoming websocket
 	 * message queue.
@@ -13455,301 +13523,354 @@ read_websocket(struct mg_connection *conn,
 	unsigned char mem[4096];
 	unsigned char mop; /* mask flag and opcode */
 
-	/* Variables used for connection monitoring */
-	double timeout = -1.0;
-	int enable_ping_pong = 0;
-	int ping_count = 0;
-
-	if (conn->dom_ctx->config[ENABLE_WEBSOCKET_PING_PONG]) {
-		enable_ping_pong =
-		    !mg_strcasecmp(conn->dom_ctx->config[ENABLE_WEBSOCKET_PING_PONG],
-		                   "yes");
+	header_len = 0;
+	DEBUG_ASSERT(conn->data_len >= conn->request_len);
+	if ((body_len = (size_t)(conn->data_len - conn->request_len)) >= 2) {
+		len = buf[1] & 127;
+		mask_len = (buf[1] & 128) ? 4 : 0;
+		if ((len < 126) && (body_len >= mask_len)) {
+			/* inline 7-bit length field */
+			data_len = len;
+			header_len = 2 + mask_len;
+		} else if ((len == 126) && (body_len >= (4 + mask_len))) {
+			/* 16-bit length field */
+			header_len = 4 + mask_len;
+			data_len = ((((size_t)buf[2]) << 8) + buf[3]);
+		} else if (body_len >= (10 + mask_len)) {
+			/* 64-bit length field */
+			uint32_t l1, l2;
+			memcpy(&l1, &buf[2], 4); /* Use memcpy for alignment */
+			memcpy(&l2, &buf[6], 4);
+			header_len = 10 + mask_len;
+			data_len = (((uint64_t)ntohl(l1)) << 32) + ntohl(l2);
+
+			if (data_len > (uint64_t)0x7FFF0000ul) {
+				/* no can do */
+				mg_cry_internal(
+				    conn,
+				    "%s",
+				    "websocket out of memory; closing connection");
+				return -1;
+			}
+		}
 	}
 
-	if (conn->dom_ctx->config[WEBSOCKET_TIMEOUT]) {
-		timeout = atoi(conn->dom_ctx->config[WEBSOCKET_TIMEOUT]) / 1000.0;
-	}
-	if ((timeout <= 0.0) && (conn->dom_ctx->config[REQUEST_TIMEOUT])) {
-		timeout = atoi(conn->dom_ctx->config[REQUEST_TIMEOUT]) / 1000.0;
+	/* Webinix local change: refuse a frame above the configured size
+	 * before anything is allocated or read for it */
+	if ((header_len > 0) && (body_len >= header_len)
+	    && (conn->phys_ctx->dd.config[WEBSOCKET_MAX_FRAME_SIZE] != NULL)) {
+		uint64_t max_frame = (uint64_t)strtoull(
+		    conn->phys_ctx->dd.config[WEBSOCKET_MAX_FRAME_SIZE], NULL, 10);
+		if ((max_frame > 0) && (data_len > max_frame)) {
+			mg_cry_internal(conn,
+			                "websocket frame of %" UINT64_FMT
+			                " bytes is too large; closing connection",
+			                data_len);
+			return -1;
+		}
 	}
-	if (timeout <= 0.0) {
-		timeout = atof(config_options[REQUEST_TIMEOUT].default_value) / 1000.0;
+
+#if defined(USE_WEBSOCKET_REACTOR)
+	/* A reactor thread never waits for the rest of a frame, it grows
+	 * the connection buffer and gets it with the next EPOLLIN */
+	if (conn->in_websocket_reactor && (header_len > 0)
+	    && (data_len + (uint64_t)header_len > (uint64_t)body_len)) {
+		return 0;
 	}
+#endif
 
-	/* Enter data processing loop */
-	DEBUG_TRACE("Websocket connection %s:%u start data processing loop",
-	            conn->request_info.remote_addr,
-	            conn->request_info.remote_port);
-	conn->in_websocket_handling = 1;
-	mg_set_thread_name("wsock");
+	if ((header_len > 0) && (body_len >= header_len)) {
+		/* Allocate space to hold websocket payload */
+		unsigned char *data = mem;
 
-	/* Loop continuously, reading messages from the socket, invoking the
-	 * callback, and waiting repeatedly until an error occurs. */
-	while (STOP_FLAG_IS_ZERO(&conn->phys_ctx->stop_flag)
-	       && (!conn->must_close)) {
-		header_len = 0;
-		DEBUG_ASSERT(conn->data_len >= conn->request_len);
-		if ((body_len = (size_t)(conn->data_len - conn->request_len)) >= 2) {
-			len = buf[1] & 127;
-			mask_len = (buf[1] & 128) ? 4 : 0;
-			if ((len < 126) && (body_len >= mask_len)) {
-				/* inline 7-bit length field */
-				data_len = len;
-				header_len = 2 + mask_len;
-			} else if ((len == 126) && (body_len >= (4 + mask_len))) {
-				/* 16-bit length field */
-				header_len = 4 + mask_len;
-				data_len = ((((size_t)buf[2]) << 8) + buf[3]);
-			} else if (body_len >= (10 + mask_len)) {
-				/* 64-bit length field */
-				uint32_t l1, l2;
-				memcpy(&l1, &buf[2], 4); /* Use memcpy for alignment */
-				memcpy(&l2, &buf[6], 4);
-				header_len = 10 + mask_len;
-				data_len = (((uint64_t)ntohl(l1)) << 32) + ntohl(l2);
-
-				if (data_len > (uint64_t)0x7FFF0000ul) {
-					/* no can do */
-					mg_cry_internal(
-					    conn,
-					    "%s",
-					    "websocket out of memory; closing connection");
-					break;
-				}
+		if ((size_t)data_len > (size_t)sizeof(mem)) {
+			data = (unsigned char *)mg_malloc_ctx((size_t)data_len,
+			                                      conn->phys_ctx);
+			if (data == NULL) {
+				/* Allocation failed, exit the loop and then close the
+				 * connection */
+				mg_cry_internal(
+				    conn,
+				    "%s",
+				    "websocket out of memory; closing connection");
+				return -1;
 			}
 		}
 
-		if ((header_len > 0) && (body_len >= header_len)) {
-			/* Allocate space to hold websocket payload */
-			unsigned char *data = mem;
-
-			if ((size_t)data_len > (size_t)sizeof(mem)) {
-				data = (unsigned char *)mg_malloc_ctx((size_t)data_len,
-				                                      conn->phys_ctx);
-				if (data == NULL) {
-					/* Allocation failed, exit the loop and then close the
-					 * connection */
-					mg_cry_internal(
-					    conn,
-					    "%s",
-					    "websocket out of memory; closing connection");
+		/* Copy the mask before we shift the queue and destroy it */
+		if (mask_len > 0) {
+			memcpy(mask, buf + header_len - mask_len, sizeof(mask));
+		} else {
+			memset(mask, 0, sizeof(mask));
+		}
+
+		/* Read frame payload from the first message in the queue into
+		 * data and advance the queue by moving the memory in place. */
+		DEBUG_ASSERT(body_len >= header_len);
+		if (data_len + (uint64_t)header_len > (uint64_t)body_len) {
+			mop = buf[0]; /* current mask and opcode */
+			              /* Overflow case */
+			len = body_len - header_len;
+			memcpy(data, buf + header_len, len);
+			error = 0;
+			while ((uint64_t)len < data_len) {
+				n = pull_inner(NULL,
+				               conn,
+				               (char *)(data + len),
+				               (int)(data_len - len),
+				               timeout);
+				if (n <= -2) {
+					error = 1;
+					break;
+				} else if (n > 0) {
+					len += (size_t)n;
+				} else {
+					/* Webinix local change: a peer that stalls a whole
+					 * timeout in the middle of a frame is closed */
+					error = 1;
 					break;
 				}
 			}
-
-			/* Copy the mask before we shift the queue and destroy it */
-			if (mask_len > 0) {
-				memcpy(mask, buf + header_len - mask_len, sizeof(mask));
-			} else {
-				memset(mask, 0, sizeof(mask));
+			if (error) {
+				mg_cry_internal(
+				    conn,
+				    "%s",
+				    "Websocket pull failed; closing connection");
+				if (data != mem) {
+					mg_free(data);
+				}
+				return -1;
 			}
 
-			/* Read frame payload from the first message in the queue into
-			 * data and advance the queue by moving the memory in place. */
-			DEBUG_ASSERT(body_len >= header_len);
-			if (data_len + (uint64_t)header_len > (uint64_t)body_len) {
-				mop = buf[0]; /* current mask and opcode */
-				              /* Overflow case */
-				len = body_len - header_len;
-				memcpy(data, buf + header_len, len);
-				error = 0;
-				while ((uint64_t)len < data_len) {
-					n = pull_inner(NULL,
-					               conn,
-					               (char *)(data + len),
-					               (int)(data_len - len),
-					               timeout);
-					if (n <= -2) {
-						error = 1;
-						break;
-					} else if (n > 0) {
-						len += (size_t)n;
-					} else {
-						/* Timeout: should retry */
-						/* TODO: retry condition */
-					}
-				}
-				if (error) {
-					mg_cry_internal(
-					    conn,
-					    "%s",
-					    "Websocket pull failed; closing connection");
-					if (data != mem) {
-						mg_free(data);
-					}
-					break;
-				}
+			conn->data_len = conn->request_len;
 
-				conn->data_len = conn->request_len;
+		} else {
 
-			} else {
+			mop = buf[0]; /* current mask and opcode, overwritten by
+			               * memmove() */
 
-				mop = buf[0]; /* current mask and opcode, overwritten by
-				               * memmove() */
+			/* Length of the message being read at the front of the
+			 * queue. Cast to 31 bit is OK, since we limited
+			 * data_len before. */
+			len = (size_t)data_len + header_len;
 
-				/* Length of the message being read at the front of the
-				 * queue. Cast to 31 bit is OK, since we limited
-				 * data_len before. */
-				len = (size_t)data_len + header_len;
+			/* Copy the data payload into the data pointer for the
+			 * callback. Cast to 31 bit is OK, since we
+			 * limited data_len */
+			memcpy(data, buf + header_len, (size_t)data_len);
 
-				/* Copy the data payload into the data pointer for the
-				 * callback. Cast to 31 bit is OK, since we
-				 * limited data_len */
-				memcpy(data, buf + header_len, (size_t)data_len);
+			/* Move the queue forward len bytes */
+			memmove(buf, buf + len, body_len - len);
 
-				/* Move the queue forward len bytes */
-				memmove(buf, buf + len, body_len - len);
+			/* Mark the queue as advanced */
+			conn->data_len -= (int)len;
+		}
 
-				/* Mark the queue as advanced */
-				conn->data_len -= (int)len;
+		/* Apply mask if necessary */
+		if (mask_len > 0) {
+			for (i = 0; i < (size_t)data_len; i++) {
+				data[i] ^= mask[i & 3];
 			}
+		}
 
-			/* Apply mask if necessary */
-			if (mask_len > 0) {
-				for (i = 0; i < (size_t)data_len; i++) {
-					data[i] ^= mask[i & 3];
-				}
+		exit_by_callback = 0;
+		if (enable_ping_pong && ((mop & 0xF) == MG_WEBSOCKET_OPCODE_PONG)) {
+			/* filter PONG messages */
+			DEBUG_TRACE("PONG from %s:%u",
+			            conn->request_info.remote_addr,
+			            conn->request_info.remote_port);
+			/* No unanwered PINGs left */
+			*ping_count = 0;
+		} else if (enable_ping_pong
+		           && ((mop & 0xF) == MG_WEBSOCKET_OPCODE_PING)) {
+			/* reply PING messages */
+			DEBUG_TRACE("Reply PING from %s:%u",
+			            conn->request_info.remote_addr,
+			            conn->request_info.remote_port);
+			ret = mg_websocket_write(conn,
+			                         MG_WEBSOCKET_OPCODE_PONG,
+			                         (char *)data,
+			                         (size_t)data_len);
+			if (ret <= 0) {
+				/* Error: send failed */
+				DEBUG_TRACE("Reply PONG failed (%i)", ret);
+				if (data != mem) {
+						mg_free(data);
+					}
+					return -1;
 			}
 
-			exit_by_callback = 0;
-			if (enable_ping_pong && ((mop & 0xF) == MG_WEBSOCKET_OPCODE_PONG)) {
-				/* filter PONG messages */
-				DEBUG_TRACE("PONG from %s:%u",
-				            conn->request_info.remote_addr,
-				            conn->request_info.remote_port);
-				/* No unanwered PINGs left */
-				ping_count = 0;
-			} else if (enable_ping_pong
-			           && ((mop & 0xF) == MG_WEBSOCKET_OPCODE_PING)) {
-				/* reply PING messages */
-				DEBUG_TRACE("Reply PING from %s:%u",
-				            conn->request_info.remote_addr,
-				            conn->request_info.remote_port);
-				ret = mg_websocket_write(conn,
-				                         MG_WEBSOCKET_OPCODE_PONG,
-				                         (char *)data,
-				                         (size_t)data_len);
-				if (ret <= 0) {
-					/* Error: send failed */
-					DEBUG_TRACE("Reply PONG failed (%i)", ret);
-					break;
-				}
-
-			} else {
-				/* Exit the loop if callback signals to exit (server side),
-				 * or "connection close" opcode received (client side). */
-				if (ws_data_handler != NULL) {
+		} else {
+			/* Exit the loop if callback signals to exit (server side),
+			 * or "connection close" opcode received (client side). */
+			if (ws_data_handler != NULL) {
 #if defined(USE_ZLIB) && defined(MG_EXPERIMENTAL_INTERFACES)
-					if (mop & 0x40) {
-						/* Inflate the data received if bit RSV1 is set. */
-						if (!conn->websocket_deflate_initialized) {
-							if (websocket_deflate_initialize(conn, 1) != Z_OK)
+				if (mop & 0x40) {
+					/* Inflate the data received if bit RSV1 is set. */
+					if (!conn->websocket_deflate_initialized) {
+						if (websocket_deflate_initialize(conn, 1) != Z_OK)
+							exit_by_callback = 1;
+					}
+					if (!exit_by_callback) {
+						size_t inflate_buf_size_old = 0;
+						size_t inflate_buf_size =
+						    data_len
+						    * 4; // Initial guess of the inflated message
+						         // size. We double the memory when needed.
+						Bytef *inflated = NULL;
+						Bytef *new_mem = NULL;
+						conn->websocket_inflate_state.avail_in =
+						    (uInt)(data_len + 4);
+						conn->websocket_inflate_state.next_in = data;
+						// Add trailing 0x00 0x00 0xff 0xff bytes
+						data[data_len] = '\x00';
+						data[data_len + 1] = '\x00';
+						data[data_len + 2] = '\xff';
+						data[data_len + 3] = '\xff';
+						do {
+							if (inflate_buf_size_old == 0) {
+								new_mem =
+								    (Bytef *)mg_calloc(inflate_buf_size,
+								                       sizeof(Bytef));
+							} else {
+								inflate_buf_size *= 2;
+								new_mem =
+								    (Bytef *)mg_realloc(inflated,
+								                        inflate_buf_size);
+							}
+							if (new_mem == NULL) {
+								mg_cry_internal(
+								    conn,
+								    "Out of memory: Cannot allocate "
+								    "inflate buffer of %lu bytes",
+								    (unsigned long)inflate_buf_size);
 								exit_by_callback = 1;
-						}
-						if (!exit_by_callback) {
-							size_t inflate_buf_size_old = 0;
-							size_t inflate_buf_size =
-							    data_len
-							    * 4; // Initial guess of the inflated message
-							         // size. We double the memory when needed.
-							Bytef *inflated = NULL;
-							Bytef *new_mem = NULL;
-							conn->websocket_inflate_state.avail_in =
-							    (uInt)(data_len + 4);
-							conn->websocket_inflate_state.next_in = data;
-							// Add trailing 0x00 0x00 0xff 0xff bytes
-							data[data_len] = '\x00';
-							data[data_len + 1] = '\x00';
-							data[data_len + 2] = '\xff';
-							data[data_len + 3] = '\xff';
-							do {
-								if (inflate_buf_size_old == 0) {
-									new_mem =
-									    (Bytef *)mg_calloc(inflate_buf_size,
-									                       sizeof(Bytef));
-								} else {
-									inflate_buf_size *= 2;
-									new_mem =
-									    (Bytef *)mg_realloc(inflated,
-									                        inflate_buf_size);
-								}
-								if (new_mem == NULL) {
-									mg_cry_internal(
-									    conn,
-									    "Out of memory: Cannot allocate "
-									    "inflate buffer of %lu bytes",
-									    (unsigned long)inflate_buf_size);
-									exit_by_callback = 1;
-									break;
-								}
-								inflated = new_mem;
-								conn->websocket_inflate_state.avail_out =
-								    (uInt)(inflate_buf_size
-								           - inflate_buf_size_old);
-								conn->websocket_inflate_state.next_out =
-								    inflated + inflate_buf_size_old;
-								ret = inflate(&conn->websocket_inflate_state,
-								              Z_SYNC_FLUSH);
-								if (ret == Z_NEED_DICT || ret == Z_DATA_ERROR
-								    || ret == Z_MEM_ERROR) {
-									mg_cry_internal(
-									    conn,
-									    "ZLIB inflate error: %i %s",
-									    ret,
-									    (conn->websocket_inflate_state.msg
-									         ? conn->websocket_inflate_state.msg
-									         : "<no error message>"));
-									exit_by_callback = 1;
-									break;
-								}
-								inflate_buf_size_old = inflate_buf_size;
-
-							} while (conn->websocket_inflate_state.avail_out
-							         == 0);
-							inflate_buf_size -=
-							    conn->websocket_inflate_state.avail_out;
-							if (!ws_data_handler(conn,
-							                     mop,
-							                     (char *)inflated,
-							                     inflate_buf_size,
-							                     callback_data)) {
+								break;
+							}
+							inflated = new_mem;
+							conn->websocket_inflate_state.avail_out =
+							    (uInt)(inflate_buf_size
+							           - inflate_buf_size_old);
+							conn->websocket_inflate_state.next_out =
+							    inflated + inflate_buf_size_old;
+							ret = inflate(&conn->websocket_inflate_state,
+							              Z_SYNC_FLUSH);
+							if (ret == Z_NEED_DICT || ret == Z_DATA_ERROR
+							    || ret == Z_MEM_ERROR) {
+								mg_cry_internal(
+								    conn,
+								    "ZLIB inflate error: %i %s",
+								    ret,
+								    (conn->websocket_inflate_state.msg
+								         ? conn->websocket_inflate_state.msg
+								         : "<no error message>"));
 								exit_by_callback = 1;
+								break;
 							}
-							mg_free(inflated);
+							inflate_buf_size_old = inflate_buf_size;
+
+						} while (conn->websocket_inflate_state.avail_out
+						         == 0);
+						inflate_buf_size -=
+						    conn->websocket_inflate_state.avail_out;
+						if (!ws_data_handler(conn,
+						                     mop,
+						                     (char *)inflated,
+						                     inflate_buf_size,
+						                     callback_data)) {
+							exit_by_callback = 1;
 						}
-					} else
-#endif
-					    if (!ws_data_handler(conn,
-					                         mop,
-					                         (char *)data,
-					                         (size_t)data_len,
-					                         callback_data)) {
-						exit_by_callback = 1;
+						mg_free(inflated);
 					}
+				} else
+#endif
+				    if (!ws_data_handler(conn,
+				                         mop,
+				                         (char *)data,
+				                         (size_t)data_len,
+				                         callback_data)) {
+					exit_by_callback = 1;
 				}
 			}
+		}
 
-			/* It a buffer has been allocated, free it again */
-			if (data != mem) {
-				mg_free(data);
-			}
+		/* It a buffer has been allocated, free it again */
+		if (data != mem) {
+			mg_free(data);
+		}
 
-			if (exit_by_callback) {
-				DEBUG_TRACE("Callback requests to close connection from %s:%u",
-				            conn->request_info.remote_addr,
-				            conn->request_info.remote_port);
-				break;
-			}
-			if ((mop & 0xf) == MG_WEBSOCKET_OPCODE_CONNECTION_CLOSE) {
-				/* Opcode == 8, connection close */
-				DEBUG_TRACE("Message requests to close connection from %s:%u",
-				            conn->request_info.remote_addr,
-				            conn->request_info.remote_port);
-				break;
-			}
+		if (exit_by_callback) {
+			DEBUG_TRACE("Callback requests to close connection from %s:%u",
+			            conn->request_info.remote_addr,
+			            conn->request_info.remote_port);
+			return -1;
+		}
+		if ((mop & 0xf) == MG_WEBSOCKET_OPCODE_CONNECTION_CLOSE) {
+			/* Opcode == 8, connection close */
+			DEBUG_TRACE("Message requests to close connection from %s:%u",
+			            conn->request_info.remote_addr,
+			            conn->request_info.remote_port);
+			return -1;
+		}
 
-			/* Not breaking the loop, process next websocket frame. */
-		} else {
+		/* Process the next websocket frame. */
+		return 1;
+	}
+
+	/* Need more data */
+	return 0;
+}
+
+
+static void
+read_websocket(struct mg_connection *conn,
+               mg_websocket_data_handler ws_data_handler,
+               void *callback_data)
+{
+	int n, ret;
+
+	/* Variables used for connection monitoring */
+	double timeout = -1.0;
+	int enable_ping_pong = 0;
+	int ping_count = 0;
+
+	if (conn->dom_ctx->config[ENABLE_WEBSOCKET_PING_PONG]) {
+		enable_ping_pong =
+		    !mg_strcasecmp(conn->dom_ctx->config[ENABLE_WEBSOCKET_PING_PONG],
+		                   "yes");
+	}
+
+	if (conn->dom_ctx->config[WEBSOCKET_TIMEOUT]) {
+		timeout = atoi(conn->dom_ctx->config[WEBSOCKET_TIMEOUT]) / 1000.0;
+	}
+	if ((timeout <= 0.0) && (conn->dom_ctx->config[REQUEST_TIMEOUT])) {
+		timeout = atoi(conn->dom_ctx->config[REQUEST_TIMEOUT]) / 1000.0;
+	}
+	if (timeout <= 0.0) {
+		timeout = atof(config_options[REQUEST_TIMEOUT].default_value) / 1000.0;
+	}
+
+	/* Enter data processing loop */
+	DEBUG_TRACE("Websocket connection %s:%u start data processing loop",
+	            conn->request_info.remote_addr,
+	            conn->request_info.remote_port);
+	conn->in_websocket_handling = 1;
+	mg_set_thread_name("wsock");
+
+	/* Loop continuously, reading messages from the socket, invoking the
+	 * callback, and waiting repeatedly until an error occurs. */
+	while (STOP_FLAG_IS_ZERO(&conn->phys_ctx->stop_flag)
+	       && (!conn->must_close)) {
+		ret = websocket_process_frame(conn,
+		                              ws_data_handler,
+		                              callback_data,
+		                              timeout,
+		                              enable_ping_pong,
+		                              &ping_count);
+		if (ret < 0) {
+			break;
+		}
+		if (ret == 0) {
 			/* Read from the socket into the next available location in the
 			 * message queue. */
 			n = pull_inner(NULL,
@@ -14005,6 +14126,540 @@ mg_websocket_client_write(struct mg_connection *conn,
 }
 
 
+#if defined(USE_WEBSOCKET_REACTOR)
+static void close_connection(struct mg_connection *conn);
+
+
+/* A websocket connection handed over by a worker thread. The worker
+ * keeps its own connection structure, so this is a copy with its own
+ * buffer and mutex. */
+struct mg_ws_parked {
+	struct mg_connection conn;
+	mg_websocket_data_handler data_handler;
+	mg_websocket_close_handler close_handler;
+	void *cbdata;
+	time_t last_activity;
+	int ping_count;
+	int buf_size; /* Buffer size when parked, before any frame grew it */
+	struct mg_ws_parked *prev;
+	struct mg_ws_parked *next;
+};
+
+
+struct mg_ws_reactor {
+	struct mg_context *ctx;
+	int epoll_fd;
+	int wakeup_fd;
+	volatile int stop;
+	pthread_t thread_id;
+	pthread_mutex_t mutex; /* Protects the connection list */
+	struct mg_ws_parked *list;
+};
+
+
+static double
+ws_reactor_timeout(const struct mg_context *ctx)
+{
+	/* Same as read_websocket */
+	double timeout = -1.0;
+	if (ctx->dd.config[WEBSOCKET_TIMEOUT]) {
+		timeout = atoi(ctx->dd.config[WEBSOCKET_TIMEOUT]) / 1000.0;
+	}
+	if ((timeout <= 0.0) && (ctx->dd.config[REQUEST_TIMEOUT])) {
+		timeout = atoi(ctx->dd.config[REQUEST_TIMEOUT]) / 1000.0;
+	}
+	if (timeout <= 0.0) {
+		timeout = atof(config_options[REQUEST_TIMEOUT].default_value) / 1000.0;
+	}
+	return timeout;
+}
+
+
+static void
+ws_reactor_free(struct mg_ws_parked *p)
+{
+	struct mg_request_info *ri = &p->conn.request_info;
+	if (ri->local_uri != ri->local_uri_raw) {
+		mg_free((void *)ri->local_uri);
+	}
+	pthread_mutex_destroy(&p->conn.mutex);
+	mg_free(p->conn.buf);
+	mg_free(p);
+}
+
+
+/* Request strings point into the connection buffer, move them along
+ * when the buffer is replaced */
+static void
+ws_reactor_rebase(struct mg_ws_parked *p, const char *old_buf, int old_size)
+{
+	struct mg_request_info *ri = &p->conn.request_info;
+	const char *old_end = old_buf + old_size;
+	int i;
+
+#define WS_REBASE(ptr)                                                         \
+	if (((const char *)(ptr) >= old_buf) && ((const char *)(ptr) < old_end)) { \
+		(ptr) = p->conn.buf + ((const char *)(ptr)-old_buf);                   \
+	}
+	WS_REBASE(ri->request_method);
+	WS_REBASE(ri->request_uri);
+	WS_REBASE(ri->local_uri_raw);
+	WS_REBASE(ri->local_uri);
+	WS_REBASE(ri->http_version);
+	WS_REBASE(ri->query_string);
+	WS_REBASE(ri->remote_user);
+	for (i = 0; i < ri->num_headers; i++) {
+		WS_REBASE(ri->http_headers[i].name);
+		WS_REBASE(ri->http_headers[i].value);
+	}
+#undef WS_REBASE
+}
+
+
+/* Replace the connection buffer by one of a new size, which holds at
+ * least the queued data. Returns -1 if out of memory. */
+static int
+ws_reactor_resize(struct mg_ws_parked *p, int size)
+{
+	struct mg_connection *conn = &p->conn;
+	char *old_buf = conn->buf;
+	int old_size = conn->buf_size;
+	char *buf = (char *)mg_malloc_ctx((size_t)size, conn->phys_ctx);
+
+	if (buf == NULL) {
+		mg_cry_internal(conn,
+		                "%s",
+		                "websocket out of memory; closing connection");
+		return -1;
+	}
+	memcpy(buf, old_buf, (size_t)conn->data_len);
+	conn->buf = buf;
+	conn->buf_size = size;
+	ws_reactor_rebase(p, old_buf, old_size);
+	mg_free(old_buf);
+	return 0;
+}
+
+
+/* Caller must hold the reactor mutex */
+static void
+ws_reactor_unlink(struct mg_ws_reactor *r, struct mg_ws_parked *p)
+{
+	if (p->prev) {
+		p->prev->next = p->next;
+	} else if (r->list == p) {
+		r->list = p->next;
+	}
+	if (p->next) {
+		p->next->prev = p->prev;
+	}
+	p->prev = p->next = NULL;
+}
+
+
+/* Close an unlinked connection */
+static void
+ws_reactor_release(struct mg_ws_reactor *r, struct mg_ws_parked *p)
+{
+	epoll_ctl(r->epoll_fd, EPOLL_CTL_DEL, p->conn.client.sock, NULL);
+
+	/* Same order as a worker thread: close handler, then socket. The
+	 * connection is freed below, so the close handler must make sure
+	 * no other thread still uses it. */
+	if (p->close_handler) {
+		p->close_handler(&p->conn, p->cbdata);
+	}
+	close_connection(&p->conn);
+	ws_reactor_free(p);
+}
+
+
+static void
+ws_reactor_close(struct mg_ws_reactor *r, struct mg_ws_parked *p)
+{
+	pthread_mutex_lock(&r->mutex);
+	ws_reactor_unlink(r, p);
+	pthread_mutex_unlock(&r->mutex);
+	ws_reactor_release(r, p);
+}
+
+
+/* Read what is available and process the complete frames. The rest
+ * of an incomplete frame comes with a later EPOLLIN, the buffer grows
+ * with the received data (twice its size at most) until the frame
+ * fits. Returns -1 if the connection must be closed. */
+static int
+ws_reactor_read(struct mg_ws_parked *p, double timeout, int enable_ping_pong)
+{
+	struct mg_connection *conn = &p->conn;
+	int n, ret;
+
+	if (conn->must_close) {
+		return -1;
+	}
+	if (conn->data_len < conn->buf_size) {
+		n = pull_inner(NULL,
+		               conn,
+		               conn->buf + conn->data_len,
+		               conn->buf_size - conn->data_len,
+		               0.0);
+		if (n <= -2) {
+			return -1;
+		}
+		if (n > 0) {
+			conn->data_len += n;
+			p->ping_count = 0;
+			p->last_activity = time(NULL);
+		}
+	}
+
+	while ((ret = websocket_process_frame(conn,
+	                                      p->data_handler,
+	                                      p->cbdata,
+	                                      timeout,
+	                                      enable_ping_pong,
+	                                      &p->ping_count))
+	       > 0) {
+		if (conn->must_close) {
+			return -1;
+		}
+	}
+	if (ret < 0) {
+		return -1;
+	}
+
+	if (conn->data_len == conn->buf_size) {
+		/* The frame at the queue head does not fit yet. Its size was
+		 * checked against the limits when its header was parsed. */
+		int size = (conn->buf_size > 0x3FFFFFFF) ? 0x7FFFFFFF
+		                                          : (conn->buf_size * 2);
+		if ((conn->buf_size == 0x7FFFFFFF) || (ws_reactor_resize(p, size) < 0)) {
+			return -1;
+		}
+	} else if ((conn->buf_size > p->buf_size)
+	           && (conn->data_len <= p->buf_size)) {
+		/* The large frame is done */
+		if (ws_reactor_resize(p, p->buf_size) < 0) {
+			return -1;
+		}
+	}
+	return 0;
+}
+
+
+static void
+ws_reactor_idle(struct mg_ws_reactor *r, double timeout, int enable_ping_pong)
+{
+	/* Same as the timeout branch of read_websocket */
+	struct mg_ws_parked *closing = NULL;
+	struct mg_ws_parked *pinging = NULL;
+	struct mg_ws_parked *p;
+	time_t now = time(NULL);
+
+	/* Only the reactor thread removes connections from its list, so
+	 * the unlinked ones stay valid after the mutex is released */
+	pthread_mutex_lock(&r->mutex);
+	p = r->list;
+	while (p != NULL) {
+		struct mg_ws_parked *next = p->next;
+		if (difftime(now, p->last_activity) >= timeout) {
+			p->last_activity = now;
+			if (p->ping_count > MG_MAX_UNANSWERED_PING) {
+				DEBUG_TRACE("Too many (%i) unanswered ping from %s:%u "
+				            "- closing connection",
+				            p->ping_count,
+				            p->conn.request_info.remote_addr,
+				            p->conn.request_info.remote_port);
+				ws_reactor_unlink(r, p);
+				p->next = closing;
+				closing = p;
+			} else if (enable_ping_pong) {
+				/* Sent below, a PING can block on a full socket */
+				ws_reactor_unlink(r, p);
+				p->next = pinging;
+				pinging = p;
+			}
+		}
+		p = next;
+	}
+	pthread_mutex_unlock(&r->mutex);
+
+	while (pinging != NULL) {
+		p = pinging;
+		pinging = p->next;
+		p->next = NULL;
+		if (mg_websocket_write(&p->conn, MG_WEBSOCKET_OPCODE_PING, NULL, 0)
+		    <= 0) {
+			p->next = closing;
+			closing = p;
+		} else {
+			p->ping_count++;
+			pthread_mutex_lock(&r->mutex);
+			p->next = r->list;
+			if (r->list) {
+				r->list->prev = p;
+			}
+			r->list = p;
+			pthread_mutex_unlock(&r->mutex);
+		}
+	}
+
+	/* Close handlers run without the reactor mutex */
+	while (closing != NULL) {
+		p = closing;
+		closing = p->next;
+		ws_reactor_release(r, p);
+	}
+}
+
+
+static void *
+ws_reactor_thread(void *thread_func_param)
+{
+	struct mg_ws_reactor *r = (struct mg_ws_reactor *)thread_func_param;
+	struct mg_context *ctx = r->ctx;
+	struct epoll_event events[64];
+	double timeout = ws_reactor_timeout(ctx);
+	int timeout_ms = (int)(timeout * 1000.0);
+	int enable_ping_pong = 0;
+	time_t last_idle = time(NULL);
+	int i, n;
+
+	mg_set_thread_name("wsio");
+
+	if (ctx->dd.config[ENABLE_WEBSOCKET_PING_PONG]) {
+		enable_ping_pong =
+		    !mg_strcasecmp(ctx->dd.config[ENABLE_WEBSOCKET_PING_PONG], "yes");
+	}
+	if (timeout_ms <= 0) {
+		timeout_ms = 1000;
+	}
+
+	/* Runs until ws_reactor_stop, after all workers are joined, so no
+	 * connection can be handed over to a stopped reactor */
+	while (!r->stop) {
+		n = epoll_wait(r->epoll_fd, events, 64, timeout_ms);
+		for (i = 0; i < n; i++) {
+			struct mg_ws_parked *p =
+			    (struct mg_ws_parked *)events[i].data.ptr;
+			if (p == NULL) {
+				uint64_t value;
+				if (read(r->wakeup_fd, &value, sizeof(value)) < 0) {
+					/* Nothing to do */
+				}
+				continue;
+			}
+			if (ws_reactor_read(p, timeout, enable_ping_pong) < 0) {
+				ws_reactor_close(r, p);
+			}
+		}
+		if (difftime(time(NULL), last_idle) >= timeout) {
+			last_idle = time(NULL);
+			ws_reactor_idle(r, timeout, enable_ping_pong);
+		}
+	}
+
+	/* Server is stopping */
+	while (r->list != NULL) {
+		ws_reactor_close(r, r->list);
+	}
+	if (ctx->callbacks.exit_thread) {
+		/* Internal thread (type 2), handlers ran here */
+		ctx->callbacks.exit_thread(ctx, 2, NULL);
+	}
+	return NULL;
+}
+
+
+/* Hand a websocket connection over to a reactor, after the handshake.
+ * The ready handler gets the reactor connection, the one the data and
+ * close handlers get later. Returns 1 if the reactor owns the
+ * connection now, or 0 to keep it in the worker thread (the ready
+ * handler is not called then). */
+static int
+ws_reactor_park(struct mg_connection *conn,
+                mg_websocket_ready_handler ws_ready_handler,
+                mg_websocket_data_handler ws_data_handler,
+                mg_websocket_close_handler ws_close_handler,
+                void *cbData)
+{
+	struct mg_context *ctx = conn->phys_ctx;
+	struct mg_ws_reactor *r;
+	struct mg_ws_parked *p;
+	struct epoll_event ev;
+	int ret;
+
+	/* TLS connections keep their worker thread */
+	if ((ctx->ws_reactor_count == 0) || (conn->ssl != NULL)
+	    || (ctx->context_type != CONTEXT_SERVER)
+	    || !STOP_FLAG_IS_ZERO(&ctx->stop_flag)) {
+		return 0;
+	}
+
+	p = (struct mg_ws_parked *)mg_calloc_ctx(1, sizeof(*p), ctx);
+	if (p == NULL) {
+		return 0;
+	}
+	p->conn = *conn;
+	p->conn.buf = (char *)mg_malloc_ctx((size_t)conn->buf_size, ctx);
+	if (p->conn.buf == NULL) {
+		mg_free(p);
+		return 0;
+	}
+	if (0 != pthread_mutex_init(&p->conn.mutex, &pthread_mutex_attr)) {
+		mg_free(p->conn.buf);
+		mg_free(p);
+		return 0;
+	}
+	memcpy(p->conn.buf, conn->buf, (size_t)conn->data_len);
+
+	/* Request strings point into the worker buffer */
+	ws_reactor_rebase(p, conn->buf, conn->buf_size);
+	p->buf_size = conn->buf_size;
+	p->conn.path_info = NULL;
+	p->conn.tls_user_ptr = NULL;
+	p->conn.in_websocket_handling = 1;
+	p->conn.in_websocket_reactor = 1;
+	p->data_handler = ws_data_handler;
+	p->close_handler = ws_close_handler;
+	p->cbdata = cbData;
+	p->last_activity = time(NULL);
+
+	/* The copy owns the cleaned local URI, and the socket */
+	if (conn->request_info.local_uri != conn->request_info.local_uri_raw) {
+		conn->request_info.local_uri = conn->request_info.local_uri_raw;
+	}
+	conn->client.sock = INVALID_SOCKET;
+	conn->must_close = 1;
+
+	if (ws_ready_handler != NULL) {
+		ws_ready_handler(&p->conn, cbData);
+	}
+
+	/* Frames received with the handshake */
+	ret = 0;
+	while (ret == 0) {
+		int status = websocket_process_frame(&p->conn,
+		                                     ws_data_handler,
+		                                     cbData,
+		                                     ws_reactor_timeout(ctx),
+		                                     0,
+		                                     &p->ping_count);
+		if (status < 0) {
+			ret = -1;
+		} else if (status == 0) {
+			break;
+		}
+	}
+
+	r = &ctx->ws_reactors[(size_t)mg_atomic_inc(&ctx->ws_reactor_next)
+	                      % ctx->ws_reactor_count];
+	if ((ret < 0) || p->conn.must_close) {
+		ws_reactor_release(r, p);
+		return 1;
+	}
+
+	/* The reactor can't close it before it is in the list */
+	memset(&ev, 0, sizeof(ev));
+	ev.events = EPOLLIN | EPOLLRDHUP;
+	ev.data.ptr = p;
+	pthread_mutex_lock(&r->mutex);
+	p->next = r->list;
+	if (r->list) {
+		r->list->prev = p;
+	}
+	r->list = p;
+	if (epoll_ctl(r->epoll_fd, EPOLL_CTL_ADD, p->conn.client.sock, &ev) != 0) {
+		ws_reactor_unlink(r, p);
+		pthread_mutex_unlock(&r->mutex);
+		ws_reactor_release(r, p);
+		return 1;
+	}
+	pthread_mutex_unlock(&r->mutex);
+	return 1;
+}
+
+
+static void
+ws_reactor_start(struct mg_context *ctx)
+{
+	unsigned int i;
+	int count = atoi(ctx->dd.config[WEBSOCKET_REACTOR_THREADS]);
+
+	ctx->ws_reactor_count = 0;
+	if (count <= 0) {
+		return;
+	}
+	if (count > MAX_WEBSOCKET_REACTORS) {
+		count = MAX_WEBSOCKET_REACTORS;
+	}
+	ctx->ws_reactors = (struct mg_ws_reactor *)
+	    mg_calloc_ctx((size_t)count, sizeof(struct mg_ws_reactor), ctx);
+	if (ctx->ws_reactors == NULL) {
+		return;
+	}
+
+	for (i = 0; i < (unsigned)count; i++) {
+		struct mg_ws_reactor *r = &ctx->ws_reactors[i];
+		struct epoll_event ev;
+		r->ctx = ctx;
+		r->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+		r->wakeup_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+		memset(&ev, 0, sizeof(ev));
+		ev.events = EPOLLIN;
+		ev.data.ptr = NULL;
+		if ((r->epoll_fd < 0) || (r->wakeup_fd < 0)
+		    || (epoll_ctl(r->epoll_fd, EPOLL_CTL_ADD, r->wakeup_fd, &ev) != 0)
+		    || (pthread_mutex_init(&r->mutex, &pthread_mutex_attr) != 0)) {
+			if (r->epoll_fd >= 0) {
+				close(r->epoll_fd);
+			}
+			if (r->wakeup_fd >= 0) {
+				close(r->wakeup_fd);
+			}
+			break;
+		}
+		if (mg_start_thread_with_id(ws_reactor_thread, r, &r->thread_id)
+		    != 0) {
+			pthread_mutex_destroy(&r->mutex);
+			close(r->epoll_fd);
+			close(r->wakeup_fd);
+			break;
+		}
+		ctx->ws_reactor_count++;
+	}
+
+	if (ctx->ws_reactor_count == 0) {
+		mg_cry_ctx_internal(ctx, "%s", "Cannot start websocket reactor");
+		mg_free(ctx->ws_reactors);
+		ctx->ws_reactors = NULL;
+	}
+}
+
+
+static void
+ws_reactor_stop(struct mg_context *ctx)
+{
+	unsigned int i;
+	for (i = 0; i < ctx->ws_reactor_count; i++) {
+		struct mg_ws_reactor *r = &ctx->ws_reactors[i];
+		uint64_t value = 1;
+		r->stop = 1;
+		if (write(r->wakeup_fd, &value, sizeof(value)) < 0) {
+			/* The reactor wakes up on its timeout */
+		}
+		mg_join_thread(r->thread_id);
+		pthread_mutex_destroy(&r->mutex);
+		close(r->epoll_fd);
+		close(r->wakeup_fd);
+	}
+	mg_free(ctx->ws_reactors);
+	ctx->ws_reactors = NULL;
+	ctx->ws_reactor_count = 0;
+}
+#endif /* USE_WEBSOCKET_REACTOR */
+
+
 static void
 handle_websocket_request(struct mg_connection *conn,
                          const char *path,
@@ -14171,8 +14826,18 @@ handle_websocket_request(struct mg_connection *conn,
 		return;
 	}
 
-	/* Step 6: Call the ready handler */
+	/* Step 6: Call the ready handler, or let a reactor call it and
+	 * read, the worker thread is free again */
 	if (is_callback_resource) {
+#if defined(USE_WEBSOCKET_REACTOR)
+		if (ws_reactor_park(conn,
+		                    ws_ready_handler,
+		                    ws_data_handler,
+		                    ws_close_handler,
+		                    cbData)) {
+			return;
+		}
+#endif
 		if (ws_ready_handler != NULL) {
 			ws_ready_handler(conn, cbData);
 		}
@@ -16086,6 +16751,30 @@ is_ssl_port_used(const char *ports)
 }
 
 
+/* Duplicate a socket already bound and listening, handed over by the
+ * application with the "listening_socket" option. The application
+ * keeps and closes its own descriptor. */
+static SOCKET
+adopt_listening_socket(const char *value)
+{
+#if defined(_WIN32)
+	WSAPROTOCOL_INFOW info;
+	SOCKET sock = (SOCKET)strtoull(value, NULL, 10);
+	if (WSADuplicateSocketW(sock, GetCurrentProcessId(), &info) != 0) {
+		return INVALID_SOCKET;
+	}
+	return WSASocketW(FROM_PROTOCOL_INFO,
+	                  FROM_PROTOCOL_INFO,
+	                  FROM_PROTOCOL_INFO,
+	                  &info,
+	                  0,
+	                  0);
+#else
+	return dup((int)strtol(value, NULL, 10));
+#endif
+}
+
+
 static int
 set_ports_option(struct mg_context *phys_ctx)
 {
@@ -16141,6 +16830,22 @@ set_ports_option(struct mg_context *phys_ctx)
 			continue;
 		}
 #endif
+		/* The first port may be a socket already bound and listening
+		 * (e.g. port 0), so its port is known before the server starts
+		 * and cannot be taken by another process in between. */
+		if ((portsTotal == 1) && (phys_ctx->dd.config[LISTEN_SOCKET] != NULL)
+		    && (phys_ctx->dd.config[LISTEN_SOCKET][0] != '\0')) {
+			so.sock = adopt_listening_socket(phys_ctx->dd.config[LISTEN_SOCKET]);
+			if (so.sock == INVALID_SOCKET) {
+				mg_cry_ctx_internal(phys_ctx,
+				                    "cannot use listening socket %s",
+				                    phys_ctx->dd.config[LISTEN_SOCKET]);
+				continue;
+			}
+			len = sizeof(usa);
+			goto listening;
+		}
+
 		/* Create socket. */
 		/* For a list of protocol numbers (e.g., TCP==6) see:
 		 * https://www.iana.org/assignments/protocol-numbers/protocol-numbers.xhtml
@@ -16194,6 +16899,24 @@ set_ports_option(struct mg_context *phys_ctx)
 			    "cannot set socket option SO_REUSEADDR (entry %i)",
 			    portsTotal);
 		}
+#if defined(SO_REUSEPORT)
+		/* Several processes may listen on the same port, the kernel
+		 * balances incoming connections between them. */
+		if (phys_ctx->dd.config[LISTEN_REUSE_PORT]
+		    && !mg_strcasecmp(phys_ctx->dd.config[LISTEN_REUSE_PORT], "yes")
+		    && setsockopt(so.sock,
+		                  SOL_SOCKET,
+		                  SO_REUSEPORT,
+		                  (SOCK_OPT_TYPE)&on,
+		                  sizeof(on))
+		           != 0) {
+
+			mg_cry_ctx_internal(
+			    phys_ctx,
+			    "cannot set socket option SO_REUSEPORT (entry %i)",
+			    portsTotal);
+		}
+#endif
 #endif
 
 #if defined(USE_X_DOM_SOCKET)
@@ -16339,6 +17062,7 @@ set_ports_option(struct mg_context *phys_ctx)
 			continue;
 		}
 
+	listening:
 		if ((getsockname(so.sock, &(usa.sa), &len) != 0)
 		    || (usa.sa.sa_family != so.lsa.sa.sa_family)) {
 
@@ -18364,6 +19088,12 @@ mg_close_connection(struct mg_connection *conn)
 		if (conn->in_websocket_handling) {
 			/* Set close flag, so the server thread can exit. */
 			conn->must_close = 1;
+#if defined(USE_WEBSOCKET_REACTOR)
+			if (conn->in_websocket_reactor) {
+				/* Wake up the reactor, it reads EOF and closes */
+				shutdown(conn->client.sock, SHUT_RD);
+			}
+#endif
 			return;
 		}
 	}
@@ -20674,6 +21404,11 @@ master_thread_run(struct mg_context *ctx)
 		}
 	}
 
+#if defined(USE_WEBSOCKET_REACTOR)
+	/* Close the websocket connections held by reactors */
+	ws_reactor_stop(ctx);
+#endif
+
 #if defined(USE_LUA)
 	/* Free Lua state of lua background task */
 	if (ctx->lua_background_state) {
@@ -21840,6 +22575,11 @@ mg_start2(struct mg_init_data *init, struct mg_error_data *error)
 		}
 	}
 
+#if defined(USE_WEBSOCKET_REACTOR)
+	/* Start websocket reactor threads, if any */
+	ws_reactor_start(ctx);
+#endif
+
 	/* Start master (listening) thread */
 	mg_start_thread_with_id(master_thread, ctx, &ctx->masterthreadid);
 
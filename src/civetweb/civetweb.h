@@ -932,6 +932,25 @@ CIVETWEB_API int mg_send_file_body(struct mg_connection *conn,
                                    const char *path);
 
 
+/* Send a byte range of the file without HTTP headers.
+ * Same as mg_send_file_body, but only `len` bytes starting at `offset`
+ * are sent. On Linux the data is sent with sendfile() when possible.
+ *
+ * Parameters:
+ *   conn: Current connection information.
+ *   path: Full path to the file to send.
+ *   offset: First byte to send.
+ *   len: Number of bytes to send.
+ *
+ * Return:
+ *   < 0   Error
+ */
+CIVETWEB_API int mg_send_file_body_range(struct mg_connection *conn,
+                                         const char *path,
+                                         long long offset,
+                                         long long len);
+
+
 /* Send HTTP error reply. */
 CIVETWEB_API int mg_send_http_error(struct mg_connection *conn,
                                     int status_code,
@@ -11,6 +11,11 @@
 // 64Mb max dynamic memory allocation
 #define WEBUI_MAX_BUF (64000000)
 
+// Linux `struct ucred` (cluster bus sender credentials)
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+    #define _GNU_SOURCE
+#endif
+
 // -- Includes ------------------------
 #include "../bridge/webinix_bridge.h" // Webinix Bridge (JavaScript)
 #include "webinix.h"                  // Webinix Header
@@ -45,6 +50,13 @@
 #define MG_BUF_LEN (WEBUI_MAX_BUF)
 #include "civetweb/civetweb.h"
 
+// -- Sockets -------------------------
+#ifndef _WIN32
+    #include <arpa/inet.h>
+    #include <netinet/in.h>
+    #include <sys/un.h>
+#endif
+
 // -- Disable Non-critical warnings ---
 #ifdef _MSC_VER
     #pragma warning(push, 0)
@@ -88,7 +100,28 @@
 #define WEBUI_SHOW_FOLDER    (4)     // Show window using a Folder
 #define WEBUI_MIN_PORT       (10000) // Minimum socket port
 #define WEBUI_MAX_PORT       (65500) // Should be less than 65535
+#define WEBUI_LISTEN_BACKLOG (200)   // Default `listen_backlog`, same as civetweb
 #define WEBUI_STDOUT_BUF     (10240) // Command STDOUT output buffer size
+#define WEBUI_RUNTIME_MAX_WORKERS  (16)   // Maximum runtime workers per runtime
+#define WEBUI_RUNTIME_MAX_REQUESTS (1000) // Requests served before a runtime worker is recycled
+#define WEBUI_RUNTIME_BUF          (16384) // Runtime worker output copy buffer size
+#define WEBUI_RUNTIME_TIMEOUT      (30)   // Default runtime worker request timeout in seconds
+#define WEBUI_PRELOAD_BUF     (2048)  // Maximum `Link` preload header size
+#define WEBUI_MAX_SERVER_OPTS (16)    // Maximum civetweb options set by `webinix_set_server_option()`
+#define WEBUI_WS_REACTORS     "2"     // WebSocket reactor threads (`ws_reactor`)
+#define WEBUI_CLUSTER_BUF     (65536) // Maximum data relayed in one cluster bus message
+#define WEBUI_CLUSTER_HEADER  (8)     // Cluster message: [SIGNATURE][TYPE][CMD][0][WINDOW (4 Bytes)]
+#define WEBUI_CLUSTER_SEND    (1)     // Cluster message: Packet for all clients of a window
+#define WEBUI_CLUSTER_COOKIE  (2)     // Cluster message: New auth cookies
+#define WEBUI_CLUSTER_SYNC    (3)     // Cluster message: A new worker asks for all auth cookies
+#define WEBUI_CLUSTER_STOP    (4)     // Cluster message: Stop the bus thread (sent to itself)
+#define WEBUI_WV_SCHEME      "webinix" // In-process WebView URI scheme and script message handler (`wv_in_process`)
+#define WEBUI_WV_RECV        "__webinix_local_recv" // In-process WebView bridge receive function (`wv_in_process`)
+#define WEBUI_PATH_CACHE_SIZE (256)   // URL resolution cache slots per window
+#define WEBUI_PATH_CACHE_TTL  (2000)  // URL resolution cache entry lifetime in milliseconds
+#define WEBUI_PATH_FILE       (1)     // Resolved URL is a local file
+#define WEBUI_PATH_REDIRECT   (2)     // Resolved URL is a folder with an index file
+#define WEBUI_PATH_NOT_FOUND  (3)     // Resolved URL is not a file, nor a folder with an index file
 #define WEBUI_DEFAULT_PATH   "."     // Default root path
 #define WEBUI_DEF_TIMEOUT    (15)    // Default startup timeout in seconds
 #define WEBUI_RELOAD_TIMEOUT (1500)  // Default reload page timeout in milliseconds
@@ -106,6 +139,42 @@
 #define WEBUI_PROFILE_NAME   "Webinix" // Default browser profile name (Used only for Firefox)
 #define WEBUI_COOKIES_LEN    (32)    // Authentification cookies len
 #define WEBUI_COOKIES_BUF    (64)    // Authentification cookies buffer size
+#define WEBUI_SESSIONS_MAX   (16384) // Default most sessions (auth cookies), least recently used are evicted
+#define WEBUI_SESSION_IDLE   (86400) // Default session idle timeout in seconds
+#define WEBUI_SESSION_NONE   ((size_t)-1) // No session, end of the LRU list
+#define WEBUI_MAX_RANGES     (16)    // Maximum byte ranges served in a single HTTP response
+#define WEBUI_RANGE_BOUNDARY "webinix-byteranges" // Multipart byte ranges boundary
+#define WEBUI_HTTP_NO_CACHE   (0)    // HTTP cache: Never store (dynamic content)
+#define WEBUI_HTTP_CACHE      (1)    // HTTP cache: Public, one year
+#define WEBUI_HTTP_REVALIDATE (2)    // HTTP cache: Store, but revalidate using the ETag
+#define WEBUI_HTTP_IMMUTABLE  (3)    // HTTP cache: Public, one year, never revalidate (versioned URL)
+#define WEBUI_HTTP_CUSTOM     (4)    // HTTP cache: `Cache-Control` is in the caller's extra headers
+#define WEBUI_HTTP_UNKNOWN_LEN ((size_t)-1) // HTTP body length not known ahead (no `Content-Length`)
+#define WEBUI_BRIDGE_CONFIG_BUF (1024) // Per-window bridge configuration script buffer size
+#define WEBUI_BUNDLE_MAGIC   "WEBUIBN1" // Binary asset bundle file signature (8 bytes)
+#define WEBUI_BUNDLE_HEADER  (16)    // Binary asset bundle header size in bytes
+#define WEBUI_BUNDLE_ENTRY   (48)    // Binary asset bundle entry size in bytes
+#define WEBUI_ETAG_BUF       (24)    // Computed ETag buffer size
+#define WEBUI_MEM_MAGIC      (0x57454255494D454DULL) // Memory block header signature, xor the header address
+#define WEBUI_MEM_CORE       (1)     // Memory block owner: Webinix (`_webinix_malloc()`)
+#define WEBUI_MEM_USER       (2)     // Memory block owner: User (`webinix_malloc()`)
+#define WEBUI_MEM_BUCKETS    (16384) // Live blocks registry buckets, power of two
+#define WEBUI_MEM_SHARDS     (64)    // Live blocks registry locks, divides `WEBUI_MEM_BUCKETS`
+#define WEBUI_ARENA_SIZE     (2048)  // Event arena bytes, on top of the received packet copy
+#define WEBUI_MEM_POOL       (3)     // Memory block owner: Per-thread buffer pool (`_webinix_pool_get()`)
+#define WEBUI_POOL_MIN       (256)   // Smallest pool size class in bytes
+#define WEBUI_POOL_CLASSES   (9)     // Pool size classes, 256 B to 64 KiB
+#define WEBUI_POOL_DEPTH     (8)     // Most cached buffers per size class and thread
+#define WEBUI_POOL_TRIM      (256)   // Gets per size class between two trims
+#define WEBUI_POOL_SHARED    (32)    // Most buffers per size class in the shared pool
+#define WEBUI_MEM_OTHER      (0)     // Memory category: Anything else (windows, strings, scripts)
+#define WEBUI_MEM_PACKETS    (1)     // Memory category: Protocol buffers, multi-packet messages
+#define WEBUI_MEM_EVENTS     (2)     // Memory category: Event arenas
+#define WEBUI_MEM_COOKIES    (3)     // Memory category: Client authentication cookies
+#define WEBUI_MEM_RESPONSES  (4)     // Memory category: Event responses outside their arena
+#define WEBUI_MEM_ASSETS     (5)     // Memory category: Asset bundle indexes, path cache
+#define WEBUI_MEM_CATEGORIES (6)     // Memory categories count (`webinix_get_memory_stats()`)
+#define WEBUI_MAX_WINDOWS    (65536) // Window numbers limit, the window table grows up to it
 
 #ifdef WEBUI_TLS
 #define WEBUI_SECURE         "TLS-Encryption"
@@ -143,6 +212,26 @@ typedef pthread_mutex_t webinix_mutex_t;
 typedef pthread_cond_t webinix_condition_t;
 #endif
 
+// Thread local storage and atomics
+#ifdef _MSC_VER
+#define WEBUI_THREAD_LOCAL __declspec(thread)
+#define WEBUI_ATOMIC_CAS64(ptr, expected, desired) \
+    (InterlockedCompareExchange64((volatile LONG64*)(ptr), (LONG64)(desired), (LONG64)(expected)) == (LONG64)(expected))
+#ifdef _WIN64
+#define WEBUI_ATOMIC_ADD(ptr, value) ((size_t)InterlockedExchangeAdd64((volatile LONG64*)(ptr), (LONG64)(value)) + (size_t)(value))
+#else
+#define WEBUI_ATOMIC_ADD(ptr, value) ((size_t)InterlockedExchangeAdd((volatile LONG*)(ptr), (LONG)(value)) + (size_t)(value))
+#endif
+#define WEBUI_ATOMIC_LOAD_PTR(ptr) InterlockedCompareExchangePointer((PVOID volatile*)(ptr), NULL, NULL)
+#define WEBUI_ATOMIC_STORE_PTR(ptr, value) InterlockedExchangePointer((PVOID volatile*)(ptr), (PVOID)(value))
+#else
+#define WEBUI_THREAD_LOCAL __thread
+#define WEBUI_ATOMIC_CAS64(ptr, expected, desired) __sync_bool_compare_and_swap((ptr), (expected), (desired))
+#define WEBUI_ATOMIC_ADD(ptr, value) __sync_add_and_fetch((ptr), (value)) // Returns the new value
+#define WEBUI_ATOMIC_LOAD_PTR(ptr) __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define WEBUI_ATOMIC_STORE_PTR(ptr, value) __atomic_store_n((ptr), (value), __ATOMIC_RELEASE)
+#endif
+
 // Compiler
 #if defined(_MSC_VER)
     #define WEBUI_COMPILER "MSVC"
@@ -165,6 +254,64 @@ typedef struct _webinix_timer_t {
     struct timespec now;
 } _webinix_timer_t;
 
+// Memory block header (`_webinix_malloc()`), right before the data
+typedef struct _webinix_mem_header_t {
+    uint64_t magic; // `WEBUI_MEM_MAGIC` xor the header address, zero once freed
+    uint64_t size; // Requested size, the block has one more (zero) byte
+    struct _webinix_mem_header_t* next; // Next live block of the same registry bucket
+    uint32_t owner; // `WEBUI_MEM_CORE` or `WEBUI_MEM_USER`
+    uint32_t category; // `WEBUI_MEM_OTHER`, `WEBUI_MEM_PACKETS`...
+} _webinix_mem_header_t;
+
+// Replaced table (`_webinix_table_grow()`), freed by `_webinix_clean()`
+// as threads may still be reading it
+typedef struct _webinix_retired_t {
+    void * table;
+    struct _webinix_retired_t* next;
+} _webinix_retired_t;
+
+// Windows table as lock-free readers see it. Published in one release
+// store by `_webinix_wins_grow()`, so a table never comes with the
+// capacity of another.
+typedef struct _webinix_wins_view_t {
+    size_t capacity;
+    struct _webinix_window_t** wins;
+    bool* cookies_single_set;
+} _webinix_wins_view_t;
+
+// Clients table as lock-free readers see it (`_webinix_clients_grow()`)
+typedef struct _webinix_clients_view_t {
+    size_t capacity;
+    struct mg_connection** clients;
+    size_t* win_num;
+} _webinix_clients_view_t;
+
+// Per-thread buffer pool, one per size class
+typedef struct _webinix_pool_t {
+    void * cached[WEBUI_POOL_DEPTH];
+    size_t count;
+    size_t low; // Least cached since the last trim, never used since
+    size_t gets;
+} _webinix_pool_t;
+
+// Shared buffer pool, one per size class, where buffers released
+// by a thread come back to the thread pools that need them
+typedef struct _webinix_pool_shared_t {
+    void * cached[WEBUI_POOL_SHARED];
+    size_t count;
+    size_t low; // Least cached since the last trim
+    size_t uses;
+} _webinix_pool_shared_t;
+
+// Event arena (`_webinix_arena_new()`), one block for a received
+// packet and all allocations of its events, right after this header
+typedef struct _webinix_arena_t {
+    size_t size; // Bytes after the header
+    size_t used;
+    size_t refs; // Receiver + events, freed at zero
+    size_t padding; // Keeps the data 16 bytes aligned
+} _webinix_arena_t;
+
 // Event data
 typedef struct webinix_event_inf_t {
     // Client
@@ -176,6 +323,7 @@ typedef struct webinix_event_inf_t {
     char* response; // Event response (string)
     size_t count; // Event arguments count
     bool done;
+    _webinix_arena_t* arena; // Owner of this struct and its response, if not NULL
 } webinix_event_inf_t;
 
 // WebView
@@ -266,6 +414,35 @@ typedef struct webinix_event_inf_t {
     webkit_web_view_new_func webkit_web_view_new = NULL;
     webkit_web_view_load_uri_func webkit_web_view_load_uri = NULL;
     webkit_web_view_get_title_func webkit_web_view_get_title = NULL;
+    // WebKit In-process Symbol Addresses (`wv_in_process`, optional)
+    typedef void *(*webkit_web_context_get_default_func)(void);
+    typedef void (*webkit_web_context_register_uri_scheme_func)(void *, const char *, void (*callback)(void *, void *), void *, void (*destroy)(void *));
+    typedef const char *(*webkit_uri_scheme_request_get_uri_func)(void *);
+    typedef const char *(*webkit_web_view_get_uri_func)(void *);
+    typedef void (*webkit_uri_scheme_request_finish_func)(void *, void *, int64_t, const char *);
+    typedef void *(*webkit_web_view_get_user_content_manager_func)(void *);
+    typedef int (*webkit_user_content_manager_register_script_message_handler_func)(void *, const char *);
+    typedef void *(*webkit_javascript_result_get_js_value_func)(void *);
+    typedef void (*webkit_web_view_run_javascript_func)(void *, const char *, void *, void *, void *);
+    typedef void (*webkit_web_view_evaluate_javascript_func)(void *, const char *, ssize_t, const char *, const char *, void *, void *, void *);
+    typedef char *(*jsc_value_to_string_func)(void *);
+    typedef void *(*g_memory_input_stream_new_from_data_func)(const void *, ssize_t, void (*destroy)(void *));
+    typedef void (*g_object_unref_func)(void *);
+    typedef void (*g_free_func)(void *);
+    webkit_web_context_get_default_func webkit_web_context_get_default = NULL;
+    webkit_web_context_register_uri_scheme_func webkit_web_context_register_uri_scheme = NULL;
+    webkit_uri_scheme_request_get_uri_func webkit_uri_scheme_request_get_uri = NULL;
+    webkit_web_view_get_uri_func webkit_web_view_get_uri = NULL;
+    webkit_uri_scheme_request_finish_func webkit_uri_scheme_request_finish = NULL;
+    webkit_web_view_get_user_content_manager_func webkit_web_view_get_user_content_manager = NULL;
+    webkit_user_content_manager_register_script_message_handler_func webkit_user_content_manager_register_script_message_handler = NULL;
+    webkit_javascript_result_get_js_value_func webkit_javascript_result_get_js_value = NULL;
+    webkit_web_view_run_javascript_func webkit_web_view_run_javascript = NULL;
+    webkit_web_view_evaluate_javascript_func webkit_web_view_evaluate_javascript = NULL;
+    jsc_value_to_string_func jsc_value_to_string = NULL;
+    g_memory_input_stream_new_from_data_func g_memory_input_stream_new_from_data = NULL;
+    g_object_unref_func g_object_unref = NULL;
+    g_free_func g_free = NULL;
     
     typedef struct _webinix_wv_linux_t {
         // Linux WebView
@@ -273,6 +450,7 @@ typedef struct webinix_event_inf_t {
         void* gtk_wv;
         bool open;
         // Webinix Window
+        size_t num;
         char* url;
         bool navigate;
         bool size;
@@ -314,6 +492,73 @@ typedef struct webinix_event_inf_t {
     } _webinix_wv_macos_t;
 #endif
 
+// Asset bundle
+typedef struct _webinix_bundle_asset_t {
+    webinix_asset_t asset;
+    bool gzip_raw; // `data_gzip` is a raw deflate stream (zip entry) that needs the gzip framing
+    uint32_t gzip_crc32; // CRC-32 of the content, for the gzip trailer
+} _webinix_bundle_asset_t;
+typedef struct _webinix_bundle_t {
+    _webinix_bundle_asset_t* assets; // Sorted by path
+    size_t count;
+    char* strings; // Paths and ETags read from an archive
+    char* etags; // Computed ETags (for assets without one)
+    const void* map; // Memory-mapped bundle or archive file (or NULL)
+    size_t map_size;
+} _webinix_bundle_t;
+
+// Streaming response
+struct webinix_response_t {
+    struct _webinix_window_t* win;
+    struct mg_connection* client;
+    bool begun;
+    bool chunked; // Chunked transfer encoding (unknown length, HTTP/1.1)
+    bool ended;
+    bool failed;
+    int64_t remaining; // Body bytes left to send, `-1` if unknown
+};
+
+// Pending asynchronous file handler request
+typedef struct _webinix_file_request_t {
+    size_t id; // Request handle, `0` if the slot is free
+    size_t window;
+    bool done;
+    bool by_handle; // Handle taken using `webinix_interface_get_file_handler_request()`
+    const void* response;
+    int length;
+    webinix_condition_t condition;
+} _webinix_file_request_t;
+
+// Runtime worker (long-lived Deno, Node.js or Bun process)
+typedef struct _webinix_runtime_worker_t {
+    bool running;
+    bool busy;
+    size_t requests; // Requests served since the worker started
+    FILE* in; // Worker stdin (requests)
+    FILE* out; // Worker stdout (responses)
+    #ifdef _WIN32
+    HANDLE process;
+    #else
+    pid_t pid;
+    #endif
+} _webinix_runtime_worker_t;
+typedef struct _webinix_runtime_pool_t {
+    _webinix_runtime_worker_t workers[WEBUI_RUNTIME_MAX_WORKERS];
+    size_t count; // Number of workers to use, `0` means disabled
+} _webinix_runtime_pool_t;
+
+// URL resolution cache entry
+typedef struct _webinix_path_entry_t {
+    char* url; // `NULL` if the slot is free
+    int kind; // `WEBUI_PATH_FILE`, `WEBUI_PATH_REDIRECT` or `WEBUI_PATH_NOT_FOUND`
+    char* full_path; // Local file path
+    const char* mime_type;
+    char* redirect; // Index file URL
+    bool script; // `.js` or `.ts` file, interpreted when a runtime is set
+    size_t generation; // `path_cache_generation` when resolved
+    _webinix_timer_t timer; // Resolve time
+} _webinix_path_entry_t;
+
 // Window
 typedef struct _webinix_window_t {
     // Client
@@ -325,6 +570,11 @@ typedef struct _webinix_window_t {
     bool server_running; // Slow check
     bool connected; // Fast check
     size_t server_port;
+    #ifdef _WIN32
+    SOCKET listen_socket; // Bound by `webinix_show()`, handed over to the server thread
+    #else
+    int listen_socket;
+    #endif
     char* url;
     const char* html;
     char* server_root_path;
@@ -373,9 +623,14 @@ typedef struct _webinix_window_t {
     size_t process_id;
     const void*(*files_handler)(const char* filename, int* length);
     const void*(*files_handler_window)(size_t window, const char* filename, int* length);
-    const void* file_handler_async_response;
-    int file_handler_async_len;
-    bool file_handler_async_done;
+    bool(*files_handler_stream)(size_t window, const char* filename, webinix_response_t* response);
+    bool file_request_handles; // The files handler answers using request handles, no need to serialize
+    _webinix_bundle_t* bundle;
+    _webinix_bundle_t* archive; // Root folder archive (zip, tar)
+    _webinix_path_entry_t* path_cache; // URL resolution cache, protected by `mutex_http_handler`
+    char* preload; // User `Link` preload values (`webinix_set_preload()`)
+    char url_prefix[32]; // `/_webinix/<num>` on the shared server, empty otherwise
+    char* server_options[WEBUI_MAX_SERVER_OPTS * 2]; // Civetweb [name, value] overrides
     webinix_event_inf_t* events[WEBUI_MAX_IDS];
     size_t events_count;
     bool is_public;
@@ -383,10 +638,17 @@ typedef struct _webinix_window_t {
     char *proxy_server;
     webinix_mutex_t mutex_win_exit_now;
     bool win_exit_now;
+    webinix_condition_t condition_server; // Server thread wake up, protected by `mutex_win_exit_now`
+    bool server_notified;
+    webinix_mutex_t mutex_show_timeline; // Protects `show_timer` and `show_timeline`
+    _webinix_timer_t show_timer;
+    webinix_show_timeline_t show_timeline; // `webinix_get_show_timeline()`
+    bool show_failed; // Browser failed, the server thread should not stop the app
     // WebView
     bool allow_webview;
     bool allow_browser;
     bool update_webview;
+    bool wv_in_process; // Linux WebView talks to Webinix without the server (`wv_in_process`)
     webinix_mutex_t mutex_webview_update;
     webinix_condition_t condition_webview_update;
     #ifdef _WIN32
@@ -409,14 +671,60 @@ typedef struct _webinix_core_t {
         bool multi_client;
         bool use_cookies;
         bool asynchronous_response;
+        bool early_hints;
+        bool shared_server;
+        bool ws_reactor;
+        bool cluster;
+        bool wv_in_process;
     } config;
-    struct mg_connection* clients[WEBUI_MAX_IDS];
-    size_t clients_win_num[WEBUI_MAX_IDS];
-    bool clients_token_check[WEBUI_MAX_IDS];
-    char* cookies[WEBUI_MAX_IDS];
-    bool cookies_single_set[WEBUI_MAX_IDS];
+    // Clients table, by connection ID. Growable, protected by `mutex_client`
+    struct mg_connection** clients;
+    size_t* clients_win_num;
+    bool* clients_token_check; // Also protected by `mutex_token`
+    size_t* clients_free; // Released connection IDs, a stack
+    size_t clients_free_count;
+    size_t clients_used; // Connection IDs handed out at least once, atomic
+    size_t clients_capacity;
+    _webinix_clients_view_t* clients_view; // Lock-free readers (`_webinix_clients_snapshot()`)
+    size_t* clients_index; // Connection to ID + 1, open addressing
+    size_t* clients_session; // Session (client ID) + 1 of each connection, `0` for none
+    size_t clients_index_size; // Power of two, twice `clients_capacity`
+    char local_clients[WEBUI_MAX_IDS]; // In-process clients (`wv_in_process`), one address per window
+    // Sessions (auth cookies), by client ID. Growable, protected by `mutex_sessions`
+    char* sessions; // `WEBUI_COOKIES_BUF` bytes each, `[win number]_[cookies]`, empty when free
+    uint64_t* sessions_hash;
+    uint64_t* sessions_seen; // Last use, `_webinix_session_now()`
+    size_t* sessions_conns; // Live connections, never expired or evicted while not zero
+    size_t* sessions_prev; // LRU list, most recently used first
+    size_t* sessions_next;
+    size_t sessions_head;
+    size_t sessions_tail;
+    size_t* sessions_free; // Released client IDs, a stack
+    size_t sessions_free_count;
+    size_t sessions_used; // Client IDs handed out at least once
+    size_t sessions_capacity;
+    size_t* sessions_index; // Cookies hash to client ID + 1, open addressing
+    size_t sessions_index_size; // Power of two, twice `sessions_capacity`
+    size_t sessions_max; // `webinix_set_session_limits()`
+    size_t sessions_idle; // Seconds, `0` for no expiry
+    webinix_session_stats_t sessions_stats;
+    webinix_mutex_t mutex_sessions;
     size_t servers;
-    size_t used_ports[WEBUI_MAX_IDS];
+    struct mg_context* shared_ctx; // Shared server (`shared_server`), protected by `mutex_server_start`
+    size_t shared_port;
+    size_t shared_windows; // Windows using the shared server
+    #ifndef _WIN32
+    // Cluster bus (`cluster`), protected by `mutex_cluster`
+    int cluster_fd;
+    bool cluster_running;
+    pthread_t cluster_thread;
+    uint32_t cluster_secret; // Shared by all workers, window tokens derive from it
+    char cluster_dir[WEBUI_MAX_PATH];
+    struct sockaddr_un cluster_addr;
+    #endif
+    webinix_mutex_t mutex_cluster;
+    webinix_mutex_t mutex_ports;
+    uint8_t used_ports[65536 / 8]; // Ports of our windows, one bit per port, protected by `mutex_ports`
     size_t startup_timeout;
     size_t cb_count;
     bool app_exit_now;
@@ -427,12 +735,25 @@ typedef struct _webinix_core_t {
     uint16_t run_last_id;
     bool initialized;
     char* executable_path;
-    void * ptr_list[WEBUI_MAX_IDS * 2];
-    size_t ptr_last_pos;
-    size_t ptr_size[WEBUI_MAX_IDS * 2];
+    _webinix_mem_header_t* mem_registry[WEBUI_MEM_BUCKETS]; // Live `_webinix_malloc()` blocks
+    webinix_mutex_t mutex_mem[WEBUI_MEM_SHARDS]; // Registry locks, bucket % `WEBUI_MEM_SHARDS`
+    size_t mem_blocks; // Live `_webinix_malloc()` blocks, atomic
+    size_t mem_bytes; // Live `_webinix_malloc()` bytes, atomic
+    uint64_t mem_bytes_peak; // Atomic
+    size_t mem_live[WEBUI_MEM_CATEGORIES]; // Live bytes by category, atomic
+    uint64_t mem_peak[WEBUI_MEM_CATEGORIES]; // Atomic
+    size_t mem_limit_message; // Biggest client message (`webinix_set_memory_limits()`)
+    size_t mem_limit_total; // Most live bytes, `0` for no limit
     size_t current_browser;
-    _webinix_window_t* wins[WEBUI_MAX_IDS];
-    bool wins_reserved[WEBUI_MAX_IDS];
+    // Windows table, by window number. Growable, protected by `mutex_tables`
+    _webinix_window_t** wins;
+    bool* wins_reserved;
+    bool* cookies_single_set;
+    _webinix_wins_view_t* wins_view; // Capacity, and lock-free readers (`_webinix_wins_view()`)
+    _webinix_retired_t* retired; // Protected by `mutex_tables`
+    webinix_mutex_t mutex_tables;
+    _webinix_pool_shared_t pool_shared[WEBUI_POOL_CLASSES]; // Protected by `mutex_pool`
+    webinix_mutex_t mutex_pool;
     webinix_mutex_t mutex_server_start;
     webinix_mutex_t mutex_send;
     webinix_mutex_t mutex_receive;
@@ -444,13 +765,26 @@ typedef struct _webinix_core_t {
     webinix_mutex_t mutex_http_handler;
     webinix_mutex_t mutex_client;
     webinix_mutex_t mutex_async_response;
-    webinix_mutex_t mutex_mem;
+    webinix_mutex_t mutex_async_legacy; // One request at a time for `webinix_interface_set_response_file_handler()`
     webinix_mutex_t mutex_token;
     webinix_condition_t condition_wait;
+    _webinix_file_request_t file_requests[WEBUI_MAX_IDS]; // Protected by `mutex_async_response`
+    size_t file_requests_last_id;
+    _webinix_runtime_pool_t runtime_pools[4]; // Indexed by runtime, protected by `mutex_runtime`
+    webinix_mutex_t mutex_runtime;
+    webinix_condition_t condition_runtime;
+    char runtime_worker_path[WEBUI_MAX_PATH];
+    size_t runtime_timeout; // Seconds, `0` for no timeout (`webinix_set_runtime_timeout()`)
+    size_t path_cache_generation; // Bumped by the folder monitor, protected by `mutex_path_cache`
+    webinix_mutex_t mutex_path_cache;
     char* default_server_root_path;
+    char* default_server_options[WEBUI_MAX_SERVER_OPTS * 2]; // Civetweb [name, value] overrides, all windows
     bool ui;
     char* custom_browser_folder_path;
     #ifdef WEBUI_TLS
+    bool tls_preparing; // Self-signed certificate generation running, protected by `mutex_tls`
+    webinix_mutex_t mutex_tls;
+    webinix_condition_t condition_tls;
     char* root_cert;
     char* root_key;
     char* ssl_cert;
@@ -488,9 +822,16 @@ typedef struct _webinix_recv_arg_t {
     int event_type;
     struct mg_connection* client;
     size_t connection_id;
+    _webinix_arena_t* arena;
 }
 _webinix_recv_arg_t;
 
+typedef struct _webinix_range_t {
+    int64_t start;
+    int64_t end;
+}
+_webinix_range_t;
+
 typedef struct _webinix_cmd_async_t {
     _webinix_window_t* win;
     char* cmd;
@@ -502,7 +843,6 @@ _webinix_cmd_async_t;
 static const char* os_sep = "\\";
 static DWORD WINAPI _webinix_run_browser_task(LPVOID _arg);
 static int _webinix_system_win32(_webinix_window_t* win, char* cmd, bool show);
-static int _webinix_system_win32_out(const char* cmd, char ** output, bool show);
 static bool _webinix_socket_test_listen_win32(size_t port_num);
 static bool _webinix_get_windows_reg_value(HKEY key, LPCWSTR reg, LPCWSTR value_name, char value[WEBUI_MAX_PATH]);
 static bool _webinix_str_to_wide(const char *s, wchar_t **w);
@@ -525,6 +865,10 @@ static bool _webinix_show(_webinix_window_t* win, struct mg_connection* client,
 static bool _webinix_get_cb_index(_webinix_window_t* win, const char* element, size_t* id);
 static size_t _webinix_get_free_port(void); 
 static void _webinix_free_port(size_t port);
+static bool _webinix_port_mark(size_t port, bool used);
+static bool _webinix_port_marked(size_t port);
+static bool _webinix_listen_socket(_webinix_window_t* win);
+static void _webinix_listen_socket_close(_webinix_window_t* win);
 static char* _webinix_get_current_path(void);
 static void _webinix_send_client_ws(_webinix_window_t* win, struct mg_connection* client,
     size_t connection_id, char* packet, size_t packets_size);
@@ -554,12 +898,26 @@ static long _webinix_timer_diff(struct timespec * start, struct timespec* end);
 static void _webinix_timer_start(_webinix_timer_t* t);
 static bool _webinix_timer_is_end(_webinix_timer_t* t, size_t ms);
 static void _webinix_timer_clock_gettime(struct timespec * spec);
+static void _webinix_show_phase(_webinix_window_t* win, size_t* phase);
 static bool _webinix_set_root_folder(_webinix_window_t* win, const char* path);
-static const char* _webinix_generate_js_bridge(_webinix_window_t* win, struct mg_connection* client);
+static bool _webinix_generate_js_bridge(_webinix_window_t* win, char* buffer, size_t buffer_len);
 static void _webinix_free_mem(void * ptr);
-static bool _webinix_file_exist_mg(_webinix_window_t* win, struct mg_connection* client);
 static bool _webinix_file_exist(const char* path);
-static void _webinix_free_all_mem(void);
+static void _webinix_mem_peak(uint64_t* peak, size_t live);
+static size_t _webinix_mem_bucket(const void * ptr);
+static _webinix_mem_header_t* _webinix_mem_header(void * ptr);
+static void _webinix_mem_tag(void * ptr, uint32_t category);
+static bool _webinix_mem_allow(size_t size);
+static void * _webinix_table_grow(void * table, size_t item_size, size_t count, size_t new_count);
+static void _webinix_table_retire(void * table);
+static bool _webinix_wins_grow(size_t count);
+static bool _webinix_clients_grow(void);
+static _webinix_wins_view_t* _webinix_wins_view(void);
+static _webinix_window_t* _webinix_wins_get(size_t num);
+static size_t _webinix_clients_snapshot(const _webinix_clients_view_t** view);
+static size_t _webinix_client_hash(const struct mg_connection* client);
+static size_t _webinix_client_find(const struct mg_connection* client);
+static void _webinix_client_unindex(size_t pos);
 static bool _webinix_show_window(_webinix_window_t* win, struct mg_connection* client,
     const char* content, int type, size_t browser);
 static bool _webinix_is_empty(const char* s);
@@ -580,33 +938,79 @@ static void _webinix_mutex_destroy(webinix_mutex_t* mutex);
 static bool _webinix_mutex_is_connected(_webinix_window_t* win, int update);
 static bool _webinix_mutex_app_is_exit_now(int update);
 static bool _webinix_mutex_win_is_exit_now(_webinix_window_t* win, int update);
+static void _webinix_server_notify(_webinix_window_t* win);
+static void _webinix_server_wait(_webinix_window_t* win, _webinix_timer_t* timer, size_t ms);
 static bool _webinix_mutex_is_webview_update(_webinix_window_t* win, int update);
 static void _webinix_condition_init(webinix_condition_t* cond);
 static void _webinix_condition_wait(webinix_condition_t* cond, webinix_mutex_t* mutex);
+static void _webinix_condition_timedwait(webinix_condition_t* cond, webinix_mutex_t* mutex, size_t ms);
 static void _webinix_condition_signal(webinix_condition_t* cond);
+static void _webinix_condition_broadcast(webinix_condition_t* cond);
 static void _webinix_condition_destroy(webinix_condition_t* cond);
 static void _webinix_http_send(_webinix_window_t* win, struct mg_connection* client,
-    const char* mime_type, const char* body, size_t body_len, bool cache);
+    const char* mime_type, const char* body, size_t body_len, int cache);
 static void _webinix_http_send_file(_webinix_window_t* win, struct mg_connection* client,
-    const char* mime_type, const char* path, bool cache);
-static void _webinix_http_send_header(_webinix_window_t* win, struct mg_connection* client,
-    const char* mime_type, size_t body_len, bool cache);
+    const char* mime_type, const char* path, int cache);
+static bool _webinix_http_send_header(_webinix_window_t* win, struct mg_connection* client,
+    int status, const char* mime_type, size_t body_len, int cache, const char* extra_headers);
+static void _webinix_http_preload_links(_webinix_window_t* win, char* buffer, size_t len);
+static const char* _webinix_http_header_find(const char* headers, const char* name);
+static bool _webinix_http_cache_public(const char* value);
+static bool _webinix_file_stat(const char* path, int64_t* size, time_t* mtime);
+static bool _webinix_server_option_set(char** options, const char* name, const char* value);
+static const char* _webinix_server_option_get(char** options, const char* name);
+static void _webinix_server_options_free(char** options);
+static void _webinix_server_options_apply(const char** http_options, size_t count, char** options);
+static void _webinix_http_date(time_t t, char* buffer, size_t len);
+static int _webinix_http_parse_range(const char* header, int64_t size, _webinix_range_t* ranges, int max);
+static uint64_t _webinix_read_le(const unsigned char* p, size_t bytes);
+static const void* _webinix_map_file(const char* path, size_t* size);
+static void _webinix_unmap_file(const void* map, size_t size);
+static _webinix_bundle_t* _webinix_bundle_new(size_t count);
+static bool _webinix_bundle_index(_webinix_bundle_t* bundle);
+static void _webinix_bundle_free(_webinix_bundle_t* bundle);
+static void _webinix_bundle_set(_webinix_window_t* win, _webinix_bundle_t* bundle);
+static const _webinix_bundle_asset_t* _webinix_bundle_find(const _webinix_bundle_t* bundle, const char* path);
+static bool _webinix_bundle_serve(_webinix_window_t* win, _webinix_bundle_t* bundle,
+    struct mg_connection* client, int* status);
+static _webinix_bundle_t* _webinix_archive_load(const char* path);
+static bool _webinix_archive_load_zip(_webinix_bundle_t* bundle, const unsigned char* map, size_t size);
+static bool _webinix_archive_load_tar(_webinix_bundle_t* bundle, const unsigned char* map, size_t size);
 static void _webinix_http_send_error(struct mg_connection* client, const char* body, int status);
+static void _webinix_http_send_bridge(_webinix_window_t* win, struct mg_connection* client);
 static int _webinix_http_handler(struct mg_connection* client, void * _win);
+static int _webinix_http_prefix_handler(struct mg_connection* client, void * _win);
+static int _webinix_http_shared_handler(struct mg_connection* client, void * _win);
+static struct mg_context* _webinix_shared_server_join(_webinix_window_t* win,
+    const struct mg_callbacks* callbacks, const char** options);
+static void _webinix_shared_server_leave(_webinix_window_t* win);
+static bool _webinix_cluster_join(size_t port);
+static void _webinix_cluster_leave(void);
+static void _webinix_cluster_publish(unsigned char type, size_t window, unsigned char cmd,
+    const char* data, size_t len);
+static void _webinix_send_all_local(_webinix_window_t* win, unsigned char cmd, const char* data, size_t len);
+static void _webinix_send_all_clients(_webinix_window_t* win, unsigned char cmd, const char* data, size_t len);
+static bool _webinix_client_cookies_add(const char* win_cookies, size_t* client_id);
+static const _webinix_path_entry_t* _webinix_path_resolve(_webinix_window_t* win, const char* url);
+static void _webinix_path_cache_free(_webinix_window_t* win);
+static void _webinix_path_cache_invalidate(void);
 static int _webinix_ws_connect_handler(const struct mg_connection* client, void * _win);
 static void _webinix_ws_ready_handler(struct mg_connection* client, void * _win);
 static int _webinix_ws_data_handler(struct mg_connection* client, int opcode, char* data, size_t datasize, void * _win);
 static void _webinix_ws_close_handler(const struct mg_connection* client, void * _win);
 static void _webinix_receive(_webinix_window_t* win, struct mg_connection* client, int event_type, void * data, size_t len);
 static void _webinix_ws_process(_webinix_window_t* win, struct mg_connection* client, size_t connection_id, 
-    void* ptr, size_t len, size_t recvNum, int event_type);
+    void* ptr, size_t len, size_t recvNum, int event_type, _webinix_arena_t* arena);
 static bool _webinix_connection_save(_webinix_window_t* win, struct mg_connection* client, size_t* connection_id);
 static bool _webinix_connection_get_id(_webinix_window_t* win, struct mg_connection* client, size_t* connection_id);
+static bool _webinix_is_local_client(const struct mg_connection* client);
 static void _webinix_connection_remove(_webinix_window_t* win, struct mg_connection* client);
 static void _webinix_remove_firefox_profile_ini(const char* path, const char* profile_name);
 static bool _webinix_is_firefox_ini_profile_exist(const char* path, const char* profile_name);
 static void _webinix_send_client(_webinix_window_t* win, struct mg_connection *client, 
     uint16_t id, unsigned char cmd, const char* data, size_t len, bool token_bypass);
+static void _webinix_send_client_arena(_webinix_window_t* win, struct mg_connection *client, 
+    uint16_t id, unsigned char cmd, const char* data, size_t len, bool token_bypass, _webinix_arena_t* arena);
 static void _webinix_send_all(_webinix_window_t* win, uint16_t id, unsigned char cmd, const char* data, size_t len);
 static uint16_t _webinix_get_id(const char* data);
 static uint32_t _webinix_get_token(const char* data);
@@ -618,18 +1022,55 @@ static bool _webinix_port_is_used(size_t port_num);
 static char* _webinix_str_dup(const char* src);
 static void _webinix_bridge_api_handler(webinix_event_t* e);
 // static size_t _webinix_hash_djb2(const char* s);
-static size_t _webinix_new_event_inf(_webinix_window_t* win, webinix_event_inf_t** event_inf);
+static size_t _webinix_new_event_inf(_webinix_window_t* win, webinix_event_inf_t** event_inf, _webinix_arena_t* arena);
 static void _webinix_free_event_inf(_webinix_window_t* win, size_t event_num);
+static _webinix_arena_t* _webinix_arena_new(size_t extra);
+static void * _webinix_arena_alloc(_webinix_arena_t* arena, size_t size);
+static bool _webinix_arena_owns(_webinix_arena_t* arena, const void * ptr);
+static void _webinix_arena_release(_webinix_arena_t* arena);
+static void * _webinix_event_malloc(webinix_event_inf_t* event_inf, size_t size);
+static void _webinix_event_free_mem(webinix_event_inf_t* event_inf, void * ptr);
+static void * _webinix_pool_get(size_t size);
+static void _webinix_pool_put(void * ptr);
+static void _webinix_pool_flush(void);
+static void _webinix_pool_exchange(size_t c, _webinix_pool_t* pool, size_t keep);
+static void _webinix_http_exit_thread(const struct mg_context* ctx, int thread_type, void * thread_pointer);
 static const char* _webinix_get_cookies_full(const struct mg_connection* client);
-static void _webinix_get_cookies(const struct mg_connection* client, char* buffer);
+static void _webinix_get_cookies(_webinix_window_t* win, const struct mg_connection* client, char* buffer);
+static void _webinix_cookies_name(_webinix_window_t* win, char* buffer, size_t len);
+static const char* _webinix_http_local_uri(_webinix_window_t* win, const struct mg_request_info* ri);
 static bool _webinix_client_cookies_save(_webinix_window_t* win, const char* cookies, size_t* client_id);
 static bool _webinix_client_cookies_get_id(_webinix_window_t* win, const char* cookies, size_t* client_id);
-// static void _webinix_client_cookies_free_all(_webinix_window_t* win);
-// static void _webinix_client_cookies_free(_webinix_window_t* win, struct mg_connection* client);
+static uint64_t _webinix_session_hash(const char* cookies);
+static size_t _webinix_session_find(const char* cookies, uint64_t hash);
+static void _webinix_session_unindex(size_t pos);
+static bool _webinix_session_grow(void);
+static uint64_t _webinix_session_now(void);
+static void _webinix_session_touch(size_t id, uint64_t now);
+static void _webinix_session_remove(size_t id);
+static void _webinix_session_expire(uint64_t now);
+static size_t _webinix_session_acquire(_webinix_window_t* win, struct mg_connection* client);
+static void _webinix_session_release(size_t session);
 static size_t _webinix_client_get_id(_webinix_window_t* win, struct mg_connection* client);
 static void _webinix_generate_cookies(char* cookies, size_t length);
 static int _webinix_serve_file(_webinix_window_t* win, struct mg_connection* client, size_t client_id);
 static int _webinix_external_file_handler(_webinix_window_t* win, struct mg_connection* client, size_t client_id);
+static int _webinix_external_file_stream(_webinix_window_t* win, struct mg_connection* client);
+static _webinix_file_request_t* _webinix_file_request_new(size_t window);
+static _webinix_file_request_t* _webinix_file_request_get(size_t request);
+static void _webinix_file_request_complete(_webinix_file_request_t* req, const void* response, int length);
+static void _webinix_file_request_cancel(size_t window);
+static bool _webinix_runtime_worker_script(void);
+static bool _webinix_runtime_worker_start(_webinix_runtime_worker_t* worker, size_t runtime);
+static void _webinix_runtime_worker_stop(_webinix_runtime_worker_t* worker);
+static bool _webinix_runtime_worker_alive(_webinix_runtime_worker_t* worker);
+static bool _webinix_runtime_worker_wait(_webinix_runtime_worker_t* worker, _webinix_timer_t* timer, size_t timeout);
+static int _webinix_runtime_worker_line(_webinix_runtime_worker_t* worker, _webinix_timer_t* timer,
+    size_t timeout, char* buffer, size_t size);
+static int _webinix_runtime_worker_run(_webinix_runtime_worker_t* worker, webinix_response_t* response, const char* request);
+static bool _webinix_runtime_pool_serve(_webinix_window_t* win, struct mg_connection* client,
+    size_t runtime, const char* path, const char* query);
+static void _webinix_runtime_pool_stop_all(void);
 static int _webinix_interpret_file(_webinix_window_t* win, struct mg_connection* client, char* index, size_t client_id);
 static void _webinix_webview_update(_webinix_window_t* win);
 // WebView
@@ -656,6 +1097,7 @@ static void _webinix_wv_event_closed(void *widget, void *arg);
 static int _webinix_wv_exit_schedule(void* arg);
 static bool _webinix_wv_maximize(_webinix_wv_linux_t* webView);
 static bool _webinix_wv_minimize(_webinix_wv_linux_t* webView);
+static int _webinix_wv_local_send(_webinix_window_t* win, const char* packet, size_t len);
 static bool _webinix_load_gtk_and_webkit();
 #else
 // macOS
@@ -673,6 +1115,7 @@ static bool _webinix_wv_minimize(_webinix_wv_macos_t* webView);
 #ifdef WEBUI_TLS
 static int _webinix_tls_initialization(void * ssl_ctx, void * ptr);
 static bool _webinix_tls_generate_self_signed_cert(char* root_cert, char* root_key, char* ssl_cert, char* ssl_key);
+static void _webinix_tls_prepare(bool wait);
 static bool _webinix_check_certificate(const char* certificate_pem, const char* private_key_pem);
 #endif
 #ifdef WEBUI_LOG
@@ -711,6 +1154,10 @@ static WEBUI_THREAD_MONITOR;
 
 // -- Heap ----------------------------
 static _webinix_core_t _webinix;
+
+// Handle of the file handler request served by the current thread
+static WEBUI_THREAD_LOCAL size_t _webinix_file_request_current = 0;
+static WEBUI_THREAD_LOCAL _webinix_pool_t _webinix_pools[WEBUI_POOL_CLASSES];
 static const char* webinix_html_served = "<html><head><title>Access Denied</title><script src=\"/webinix.js\"></script><style>"
 "body{margin:0;background-repeat:no-repeat;background-attachment:fixed;background-color:#FF3CAC;background-image:linear-"
 "gradient(225deg,#FF3CAC 0%,#784BA0 45%,#2B86C5 100%);font-family:sans-serif;margin:20px;color:#fff}a{color:#fff}</style>"
@@ -724,6 +1171,67 @@ static const char* webinix_html_res_not_available = "<html><head><title>Resource
 "https://www.webinix.me\"><small>Webinix v" WEBUI_VERSION "</small></a></body></html>";
 static const char* webinix_def_icon = "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"500\" zoomAndPan=\"magnify\" viewBox=\"0 0 375 374.999991\" height=\"500\" preserveAspectRatio=\"xMidYMid meet\" version=\"1.0\"><defs><clipPath id=\"3530adfd62\"><path d=\"M 22.375 22.558594 L 352.625 22.558594 L 352.625 352.441406 L 22.375 352.441406 Z M 22.375 22.558594 \" clip-rule=\"nonzero\"/></clipPath></defs><g clip-path=\"url(#3530adfd62)\"><path fill=\"#2a6699\" d=\"M 22.375 22.558594 L 352.257812 22.558594 L 352.257812 352.441406 L 22.375 352.441406 Z M 22.375 22.558594 \" fill-opacity=\"1\" fill-rule=\"nonzero\"/></g></svg>"; static const char* webinix_def_icon_type = "image/svg+xml";
 
+// Runtime worker, reads one JSON request per line from stdin and runs
+// the script in-process. Output is sent back as `WEBUI <length>\n<data>`
+// frames, an empty frame ends the response.
+static const char* webinix_runtime_worker_js =
+"import process from \"node:process\";\n"
+"import readline from \"node:readline\";\n"
+"import util from \"node:util\";\n"
+"import { createRequire } from \"node:module\";\n"
+"import { pathToFileURL } from \"node:url\";\n"
+"const isDeno = typeof Deno !== \"undefined\";\n"
+"const encoder = new TextEncoder();\n"
+"const write = isDeno ? null : process.stdout.write.bind(process.stdout);\n"
+"function frame(data) {\n"
+"  const head = encoder.encode(\"WEBUI \" + data.length + \"\\n\");\n"
+"  if (isDeno) {\n"
+"    for (const b of [head, data]) { let n = 0; while (n < b.length) n += Deno.stdout.writeSync(b.subarray(n)); }\n"
+"  } else {\n"
+"    write(head);\n"
+"    if (data.length) write(data);\n"
+"  }\n"
+"}\n"
+"function emit(chunk) {\n"
+"  const data = chunk instanceof Uint8Array ? chunk : encoder.encode(String(chunk));\n"
+"  if (data.length) frame(data);\n"
+"  return true;\n"
+"}\n"
+"const log = (...args) => emit(util.format(...args) + \"\\n\");\n"
+"for (const m of [\"log\", \"info\", \"warn\", \"error\", \"debug\", \"trace\"]) console[m] = log;\n"
+"if (!isDeno) {\n"
+"  process.stdout.write = process.stderr.write = (chunk, encoding, cb) => {\n"
+"    emit(chunk);\n"
+"    if (typeof encoding === \"function\") encoding(); else if (typeof cb === \"function\") cb();\n"
+"    return true;\n"
+"  };\n"
+"}\n"
+"class WebinixExit extends Error {}\n"
+"process.exit = () => { throw new WebinixExit(); };\n"
+"if (isDeno) { try { Deno.exit = process.exit; } catch {} }\n"
+"const require = createRequire(import.meta.url);\n"
+"let count = 0;\n"
+"async function run(path, query) {\n"
+"  process.argv = [process.argv[0], path, query];\n"
+"  if (isDeno) { try { Object.defineProperty(Deno, \"args\", { value: [query], configurable: true }); } catch {} }\n"
+"  try {\n"
+"    // A new URL evaluates the module again, CommonJS files\n"
+"    // are cached by the file name and need to be evicted\n"
+"    if (!isDeno) delete require.cache[path];\n"
+"    await import(pathToFileURL(path).href + \"?webinix=\" + (++count));\n"
+"  } catch (e) {\n"
+"    if (!(e instanceof WebinixExit)) log(e && e.stack ? e.stack : String(e));\n"
+"  }\n"
+"}\n"
+"const rl = readline.createInterface({ input: process.stdin });\n"
+"for await (const line of rl) {\n"
+"  let req;\n"
+"  try { req = JSON.parse(line); } catch { continue; }\n"
+"  await run(req.path, req.query);\n"
+"  await new Promise((resolve) => setTimeout(resolve, 0));\n"
+"  frame(new Uint8Array(0));\n"
+"}\n";
+
 // -- Functions -----------------------
 void webinix_run_client(webinix_event_t* e, const char* script) {
 
@@ -804,6 +1312,7 @@ void webinix_set_file_handler(size_t window, const void*(*handler)(const char* f
     win->files_handler = handler;
     // And reset any previous `files_handler_window`
     win->files_handler_window = NULL;
+    win->files_handler_stream = NULL;
 }
 
 void webinix_set_file_handler_window(size_t window, const void*(*handler)(size_t window, const char* filename, int* length)) {
@@ -821,10 +1330,382 @@ void webinix_set_file_handler_window(size_t window, const void*(*handler)(size_t
 
     // Reset any previous `files_handler`
     win->files_handler = NULL;
+    win->files_handler_stream = NULL;
     // And set `files_handler_window`
     win->files_handler_window = handler;
 }
 
+void webinix_set_file_handler_stream(size_t window, bool (*handler)(size_t window, const char* filename, webinix_response_t* response)) {
+
+    if (handler == NULL)
+        return;
+
+    // Initialization
+    _webinix_init();
+
+    // Dereference
+    if (_webinix_mutex_app_is_exit_now(WEBUI_MUTEX_GET_STATUS) || _webinix.wins[window] == NULL)
+        return;
+    _webinix_window_t* win = _webinix.wins[window];
+
+    // Reset any previous `files_handler` and `files_handler_window`
+    win->files_handler = NULL;
+    win->files_handler_window = NULL;
+    // And set `files_handler_stream`
+    win->files_handler_stream = handler;
+}
+
+bool webinix_response_begin(webinix_response_t* response, int status, const char* mime_type, long long length, const char* headers) {
+
+    #ifdef WEBUI_LOG
+    printf("[User] webinix_response_begin([%d], [%lld])\n", status, length);
+    #endif
+
+    if (response == NULL || response->begun)
+        return false;
+    response->begun = true;
+
+    if (status <= 0)
+        status = 200;
+    if (_webinix_is_empty(mime_type))
+        mime_type = "application/octet-stream";
+
+    // Unknown length: chunked for HTTP/1.1 clients, otherwise
+    // the end of the body is the end of the connection
+    const struct mg_request_info* ri = mg_get_request_info(response->client);
+    response->remaining = (length < 0 ? -1 : (int64_t)length);
+    response->chunked = (length < 0 && ri->http_version != NULL && strcmp(ri->http_version, "1.1") == 0);
+
+    // Extra headers
+    size_t headers_len = (_webinix_strlen(headers) + 64);
+    char* extra_headers = (char*)_webinix_malloc(headers_len);
+    WEBUI_SN_PRINTF_DYN(extra_headers, headers_len, "%s%s",
+        (headers != NULL ? headers : ""),
+        (response->chunked ? "Transfer-Encoding: chunked\r\n" : "")
+    );
+
+    // The caller can choose the cache policy
+    int cache = (_webinix_http_header_find(headers, "Cache-Control") != NULL ?
+        WEBUI_HTTP_CUSTOM : WEBUI_HTTP_NO_CACHE);
+
+    // The auth cookies state is protected by `mutex_http_handler`,
+    // which the stream callers don't hold
+    _webinix_mutex_lock(&_webinix.mutex_http_handler);
+    if (!_webinix_http_send_header(response->win, response->client, status, mime_type,
+        (length < 0 ? WEBUI_HTTP_UNKNOWN_LEN : (size_t)length), cache, extra_headers)) {
+        response->failed = true;
+    }
+    _webinix_mutex_unlock(&_webinix.mutex_http_handler);
+
+    _webinix_free_mem((void*)extra_headers);
+    return !response->failed;
+}
+
+bool webinix_response_write(webinix_response_t* response, const void* data, size_t length) {
+
+    #ifdef WEBUI_LOG
+    printf("[User] webinix_response_write([%zu bytes])\n", length);
+    #endif
+
+    if (response == NULL || !response->begun || response->ended || response->failed)
+        return false;
+    if (data == NULL || length == 0)
+        return true;
+
+    // A known length can not be exceeded
+    if (response->remaining >= 0) {
+        if ((int64_t)length > response->remaining) {
+            response->failed = true;
+            return false;
+        }
+        response->remaining -= (int64_t)length;
+    }
+
+    // `mg_write()` blocks until the socket accepts the data, so a
+    // slow client slows down the handler (backpressure)
+    const char* ptr = (const char*)data;
+    while (length > 0) {
+        size_t chunk_len = (length > (size_t)INT_MAX ? (size_t)INT_MAX : length);
+        int ret = (response->chunked ?
+            mg_send_chunk(response->client, ptr, (unsigned int)chunk_len) :
+            mg_write(response->client, ptr, chunk_len));
+        if (ret <= 0) {
+            #ifdef WEBUI_LOG
+            printf("[User] webinix_response_write() -> Client disconnected\n");
+            #endif
+            response->failed = true;
+            return false;
+        }
+        ptr += chunk_len;
+        length -= chunk_len;
+    }
+    return true;
+}
+
+bool webinix_response_end(webinix_response_t* response) {
+
+    #ifdef WEBUI_LOG
+    printf("[User] webinix_response_end()\n");
+    #endif
+
+    if (response == NULL || !response->begun)
+        return false;
+    if (response->ended)
+        return !response->failed;
+    response->ended = true;
+
+    if (!response->failed) {
+        if (response->chunked) {
+            // Last chunk
+            if (mg_write(response->client, "0\r\n\r\n", 5) != 5)
+                response->failed = true;
+        }
+        else if (response->remaining > 0) {
+            // Shorter than announced, the client will
+            // see the connection closing early
+            response->failed = true;
+        }
+    }
+    return !response->failed;
+}
+
+bool webinix_set_asset_bundle(size_t window, const webinix_asset_t* assets, size_t count) {
+
+    #ifdef WEBUI_LOG
+    printf("[User] webinix_set_asset_bundle([%zu], [%zu])\n", window, count);
+    #endif
+
+    // Initialization
+    _webinix_init();
+
+    // Dereference
+    if (_webinix_mutex_app_is_exit_now(WEBUI_MUTEX_GET_STATUS) || _webinix.wins[window] == NULL)
+        return false;
+    _webinix_window_t* win = _webinix.wins[window];
+
+    // Remove the current bundle
+    if (assets == NULL || count < 1) {
+        _webinix_bundle_set(win, NULL);
+        return true;
+    }
+
+    // Index our own copy of the assets array
+    _webinix_bundle_t* bundle = _webinix_bundle_new(count);
+    for (size_t i = 0; i < count; i++)
+        bundle->assets[i].asset = assets[i];
+    if (!_webinix_bundle_index(bundle)) {
+        _webinix_bundle_free(bundle);
+        return false;
+    }
+
+    _webinix_bundle_set(win, bundle);
+    return true;
+}
+
+bool webinix_set_asset_bundle_file(size_t window, const char* path) {
+
+    #ifdef WEBUI_LOG
+    printf("[User] webinix_set_asset_bundle_file([%zu], [%s])\n", window, path);
+    #endif
+
+    // Initialization
+    _webinix_init();
+
+    // Dereference
+    if (_webinix_mutex_app_is_exit_now(WEBUI_MUTEX_GET_STATUS) || _webinix.wins[window] == NULL)
+        return false;
+    _webinix_window_t* win = _webinix.wins[window];
+
+    if (_webinix_is_empty(path))
+        return false;
+
+    size_t size = 0;
+    const unsigned char* map = (const unsigned char*)_webinix_map_file(path, &size);
+    if (map == NULL) {
+        #ifdef WEBUI_LOG
+        printf("[User] webinix_set_asset_bundle_file() -> Failed to map file\n");
+        #endif
+        return false;
+    }
+
+    // Bundle File Format (little-endian):
+    // [Magic 8 bytes][Count u32][Reserved u32]
+    // [Entry 48 bytes] * Count:
+    //   [Path u32][MIME u32][ETag u32][Reserved u32]
+    //   [Data u64][Data Size u64][Gzip u64][Gzip Size u64]
+    // [Strings (null-terminated)][Data]
+    // All offsets are from the start of the file, zero means none.
+
+    if (size < WEBUI_BUNDLE_HEADER || memcmp(map, WEBUI_BUNDLE_MAGIC, 8) != 0) {
+        #ifdef WEBUI_LOG
+        printf("[User] webinix_set_asset_bundle_file() -> Invalid bundle file\n");
+        #endif
+        _webinix_unmap_file(map, size);
+        return false;
+    }
+    uint32_t count = (uint32_t)_webinix_read_le(map + 8, 4);
+    if (count < 1 || count > ((size - WEBUI_BUNDLE_HEADER) / WEBUI_BUNDLE_ENTRY)) {
+        #ifdef WEBUI_LOG
+        printf("[User] webinix_set_asset_bundle_file() -> Invalid assets count\n");
+        #endif
+        _webinix_unmap_file(map, size);
+        return false;
+    }
+
+    _webinix_bundle_t* bundle = _webinix_bundle_new(count);
+    bundle->map = map;
+    bundle->map_size = size;
+    for (uint32_t i = 0; i < count; i++) {
+        const unsigned char* e = map + WEBUI_BUNDLE_HEADER + ((size_t)i * WEBUI_BUNDLE_ENTRY);
+        uint64_t v[8];
+        for (size_t f = 0; f < 8; f++) {
+            // Four u32 then four u64
+            if (f < 4)
+                v[f] = _webinix_read_le(e + (f * 4), 4);
+            else
+                v[f] = _webinix_read_le(e + 16 + ((f - 4) * 8), 8);
+        }
+        // Strings must be null-terminated inside the file
+        const char* str[3] = {NULL, NULL, NULL};
+        for (size_t f = 0; f < 3; f++) {
+            if (v[f] == 0)
+                continue;
+            if (v[f] >= size || memchr(map + v[f], 0, (size_t)(size - v[f])) == NULL) {
+                _webinix_bundle_free(bundle);
+                return false;
+            }
+            str[f] = (const char*)(map + v[f]);
+        }
+        // Data must be inside the file
+        if (v[4] > size || v[5] > (size - v[4]) || v[6] > size || v[7] > (size - v[6])) {
+            _webinix_bundle_free(bundle);
+            return false;
+        }
+        bundle->assets[i].asset.path = str[0];
+        bundle->assets[i].asset.mime_type = str[1];
+        bundle->assets[i].asset.etag = str[2];
+        bundle->assets[i].asset.data = (v[4] != 0 ? (map + v[4]) : NULL);
+        bundle->assets[i].asset.length = (size_t)v[5];
+        bundle->assets[i].asset.data_gzip = (v[6] != 0 ? (map + v[6]) : NULL);
+        bundle->assets[i].asset.length_gzip = (size_t)v[7];
+    }
+    if (!_webinix_bundle_index(bundle)) {
+        #ifdef WEBUI_LOG
+        printf("[User] webinix_set_asset_bundle_file() -> Invalid assets\n");
+        #endif
+        _webinix_bundle_free(bundle);
+        return false;
+    }
+
+    #ifdef WEBUI_LOG
+    printf("[User] webinix_set_asset_bundle_file() -> %u assets loaded\n", count);
+    #endif
+
+    _webinix_bundle_set(win, bundle);
+    return true;
+}
+
+void webinix_set_preload(size_t window, const char* assets) {
+
+    #ifdef WEBUI_LOG
+    printf("[User] webinix_set_preload([%zu], [%s])\n", window, assets);
+    #endif
+
+    // Initialization
+    _webinix_init();
+
+    // Dereference
+    if (_webinix_mutex_app_is_exit_now(WEBUI_MUTEX_GET_STATUS) || _webinix.wins[window] == NULL)
+        return;
+    _webinix_window_t* win = _webinix.wins[window];
+
+    // Clean old sets if any
+    if (win->preload != NULL) {
+        _webinix_free_mem((void*)win->preload);
+        win->preload = NULL;
+    }
+    if (_webinix_is_empty(assets))
+        return;
+
+    // Build the `Link` header values once
+    // `</app.css>; rel=preload; as=style, ...`
+    char* links = (char*)_webinix_malloc(WEBUI_PRELOAD_BUF);
+    size_t links_len = 0;
+    const char* p = assets;
+    while (*p) {
+        // Next trimmed item
+        while (*p == ' ' || *p == ',')
+            p++;
+        const char* end = p;
+        while (*end && *end != ',')
+            end++;
+        size_t item_len = (size_t)(end - p);
+        while (item_len > 0 && p[item_len - 1] == ' ')
+            item_len--;
+        if (item_len == 0)
+            break;
+
+        // The `as` type from the extension, fonts and fetches
+        // need `crossorigin` to match the later request
+        const char* ext = p + item_len;
+        while (ext > p && *(ext - 1) != '.' && *(ext - 1) != '/')
+            ext--;
+        size_t ext_len = (size_t)((p + item_len) - ext);
+        if (ext == p || *(ext - 1) != '.')
+            ext_len = 0;
+        const char* rel = "preload";
+        const char* as = "fetch";
+        bool crossorigin = true;
+        if (ext_len == 3 && strncmp(ext, "css", 3) == 0) {
+            as = "style";
+            crossorigin = false;
+        }
+        else if (ext_len == 2 && strncmp(ext, "js", 2) == 0) {
+            as = "script";
+            crossorigin = false;
+        }
+        else if (ext_len == 3 && strncmp(ext, "mjs", 3) == 0) {
+            rel = "modulepreload";
+            as = NULL;
+            crossorigin = false;
+        }
+        else if ((ext_len == 4 && strncmp(ext, "woff", 4) == 0) || (ext_len == 5 && strncmp(ext, "woff2", 5) == 0) ||
+            (ext_len == 3 && (strncmp(ext, "ttf", 3) == 0 || strncmp(ext, "otf", 3) == 0))) {
+            as = "font";
+        }
+        else if ((ext_len == 3 && (strncmp(ext, "png", 3) == 0 || strncmp(ext, "jpg", 3) == 0 ||
+            strncmp(ext, "gif", 3) == 0 || strncmp(ext, "svg", 3) == 0 || strncmp(ext, "ico", 3) == 0)) ||
+            (ext_len == 4 && (strncmp(ext, "jpeg", 4) == 0 || strncmp(ext, "webp", 4) == 0 ||
+            strncmp(ext, "avif", 4) == 0))) {
+            as = "image";
+            crossorigin = false;
+        }
+
+        int c = WEBUI_SN_PRINTF_DYN(links + links_len, WEBUI_PRELOAD_BUF - links_len,
+            "%s<%.*s>; rel=%s%s%s%s",
+            (links_len > 0 ? ", " : ""), (int)item_len, p, rel,
+            (as != NULL ? "; as=" : ""), (as != NULL ? as : ""),
+            (crossorigin ? "; crossorigin" : "")
+        );
+        if (c < 0 || (size_t)c >= (WEBUI_PRELOAD_BUF - links_len)) {
+            // Keep the assets that fit
+            #ifdef WEBUI_LOG
+            printf("[User] webinix_set_preload() -> Too many assets, list truncated\n");
+            #endif
+            links[links_len] = '\0';
+            break;
+        }
+        links_len += (size_t)c;
+        p = end;
+    }
+
+    if (links_len == 0) {
+        _webinix_free_mem((void*)links);
+        return;
+    }
+    win->preload = links;
+}
+
 bool webinix_script_client(webinix_event_t* e, const char* script, size_t timeout,
     char* buffer, size_t buffer_length) {
 
@@ -1004,7 +1885,12 @@ size_t webinix_new_window_id(size_t num) {
         return 0;
 
     // Check window ID
-    if (num < 1 || num > WEBUI_MAX_IDS)
+    if (num < 1 || num >= WEBUI_MAX_WINDOWS)
+        return 0;
+    _webinix_mutex_lock(&_webinix.mutex_tables);
+    bool grown = _webinix_wins_grow(num + 1);
+    _webinix_mutex_unlock(&_webinix.mutex_tables);
+    if (!grown)
         return 0;
 
     // Destroy the window if already exist
@@ -1013,16 +1899,25 @@ size_t webinix_new_window_id(size_t num) {
 
     // Create a new window
     _webinix_window_t* win = (_webinix_window_t* ) _webinix_malloc(sizeof(_webinix_window_t));
+    _webinix_mutex_lock(&_webinix.mutex_tables);
     _webinix.wins[num] = win;
+    _webinix_mutex_unlock(&_webinix.mutex_tables);
 
     // Mutex Initialisation
     _webinix_mutex_init(&win->mutex_win_exit_now);
+    _webinix_condition_init(&win->condition_server);
     _webinix_mutex_init(&win->mutex_webview_update);
     _webinix_condition_init(&win->condition_webview_update);
+    _webinix_mutex_init(&win->mutex_show_timeline);
 
     // Initialisation
     win->ws_block = _webinix.config.ws_block;
     win->num = num;
+    #ifdef _WIN32
+    win->listen_socket = INVALID_SOCKET;
+    #else
+    win->listen_socket = -1;
+    #endif
     win->browser_path = (char*)_webinix_malloc(WEBUI_MAX_PATH);
     win->server_root_path = (char*)_webinix_malloc(WEBUI_MAX_PATH);
     if (_webinix_is_empty(_webinix.default_server_root_path))
@@ -1043,6 +1938,12 @@ size_t webinix_new_window_id(size_t num) {
     // Auto bind JavaScript-Bridge Core API Handler
     webinix_bind(num, "__webinix_core_api__", _webinix_bridge_api_handler);
 
+    #ifdef WEBUI_TLS
+    // Generate the self-signed certificate in the background while
+    // the app sets up its window, so `webinix_show()` does not wait
+    _webinix_tls_prepare(false);
+    #endif
+
     #ifdef WEBUI_LOG
     printf("[User] webinix_new_window_id() -> New window #%zu @ 0x%p\n", num, win);
     #endif
@@ -1061,14 +1962,19 @@ size_t webinix_get_new_window_id(void) {
     if (_webinix_mutex_app_is_exit_now(WEBUI_MUTEX_GET_STATUS))
         return 0;
 
-    for (size_t i = 1; i < WEBUI_MAX_IDS; i++) {
+    _webinix_mutex_lock(&_webinix.mutex_tables);
+    for (size_t i = 1; i < WEBUI_MAX_WINDOWS; i++) {
+        if (i == _webinix_wins_view()->capacity && !_webinix_wins_grow(i + 1))
+            break;
         if (_webinix.wins[i] == NULL && !_webinix.wins_reserved[i]) {
             _webinix.wins_reserved[i] = true;
+            _webinix_mutex_unlock(&_webinix.mutex_tables);
             return i;
         }
     }
+    _webinix_mutex_unlock(&_webinix.mutex_tables);
 
-    // We should never reach here
+    // Windows table is full
     WEBUI_ASSERT("webinix_get_new_window_id() failed");
     return 0;
 }
@@ -1239,8 +2145,9 @@ void webinix_close_client(webinix_event_t* e) {
     // Send the packet to a single client
     _webinix_send_client(win, _webinix.clients[e->connection_id], 0, WEBUI_CMD_CLOSE, NULL, 0, false);
 
-    // Forced close
-    mg_close_connection(_webinix.clients[e->connection_id]);
+    // Forced close, an in-process client closes itself on `WEBUI_CMD_CLOSE`
+    if (!_webinix_is_local_client(_webinix.clients[e->connection_id]))
+        mg_close_connection(_webinix.clients[e->connection_id]);
 }
 
 void webinix_close(size_t window) {
@@ -1329,6 +2236,7 @@ void webinix_destroy(size_t window) {
     }
 
     // Free memory resources
+    _webinix_listen_socket_close(win);
     _webinix_free_mem((void*)win->url);
     _webinix_free_mem((void*)win->html);
     _webinix_free_mem((void*)win->icon);
@@ -1337,22 +2245,35 @@ void webinix_destroy(size_t window) {
     _webinix_free_mem((void*)win->profile_path);
     _webinix_free_mem((void*)win->profile_name);
     _webinix_free_mem((void*)win->server_root_path);
-
-    // Free events
-    for (size_t i = 1; i < WEBUI_MAX_IDS; i++) {
-        if (win->events[i] != NULL)
+    _webinix_free_mem((void*)win->preload);
+    _webinix_server_options_free(win->server_options);
+    _webinix_bundle_free(win->bundle);
+    _webinix_bundle_free(win->archive);
+    win->bundle = NULL;
+    win->archive = NULL;
+    _webinix_path_cache_free(win);
+
+    // Free events and bindings
+    for (size_t i = 0; i < WEBUI_MAX_IDS; i++) {
+        if (i > 0 && win->events[i] != NULL)
             _webinix_free_mem((void*)win->events[i]);
+        if (!_webinix_is_empty(win->html_elements[i]))
+            _webinix_free_mem((void*)win->html_elements[i]);
     }
 
     // Free Mutex
+    _webinix_mutex_destroy(&win->mutex_show_timeline);
     _webinix_condition_destroy(&win->condition_webview_update);
     _webinix_mutex_destroy(&win->mutex_webview_update);
+    _webinix_condition_destroy(&win->condition_server);
     _webinix_mutex_destroy(&win->mutex_win_exit_now);
 
     // Free window struct
     _webinix_free_mem((void*)_webinix.wins[window]);
+    _webinix_mutex_lock(&_webinix.mutex_tables);
     _webinix.wins[window] = NULL;
     _webinix.wins_reserved[window] = false;
+    _webinix_mutex_unlock(&_webinix.mutex_tables);
 }
 
 bool webinix_is_shown(size_t window) {
@@ -1510,8 +2431,9 @@ void webinix_delete_all_profiles(void) {
     _webinix_init();
 
     // Loop trough all windows
-    for (size_t i = 1; i < WEBUI_MAX_IDS; i++) {
-        if (_webinix.wins[i] != NULL) {
+    _webinix_wins_view_t* view = _webinix_wins_view();
+    for (size_t i = 1; i < view->capacity; i++) {
+        if (view->wins[i] != NULL) {
             webinix_delete_profile(i);
         }
     }
@@ -1976,7 +2898,7 @@ const char* webinix_get_string_at(webinix_event_t* e, size_t index) {
 
     if (event_inf->event_data[index] != NULL) {
         size_t len = event_inf->event_size[index];
-        if (len > 0 && len <= WEBUI_MAX_BUF)
+        if (len > 0 && len <= _webinix.mem_limit_message)
             return (const char*)event_inf->event_data[index];
     }
 
@@ -2169,12 +3091,11 @@ void webinix_return_int(webinix_event_t* e, long long int n) {
         return;
 
     // Free
-    if (event_inf->response != NULL)
-        _webinix_free_mem((void*)event_inf->response);
+    _webinix_event_free_mem(event_inf, event_inf->response);
 
     // Int to Str
     // 64-bit max is -9,223,372,036,854,775,808 (20 character)
-    char* buf = (char*)_webinix_malloc(20);
+    char* buf = (char*)_webinix_event_malloc(event_inf, 20);
     WEBUI_SN_PRINTF_DYN(buf, 20, "%lld", n);
 
     // Set response
@@ -2208,12 +3129,11 @@ void webinix_return_float(webinix_event_t* e, double f) {
         return;
 
     // Free
-    if (event_inf->response != NULL)
-        _webinix_free_mem((void*)event_inf->response);
+    _webinix_event_free_mem(event_inf, event_inf->response);
 
     // Float to Str
     // 64-bit max is -9,223,372,036,854,775,808 (20 character)
-    char* buf = (char*)_webinix_malloc(20);
+    char* buf = (char*)_webinix_event_malloc(event_inf, 20);
     WEBUI_SN_PRINTF_DYN(buf, 20, "%lf", f);
 
     // Set response
@@ -2250,12 +3170,11 @@ void webinix_return_string(webinix_event_t* e, const char* s) {
         return;
 
     // Free
-    if (event_inf->response != NULL)
-        _webinix_free_mem((void*)event_inf->response);
+    _webinix_event_free_mem(event_inf, event_inf->response);
 
     // Copy Str
     size_t len = _webinix_strlen(s);
-    char* buf = (char*)_webinix_malloc(len);
+    char* buf = (char*)_webinix_event_malloc(event_inf, len);
     memcpy(buf, s, len);
 
     // Set response
@@ -2309,12 +3228,11 @@ void webinix_return_bool(webinix_event_t* e, bool b) {
         return;
 
     // Free
-    if (event_inf->response != NULL)
-        _webinix_free_mem((void*)event_inf->response);
+    _webinix_event_free_mem(event_inf, event_inf->response);
 
     // Bool to Str
     int len = 1;
-    char* buf = (char*)_webinix_malloc(len);
+    char* buf = (char*)_webinix_event_malloc(event_inf, len);
     WEBUI_SN_PRINTF_DYN(buf, len, "%d", b);
 
     // Set response
@@ -2386,6 +3304,27 @@ size_t webinix_get_port(size_t window) {
     return win->server_port;
 }
 
+bool webinix_get_show_timeline(size_t window, webinix_show_timeline_t* timeline) {
+
+    #ifdef WEBUI_LOG
+    printf("[User] webinix_get_show_timeline([%zu])\n", window);
+    #endif
+
+    // Initialization
+    _webinix_init();
+
+    // Dereference
+    if (_webinix_mutex_app_is_exit_now(WEBUI_MUTEX_GET_STATUS) || _webinix.wins[window] == NULL ||
+        timeline == NULL)
+        return false;
+    _webinix_window_t* win = _webinix.wins[window];
+
+    _webinix_mutex_lock(&win->mutex_show_timeline);
+    *timeline = win->show_timeline;
+    _webinix_mutex_unlock(&win->mutex_show_timeline);
+    return (timeline->total > 0);
+}
+
 #ifdef WEBUI_TLS
 static bool _webinix_check_certificate(const char* certificate_pem, const char* private_key_pem) {
 
@@ -2507,11 +3446,18 @@ bool webinix_set_tls_certificate(const char* certificate_pem, const char* privat
             return false;
         }
 
+        // Wait for a self-signed generation in progress
+        _webinix_mutex_lock(&_webinix.mutex_tls);
+        while (_webinix.tls_preparing)
+            _webinix_condition_wait(&_webinix.condition_tls, &_webinix.mutex_tls);
+
         // Free generated self-signed
         _webinix_free_mem((void*)_webinix.root_cert);
         _webinix_free_mem((void*)_webinix.root_key);
         _webinix_free_mem((void*)_webinix.ssl_cert);
         _webinix_free_mem((void*)_webinix.ssl_key);
+        _webinix.root_cert = NULL;
+        _webinix.root_key = NULL;
 
         // Set user TLS
         char* ssl_cert = (char*)_webinix_malloc(certificate_len);
@@ -2520,6 +3466,7 @@ bool webinix_set_tls_certificate(const char* certificate_pem, const char* privat
         WEBUI_SN_PRINTF_DYN(ssl_key, private_key_len, "%s", private_key_pem);
         _webinix.ssl_cert = ssl_cert;
         _webinix.ssl_key = ssl_key;
+        _webinix_mutex_unlock(&_webinix.mutex_tls);
 
         #ifdef WEBUI_LOG
         printf("[User] webinix_set_tls_certificate() -> SSL/TLS Certificate:\n");
@@ -2564,12 +3511,28 @@ void webinix_set_config(webinix_config option, bool status) {
         case asynchronous_response:
             _webinix.config.asynchronous_response = status;
             break;
+        case early_hints:
+            _webinix.config.early_hints = status;
+            break;
+        case shared_server:
+            _webinix.config.shared_server = status;
+            break;
+        case ws_reactor:
+            _webinix.config.ws_reactor = status;
+            break;
+        case cluster:
+            _webinix.config.cluster = status;
+            break;
+        case wv_in_process:
+            _webinix.config.wv_in_process = status;
+            break;
         case ui_event_blocking:
             _webinix.config.ws_block = status;
             // Update all created windows
-            for (size_t i = 1; i < WEBUI_MAX_IDS; i++) {
-                if (_webinix.wins[i] != NULL) {
-                    _webinix.wins[i]->ws_block = status;
+            _webinix_wins_view_t* view = _webinix_wins_view();
+            for (size_t i = 1; i < view->capacity; i++) {
+                if (view->wins[i] != NULL) {
+                    view->wins[i]->ws_block = status;
                 }
             }
             break;
@@ -2645,7 +3608,8 @@ bool webinix_set_port(size_t window, size_t port) {
         return false;
     _webinix_window_t* win = _webinix.wins[window];
 
-    if (_webinix_port_is_used(port))
+    // Cluster workers share the same port
+    if (!_webinix.config.cluster && _webinix_port_is_used(port))
         return false;
 
     win->custom_server_port = port;
@@ -3202,7 +4166,7 @@ void webinix_send_raw_client(webinix_event_t* e, const char* function, const voi
 
     // Generate data
     size_t data_len = _webinix_strlen(function) + 1 + size;
-    char* buf = (char*)_webinix_malloc(data_len);
+    char* buf = (char*)_webinix_pool_get(data_len);
 
     // Add Function
     size_t p = 0;
@@ -3230,7 +4194,7 @@ void webinix_send_raw_client(webinix_event_t* e, const char* function, const voi
         0, WEBUI_CMD_SEND_RAW, (const char*)buf, data_len, false
     );
 
-    _webinix_free_mem((void*)buf);
+    _webinix_pool_put((void*)buf);
 }
 
 void webinix_send_raw(size_t window, const char* function, const void * raw, size_t size) {
@@ -3252,7 +4216,7 @@ void webinix_send_raw(size_t window, const char* function, const void * raw, siz
 
     // Generate data
     size_t data_len = _webinix_strlen(function) + 1 + size;
-    char* buf = (char*)_webinix_malloc(data_len);
+    char* buf = (char*)_webinix_pool_get(data_len);
 
     // Add Function
     size_t p = 0;
@@ -3277,7 +4241,7 @@ void webinix_send_raw(size_t window, const char* function, const void * raw, siz
 
     // Send the packet
     _webinix_send_all(win, 0, WEBUI_CMD_SEND_RAW, (const char*)buf, data_len);
-    _webinix_free_mem((void*)buf);
+    _webinix_pool_put((void*)buf);
 }
 
 char* webinix_encode(const char* str) {
@@ -3393,65 +4357,145 @@ void webinix_memcpy(void* dest, void* src, size_t count) {
     }
 }
 
-void * webinix_malloc(size_t size) {
+void webinix_get_memory_stats(webinix_memory_stats_t* stats) {
 
     #ifdef WEBUI_LOG
-    printf("[User] webinix_malloc(%zu bytes)\n", size);
+    printf("[User] webinix_get_memory_stats()\n");
     #endif
 
     // Initialization
     _webinix_init();
-    if (_webinix_mutex_app_is_exit_now(WEBUI_MUTEX_GET_STATUS))
-        return NULL;
 
-    return _webinix_malloc(size);
+    if (stats == NULL)
+        return;
+
+    // Counters move on their own, each one is read atomically
+    stats->total = (size_t)WEBUI_ATOMIC_ADD(&_webinix.mem_bytes, 0);
+    stats->total_peak = (size_t)_webinix.mem_bytes_peak;
+    stats->packets = (size_t)WEBUI_ATOMIC_ADD(&_webinix.mem_live[WEBUI_MEM_PACKETS], 0);
+    stats->packets_peak = (size_t)_webinix.mem_peak[WEBUI_MEM_PACKETS];
+    stats->events = (size_t)WEBUI_ATOMIC_ADD(&_webinix.mem_live[WEBUI_MEM_EVENTS], 0);
+    stats->events_peak = (size_t)_webinix.mem_peak[WEBUI_MEM_EVENTS];
+    stats->cookies = (size_t)WEBUI_ATOMIC_ADD(&_webinix.mem_live[WEBUI_MEM_COOKIES], 0);
+    stats->cookies_peak = (size_t)_webinix.mem_peak[WEBUI_MEM_COOKIES];
+    stats->responses = (size_t)WEBUI_ATOMIC_ADD(&_webinix.mem_live[WEBUI_MEM_RESPONSES], 0);
+    stats->responses_peak = (size_t)_webinix.mem_peak[WEBUI_MEM_RESPONSES];
+    stats->assets = (size_t)WEBUI_ATOMIC_ADD(&_webinix.mem_live[WEBUI_MEM_ASSETS], 0);
+    stats->assets_peak = (size_t)_webinix.mem_peak[WEBUI_MEM_ASSETS];
+    stats->blocks = (size_t)WEBUI_ATOMIC_ADD(&_webinix.mem_blocks, 0);
 }
 
-void webinix_exit(void) {
+void webinix_set_memory_limits(size_t message_size, size_t total_size) {
 
     #ifdef WEBUI_LOG
-    printf("[User] webinix_exit()\n");
+    printf("[User] webinix_set_memory_limits(%zu, %zu)\n", message_size, total_size);
     #endif
 
     // Initialization
     _webinix_init();
-    if (_webinix_mutex_app_is_exit_now(WEBUI_MUTEX_GET_STATUS))
-        return;
-
-    // Close all windows
-    for (size_t i = 1; i < WEBUI_MAX_IDS; i++) {
-        if (_webinix.wins[i] != NULL) {
-            if (_webinix_mutex_is_connected(_webinix.wins[i], WEBUI_MUTEX_GET_STATUS)) {
 
-                if (!_webinix.wins[i]->webView) {
+    _webinix.mem_limit_message = (message_size > 0 ? message_size : WEBUI_MAX_BUF);
+    _webinix.mem_limit_total = total_size;
+}
 
-                    // Web browser
+void webinix_get_session_stats(webinix_session_stats_t* stats) {
 
-                    // Packet Protocol Format:
-                    // [...]
-                    // [CMD]
+    #ifdef WEBUI_LOG
+    printf("[User] webinix_get_session_stats()\n");
+    #endif
 
-                    // Send the packet
-                    _webinix_send_all(
-                        _webinix.wins[i], 0, WEBUI_CMD_CLOSE, NULL, 0
-                    );
-                }
-                else {
+    // Initialization
+    _webinix_init();
 
-                    // WebView
+    if (stats == NULL)
+        return;
+    _webinix_mutex_lock(&_webinix.mutex_sessions);
+    _webinix_session_expire(_webinix_session_now());
+    *stats = _webinix.sessions_stats;
+    _webinix_mutex_unlock(&_webinix.mutex_sessions);
+}
 
-                    // Stop WebView thread if any
-                    if (_webinix.wins[i]->webView) {
-                        _webinix.wins[i]->webView->stop = true;
-                        _webinix_webview_update(_webinix.wins[i]);
-                    }        
-                }
-            }
-        }
-    }
+void webinix_set_session_limits(size_t max_sessions, size_t idle_timeout) {
 
-    // Stop all threads
-    _webinix_mutex_app_is_exit_now(WEBUI_MUTEX_SET_TRUE);
+    #ifdef WEBUI_LOG
+    printf("[User] webinix_set_session_limits(%zu, %zu)\n", max_sessions, idle_timeout);
+    #endif
+
+    // Initialization
+    _webinix_init();
+
+    _webinix_mutex_lock(&_webinix.mutex_sessions);
+    _webinix.sessions_max = (max_sessions > 0 ? max_sessions : WEBUI_SESSIONS_MAX);
+    _webinix.sessions_idle = idle_timeout;
+    _webinix_mutex_unlock(&_webinix.mutex_sessions);
+}
+
+void * webinix_malloc(size_t size) {
+
+    #ifdef WEBUI_LOG
+    printf("[User] webinix_malloc(%zu bytes)\n", size);
+    #endif
+
+    // Initialization
+    _webinix_init();
+    if (_webinix_mutex_app_is_exit_now(WEBUI_MUTEX_GET_STATUS))
+        return NULL;
+
+    void* ptr = _webinix_malloc(size);
+    _webinix_mem_header_t* header = _webinix_mem_header(ptr);
+    if (header != NULL)
+        header->owner = WEBUI_MEM_USER;
+    return ptr;
+}
+
+void webinix_exit(void) {
+
+    #ifdef WEBUI_LOG
+    printf("[User] webinix_exit()\n");
+    #endif
+
+    // Initialization
+    _webinix_init();
+    if (_webinix_mutex_app_is_exit_now(WEBUI_MUTEX_GET_STATUS))
+        return;
+
+    // Close all windows
+    _webinix_wins_view_t* view = _webinix_wins_view();
+    for (size_t i = 1; i < view->capacity; i++) {
+        if (view->wins[i] != NULL) {
+            if (_webinix_mutex_is_connected(view->wins[i], WEBUI_MUTEX_GET_STATUS)) {
+
+                if (!view->wins[i]->webView) {
+
+                    // Web browser
+
+                    // Packet Protocol Format:
+                    // [...]
+                    // [CMD]
+
+                    // Send the packet
+                    _webinix_send_all(
+                        view->wins[i], 0, WEBUI_CMD_CLOSE, NULL, 0
+                    );
+                }
+                else {
+
+                    // WebView
+
+                    // Stop WebView thread if any
+                    if (view->wins[i]->webView) {
+                        view->wins[i]->webView->stop = true;
+                        _webinix_webview_update(view->wins[i]);
+                    }        
+                }
+            }
+        }
+    }
+
+    // Stop all threads
+    _webinix_mutex_app_is_exit_now(WEBUI_MUTEX_SET_TRUE);
+    _webinix_file_request_cancel(0);
+    _webinix_cluster_leave();
 
     // Let's give other threads more time to
     // safely exit and finish cleaning up.
@@ -3620,11 +4664,12 @@ void webinix_wait(void) {
             // Linux WebView Clean
 
             // Close all GTK windows if any
-            for (size_t i = 1; i < WEBUI_MAX_IDS; i++) {
-                if (_webinix.wins[i] != NULL) {
-                    if (_webinix.wins[i]->webView) {
-                        _webinix.wins[i]->webView->stop = true;
-                        _webinix_webview_update(_webinix.wins[i]);
+            _webinix_wins_view_t* view = _webinix_wins_view();
+            for (size_t i = 1; i < view->capacity; i++) {
+                if (view->wins[i] != NULL) {
+                    if (view->wins[i]->webView) {
+                        view->wins[i]->webView->stop = true;
+                        _webinix_webview_update(view->wins[i]);
                     }
                 }
                 // Process drawing events if any
@@ -3696,6 +4741,47 @@ void webinix_set_runtime(size_t window, size_t runtime) {
         win->runtime = runtime;
 }
 
+void webinix_set_runtime_workers(size_t runtime, size_t count) {
+
+    #ifdef WEBUI_LOG
+    printf("[User] webinix_set_runtime_workers([%zu], [%zu])\n", runtime, count);
+    #endif
+
+    // Initialization
+    _webinix_init();
+
+    if (runtime != Deno && runtime != NodeJS && runtime != Bun)
+        return;
+    if (count > WEBUI_RUNTIME_MAX_WORKERS)
+        count = WEBUI_RUNTIME_MAX_WORKERS;
+
+    _webinix_mutex_lock(&_webinix.mutex_runtime);
+    _webinix_runtime_pool_t* pool = &_webinix.runtime_pools[runtime];
+    pool->count = count;
+    // Stop idle workers above the new count, busy
+    // ones are stopped when they finish
+    for (size_t i = count; i < WEBUI_RUNTIME_MAX_WORKERS; i++) {
+        if (!pool->workers[i].busy)
+            _webinix_runtime_worker_stop(&pool->workers[i]);
+    }
+    _webinix_condition_broadcast(&_webinix.condition_runtime);
+    _webinix_mutex_unlock(&_webinix.mutex_runtime);
+}
+
+void webinix_set_runtime_timeout(size_t second) {
+
+    #ifdef WEBUI_LOG
+    printf("[User] webinix_set_runtime_timeout([%zu])\n", second);
+    #endif
+
+    // Initialization
+    _webinix_init();
+
+    _webinix_mutex_lock(&_webinix.mutex_runtime);
+    _webinix.runtime_timeout = second;
+    _webinix_mutex_unlock(&_webinix.mutex_runtime);
+}
+
 void webinix_set_browser_folder(const char* path) {
 
     #ifdef WEBUI_LOG
@@ -3741,6 +4827,24 @@ bool webinix_set_root_folder(size_t window, const char* path) {
     }
     #endif
     
+    // Root folder archive (zip, tar)
+    if (!win->server_running &&
+        !_webinix_is_empty(path) &&
+        (_webinix_strlen(path) <= WEBUI_MAX_PATH) &&
+        !_webinix_folder_exist(path) &&
+        _webinix_file_exist(path)) {
+        _webinix_bundle_t* archive = _webinix_archive_load(path);
+        if (archive != NULL) {
+            #ifdef WEBUI_LOG
+            printf("[User] webinix_set_root_folder() -> Archive loaded\n");
+            #endif
+            _webinix_bundle_free(win->archive);
+            win->archive = archive;
+            WEBUI_SN_PRINTF_DYN(win->server_root_path, WEBUI_MAX_PATH, "%s", path);
+            return true;
+        }
+    }
+
     if (win->server_running || 
         _webinix_is_empty(path) || 
         (_webinix_strlen(path) > WEBUI_MAX_PATH) ||
@@ -3756,6 +4860,8 @@ bool webinix_set_root_folder(size_t window, const char* path) {
     #ifdef WEBUI_LOG
     printf("[User] webinix_set_root_folder() -> Success\n");
     #endif
+    _webinix_bundle_free(win->archive);
+    win->archive = NULL;
     WEBUI_SN_PRINTF_DYN(win->server_root_path, WEBUI_MAX_PATH, "%s", path);
     return true;
 }
@@ -3787,9 +4893,10 @@ bool webinix_set_default_root_folder(const char* path) {
 
     // Update all windows. This will works only
     // for non-running windows.
-    for (size_t i = 1; i < WEBUI_MAX_IDS; i++) {
-        if (_webinix.wins[i] != NULL) {
-            WEBUI_SN_PRINTF_DYN(_webinix.wins[i]->server_root_path, WEBUI_MAX_PATH, 
+    _webinix_wins_view_t* view = _webinix_wins_view();
+    for (size_t i = 1; i < view->capacity; i++) {
+        if (view->wins[i] != NULL) {
+            WEBUI_SN_PRINTF_DYN(view->wins[i]->server_root_path, WEBUI_MAX_PATH, 
                 "%s", _webinix.default_server_root_path);
         }
     }
@@ -3797,6 +4904,43 @@ bool webinix_set_default_root_folder(const char* path) {
     return true;
 }
 
+bool webinix_set_server_option(size_t window, const char* name, const char* value) {
+
+    #ifdef WEBUI_LOG
+    printf("[User] webinix_set_server_option([%zu], [%s], [%s])\n", window, name, value);
+    #endif
+
+    // Initialization
+    _webinix_init();
+
+    // Dereference
+    if (_webinix_mutex_app_is_exit_now(WEBUI_MUTEX_GET_STATUS) || _webinix.wins[window] == NULL)
+        return false;
+    _webinix_window_t* win = _webinix.wins[window];
+
+    _webinix_mutex_lock(&_webinix.mutex_server_start);
+    bool status = _webinix_server_option_set(win->server_options, name, value);
+    _webinix_mutex_unlock(&_webinix.mutex_server_start);
+    return status;
+}
+
+bool webinix_set_default_server_option(const char* name, const char* value) {
+
+    #ifdef WEBUI_LOG
+    printf("[User] webinix_set_default_server_option([%s], [%s])\n", name, value);
+    #endif
+
+    // Initialization
+    _webinix_init();
+    if (_webinix_mutex_app_is_exit_now(WEBUI_MUTEX_GET_STATUS))
+        return false;
+
+    _webinix_mutex_lock(&_webinix.mutex_server_start);
+    bool status = _webinix_server_option_set(_webinix.default_server_options, name, value);
+    _webinix_mutex_unlock(&_webinix.mutex_server_start);
+    return status;
+}
+
 // -- Interface's Functions ----------------
 static void _webinix_interface_bind_handler_all(webinix_event_t* e) {
 
@@ -4038,12 +5182,11 @@ void webinix_interface_set_response(size_t window, size_t event_number, const ch
         return;
 
     // Free
-    if (event_inf->response != NULL)
-        _webinix_free_mem((void*)event_inf->response);
+    _webinix_event_free_mem(event_inf, event_inf->response);
 
     // Set the response
     size_t len = _webinix_strlen(response);
-    event_inf->response = (char*)_webinix_malloc(len);
+    event_inf->response = (char*)_webinix_event_malloc(event_inf, len);
     WEBUI_STR_COPY_DYN(event_inf->response, len, response);
 
     // Async response
@@ -4074,16 +5217,57 @@ void webinix_interface_set_response_file_handler(size_t window, const void* resp
         return;
     _webinix_window_t* win = _webinix.wins[window];
 
-    // Set the response
-    win->file_handler_async_response = response;
-    win->file_handler_async_len = length;
+    // Answer the pending request of this window that has no handle,
+    // requests without a handle are served one at a time
+    _webinix_mutex_lock(&_webinix.mutex_async_response);
+    for (size_t i = 0; i < WEBUI_MAX_IDS; i++) {
+        _webinix_file_request_t* req = &_webinix.file_requests[i];
+        if (req->id != 0 && !req->done && !req->by_handle && req->window == win->num) {
+            _webinix_file_request_complete(req, response, length);
+            break;
+        }
+    }
+    _webinix_mutex_unlock(&_webinix.mutex_async_response);
+}
 
-    // Async response
-    if (_webinix.config.asynchronous_response) {
-        _webinix_mutex_lock(&_webinix.mutex_async_response);
-        win->file_handler_async_done = true;
-        _webinix_mutex_unlock(&_webinix.mutex_async_response);
+size_t webinix_interface_get_file_handler_request(void) {
+
+    #ifdef WEBUI_LOG
+    printf("[User] webinix_interface_get_file_handler_request()\n");
+    printf("[User] webinix_interface_get_file_handler_request() -> Request #%zu\n", _webinix_file_request_current);
+    #endif
+
+    // This request, and the next ones of its window, are
+    // answered by handle and need no serialization
+    _webinix_mutex_lock(&_webinix.mutex_async_response);
+    _webinix_file_request_t* req = _webinix_file_request_get(_webinix_file_request_current);
+    if (req != NULL) {
+        req->by_handle = true;
+        _webinix_window_t* win = _webinix_wins_get(req->window);
+        if (win != NULL)
+            win->file_request_handles = true;
     }
+    _webinix_mutex_unlock(&_webinix.mutex_async_response);
+
+    return _webinix_file_request_current;
+}
+
+void webinix_interface_set_response_file_handler_request(size_t request, const void* response, int length) {
+
+    #ifdef WEBUI_LOG
+    printf("[User] webinix_interface_set_response_file_handler_request()\n");
+    printf("[User] webinix_interface_set_response_file_handler_request() -> Request #%zu\n", request);
+    printf("[User] webinix_interface_set_response_file_handler_request() -> Response %d bytes\n", length);
+    #endif
+
+    // Initialization
+    _webinix_init();
+
+    _webinix_mutex_lock(&_webinix.mutex_async_response);
+    _webinix_file_request_t* req = _webinix_file_request_get(request);
+    if (req != NULL && !req->done)
+        _webinix_file_request_complete(req, response, length);
+    _webinix_mutex_unlock(&_webinix.mutex_async_response);
 }
 
 bool webinix_interface_is_app_running(void) {
@@ -4315,59 +5499,36 @@ void* webinix_interface_get_context(size_t window, size_t event_number) {
 }
 
 // -- Core's Functions ----------------
-static bool _webinix_ptr_exist(void * ptr) {
-
-    #ifdef WEBUI_LOG_VERBOSE
-    printf("[Core]\t\t_webinix_ptr_exist()\n");
-    #endif
+static void _webinix_mem_peak(uint64_t* peak, size_t live) {
 
-    if (ptr == NULL)
-        return false;
+    // Raise a peak counter to `live`, lock-free
+    uint64_t current = *peak;
+    while ((uint64_t)live > current && !WEBUI_ATOMIC_CAS64(peak, current, (uint64_t)live))
+        current = *peak;
+}
 
-    for (size_t i = 0; i < _webinix.ptr_last_pos; i++) {
-        if (_webinix.ptr_list[i] == ptr)
-            return true;
-    }
+static size_t _webinix_mem_bucket(const void * ptr) {
 
-    return false;
+    // Registry bucket of a data pointer (Fibonacci hashing)
+    uint64_t h = ((uint64_t)(uintptr_t)ptr >> 4) * 0x9E3779B97F4A7C15ULL;
+    return (size_t)(h >> 32) & (WEBUI_MEM_BUCKETS - 1);
 }
 
-static void _webinix_ptr_add(void * ptr, size_t size) {
+static _webinix_mem_header_t* _webinix_mem_header(void * ptr) {
 
-    #ifdef WEBUI_LOG_VERBOSE
-    printf("[Core]\t\t_webinix_ptr_add(0x%p)\n", ptr);
-    #endif
+    // The header of a live `_webinix_malloc()` block, or `NULL` once
+    // freed. O(1), no lock. Reads before `ptr`, so only for pointers
+    // known to come from `_webinix_malloc()`, anything else goes
+    // through the registry (`_webinix_free_mem()`).
 
     if (ptr == NULL)
-        return;
+        return NULL;
 
-    // Search for first empty slot & save pointer
-    if (!_webinix_ptr_exist(ptr)) {
-        size_t i = 0;
-        for (; i < _webinix.ptr_last_pos; i++) {
-            if (_webinix.ptr_list[i] == NULL) {
-                // Pointer found
-                break;
-            }
-        }
-        if (i == _webinix.ptr_last_pos) {
-            // Pointer not found
-            i = _webinix.ptr_last_pos++;
-            if (_webinix.ptr_last_pos >= (WEBUI_MAX_IDS * 2)) {
-                _webinix.ptr_last_pos = ((WEBUI_MAX_IDS * 2) - 1);
-                #ifdef WEBUI_LOG
-                printf("[Core]\t\t_webinix_ptr_add(0x%p) -> ERROR: Maximum pointer capacity reached.\n",
-                ptr);
-                #endif
-            }
-        }
-        // Add pointer
-        _webinix.ptr_list[i] = ptr;
-        _webinix.ptr_size[i] = size;
-        #ifdef WEBUI_LOG_VERBOSE
-        printf("[Core]\t\t_webinix_ptr_add(0x%p) -> Pointer #%zu saved (%zu + 1 bytes)\n", ptr, i, size);
-        #endif        
-    }
+    _webinix_mem_header_t* header = ((_webinix_mem_header_t*)ptr) - 1;
+    if (header->magic != (WEBUI_MEM_MAGIC ^ (uint64_t)(uintptr_t)header))
+        return NULL;
+
+    return header;
 }
 
 static void _webinix_free_mem(void * ptr) {
@@ -4379,62 +5540,37 @@ static void _webinix_free_mem(void * ptr) {
     if (ptr == NULL)
         return;
 
-    _webinix_mutex_lock(&_webinix.mutex_mem);
-
-    // Search for pointer & free
-    for (size_t i = 0; i < _webinix.ptr_last_pos; i++) {
-        if (_webinix.ptr_list[i] == ptr) {
-            #ifdef WEBUI_LOG_VERBOSE
-            printf("[Core]\t\t_webinix_free_mem(0x%p) -> Pointer #%zu freed (%zu + 1 bytes)\n",
-            ptr, i, _webinix.ptr_size[i]);
-            #endif
-            free(ptr);
-            _webinix.ptr_size[i] = 0;
-            _webinix.ptr_list[i] = NULL;
-        }
+    // Unlink the block from the registry, a pointer that is not there
+    // (foreign, already freed) is never dereferenced. Only one of
+    // concurrent frees of the same block finds it.
+    size_t bucket = _webinix_mem_bucket(ptr);
+    webinix_mutex_t* lock = &_webinix.mutex_mem[bucket % WEBUI_MEM_SHARDS];
+    _webinix_mutex_lock(lock);
+    _webinix_mem_header_t** link = &_webinix.mem_registry[bucket];
+    while (*link != NULL && (void*)((*link) + 1) != ptr)
+        link = &(*link)->next;
+    _webinix_mem_header_t* header = *link;
+    if (header != NULL) {
+        *link = header->next;
+        header->magic = 0;
     }
+    _webinix_mutex_unlock(lock);
 
-    // Search (backward) for first empty slot
-    for (int i = _webinix.ptr_last_pos; i >= 0;i--) {
-        if (_webinix.ptr_list[i] == NULL) {
-            _webinix.ptr_last_pos = i;
-            break;
-        }
+    if (header == NULL) {
+        #ifdef WEBUI_LOG_VERBOSE
+        printf("[Core]\t\t_webinix_free_mem(0x%p) -> Not a Webinix block, ignored\n", ptr);
+        #endif
+        return;
     }
 
-    _webinix_mutex_unlock(&_webinix.mutex_mem);
-}
-
-static void _webinix_free_all_mem(void) {
-
-    #ifdef WEBUI_LOG
-    printf("[Core]\t\t_webinix_free_all_mem()\n");
+    #ifdef WEBUI_LOG_VERBOSE
+    printf("[Core]\t\t_webinix_free_mem(0x%p) -> Freed (%zu + 1 bytes)\n", ptr, (size_t)header->size);
     #endif
 
-    _webinix_mutex_lock(&_webinix.mutex_mem);    
-
-    // Makes sure we run this once
-    static bool freed = false;
-    if (freed)
-        return;
-    freed = true;
-
-    // Free all pointers in the list
-    void * ptr = NULL;
-    for (size_t i = 0; i < _webinix.ptr_last_pos; i++) {
-        ptr = _webinix.ptr_list[i];
-        if (ptr != NULL) {
-            #ifdef WEBUI_LOG
-            printf("[Core]\t\t_webinix_free_all_mem() -> Pointer #%zu freed (%zu + 1 bytes) 0x%p\n",
-            i, _webinix.ptr_size[i], ptr);
-            #endif
-            free(ptr);
-            _webinix.ptr_size[i] = 0;
-            _webinix.ptr_list[i] = NULL;
-        }
-    }
-
-    _webinix_mutex_unlock(&_webinix.mutex_mem);
+    WEBUI_ATOMIC_ADD(&_webinix.mem_blocks, (size_t)-1);
+    WEBUI_ATOMIC_ADD(&_webinix.mem_bytes, (size_t)0 - (size_t)header->size);
+    WEBUI_ATOMIC_ADD(&_webinix.mem_live[header->category], (size_t)0 - (size_t)header->size);
+    free(header);
 }
 
 static void _webinix_panic(char* msg) {
@@ -4453,27 +5589,151 @@ static void * _webinix_malloc(size_t size) {
     printf("[Core]\t\t_webinix_malloc([%zu])\n", size);
     #endif
 
-    _webinix_mutex_lock(&_webinix.mutex_mem);
-
-    // Dynamic allocation + null terminator
-    void* mem = NULL;
-    mem = malloc(size + 1);
+    // [Header][Data][Null terminator]
+    if (size > (SIZE_MAX - sizeof(_webinix_mem_header_t) - 1)) {
+        WEBUI_ASSERT("malloc() size overflow");
+        return NULL;
+    }
+    _webinix_mem_header_t* header = (_webinix_mem_header_t*)calloc(1, sizeof(_webinix_mem_header_t) + size + 1);
 
     // Check
-    if (mem == NULL) {
+    if (header == NULL) {
         WEBUI_ASSERT("malloc() failed");
         return NULL;
     }
 
-    // Ini memory block
-    memset(mem, 0, (size + 1));
+    header->size = size;
+    header->owner = WEBUI_MEM_CORE;
+    header->category = WEBUI_MEM_OTHER;
+    header->magic = (WEBUI_MEM_MAGIC ^ (uint64_t)(uintptr_t)header);
+
+    // Register
+    size_t bucket = _webinix_mem_bucket(header + 1);
+    webinix_mutex_t* lock = &_webinix.mutex_mem[bucket % WEBUI_MEM_SHARDS];
+    _webinix_mutex_lock(lock);
+    header->next = _webinix.mem_registry[bucket];
+    _webinix.mem_registry[bucket] = header;
+    _webinix_mutex_unlock(lock);
+
+    WEBUI_ATOMIC_ADD(&_webinix.mem_blocks, 1);
+    _webinix_mem_peak(&_webinix.mem_bytes_peak, WEBUI_ATOMIC_ADD(&_webinix.mem_bytes, size));
+    _webinix_mem_peak(&_webinix.mem_peak[WEBUI_MEM_OTHER], WEBUI_ATOMIC_ADD(&_webinix.mem_live[WEBUI_MEM_OTHER], size));
+
+    return (void*)(header + 1);
+}
+
+static void _webinix_mem_tag(void * ptr, uint32_t category) {
+
+    // Move a `_webinix_malloc()` block to another memory category,
+    // all blocks start in `WEBUI_MEM_OTHER`
+    _webinix_mem_header_t* header = _webinix_mem_header(ptr);
+    if (header == NULL || header->category == category || category >= WEBUI_MEM_CATEGORIES)
+        return;
+    size_t size = (size_t)header->size;
+    WEBUI_ATOMIC_ADD(&_webinix.mem_live[header->category], (size_t)0 - size);
+    _webinix_mem_peak(&_webinix.mem_peak[category], WEBUI_ATOMIC_ADD(&_webinix.mem_live[category], size));
+    header->category = category;
+}
+
+static void * _webinix_table_grow(void * table, size_t item_size, size_t count, size_t new_count) {
+
+    // A zeroed table of `new_count` items, starting with the `count`
+    // items of `table`. The caller retires the old table once the
+    // new one is published (`_webinix_table_retire()`).
+    if (new_count > (SIZE_MAX / item_size))
+        return NULL;
+    void * grown = _webinix_malloc(item_size * new_count);
+    if (grown != NULL && table != NULL && count > 0)
+        memcpy(grown, table, item_size * count);
+    return grown;
+}
+
+static void _webinix_table_retire(void * table) {
+
+    // Lock-free readers may still hold a replaced table, it's freed
+    // by `_webinix_clean()`. Tables double, so this is less than the
+    // live table. Caller must hold `mutex_tables`.
+    if (table == NULL)
+        return;
+    _webinix_retired_t* retired = (_webinix_retired_t*)_webinix_malloc(sizeof(_webinix_retired_t));
+    if (retired == NULL)
+        return;
+    retired->table = table;
+    retired->next = _webinix.retired;
+    _webinix.retired = retired;
+}
+
+static bool _webinix_wins_grow(size_t count) {
+
+    // Grow the windows table to at least `count` windows.
+    // Caller must hold `mutex_tables`.
+    size_t old_capacity = (_webinix.wins_view != NULL ? _webinix.wins_view->capacity : 0);
+    if (count <= old_capacity)
+        return true;
+    if (count > WEBUI_MAX_WINDOWS)
+        return false;
+    size_t capacity = (old_capacity > 0 ? old_capacity : WEBUI_MAX_IDS);
+    while (capacity < count)
+        capacity *= 2;
+    if (capacity > WEBUI_MAX_WINDOWS)
+        capacity = WEBUI_MAX_WINDOWS;
+
+    _webinix_window_t** wins = (_webinix_window_t**)_webinix_table_grow(
+        _webinix.wins, sizeof(_webinix_window_t*), old_capacity, capacity);
+    bool* wins_reserved = (bool*)_webinix_table_grow(
+        _webinix.wins_reserved, sizeof(bool), old_capacity, capacity);
+    bool* cookies_single_set = (bool*)_webinix_table_grow(
+        _webinix.cookies_single_set, sizeof(bool), old_capacity, capacity);
+    _webinix_wins_view_t* view = (_webinix_wins_view_t*)_webinix_malloc(sizeof(_webinix_wins_view_t));
+    if (wins == NULL || wins_reserved == NULL || cookies_single_set == NULL || view == NULL) {
+        _webinix_free_mem((void*)wins);
+        _webinix_free_mem((void*)wins_reserved);
+        _webinix_free_mem((void*)cookies_single_set);
+        _webinix_free_mem((void*)view);
+        return false;
+    }
+
+    _webinix_table_retire((void*)_webinix.wins);
+    _webinix_table_retire((void*)_webinix.wins_reserved);
+    _webinix_table_retire((void*)_webinix.cookies_single_set);
+    _webinix_table_retire((void*)_webinix.wins_view);
+    _webinix.wins = wins;
+    _webinix.wins_reserved = wins_reserved;
+    _webinix.cookies_single_set = cookies_single_set;
+    // Tables first, then the view that bounds them
+    view->capacity = capacity;
+    view->wins = wins;
+    view->cookies_single_set = cookies_single_set;
+    WEBUI_ATOMIC_STORE_PTR(&_webinix.wins_view, view);
+    return true;
+}
+
+static _webinix_wins_view_t* _webinix_wins_view(void) {
+
+    // The windows table and its capacity, lock-free. Index only
+    // with this view, the table may be replaced meanwhile.
+    return (_webinix_wins_view_t*)WEBUI_ATOMIC_LOAD_PTR(&_webinix.wins_view);
+}
+
+static _webinix_window_t* _webinix_wins_get(size_t num) {
 
-    // Add pointer to the list
-    _webinix_ptr_add((void*)mem, size);
+    // A window by number, `NULL` if out of the table, lock-free
+    _webinix_wins_view_t* view = _webinix_wins_view();
+    if (view == NULL || num >= view->capacity)
+        return NULL;
+    return view->wins[num];
+}
 
-    _webinix_mutex_unlock(&_webinix.mutex_mem);
+static bool _webinix_mem_allow(size_t size) {
 
-    return mem;
+    // Check a client message of `size` bytes against the memory
+    // limits (`webinix_set_memory_limits()`)
+    if (size > _webinix.mem_limit_message)
+        return false;
+    if (_webinix.mem_limit_total > 0 &&
+        ((size_t)WEBUI_ATOMIC_ADD(&_webinix.mem_bytes, 0) + size) > _webinix.mem_limit_total)
+        return false;
+    return true;
 }
 
 static _webinix_window_t* _webinix_dereference_win_ptr(void * ptr) {
@@ -4487,8 +5747,9 @@ static _webinix_window_t* _webinix_dereference_win_ptr(void * ptr) {
 
     _webinix_window_t* win = (_webinix_window_t* ) ptr;
 
-    for (size_t i = 1; i < WEBUI_MAX_IDS; i++) {
-        if (_webinix.wins[i] == win)
+    _webinix_wins_view_t* view = _webinix_wins_view();
+    for (size_t i = 1; i < view->capacity; i++) {
+        if (view->wins[i] == win)
             return win;
     }
 
@@ -4563,6 +5824,26 @@ static bool _webinix_timer_is_end(_webinix_timer_t* t, size_t ms) {
     return false;
 }
 
+static void _webinix_show_phase(_webinix_window_t* win, size_t* phase) {
+
+    #ifdef WEBUI_LOG_VERBOSE
+    printf("[Core]\t\t_webinix_show_phase()\n");
+    #endif
+
+    // Microseconds since `webinix_show()`, at least 1 as 0 means not
+    // reached. Phases are set by the show, server and WebSocket threads,
+    // the first time only.
+    struct timespec now;
+    _webinix_timer_clock_gettime(&now);
+    _webinix_mutex_lock(&win->mutex_show_timeline);
+    if (*phase == 0) {
+        long long us = ((long long)(now.tv_sec - win->show_timer.start.tv_sec) * 1000000) +
+            ((long long)(now.tv_nsec - win->show_timer.start.tv_nsec) / 1000);
+        *phase = (us > 0 ? (size_t)us : 1);
+    }
+    _webinix_mutex_unlock(&win->mutex_show_timeline);
+}
+
 static bool _webinix_is_empty(const char* s) {
 
     #ifdef WEBUI_LOG_VERBOSE
@@ -4583,46 +5864,9 @@ static size_t _webinix_strlen(const char* s) {
     if (_webinix_is_empty(s))
         return 0;
 
-    size_t length = 0;
-
-    while((s[length] != '\0') && (length < WEBUI_MAX_BUF)) {
-        length++;
-    }
-
-    return length;
-}
-
-static bool _webinix_file_exist_mg(_webinix_window_t* win, struct mg_connection* client) {
-
-    #ifdef WEBUI_LOG_VERBOSE
-    printf("[Core]\t\t_webinix_file_exist_mg()\n");
-    #endif
-
-    char* file;
-    char* full_path;
-
-    const struct mg_request_info * ri = mg_get_request_info(client);
-    const char* url = ri->local_uri;
-    size_t url_len = _webinix_strlen(url);
-
-    // Get file name
-    file = (char*)_webinix_malloc(url_len);
-    const char* p = url;
-    p++; // Skip "/"
-    WEBUI_SN_PRINTF_DYN(file, url_len, "%.*s", (int)(url_len - 1), p);
-
-    // Get full path
-    // [current folder][/][file]
-    size_t bf_len = (_webinix_strlen(win->server_root_path) + 1 + _webinix_strlen(file));
-    full_path = (char*)_webinix_malloc(bf_len);
-    WEBUI_SN_PRINTF_DYN(full_path, bf_len, "%s%s%s", win->server_root_path, os_sep, file);
-
-    bool exist = _webinix_file_exist(full_path);
-
-    _webinix_free_mem((void*)file);
-    _webinix_free_mem((void*)full_path);
-
-    return exist;
+    // Not capped, client messages may be bigger than `WEBUI_MAX_BUF`
+    // (`webinix_set_memory_limits()`), all buffers are null-terminated
+    return strlen(s);
 }
 
 static bool _webinix_is_valid_url(const char* url) {
@@ -4742,8 +5986,8 @@ static bool _webinix_socket_test_listen_mg(size_t port_num) {
     #endif
 
     // HTTP Port Test
-    char* test_port = (char*)_webinix_malloc(64);
-    WEBUI_SN_PRINTF_DYN(test_port, 64, "127.0.0.1:%zu", port_num);
+    char test_port[64] = {0};
+    WEBUI_SN_PRINTF_STATIC(test_port, sizeof(test_port), "127.0.0.1:%zu", port_num);
 
     // Start HTTP Server
     const char* http_options[] = {
@@ -4868,8 +6112,13 @@ static char* _webinix_get_full_path(_webinix_window_t* win, const char* file) {
     return full_path;
 }
 
-static size_t _webinix_new_event_inf(_webinix_window_t* win, webinix_event_inf_t** event_inf) {
-    (*event_inf) = (webinix_event_inf_t*)_webinix_malloc(sizeof(webinix_event_inf_t));
+static size_t _webinix_new_event_inf(_webinix_window_t* win, webinix_event_inf_t** event_inf, _webinix_arena_t* arena) {
+    (*event_inf) = (webinix_event_inf_t*)_webinix_arena_alloc(arena, sizeof(webinix_event_inf_t));
+    if ((*event_inf) != NULL) {
+        (*event_inf)->arena = arena;
+        arena->refs++;
+    }
+    else (*event_inf) = (webinix_event_inf_t*)_webinix_malloc(sizeof(webinix_event_inf_t));
     if (win->events_count > WEBUI_MAX_ARG)
         win->events_count = 0;
     size_t event_num = win->events_count++;
@@ -4879,25 +6128,200 @@ static size_t _webinix_new_event_inf(_webinix_window_t* win, webinix_event_inf_t
 
 static void _webinix_free_event_inf(_webinix_window_t* win, size_t event_num) {
     webinix_event_inf_t* event_inf = win->events[event_num];
-    for (size_t i = 0; i < (WEBUI_MAX_ARG + 1); i++) {
-        if (event_inf->event_data[i] != NULL)
-            webinix_free((void*)event_inf->event_data[i]);
-    }
-    if (event_inf->response != NULL)
-        webinix_free((void*)event_inf->response);
-    webinix_free((void*)event_inf);
     win->events[event_num] = NULL;
+    // `event_data` points into the received packet
+    _webinix_event_free_mem(event_inf, event_inf->response);
+    if (event_inf->arena != NULL)
+        _webinix_arena_release(event_inf->arena);
+    else _webinix_free_mem((void*)event_inf);
 }
 
-static int _webinix_external_file_handler(_webinix_window_t* win, struct mg_connection* client, size_t client_id) {
+static _webinix_arena_t* _webinix_arena_new(size_t extra) {
 
-    #ifdef WEBUI_LOG
-    printf("[Core]\t\t_webinix_external_file_handler()\n");
-    #endif
+    // [Header][Packet copy (extra)][WEBUI_ARENA_SIZE]
+    size_t size = WEBUI_ARENA_SIZE + extra + 16;
+    _webinix_arena_t* arena = (_webinix_arena_t*)_webinix_pool_get(sizeof(_webinix_arena_t) + size);
+    if (arena == NULL)
+        return NULL;
+    _webinix_mem_tag(arena, WEBUI_MEM_EVENTS);
+    // All of the pool buffer
+    arena->size = (size_t)_webinix_mem_header(arena)->size - sizeof(_webinix_arena_t);
+    arena->used = 0;
+    arena->refs = 1;
+    return arena;
+}
+
+static void * _webinix_arena_alloc(_webinix_arena_t* arena, size_t size) {
+
+    // Zeroed, 16 bytes aligned, one more (zero) byte like `_webinix_malloc()`.
+    // Never freed on its own, `NULL` when full.
+    if (arena == NULL || size >= (arena->size - arena->used))
+        return NULL;
+    size_t need = (size + 1 + 15) & ~((size_t)15);
+    if (need > (arena->size - arena->used))
+        return NULL;
+    void * ptr = ((char*)(arena + 1)) + arena->used;
+    arena->used += need;
+    memset(ptr, 0, need);
+    return ptr;
+}
+
+static bool _webinix_arena_owns(_webinix_arena_t* arena, const void * ptr) {
+    if (arena == NULL || ptr == NULL)
+        return false;
+    const char* start = (const char*)(arena + 1);
+    return ((const char*)ptr >= start && (const char*)ptr < (start + arena->size));
+}
+
+static void _webinix_arena_release(_webinix_arena_t* arena) {
+
+    // Receiver and events of one packet all run in the
+    // same thread, so the count needs no lock
+    if (arena != NULL && --arena->refs == 0)
+        _webinix_pool_put((void*)arena);
+}
+
+static void * _webinix_event_malloc(webinix_event_inf_t* event_inf, size_t size) {
+    void * ptr = _webinix_arena_alloc(event_inf->arena, size);
+    if (ptr == NULL) {
+        ptr = _webinix_malloc(size);
+        _webinix_mem_tag(ptr, WEBUI_MEM_RESPONSES);
+    }
+    return ptr;
+}
+
+static void _webinix_event_free_mem(webinix_event_inf_t* event_inf, void * ptr) {
+    // Arena memory goes with the arena
+    if (!_webinix_arena_owns(event_inf->arena, ptr))
+        _webinix_free_mem(ptr);
+}
+
+static void * _webinix_pool_get(size_t size) {
+
+    // A protocol buffer of at least `size` + 1 bytes from this
+    // thread's pool. Not zeroed, but for the byte at `size`.
+    size_t c = 0;
+    size_t class_size = WEBUI_POOL_MIN;
+    while (c < WEBUI_POOL_CLASSES && class_size < size) {
+        class_size <<= 1;
+        c++;
+    }
+    if (c == WEBUI_POOL_CLASSES) {
+        void * big = _webinix_malloc(size);
+        _webinix_mem_tag(big, WEBUI_MEM_PACKETS);
+        return big;
+    }
+
+    _webinix_pool_t* pool = &_webinix_pools[c];
+    if (pool->count == 0)
+        _webinix_pool_exchange(c, pool, WEBUI_POOL_DEPTH / 2);
+    char* ptr = NULL;
+    if (pool->count > 0) {
+        ptr = (char*)pool->cached[--pool->count];
+        if (pool->count < pool->low)
+            pool->low = pool->count;
+    }
+    else {
+        ptr = (char*)_webinix_malloc(class_size);
+        if (ptr == NULL)
+            return NULL;
+        _webinix_mem_header(ptr)->owner = WEBUI_MEM_POOL;
+        pool->low = 0;
+    }
+    _webinix_mem_tag(ptr, WEBUI_MEM_PACKETS);
+
+    // Trim, buffers that stayed cached a whole period are above
+    // the high-water mark of this thread
+    if (++pool->gets >= WEBUI_POOL_TRIM) {
+        _webinix_pool_exchange(c, pool, pool->count - pool->low);
+        pool->low = pool->count;
+        pool->gets = 0;
+    }
+
+    ptr[size] = 0x00;
+    return (void*)ptr;
+}
+
+static void _webinix_pool_put(void * ptr) {
+
+    // Back to this thread's pool, any other block is freed
+    _webinix_mem_header_t* header = _webinix_mem_header(ptr);
+    if (header == NULL)
+        return;
+    if (header->owner != WEBUI_MEM_POOL) {
+        _webinix_free_mem(ptr);
+        return;
+    }
+    size_t c = 0;
+    while (((size_t)WEBUI_POOL_MIN << c) < header->size)
+        c++;
+    _webinix_pool_t* pool = &_webinix_pools[c];
+    if (pool->count == WEBUI_POOL_DEPTH)
+        _webinix_pool_exchange(c, pool, WEBUI_POOL_DEPTH / 2);
+    pool->cached[pool->count++] = ptr;
+}
+
+static void _webinix_pool_exchange(size_t c, _webinix_pool_t* pool, size_t keep) {
+
+    // Move buffers of size class `c` between this thread's pool and the
+    // shared one until the thread has `keep` of them (or the shared pool
+    // is empty). Buffers often cross threads (received by a server thread,
+    // released by the event thread), this is how they get reused.
+    _webinix_mutex_lock(&_webinix.mutex_pool);
+    _webinix_pool_shared_t* shared = &_webinix.pool_shared[c];
+    while (pool->count < keep && shared->count > 0)
+        pool->cached[pool->count++] = shared->cached[--shared->count];
+    while (pool->count > keep) {
+        void * ptr = pool->cached[--pool->count];
+        if (shared->count < WEBUI_POOL_SHARED)
+            shared->cached[shared->count++] = ptr;
+        else _webinix_free_mem(ptr);
+    }
+    if (shared->count < shared->low)
+        shared->low = shared->count;
+
+    // Trim, same as the thread pools
+    if (++shared->uses >= WEBUI_POOL_TRIM) {
+        for (size_t i = 0; i < shared->low; i++)
+            _webinix_free_mem(shared->cached[--shared->count]);
+        shared->low = shared->count;
+        shared->uses = 0;
+    }
+    _webinix_mutex_unlock(&_webinix.mutex_pool);
+}
+
+static void _webinix_pool_flush(void) {
+
+    // Give this thread's cached buffers to the shared pool, before it exits
+    for (size_t c = 0; c < WEBUI_POOL_CLASSES; c++) {
+        _webinix_pool_t* pool = &_webinix_pools[c];
+        if (pool->count > 0)
+            _webinix_pool_exchange(c, pool, 0);
+        pool->low = 0;
+        pool->gets = 0;
+    }
+}
+
+static void _webinix_http_exit_thread(const struct mg_context* ctx, int thread_type, void * thread_pointer) {
+    (void)ctx;
+    (void)thread_type;
+    (void)thread_pointer;
+    _webinix_pool_flush();
+}
+
+static int _webinix_external_file_handler(_webinix_window_t* win, struct mg_connection* client, size_t client_id) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_external_file_handler()\n");
+    #endif
 
     int http_status_code = 0;
     const struct mg_request_info * ri = mg_get_request_info(client);
-    const char* url = ri->local_uri;
+    const char* url = _webinix_http_local_uri(win, ri);
+
+    if (win->files_handler_stream != NULL) {
+        return _webinix_external_file_stream(win, client);
+    }
 
     if (win->files_handler != NULL || win->files_handler_window != NULL) {
         // Get file content from the external files handler
@@ -4925,10 +6349,29 @@ static int _webinix_external_file_handler(_webinix_window_t* win, struct mg_conn
         #endif
 
         // Async response ini
+        _webinix_file_request_t* req = NULL;
+        bool serialized = false;
         if (_webinix.config.asynchronous_response) {
-            win->file_handler_async_response = NULL;
-            win->file_handler_async_len = 0;
-            win->file_handler_async_done = false;
+            // The legacy API answers without a handle, so with more than one
+            // request in flight the answer could reach the wrong one. Serve
+            // one request at a time until the handler uses handles.
+            if (!win->file_request_handles) {
+                serialized = true;
+                _webinix_mutex_unlock(&_webinix.mutex_http_handler);
+                _webinix_mutex_lock(&_webinix.mutex_async_legacy);
+                _webinix_mutex_lock(&_webinix.mutex_http_handler);
+            }
+            _webinix_mutex_lock(&_webinix.mutex_async_response);
+            req = _webinix_file_request_new(win->num);
+            _webinix_mutex_unlock(&_webinix.mutex_async_response);
+            if (req == NULL) {
+                // Too many pending requests
+                if (serialized)
+                    _webinix_mutex_unlock(&_webinix.mutex_async_legacy);
+                _webinix_http_send_error(client, webinix_html_res_not_available, 503);
+                return 503;
+            }
+            _webinix_file_request_current = req->id;
         }
 
         // Call user callback
@@ -4938,21 +6381,26 @@ static int _webinix_external_file_handler(_webinix_window_t* win, struct mg_conn
         } else {
             callback_resp = win->files_handler(url, (int*)&length);
         }
+        _webinix_file_request_current = 0;
 
         // Async response wait
-        if (_webinix.config.asynchronous_response) {
-            // `callback_resp` is NULL now, we need to
-            // wait for the response that will come later.
-            bool done = false;
-            while (!done) {
-                _webinix_sleep(10);
-                _webinix_mutex_lock(&_webinix.mutex_async_response);
-                if(win->file_handler_async_done) done = true;
-                _webinix_mutex_unlock(&_webinix.mutex_async_response);
+        if (req != NULL) {
+            // `callback_resp` is NULL now, we need to wait for the response
+            // that will come later. Other requests are served meanwhile.
+            _webinix_mutex_unlock(&_webinix.mutex_http_handler);
+            _webinix_mutex_lock(&_webinix.mutex_async_response);
+            while (!req->done) {
+                _webinix_condition_wait(&req->condition, &_webinix.mutex_async_response);
             }
             // Get the async response
-            callback_resp = win->file_handler_async_response;
-            length = win->file_handler_async_len;
+            callback_resp = req->response;
+            length = (size_t)(req->length > 0 ? req->length : 0);
+            _webinix_condition_destroy(&req->condition);
+            req->id = 0;
+            _webinix_mutex_unlock(&_webinix.mutex_async_response);
+            if (serialized)
+                _webinix_mutex_unlock(&_webinix.mutex_async_legacy);
+            _webinix_mutex_lock(&_webinix.mutex_http_handler);
         }
 
         if (callback_resp != NULL) {
@@ -4975,7 +6423,7 @@ static int _webinix_external_file_handler(_webinix_window_t* win, struct mg_conn
             #endif
 
             // Send user data (Header + Body)
-            mg_write(client, callback_resp, length);
+            mg_write(client, (const char*)callback_resp, length);
             
             // Safely free resources if end-user allocated
             // using `webinix_malloc()`. Otherwise just do nothing.
@@ -4997,6 +6445,126 @@ static int _webinix_external_file_handler(_webinix_window_t* win, struct mg_conn
     return http_status_code;
 }
 
+static _webinix_file_request_t* _webinix_file_request_new(size_t window) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_file_request_new([%zu])\n", window);
+    #endif
+
+    // Caller must hold `mutex_async_response`
+    for (size_t i = 0; i < WEBUI_MAX_IDS; i++) {
+        _webinix_file_request_t* req = &_webinix.file_requests[i];
+        if (req->id == 0) {
+            // Handles are never reused, so a late answer to a
+            // finished request can not reach a new one
+            if (++_webinix.file_requests_last_id == 0)
+                _webinix.file_requests_last_id = 1;
+            req->id = _webinix.file_requests_last_id;
+            req->window = window;
+            req->done = false;
+            req->by_handle = false;
+            req->response = NULL;
+            req->length = 0;
+            _webinix_condition_init(&req->condition);
+            return req;
+        }
+    }
+    return NULL;
+}
+
+static _webinix_file_request_t* _webinix_file_request_get(size_t request) {
+
+    // Caller must hold `mutex_async_response`
+    if (request == 0)
+        return NULL;
+    for (size_t i = 0; i < WEBUI_MAX_IDS; i++) {
+        if (_webinix.file_requests[i].id == request)
+            return &_webinix.file_requests[i];
+    }
+    return NULL;
+}
+
+static void _webinix_file_request_complete(_webinix_file_request_t* req, const void* response, int length) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_file_request_complete([%zu])\n", req->id);
+    #endif
+
+    // Caller must hold `mutex_async_response`
+    req->response = response;
+    req->length = length;
+    req->done = true;
+    _webinix_condition_signal(&req->condition);
+}
+
+static void _webinix_file_request_cancel(size_t window) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_file_request_cancel([%zu])\n", window);
+    #endif
+
+    // Release the server threads waiting for a response, as
+    // not found, for one window or all windows (`0`)
+    _webinix_mutex_lock(&_webinix.mutex_async_response);
+    for (size_t i = 0; i < WEBUI_MAX_IDS; i++) {
+        _webinix_file_request_t* req = &_webinix.file_requests[i];
+        if (req->id != 0 && !req->done && (window == 0 || req->window == window))
+            _webinix_file_request_complete(req, NULL, 0);
+    }
+    _webinix_mutex_unlock(&_webinix.mutex_async_response);
+}
+
+static int _webinix_external_file_stream(_webinix_window_t* win, struct mg_connection* client) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_external_file_stream()\n");
+    #endif
+
+    const struct mg_request_info * ri = mg_get_request_info(client);
+    const char* url = _webinix_http_local_uri(win, ri);
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_external_file_stream() -> Path [%s]\n", url);
+    printf("[Core]\t\t_webinix_external_file_stream() -> Calling custom files stream handler callback\n");
+    printf("[Call]\n");
+    #endif
+
+    // The response lives on the stack for the duration of the callback
+    webinix_response_t response;
+    memset(&response, 0, sizeof(response));
+    response.win = win;
+    response.client = client;
+    response.remaining = -1;
+
+    // The callback can take long (large or slow responses),
+    // other requests are served meanwhile
+    _webinix_mutex_unlock(&_webinix.mutex_http_handler);
+    bool handled = win->files_handler_stream(win->num, url, &response);
+    if (response.begun)
+        webinix_response_end(&response);
+    _webinix_mutex_lock(&_webinix.mutex_http_handler);
+
+    if (!response.begun) {
+        if (!handled) {
+            // Not found, Webinix will try looking for the file locally
+            #ifdef WEBUI_LOG
+            printf("[Core]\t\t_webinix_external_file_stream() -> Custom files stream handler failed\n");
+            #endif
+            return 0;
+        }
+        // Handled without any response
+        _webinix_http_send_error(client, webinix_html_res_not_available, 500);
+        return 500;
+    }
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_external_file_stream() -> Response %s\n",
+        (response.failed ? "incomplete" : "sent"));
+    #endif
+
+    return 200;
+}
+
 static int _webinix_serve_file(_webinix_window_t* win, struct mg_connection* client, size_t client_id) {
 
     #ifdef WEBUI_LOG
@@ -5007,7 +6575,7 @@ static int _webinix_serve_file(_webinix_window_t* win, struct mg_connection* cli
 
     int http_status_code = 0;
     const struct mg_request_info * ri = mg_get_request_info(client);
-    const char* url = ri->local_uri;
+    const char* url = _webinix_http_local_uri(win, ri);
 
     #ifdef WEBUI_LOG
     printf("[Core]\t\t_webinix_serve_file() -> Looking for file locally\n");
@@ -5020,7 +6588,7 @@ static int _webinix_serve_file(_webinix_window_t* win, struct mg_connection* cli
     if (_webinix_file_exist(full_path)) {
 
         // 200 - File exist
-        _webinix_http_send_file(win, client, mg_get_builtin_mime_type(url), full_path, false);
+        _webinix_http_send_file(win, client, mg_get_builtin_mime_type(url), full_path, WEBUI_HTTP_NO_CACHE);
         http_status_code = 200;
     }
     else {
@@ -5093,53 +6661,132 @@ static bool _webinix_nodejs_exist(_webinix_window_t* win) {
         return false;
 }
 
-static const char* _webinix_interpret_command(const char* cmd) {
+static bool _webinix_interpret_command(_webinix_window_t* win, struct mg_connection* client, const char* cmd) {
 
     #ifdef WEBUI_LOG
     printf("[Core]\t\t_webinix_interpret_command([%s])\n", cmd);
     #endif
 
-    // Run the command with redirection of errors to stdout
-    // and return the output.
+    // Run the command with redirection of errors to stdout, and stream
+    // the output to the client as it comes (chunked encoding). Returns
+    // false if the command could not be started.
 
-    // Output buffer
-    char* out = NULL;
+    webinix_response_t response;
+    memset(&response, 0, sizeof(response));
+    response.win = win;
+    response.client = client;
+    response.remaining = -1;
+
+    char buffer[WEBUI_STDOUT_BUF];
+    bool started = false;
 
-    #ifdef _WIN32
-    // Redirect stderr to stdout
-    char cmd_with_redirection[512] = {0};
-    WEBUI_SN_PRINTF_STATIC(cmd_with_redirection, sizeof(cmd_with_redirection), "cmd.exe /c %s 2>&1", cmd);
-    _webinix_system_win32_out(cmd_with_redirection,&out, false);
-    #else
     // Redirect stderr to stdout
-    char cmd_with_redirection[512] = {0};
-    WEBUI_SN_PRINTF_STATIC(cmd_with_redirection, sizeof(cmd_with_redirection), "%s 2>&1", cmd);
+    size_t cmd_len = (_webinix_strlen(cmd) + 32);
+    char* cmd_with_redirection = (char*)_webinix_malloc(cmd_len);
 
-    FILE * pipe = WEBUI_POPEN(cmd_with_redirection, "r");
+    // Scripts can take long, let other requests be served meanwhile
+    _webinix_mutex_unlock(&_webinix.mutex_http_handler);
 
-    if (pipe == NULL)
-        return NULL;
+    #ifdef _WIN32
+    WEBUI_SN_PRINTF_DYN(cmd_with_redirection, cmd_len, "cmd.exe /c %s 2>&1", cmd);
+
+    SECURITY_ATTRIBUTES sa;
+    sa.nLength = sizeof(SECURITY_ATTRIBUTES);
+    sa.bInheritHandle = TRUE;
+    sa.lpSecurityDescriptor = NULL;
+    HANDLE stdout_read, stdout_write;
+    if (CreatePipe(&stdout_read, &stdout_write, &sa, 0)) {
+        SetHandleInformation(stdout_read, HANDLE_FLAG_INHERIT, 0);
+
+        STARTUPINFOA si;
+        ZeroMemory(&si, sizeof(STARTUPINFOA));
+        si.cb = sizeof(STARTUPINFOA);
+        si.dwFlags = STARTF_USESHOWWINDOW | STARTF_USESTDHANDLES;
+        si.wShowWindow = SW_HIDE;
+        si.hStdOutput = stdout_write;
+        si.hStdError = stdout_write;
+        PROCESS_INFORMATION pi;
+        ZeroMemory(&pi, sizeof(PROCESS_INFORMATION));
+        started = CreateProcessA(NULL, cmd_with_redirection, NULL, NULL, TRUE, CREATE_NO_WINDOW, NULL, NULL, &si, &pi);
+        CloseHandle(stdout_write);
 
-    // Read STDOUT
-    out = (char*)_webinix_malloc(WEBUI_STDOUT_BUF);
-    char* line = (char*)_webinix_malloc(1024);
-    while(fgets(line, 1024, pipe) != NULL)
-        WEBUI_STR_CAT_DYN(out, WEBUI_STDOUT_BUF, line);
-    WEBUI_PCLOSE(pipe);
+        if (started) {
+            // Read STDOUT while the process runs
+            DWORD bytes_read;
+            while (ReadFile(stdout_read, buffer, sizeof(buffer), &bytes_read, NULL) && bytes_read > 0) {
+                if (!response.begun)
+                    webinix_response_begin(&response, 200, "text/plain", -1, NULL);
+                if (!webinix_response_write(&response, buffer, bytes_read))
+                    break; // Client disconnected
+            }
+        }
+        CloseHandle(stdout_read);
 
-    // Clean
-    _webinix_free_mem((void*)line);
+        if (started) {
+            WaitForSingleObject(pi.hProcess, INFINITE);
+            CloseHandle(pi.hProcess);
+            CloseHandle(pi.hThread);
+        }
+    }
+    #else
+    WEBUI_SN_PRINTF_DYN(cmd_with_redirection, cmd_len, "%s 2>&1", cmd);
+    FILE * pipe = WEBUI_POPEN(cmd_with_redirection, "r");
+
+    if (pipe != NULL) {
+        started = true;
+
+        // Read STDOUT while the process runs. `read()` returns
+        // what is available instead of waiting for a full buffer.
+        int fd = fileno(pipe);
+        ssize_t bytes_read;
+        while ((bytes_read = read(fd, buffer, sizeof(buffer))) != 0) {
+            if (bytes_read < 0) {
+                if (errno == EINTR)
+                    continue;
+                break;
+            }
+            if (!response.begun)
+                webinix_response_begin(&response, 200, "text/plain", -1, NULL);
+            if (!webinix_response_write(&response, buffer, (size_t)bytes_read))
+                break; // Client disconnected
+        }
+
+        // Closing our end first lets a process still writing to a
+        // disconnected client end (SIGPIPE) instead of blocking
+        WEBUI_PCLOSE(pipe);
+    }
     #endif
 
-    return (const char*)out;
+    // A response is begun and ended without `mutex_http_handler`
+    if (started) {
+        if (!response.begun) {
+            // No output, send back an empty `200 OK`
+            webinix_response_begin(&response, 200, "text/plain", 0, NULL);
+        }
+        webinix_response_end(&response);
+    }
+
+    _webinix_mutex_lock(&_webinix.mutex_http_handler);
+    _webinix_free_mem((void*)cmd_with_redirection);
+    return started;
 }
 
 static void _webinix_condition_init(webinix_condition_t* cond) {
 
     #ifdef _WIN32
     InitializeConditionVariable(cond);
-    #else
+    #elif __APPLE__
+    // macOS has no `pthread_condattr_setclock()`, timed waits
+    // use a relative timeout instead
     pthread_cond_init(cond, NULL);
+    #else
+    // Timed waits use the monotonic clock, so a wall clock change
+    // does not shorten or stretch them
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(cond, &attr);
+    pthread_condattr_destroy(&attr);
     #endif
 }
 
@@ -5152,6 +6799,28 @@ static void _webinix_condition_wait(webinix_condition_t* cond, webinix_mutex_t*
     #endif
 }
 
+static void _webinix_condition_timedwait(webinix_condition_t* cond, webinix_mutex_t* mutex, size_t ms) {
+
+    #ifdef _WIN32
+    SleepConditionVariableCS(cond, mutex, (DWORD)ms);
+    #elif __APPLE__
+    struct timespec ts;
+    ts.tv_sec = (time_t)(ms / 1000);
+    ts.tv_nsec = (long)((ms % 1000) * 1000000);
+    pthread_cond_timedwait_relative_np(cond, mutex, &ts);
+    #else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    ts.tv_sec += (time_t)(ms / 1000);
+    ts.tv_nsec += (long)((ms % 1000) * 1000000);
+    if (ts.tv_nsec >= 1000000000) {
+        ts.tv_sec++;
+        ts.tv_nsec -= 1000000000;
+    }
+    pthread_cond_timedwait(cond, mutex, &ts);
+    #endif
+}
+
 static void _webinix_condition_signal(webinix_condition_t* cond) {
 
     #ifdef _WIN32
@@ -5161,6 +6830,15 @@ static void _webinix_condition_signal(webinix_condition_t* cond) {
     #endif
 }
 
+static void _webinix_condition_broadcast(webinix_condition_t* cond) {
+
+    #ifdef _WIN32
+    WakeAllConditionVariable(cond);
+    #else
+    pthread_cond_broadcast(cond);
+    #endif
+}
+
 static void _webinix_condition_destroy(webinix_condition_t* cond) {
 
     #ifdef _WIN32
@@ -5207,62 +6885,542 @@ static void _webinix_mutex_destroy(webinix_mutex_t* mutex) {
     #endif
 }
 
-static int _webinix_interpret_file(_webinix_window_t* win, struct mg_connection* client, char* index, size_t client_id) {
+static bool _webinix_runtime_worker_script(void) {
 
     #ifdef WEBUI_LOG
-    printf("[Core]\t\t_webinix_interpret_file()\n");
+    printf("[Core]\t\t_webinix_runtime_worker_script()\n");
     #endif
 
-    // Interpret the file using JavaScript/TypeScript runtimes
-    // and send back the output. otherwise, send the file as a normal text based
+    // Caller must hold `mutex_runtime`. The script is written
+    // once per process, so it always matches this library.
+    if (!_webinix_is_empty(_webinix.runtime_worker_path))
+        return true;
 
-    int interpret_http_stat = 200;
-    char* file = NULL;
-    char* full_path = NULL;
-    const char* query = NULL;
+    char folder[WEBUI_MAX_PATH];
+    WEBUI_SN_PRINTF_STATIC(folder, sizeof(folder), "%s%s.Webinix", _webinix_get_temp_path(), os_sep);
+    if (!_webinix_folder_exist(folder)) {
+        #ifdef _WIN32
+        _mkdir(folder);
+        #else
+        mkdir(folder, 0700);
+        #endif
+    }
 
-    const struct mg_request_info * ri = mg_get_request_info(client);
-    const char* url = ri->local_uri;
+    // Write to a temporary file first, other Webinix apps may be
+    // using the current script
+    char path[WEBUI_MAX_PATH];
+    char temp[WEBUI_MAX_PATH + 24];
+    int path_len = WEBUI_SN_PRINTF_STATIC(path, sizeof(path), "%s%swebinix_runtime_worker.mjs", folder, os_sep);
+    if (path_len < 0 || (size_t)path_len >= sizeof(path))
+        return false;
+    #ifdef _WIN32
+    WEBUI_SN_PRINTF_STATIC(temp, sizeof(temp), "%s.%lu", path, (unsigned long)GetCurrentProcessId());
+    #else
+    WEBUI_SN_PRINTF_STATIC(temp, sizeof(temp), "%s.%lu", path, (unsigned long)getpid());
+    #endif
+    FILE* file;
+    WEBUI_FILE_OPEN(file, temp, "wb");
+    if (file == NULL)
+        return false;
+    size_t len = _webinix_strlen(webinix_runtime_worker_js);
+    bool written = (fwrite(webinix_runtime_worker_js, 1, len, file) == len);
+    written = (fclose(file) == 0) && written;
+    #ifdef _WIN32
+    written = written && MoveFileExA(temp, path, MOVEFILE_REPLACE_EXISTING);
+    #else
+    written = written && (rename(temp, path) == 0);
+    #endif
+    if (!written) {
+        remove(temp);
+        return false;
+    }
 
-    // Get file full path
-    if (index != NULL && !_webinix_is_empty(index)) {
+    WEBUI_STR_COPY_STATIC(_webinix.runtime_worker_path, sizeof(_webinix.runtime_worker_path), path);
+    return true;
+}
 
-        // Parse as index file
+static bool _webinix_runtime_worker_start(_webinix_runtime_worker_t* worker, size_t runtime) {
 
-        file = index;
-        full_path = index;
-    } else {
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_runtime_worker_start([%zu])\n", runtime);
+    #endif
 
-        // Parse as other non-index files
+    const char* script = _webinix.runtime_worker_path;
 
-        // Get file name
-        file = _webinix_get_file_name_from_url(url);
+    #ifdef _WIN32
+    char cmd[WEBUI_MAX_PATH + 256];
+    if (runtime == Deno) {
+        WEBUI_SN_PRINTF_STATIC(cmd, sizeof(cmd),
+            "cmd.exe /c Set NO_COLOR=1&Set DENO_NO_UPDATE_CHECK=1&deno run --quiet --allow-all --unstable-ffi --allow-ffi \"%s\"",
+            script
+        );
+    }
+    else if (runtime == Bun)
+        WEBUI_SN_PRINTF_STATIC(cmd, sizeof(cmd), "bun \"%s\"", script);
+    else
+        WEBUI_SN_PRINTF_STATIC(cmd, sizeof(cmd), "node \"%s\"", script);
 
-        // Get full path
-        full_path = _webinix_get_full_path(win, file);
+    SECURITY_ATTRIBUTES sa;
+    sa.nLength = sizeof(SECURITY_ATTRIBUTES);
+    sa.bInheritHandle = TRUE;
+    sa.lpSecurityDescriptor = NULL;
+    HANDLE in_read, in_write, out_read, out_write;
+    if (!CreatePipe(&in_read, &in_write, &sa, 0))
+        return false;
+    if (!CreatePipe(&out_read, &out_write, &sa, 0)) {
+        CloseHandle(in_read);
+        CloseHandle(in_write);
+        return false;
     }
+    // Our ends of the pipes should not be inherited
+    SetHandleInformation(in_write, HANDLE_FLAG_INHERIT, 0);
+    SetHandleInformation(out_read, HANDLE_FLAG_INHERIT, 0);
 
-    // Get file extension
-    const char* extension = _webinix_get_extension(file);
+    STARTUPINFOA si;
+    ZeroMemory(&si, sizeof(STARTUPINFOA));
+    si.cb = sizeof(STARTUPINFOA);
+    si.dwFlags = STARTF_USESTDHANDLES;
+    si.hStdInput = in_read;
+    si.hStdOutput = out_write;
+    si.hStdError = GetStdHandle(STD_ERROR_HANDLE);
+    PROCESS_INFORMATION pi;
+    ZeroMemory(&pi, sizeof(PROCESS_INFORMATION));
+    BOOL created = CreateProcessA(NULL, cmd, NULL, NULL, TRUE, CREATE_NO_WINDOW, NULL, NULL, &si, &pi);
+    CloseHandle(in_read);
+    CloseHandle(out_write);
+    if (!created) {
+        CloseHandle(in_write);
+        CloseHandle(out_read);
+        return false;
+    }
+    CloseHandle(pi.hThread);
+    worker->process = pi.hProcess;
+    worker->in = _fdopen(_open_osfhandle((intptr_t)in_write, _O_WRONLY | _O_BINARY), "wb");
+    worker->out = _fdopen(_open_osfhandle((intptr_t)out_read, _O_RDONLY | _O_BINARY), "rb");
+    #else
+    const char* deno_argv[] = {"env", "NO_COLOR=1", "DENO_NO_UPDATE_CHECK=1", "deno", "run", "--quiet",
+        "--allow-all", "--unstable-ffi", "--allow-ffi", script, NULL};
+    const char* bun_argv[] = {"bun", script, NULL};
+    const char* node_argv[] = {"node", script, NULL};
+    const char** argv = (runtime == Deno ? deno_argv : (runtime == Bun ? bun_argv : node_argv));
+
+    int in_pipe[2];
+    int out_pipe[2];
+    if (pipe(in_pipe) != 0)
+        return false;
+    if (pipe(out_pipe) != 0) {
+        close(in_pipe[0]);
+        close(in_pipe[1]);
+        return false;
+    }
+    // Our ends of the pipes should not leak into other child processes
+    fcntl(in_pipe[1], F_SETFD, FD_CLOEXEC);
+    fcntl(out_pipe[0], F_SETFD, FD_CLOEXEC);
+
+    pid_t pid = fork();
+    if (pid == 0) {
+        // Child
+        dup2(in_pipe[0], STDIN_FILENO);
+        dup2(out_pipe[1], STDOUT_FILENO);
+        close(in_pipe[0]);
+        close(out_pipe[1]);
+        execvp(argv[0], (char* const*)argv);
+        _exit(127);
+    }
+    close(in_pipe[0]);
+    close(out_pipe[1]);
+    if (pid < 0) {
+        close(in_pipe[1]);
+        close(out_pipe[0]);
+        return false;
+    }
+    worker->pid = pid;
+    worker->in = fdopen(in_pipe[1], "w");
+    worker->out = fdopen(out_pipe[0], "r");
+    #endif
 
-    if (strcmp(extension, "ts") == 0 || strcmp(extension, "js") == 0) {
+    worker->running = true;
+    worker->requests = 0;
+    if (worker->in == NULL || worker->out == NULL) {
+        _webinix_runtime_worker_stop(worker);
+        return false;
+    }
+    // Unbuffered, so waiting on the pipe (`_webinix_runtime_worker_wait()`)
+    // never misses output already read into a stdio buffer
+    setvbuf(worker->out, NULL, _IONBF, 0);
+    return true;
+}
 
-        // TypeScript / JavaScript
+static bool _webinix_runtime_worker_wait(_webinix_runtime_worker_t* worker, _webinix_timer_t* timer, size_t timeout) {
 
-        if (!_webinix_file_exist(full_path)) {
+    // Wait until the worker output is readable (or closed), returns
+    // false when the request timeout is reached first
+    if (timeout == 0)
+        return true;
+    #ifdef _WIN32
+    HANDLE pipe = (HANDLE)_get_osfhandle(_fileno(worker->out));
+    for (;;) {
+        DWORD available = 0;
+        if (!PeekNamedPipe(pipe, NULL, 0, NULL, &available, NULL) || available > 0)
+            return true;
+        if (_webinix_timer_is_end(timer, timeout * 1000))
+            return false;
+        Sleep(10);
+    }
+    #else
+    for (;;) {
+        _webinix_timer_clock_gettime(&timer->now);
+        long elapsed = _webinix_timer_diff(&timer->start, &timer->now);
+        long remaining = ((long)timeout * 1000) - elapsed;
+        if (remaining <= 0)
+            return false;
+        struct pollfd pfd;
+        pfd.fd = fileno(worker->out);
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+        int ret = poll(&pfd, 1, (int)remaining);
+        if (ret > 0)
+            return true;
+        if (ret < 0 && errno != EINTR)
+            return true;
+    }
+    #endif
+}
 
-            // File not exist - 404
+static int _webinix_runtime_worker_line(_webinix_runtime_worker_t* worker, _webinix_timer_t* timer,
+    size_t timeout, char* buffer, size_t size) {
+
+    // Read a line (or what fits in `buffer`) without waiting past the
+    // request timeout. Returns `1` when read, `0` at the end of the
+    // output, and `-2` on timeout. The output is unbuffered, so each
+    // byte is waited for.
+    size_t len = 0;
+    while (len < (size - 1)) {
+        if (!_webinix_runtime_worker_wait(worker, timer, timeout))
+            return -2;
+        int c = fgetc(worker->out);
+        if (c == EOF)
+            break;
+        buffer[len++] = (char)c;
+        if (c == '\n')
+            break;
+    }
+    buffer[len] = '\0';
+    return (len > 0 ? 1 : 0);
+}
+
+static bool _webinix_runtime_worker_alive(_webinix_runtime_worker_t* worker) {
+
+    #ifdef _WIN32
+    return (WaitForSingleObject(worker->process, 0) == WAIT_TIMEOUT);
+    #else
+    if (worker->pid <= 0)
+        return false;
+    if (waitpid(worker->pid, NULL, WNOHANG) == 0)
+        return true;
+    // Exited (and reaped)
+    worker->pid = 0;
+    return false;
+    #endif
+}
+
+static void _webinix_runtime_worker_stop(_webinix_runtime_worker_t* worker) {
+
+    if (!worker->running)
+        return;
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_runtime_worker_stop()\n");
+    #endif
+
+    // Closing stdin ends the worker's request loop
+    if (worker->in != NULL)
+        fclose(worker->in);
+    if (worker->out != NULL)
+        fclose(worker->out);
+    #ifdef _WIN32
+    if (WaitForSingleObject(worker->process, 0) == WAIT_TIMEOUT)
+        TerminateProcess(worker->process, 0);
+    CloseHandle(worker->process);
+    worker->process = NULL;
+    #else
+    if (_webinix_runtime_worker_alive(worker)) {
+        kill(worker->pid, SIGKILL);
+        waitpid(worker->pid, NULL, 0);
+    }
+    worker->pid = 0;
+    #endif
+    worker->in = NULL;
+    worker->out = NULL;
+    worker->running = false;
+}
+
+static int _webinix_runtime_worker_run(_webinix_runtime_worker_t* worker, webinix_response_t* response, const char* request) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_runtime_worker_run()\n");
+    #endif
+
+    // Returns `1` when the response is complete, `0` if the worker failed
+    // before sending anything, `-1` if it failed in the middle, and `-2`
+    // if the script did not finish in time (a hung script).
+
+    if (fputs(request, worker->in) < 0 || fflush(worker->in) != 0)
+        return 0;
+
+    _webinix_mutex_lock(&_webinix.mutex_runtime);
+    size_t timeout = _webinix.runtime_timeout;
+    _webinix_mutex_unlock(&_webinix.mutex_runtime);
+    _webinix_timer_t timer;
+    _webinix_timer_start(&timer);
+
+    char buffer[WEBUI_RUNTIME_BUF];
+    bool output = false;
+    for (;;) {
+        int line = _webinix_runtime_worker_line(worker, &timer, timeout, buffer, sizeof(buffer));
+        if (line == -2)
+            return -2;
+        if (line == 0)
+            break;
+
+        // Frame: `WEBUI <length>\n<data>`
+        size_t len = 0;
+        if (strncmp(buffer, "WEBUI ", 6) != 0 || sscanf(buffer + 6, "%zu", &len) != 1) {
+            // Stray runtime output
+            continue;
+        }
+        if (len == 0)
+            return 1;
+
+        if (!response->begun)
+            webinix_response_begin(response, 200, "text/plain", -1, NULL);
+        output = true;
+
+        // Stream the data to the client. If the client is gone
+        // the data is still read, to keep the frames in sync.
+        while (len > 0) {
+            if (!_webinix_runtime_worker_wait(worker, &timer, timeout))
+                return -2;
+            size_t n = fread(buffer, 1, (len < sizeof(buffer) ? len : sizeof(buffer)), worker->out);
+            if (n == 0)
+                return -1;
+            webinix_response_write(response, buffer, n);
+            len -= n;
+        }
+    }
+    return (output ? -1 : 0);
+}
+
+static bool _webinix_runtime_pool_serve(_webinix_window_t* win, struct mg_connection* client,
+    size_t runtime, const char* path, const char* query) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_runtime_pool_serve([%zu], [%s])\n", runtime, path);
+    #endif
+
+    if (runtime != Deno && runtime != NodeJS && runtime != Bun)
+        return false;
+    _webinix_runtime_pool_t* pool = &_webinix.runtime_pools[runtime];
+
+    // Request: `{"path":"...","query":"..."}\n`
+    size_t request_len = ((_webinix_strlen(path) + _webinix_strlen(query)) * 6) + 32;
+    char* request = (char*)_webinix_malloc(request_len);
+    size_t pos = 0;
+    const char* fields[2] = {path, (query != NULL ? query : "")};
+    for (size_t f = 0; f < 2; f++) {
+        pos += WEBUI_SN_PRINTF_DYN(request + pos, request_len - pos, (f == 0 ? "{\"path\":\"" : "\",\"query\":\""));
+        for (const unsigned char* c = (const unsigned char*)fields[f]; *c != 0; c++) {
+            if (*c == '"' || *c == '\\')
+                pos += WEBUI_SN_PRINTF_DYN(request + pos, request_len - pos, "\\%c", *c);
+            else if (*c < 0x20)
+                pos += WEBUI_SN_PRINTF_DYN(request + pos, request_len - pos, "\\u%04x", *c);
+            else
+                request[pos++] = (char)*c;
+        }
+    }
+    WEBUI_SN_PRINTF_DYN(request + pos, request_len - pos, "\"}\n");
+
+    // Scripts can take long, let other requests be served meanwhile
+    _webinix_mutex_unlock(&_webinix.mutex_http_handler);
+
+    // Wait for an idle worker
+    _webinix_runtime_worker_t* worker = NULL;
+    _webinix_mutex_lock(&_webinix.mutex_runtime);
+    if (pool->count > 0 && _webinix_runtime_worker_script()) {
+        while (pool->count > 0 && !_webinix_mutex_app_is_exit_now(WEBUI_MUTEX_GET_STATUS)) {
+            for (size_t i = 0; i < pool->count; i++) {
+                if (!pool->workers[i].busy) {
+                    worker = &pool->workers[i];
+                    worker->busy = true;
+                    break;
+                }
+            }
+            if (worker != NULL)
+                break;
+            _webinix_condition_wait(&_webinix.condition_runtime, &_webinix.mutex_runtime);
+        }
+    }
+    _webinix_mutex_unlock(&_webinix.mutex_runtime);
+
+    webinix_response_t response;
+    memset(&response, 0, sizeof(response));
+    response.win = win;
+    response.client = client;
+    response.remaining = -1;
+    int result = 0;
+
+    if (worker != NULL) {
+        // A crashed worker is restarted, and the request is retried
+        // once if nothing was sent yet. A hung worker is killed, and
+        // started again on the next request.
+        for (int attempt = 0; attempt < 2 && result == 0; attempt++) {
+            // Health check
+            if (worker->running &&
+                (!_webinix_runtime_worker_alive(worker) || worker->requests >= WEBUI_RUNTIME_MAX_REQUESTS)) {
+                _webinix_runtime_worker_stop(worker);
+            }
+            if (!worker->running && !_webinix_runtime_worker_start(worker, runtime))
+                break;
+            result = _webinix_runtime_worker_run(worker, &response, request);
+            if (result == 1)
+                worker->requests++;
+            else
+                _webinix_runtime_worker_stop(worker);
+        }
+
+        // Release the worker
+        _webinix_mutex_lock(&_webinix.mutex_runtime);
+        worker->busy = false;
+        if ((size_t)(worker - pool->workers) >= pool->count)
+            _webinix_runtime_worker_stop(worker);
+        _webinix_condition_signal(&_webinix.condition_runtime);
+        _webinix_mutex_unlock(&_webinix.mutex_runtime);
+    }
+
+    // A response is begun and ended without `mutex_http_handler`
+    if (result == 1) {
+        if (!response.begun) {
+            // Empty output, send back an empty `200 OK`
+            webinix_response_begin(&response, 200, "text/plain", 0, NULL);
+        }
+        webinix_response_end(&response);
+    }
+
+    _webinix_mutex_lock(&_webinix.mutex_http_handler);
+    _webinix_free_mem((void*)request);
+
+    if (!response.begun) {
+        if (result == 0) {
+            // Pool disabled or runtime not available,
+            // run the script in a new process instead
+            return false;
+        }
+        if (result == -2) {
+            #ifdef WEBUI_LOG
+            printf("[Core]\t\t_webinix_runtime_pool_serve() -> Script timeout\n");
+            #endif
+            _webinix_http_send_error(client, webinix_html_res_not_available, 504);
+            return true;
+        }
+        if (result == -1) {
+            #ifdef WEBUI_LOG
+            printf("[Core]\t\t_webinix_runtime_pool_serve() -> Worker failed\n");
+            #endif
+            _webinix_http_send_error(client, webinix_html_res_not_available, 502);
+            return true;
+        }
+    }
+    if (result != 1) {
+        // Failed in the middle, no last chunk. The connection
+        // is closed, so the client sees a truncated body.
+        #ifdef WEBUI_LOG
+        printf("[Core]\t\t_webinix_runtime_pool_serve() -> Truncated response\n");
+        #endif
+    }
+    return true;
+}
+
+static void _webinix_runtime_pool_stop_all(void) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_runtime_pool_stop_all()\n");
+    #endif
+
+    _webinix_mutex_lock(&_webinix.mutex_runtime);
+    for (size_t r = 0; r < (sizeof(_webinix.runtime_pools) / sizeof(_webinix.runtime_pools[0])); r++) {
+        _webinix_runtime_pool_t* pool = &_webinix.runtime_pools[r];
+        pool->count = 0;
+        for (size_t i = 0; i < WEBUI_RUNTIME_MAX_WORKERS; i++) {
+            if (!pool->workers[i].busy)
+                _webinix_runtime_worker_stop(&pool->workers[i]);
+        }
+    }
+    _webinix_condition_broadcast(&_webinix.condition_runtime);
+    _webinix_mutex_unlock(&_webinix.mutex_runtime);
+}
+
+static int _webinix_interpret_file(_webinix_window_t* win, struct mg_connection* client, char* index, size_t client_id) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_interpret_file()\n");
+    #endif
+
+    // Interpret the file using JavaScript/TypeScript runtimes
+    // and send back the output. otherwise, send the file as a normal text based
+
+    int interpret_http_stat = 200;
+    char* file = NULL;
+    char* full_path = NULL;
+    const char* query = NULL;
+
+    const struct mg_request_info * ri = mg_get_request_info(client);
+    const char* url = _webinix_http_local_uri(win, ri);
+
+    // Get file full path
+    if (index != NULL && !_webinix_is_empty(index)) {
+
+        // Parse as index file
+
+        file = index;
+        full_path = index;
+    } else {
+
+        // Parse as other non-index files
+
+        // Get file name
+        file = _webinix_get_file_name_from_url(url);
+
+        // Get full path
+        full_path = _webinix_get_full_path(win, file);
+    }
+
+    // Get file extension
+    const char* extension = _webinix_get_extension(file);
+
+    if (strcmp(extension, "ts") == 0 || strcmp(extension, "js") == 0) {
+
+        // TypeScript / JavaScript
+
+        if (!_webinix_file_exist(full_path)) {
+
+            // File not exist - 404
             _webinix_http_send_error(client, webinix_html_res_not_available, 404);
 
-            _webinix_free_mem((void*)file);
-            _webinix_free_mem((void*)full_path);
+            if (index == NULL) {
+                _webinix_free_mem((void*)file);
+                _webinix_free_mem((void*)full_path);
+            }
             return 404;
         }
 
         // Get query
         query = ri->query_string;
 
-        if (win->runtime == Deno) {
+        if (win->runtime != None && _webinix_runtime_pool_serve(win, client, win->runtime, full_path, query)) {
+
+            // Served by a long-lived runtime worker
+        }
+        else if (win->runtime == Deno) {
 
             // Use Deno
             if (_webinix_deno_exist(win)) {
@@ -5285,29 +7443,21 @@ static int _webinix_interpret_file(_webinix_window_t* win, struct mg_connection*
                 );
                 #endif
 
-                // Run command
-                const char* out = _webinix_interpret_command(cmd);
-
-                if (out != NULL) {
-
-                    // Send Deno output 200
-                    _webinix_http_send(win, client, "text/plain", out, _webinix_strlen(out), false);
-                }
-                else {
+                // Run command, and stream the Deno output
+                if (!_webinix_interpret_command(win, client, cmd)) {
 
                     // Deno interpretation failed.
                     // Send back an empty `200 OK`
-                    _webinix_http_send(win, client, "text/plain", "", 0, false);
+                    _webinix_http_send(win, client, "text/plain", "", 0, WEBUI_HTTP_NO_CACHE);
                 }
 
                 _webinix_free_mem((void*)cmd);
-                _webinix_free_mem((void*)out);
             }
             else {
 
                 // Deno not installed
                 // Send back an empty `200 OK`
-                _webinix_http_send(win, client, "text/plain", "", 0, false);
+                _webinix_http_send(win, client, "text/plain", "", 0, WEBUI_HTTP_NO_CACHE);
             }
         } else if (win->runtime == Bun) {
 
@@ -5320,29 +7470,21 @@ static int _webinix_interpret_file(_webinix_window_t* win, struct mg_connection*
                 char* cmd = (char*)_webinix_malloc(bf_len);
                 WEBUI_SN_PRINTF_DYN(cmd, bf_len, "bun \"%s\" \"%s\"", full_path, query);
 
-                // Run command
-                const char* out = _webinix_interpret_command(cmd);
-
-                if (out != NULL) {
-
-                    // Send Bun output 200
-                    _webinix_http_send(win, client, "text/plain", out, _webinix_strlen(out), false);
-                }
-                else {
+                // Run command, and stream the Bun output
+                if (!_webinix_interpret_command(win, client, cmd)) {
 
                     // Bun interpretation failed.
                     // Send back an empty `200 OK`
-                    _webinix_http_send(win, client, "text/plain", "", 0, false);
+                    _webinix_http_send(win, client, "text/plain", "", 0, WEBUI_HTTP_NO_CACHE);
                 }
 
                 _webinix_free_mem((void*)cmd);
-                _webinix_free_mem((void*)out);
             }
             else {
 
                 // Bun not installed
                 // Send back an empty `200 OK`
-                _webinix_http_send(win, client, "text/plain", "", 0, false);
+                _webinix_http_send(win, client, "text/plain", "", 0, WEBUI_HTTP_NO_CACHE);
             }
         } else if (win->runtime == NodeJS) {
 
@@ -5356,34 +7498,26 @@ static int _webinix_interpret_file(_webinix_window_t* win, struct mg_connection*
                 char* cmd = (char*)_webinix_malloc(bf_len);
                 WEBUI_SN_PRINTF_DYN(cmd, bf_len, "node \"%s\" \"%s\"", full_path, query);
 
-                // Run command
-                const char* out = _webinix_interpret_command(cmd);
-
-                if (out != NULL) {
-
-                    // Send Node.js output 200
-                    _webinix_http_send(win, client, "text/plain", out, _webinix_strlen(out), false);
-                }
-                else {
+                // Run command, and stream the Node.js output
+                if (!_webinix_interpret_command(win, client, cmd)) {
 
                     // Node.js interpretation failed.
                     // Send back an empty `200 OK`
-                    _webinix_http_send(win, client, "text/plain", "", 0, false);
+                    _webinix_http_send(win, client, "text/plain", "", 0, WEBUI_HTTP_NO_CACHE);
                 }
 
                 _webinix_free_mem((void*)cmd);
-                _webinix_free_mem((void*)out);
             } else {
 
                 // Node.js not installed
                 // Send back an empty `200 OK`
-                _webinix_http_send(win, client, "text/plain", "", 0, false);
+                _webinix_http_send(win, client, "text/plain", "", 0, WEBUI_HTTP_NO_CACHE);
             }
         } else {
 
             // Unknown runtime
             // Serve as a normal text-based file 200
-            _webinix_http_send_file(win, client, mg_get_builtin_mime_type(url), full_path, false);
+            _webinix_http_send_file(win, client, mg_get_builtin_mime_type(url), full_path, WEBUI_HTTP_NO_CACHE);
         }
     } else {
 
@@ -5393,13 +7527,16 @@ static int _webinix_interpret_file(_webinix_window_t* win, struct mg_connection*
         interpret_http_stat = _webinix_serve_file(win, client, client_id);
     }
 
-    _webinix_free_mem((void*)file);
-    _webinix_free_mem((void*)full_path);
+    if (index == NULL) {
+        // Otherwise both are `index`, owned by the caller
+        _webinix_free_mem((void*)file);
+        _webinix_free_mem((void*)full_path);
+    }
 
     return interpret_http_stat;
 }
 
-static const char* _webinix_generate_js_bridge(_webinix_window_t* win, struct mg_connection* client) {
+static bool _webinix_generate_js_bridge(_webinix_window_t* win, char* buffer, size_t buffer_len) {
 
     #ifdef WEBUI_LOG
     printf("[Core]\t\t_webinix_generate_js_bridge()\n");
@@ -5415,7 +7552,7 @@ static const char* _webinix_generate_js_bridge(_webinix_window_t* win, struct mg
             // Non-authorized request to `webinix.js` because
             // the single client already connected.
             _webinix_mutex_unlock(&_webinix.mutex_bridge);
-            return NULL;
+            return false;
         }
         if (win->token == 0) {
             win->token = _webinix_generate_random_uint32();
@@ -5425,42 +7562,59 @@ static const char* _webinix_generate_js_bridge(_webinix_window_t* win, struct mg
     else {
         // Multi client mode
         if (win->token == 0) {
+            #ifndef _WIN32
+            if (_webinix.cluster_running)
+                // Same token in all cluster workers
+                win->token = (_webinix.cluster_secret ^ ((uint32_t)win->num * 0x9E3779B9u)) | 1u;
+            else
+            #endif
             win->token = _webinix_generate_random_uint32();
         }
         token = win->token;
     }
 
-    // Generate the full Webinix Bridge
+    // Generate the per-window bridge configuration. The bridge itself
+    // is static and cached by the browser (`/webinix_bridge.js`).
     #ifdef WEBUI_LOG
     const char* log = "true";
     #else
     const char* log = "false";
     #endif
-    size_t len = 256 + _webinix_strlen((const char*)webinix_javascript_bridge);
-    char* js = (char*)_webinix_malloc(len);
     #ifdef WEBUI_TLS
     const char* TLS = "true";
     #else
     const char* TLS = "false";
     #endif
-    int c = WEBUI_SN_PRINTF_DYN(
-        js, len,
-        "%s\n document.addEventListener(\"DOMContentLoaded\",function(){ globalThis.webinix = "
-        "new WebuiBridge({ secure: %s, token: %" PRIu32 ", port: %zu, log: %s, ",
-        webinix_javascript_bridge, TLS, token, win->server_port, log
-    );
+    char size[64] = {0};
+    char position[64] = {0};
     // Window Size
     if (win->size_set)
-        c += WEBUI_SN_PRINTF_DYN(js + c, len, "winW: %u, winH: %u, ", win->width, win->height);
+        WEBUI_SN_PRINTF_STATIC(size, sizeof(size), ", winW: %u, winH: %u", win->width, win->height);
     // Window Position
     if (win->position_set)
-        c += WEBUI_SN_PRINTF_DYN(js + c, len, "winX: %u, winY: %u, ", win->x, win->y);
-    // Close
-    WEBUI_STR_CAT_DYN(js, len, "});});");
+        WEBUI_SN_PRINTF_STATIC(position, sizeof(position), ", winX: %u, winY: %u", win->x, win->y);
+    // A parser-blocking `document.write()` keeps `WebuiBridge` defined
+    // right after `<script src="/webinix.js">` as before, otherwise
+    // (async, or injected after load) the bridge is appended.
+    int c = WEBUI_SN_PRINTF_STATIC(
+        buffer, buffer_len,
+        "(function(){"
+        "var o={ secure: %s, token: %" PRIu32 ", port: %zu, path: \"%s\", local: %s, log: %s%s%s };"
+        "var u=\"/webinix_bridge.js?v=%.16s\";"
+        "function i(){ globalThis.webinix = new WebuiBridge(o); }"
+        "function r(){ if(document.readyState===\"loading\") document.addEventListener(\"DOMContentLoaded\",i); else i(); }"
+        "var s=document.currentScript;"
+        "if(typeof WebuiBridge!==\"undefined\") r();"
+        "else if(document.readyState===\"loading\"&&s&&!s.async&&!s.defer){"
+        " document.write('<script src=\"'+u+'\"><\\/script>'); document.addEventListener(\"DOMContentLoaded\",i); }"
+        "else{ var e=document.createElement(\"script\"); e.src=u; e.onload=r; document.head.appendChild(e); }"
+        "})();",
+        TLS, token, win->server_port, win->url_prefix, (win->wv_in_process ? "true" : "false"),
+        log, size, position, (WEBUI_BRIDGE_ETAG + 1)
+    );
 
-    // Free
     _webinix_mutex_unlock(&_webinix.mutex_bridge);
-    return js;
+    return (c > 0 && (size_t)c < buffer_len);
 }
 
 static bool _webinix_mutex_is_connected(_webinix_window_t* win, int update) {
@@ -5471,6 +7625,8 @@ static bool _webinix_mutex_is_connected(_webinix_window_t* win, int update) {
     else if (update == WEBUI_MUTEX_SET_FALSE) win->connected = false;
     status = ((win->clients_count > 0) && (win->connected));
     _webinix_mutex_unlock(&_webinix.mutex_win_connect);
+    if (update != WEBUI_MUTEX_GET_STATUS)
+        _webinix_server_notify(win);
     return status;
 }
 
@@ -5504,6 +7660,14 @@ static bool _webinix_mutex_app_is_exit_now(int update) {
     else if (update == WEBUI_MUTEX_SET_FALSE) _webinix.app_exit_now = false;
     status = _webinix.app_exit_now;
     _webinix_mutex_unlock(&_webinix.mutex_app_exit_now);
+    if (update == WEBUI_MUTEX_SET_TRUE) {
+        // Wake up all server threads
+        _webinix_wins_view_t* view = _webinix_wins_view();
+        for (size_t i = 1; i < view->capacity; i++) {
+            if (view->wins[i] != NULL)
+                _webinix_server_notify(view->wins[i]);
+        }
+    }
     return status;
 }
 
@@ -5514,10 +7678,44 @@ static bool _webinix_mutex_win_is_exit_now(_webinix_window_t* win, int update) {
     if (update == WEBUI_MUTEX_SET_TRUE) win->win_exit_now = true;
     else if (update == WEBUI_MUTEX_SET_FALSE) win->win_exit_now = false;
     status = win->win_exit_now;
+    if (update == WEBUI_MUTEX_SET_TRUE) {
+        win->server_notified = true;
+        _webinix_condition_signal(&win->condition_server);
+    }
     _webinix_mutex_unlock(&win->mutex_win_exit_now);
     return status;
 }
 
+static void _webinix_server_notify(_webinix_window_t* win) {
+
+    // Wake up the window server thread, its connection
+    // or exit status has changed
+    _webinix_mutex_lock(&win->mutex_win_exit_now);
+    win->server_notified = true;
+    _webinix_condition_signal(&win->condition_server);
+    _webinix_mutex_unlock(&win->mutex_win_exit_now);
+}
+
+static void _webinix_server_wait(_webinix_window_t* win, _webinix_timer_t* timer, size_t ms) {
+
+    // Sleep until `_webinix_server_notify()`, or until
+    // `ms` since `timer` start. No timer waits forever.
+    _webinix_mutex_lock(&win->mutex_win_exit_now);
+    if (!win->server_notified) {
+        if (timer == NULL)
+            _webinix_condition_wait(&win->condition_server, &win->mutex_win_exit_now);
+        else {
+            _webinix_timer_clock_gettime(&timer->now);
+            long elapsed = _webinix_timer_diff(&timer->start, &timer->now);
+            if (elapsed >= 0 && (size_t)elapsed <= ms)
+                _webinix_condition_timedwait(&win->condition_server, &win->mutex_win_exit_now,
+                    (ms - (size_t)elapsed) + 1);
+        }
+    }
+    win->server_notified = false;
+    _webinix_mutex_unlock(&win->mutex_win_exit_now);
+}
+
 static bool _webinix_mutex_is_webview_update(_webinix_window_t* win, int update) {
 
     bool status = false;
@@ -5861,6 +8059,22 @@ static void _webinix_send_all(_webinix_window_t* win, uint16_t id, unsigned char
     printf("[Core]\t\t_webinix_send_all()\n");
     #endif
 
+    (void)id;
+    _webinix_send_all_local(win, cmd, data, len);
+
+    // Cluster, the other workers send it to their own clients.
+    // A close is not relayed, as each worker closes its clients
+    // on its own exit.
+    if (_webinix.config.cluster && cmd != WEBUI_CMD_CLOSE)
+        _webinix_cluster_publish(WEBUI_CLUSTER_SEND, win->num, cmd, data, len);
+}
+
+static void _webinix_send_all_local(_webinix_window_t* win, unsigned char cmd, const char* data, size_t len) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_send_all_local()\n");
+    #endif
+
     // Send the WebSocket packet to a all connected clients if
     // `multi_client` mode is enabled, if not then send packet
     // to the only single connected client.
@@ -5868,12 +8082,7 @@ static void _webinix_send_all(_webinix_window_t* win, uint16_t id, unsigned char
     // Send the packet
     if (_webinix.config.multi_client) {
         // Loop trough all connected clients in this window
-        for (size_t i = 0; i < WEBUI_MAX_IDS; i++) {
-            if ((_webinix.clients[i] != NULL) && (_webinix.clients_win_num[i] == win->num) && 
-                (_webinix_mutex_is_multi_client_token_valid(win, WEBUI_MUTEX_GET_STATUS, i))) {
-                _webinix_send_client(win, _webinix.clients[i], 0, cmd, data, len, false);
-            }
-        }
+        _webinix_send_all_clients(win, cmd, data, len);
     } else {
         // Single client
         if ((win->single_client != NULL) && (_webinix_mutex_is_single_client_token_valid(win, WEBUI_MUTEX_GET_STATUS))) {
@@ -5882,10 +8091,30 @@ static void _webinix_send_all(_webinix_window_t* win, uint16_t id, unsigned char
     }
 }
 
+static void _webinix_send_all_clients(_webinix_window_t* win, unsigned char cmd, const char* data, size_t len) {
+
+    // Every client of this window with a valid token, lock-free
+    const _webinix_clients_view_t* view = NULL;
+    size_t used = _webinix_clients_snapshot(&view);
+    for (size_t i = 0; i < used; i++) {
+        if ((view->clients[i] != NULL) && (view->win_num[i] == win->num) && 
+            (_webinix_mutex_is_multi_client_token_valid(win, WEBUI_MUTEX_GET_STATUS, i))) {
+            _webinix_send_client(win, view->clients[i], 0, cmd, data, len, false);
+        }
+    }
+}
+
 static void _webinix_send_client(
     _webinix_window_t* win, struct mg_connection *client, 
     uint16_t id, unsigned char cmd, const char* data, size_t len, bool token_bypass) {
 
+    _webinix_send_client_arena(win, client, id, cmd, data, len, token_bypass, NULL);
+}
+
+static void _webinix_send_client_arena(
+    _webinix_window_t* win, struct mg_connection *client, 
+    uint16_t id, unsigned char cmd, const char* data, size_t len, bool token_bypass, _webinix_arena_t* arena) {
+
     #ifdef WEBUI_LOG
     printf("[Core]\t\t_webinix_send_client()\n");
     #endif
@@ -5919,7 +8148,10 @@ static void _webinix_send_client(
 
     // Prepare the packet
     size_t packet_len = WEBUI_PROTOCOL_SIZE + len + 1;
-    char* packet = (char*)_webinix_malloc(packet_len);
+    char* packet = (char*)_webinix_arena_alloc(arena, packet_len);
+    if (packet == NULL)
+        packet = (char*)_webinix_pool_get(packet_len);
+    packet[packet_len - 1] = 0x00;
 
     // Signature (1 Byte)
     packet[WEBUI_PROTOCOL_SIGN] = WEBUI_SIGNATURE;
@@ -5950,7 +8182,8 @@ static void _webinix_send_client(
     _webinix_send_client_ws(win, client, connection_id, packet, packet_len);
 
     // Free
-    _webinix_free_mem((void*)packet);
+    if (!_webinix_arena_owns(arena, packet))
+        _webinix_pool_put((void*)packet);
 }
 
 static char* _webinix_str_dup(const char* src) {
@@ -6854,8 +9087,68 @@ static void _webinix_clean(void) {
     // Clean all servers services
     mg_exit_library();
 
-    // Free all non-freed memory allocations
-    _webinix_free_all_mem();
+    // Stop all runtime workers
+    _webinix_runtime_pool_stop_all();
+
+    // Free all asset bundles and archives (unmap files)
+    _webinix_wins_view_t* view = _webinix_wins_view();
+    for (size_t i = 1; i < view->capacity; i++) {
+        if (view->wins[i] != NULL) {
+            _webinix_bundle_free(view->wins[i]->bundle);
+            _webinix_bundle_free(view->wins[i]->archive);
+            view->wins[i]->bundle = NULL;
+            view->wins[i]->archive = NULL;
+        }
+    }
+
+    #ifdef WEBUI_TLS
+    // Self-signed certificate generation may still be running
+    _webinix_mutex_lock(&_webinix.mutex_tls);
+    while (_webinix.tls_preparing)
+        _webinix_condition_wait(&_webinix.condition_tls, &_webinix.mutex_tls);
+    _webinix_mutex_unlock(&_webinix.mutex_tls);
+    #endif
+
+    // Buffers cached by this thread, and the shared pool
+    _webinix_pool_flush();
+    _webinix_mutex_lock(&_webinix.mutex_pool);
+    for (size_t c = 0; c < WEBUI_POOL_CLASSES; c++) {
+        _webinix_pool_shared_t* shared = &_webinix.pool_shared[c];
+        while (shared->count > 0)
+            _webinix_free_mem(shared->cached[--shared->count]);
+    }
+    _webinix_mutex_unlock(&_webinix.mutex_pool);
+
+    // Tables replaced by a growth
+    _webinix_mutex_lock(&_webinix.mutex_tables);
+    while (_webinix.retired != NULL) {
+        _webinix_retired_t* retired = _webinix.retired;
+        _webinix.retired = retired->next;
+        _webinix_free_mem(retired->table);
+        _webinix_free_mem((void*)retired);
+    }
+    _webinix_mutex_unlock(&_webinix.mutex_tables);
+
+    // Free all blocks still allocated
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_clean() -> Freeing %zu blocks (%zu bytes)\n",
+        (size_t)WEBUI_ATOMIC_ADD(&_webinix.mem_blocks, 0), (size_t)WEBUI_ATOMIC_ADD(&_webinix.mem_bytes, 0));
+    #endif
+    for (size_t i = 0; i < WEBUI_MEM_BUCKETS; i++) {
+        _webinix_mutex_lock(&_webinix.mutex_mem[i % WEBUI_MEM_SHARDS]);
+        _webinix_mem_header_t* header = _webinix.mem_registry[i];
+        _webinix.mem_registry[i] = NULL;
+        _webinix_mutex_unlock(&_webinix.mutex_mem[i % WEBUI_MEM_SHARDS]);
+        while (header != NULL) {
+            _webinix_mem_header_t* next = header->next;
+            header->magic = 0;
+            WEBUI_ATOMIC_ADD(&_webinix.mem_blocks, (size_t)-1);
+            WEBUI_ATOMIC_ADD(&_webinix.mem_bytes, (size_t)0 - (size_t)header->size);
+            WEBUI_ATOMIC_ADD(&_webinix.mem_live[header->category], (size_t)0 - (size_t)header->size);
+            free(header);
+            header = next;
+        }
+    }
 
     // Destroy all mutex
     _webinix_mutex_destroy(&_webinix.mutex_server_start);
@@ -6868,7 +9161,21 @@ static void _webinix_clean(void) {
     _webinix_mutex_destroy(&_webinix.mutex_http_handler);
     _webinix_mutex_destroy(&_webinix.mutex_client);
     _webinix_mutex_destroy(&_webinix.mutex_async_response);
-    _webinix_mutex_destroy(&_webinix.mutex_mem);
+    _webinix_mutex_destroy(&_webinix.mutex_async_legacy);
+    _webinix_mutex_destroy(&_webinix.mutex_runtime);
+    _webinix_mutex_destroy(&_webinix.mutex_path_cache);
+    _webinix_mutex_destroy(&_webinix.mutex_cluster);
+    _webinix_mutex_destroy(&_webinix.mutex_ports);
+    _webinix_mutex_destroy(&_webinix.mutex_tables);
+    _webinix_mutex_destroy(&_webinix.mutex_pool);
+    _webinix_mutex_destroy(&_webinix.mutex_sessions);
+    for (size_t i = 0; i < WEBUI_MEM_SHARDS; i++)
+        _webinix_mutex_destroy(&_webinix.mutex_mem[i]);
+    #ifdef WEBUI_TLS
+    _webinix_mutex_destroy(&_webinix.mutex_tls);
+    _webinix_condition_destroy(&_webinix.condition_tls);
+    #endif
+    _webinix_condition_destroy(&_webinix.condition_runtime);
     _webinix_mutex_destroy(&_webinix.mutex_token);
     _webinix_condition_destroy(&_webinix.condition_wait);
 
@@ -7882,61 +10189,48 @@ static bool _webinix_tls_generate_self_signed_cert(char* root_cert, char* root_k
 
     return true;
 }
-#endif
 
-static bool _webinix_show_window(_webinix_window_t* win, struct mg_connection* client, const char* content, int type, size_t browser) {
+#ifdef _WIN32
+static DWORD WINAPI _webinix_tls_prepare_thread(LPVOID arg) {
+#else
+static void * _webinix_tls_prepare_thread(void * arg) {
+#endif
 
     #ifdef WEBUI_LOG
-    if (type == WEBUI_SHOW_HTML)
-        printf("[Core]\t\t_webinix_show_window(HTML, [%zu])\n", browser);
-    else if (type == WEBUI_SHOW_URL)
-        printf("[Core]\t\t_webinix_show_window(URL, [%zu])\n", browser);
-    else if (type == WEBUI_SHOW_FOLDER)
-        printf("[Core]\t\t_webinix_show_window(FOLDER, [%zu])\n", browser);
-    else
-        printf("[Core]\t\t_webinix_show_window(FILE, [%zu])\n", browser);
+    printf("[Core]\t\t_webinix_tls_prepare_thread() -> Generating self-signed TLS "
+        "certificate\n");
     #endif
 
-    #ifdef WEBUI_TLS
-    // TLS
-    if (_webinix_is_empty(_webinix.ssl_cert) || _webinix_is_empty(_webinix.ssl_key)) {
-
-        #ifdef WEBUI_LOG
-        printf("[Core]\t\t_webinix_show_window() -> Generating self-signed TLS "
-            "certificate\n");
-        #endif
+    (void)arg;
 
-        // Generate SSL self-signed certificate once
-        char* root_cert = (char*)_webinix_malloc(WEBUI_SSL_SIZE);
-        char* root_key = (char*)_webinix_malloc(WEBUI_SSL_SIZE);
-        char* ssl_cert = (char*)_webinix_malloc(WEBUI_SSL_SIZE);
-        char* ssl_key = (char*)_webinix_malloc(WEBUI_SSL_SIZE);
-        if (!_webinix_tls_generate_self_signed_cert(root_cert, root_key, ssl_cert, ssl_key)) {
-            #ifdef WEBUI_LOG
-            unsigned long err = ERR_get_error();
-            char err_buf[1024];
-            ERR_error_string_n(err, err_buf, sizeof(err_buf));
-            printf(
-                "[Core]\t\t_webinix_show_window() -> Generating self-signed TLS "
-                "certificate failed:\n%s\n",
-                err_buf
-            );
-            #endif
-            _webinix_free_mem((void*)root_cert);
-            _webinix_free_mem((void*)root_key);
-            _webinix_free_mem((void*)ssl_cert);
-            _webinix_free_mem((void*)ssl_key);
-            WEBUI_ASSERT("Generating self-signed TLS certificate failed");
-            return false;
-        }
+    // Generate SSL self-signed certificate once
+    char* root_cert = (char*)_webinix_malloc(WEBUI_SSL_SIZE);
+    char* root_key = (char*)_webinix_malloc(WEBUI_SSL_SIZE);
+    char* ssl_cert = (char*)_webinix_malloc(WEBUI_SSL_SIZE);
+    char* ssl_key = (char*)_webinix_malloc(WEBUI_SSL_SIZE);
+    bool generated = _webinix_tls_generate_self_signed_cert(root_cert, root_key, ssl_cert, ssl_key);
+    #ifdef WEBUI_LOG
+    if (!generated) {
+        unsigned long err = ERR_get_error();
+        char err_buf[1024];
+        ERR_error_string_n(err, err_buf, sizeof(err_buf));
+        printf(
+            "[Core]\t\t_webinix_tls_prepare_thread() -> Generating self-signed TLS "
+            "certificate failed:\n%s\n",
+            err_buf
+        );
+    }
+    #endif
 
+    _webinix_mutex_lock(&_webinix.mutex_tls);
+    if (generated && (_webinix_is_empty(_webinix.ssl_cert) || _webinix_is_empty(_webinix.ssl_key))) {
         _webinix.root_cert = root_cert;
         _webinix.root_key = root_key;
         _webinix.ssl_cert = ssl_cert;
         _webinix.ssl_key = ssl_key;
 
         #ifdef WEBUI_LOG
-        printf("[Core]\t\t_webinix_show_window() -> Self-signed SSL/TLS "
+        printf("[Core]\t\t_webinix_tls_prepare_thread() -> Self-signed SSL/TLS "
             "Certificate:\nRoot:\n");
         printf("%s\n", (const char*)_webinix.root_cert);
         printf("%s\nServer:\n", (const char*)_webinix.root_key);
@@ -7944,25 +10238,119 @@ static bool _webinix_show_window(_webinix_window_t* win, struct mg_connection* c
         printf("%s\n", (const char*)_webinix.ssl_key);
         #endif
     }
-    #endif
+    else {
+        // Failed, or the user has set a certificate meanwhile
+        _webinix_free_mem((void*)root_cert);
+        _webinix_free_mem((void*)root_key);
+        _webinix_free_mem((void*)ssl_cert);
+        _webinix_free_mem((void*)ssl_key);
+    }
+    _webinix.tls_preparing = false;
+    _webinix_condition_broadcast(&_webinix.condition_tls);
+    _webinix_mutex_unlock(&_webinix.mutex_tls);
 
-    // Initialization
-    _webinix_mutex_win_is_exit_now(win, WEBUI_MUTEX_SET_FALSE);
-    if (win->html != NULL)
-        _webinix_free_mem((void*)win->html);
-    if (win->url != NULL)
-        _webinix_free_mem((void*)win->url);
+    if (!generated)
+        WEBUI_ASSERT("Generating self-signed TLS certificate failed");
 
-    // Get network ports
-    if (win->custom_server_port > 0) win->server_port = win->custom_server_port;
-    else if (win->server_port == 0) win->server_port = _webinix_get_free_port();
+    WEBUI_THREAD_RETURN
+}
 
-    // Generate the server URL
-    win->url = (char*)_webinix_malloc(32); // [http][domain][port]
-    WEBUI_SN_PRINTF_DYN(win->url, 32, WEBUI_HTTP_PROTOCOL "localhost:%zu", win->server_port);
+static void _webinix_tls_prepare(bool wait) {
 
-    // Generate the window URL
-    char* window_url = NULL;
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_tls_prepare([%d])\n", wait);
+    #endif
+
+    // Start generating the self-signed certificate, if there is
+    // no certificate yet, and optionally wait until it is ready
+    _webinix_mutex_lock(&_webinix.mutex_tls);
+    if (!_webinix.tls_preparing &&
+        (_webinix_is_empty(_webinix.ssl_cert) || _webinix_is_empty(_webinix.ssl_key))) {
+        _webinix.tls_preparing = true;
+        #ifdef _WIN32
+        HANDLE thread = CreateThread(NULL, 0, _webinix_tls_prepare_thread, NULL, 0, NULL);
+        if (thread != NULL)
+            CloseHandle(thread);
+        else _webinix.tls_preparing = false;
+        #else
+        pthread_t thread;
+        if (pthread_create(&thread, NULL, &_webinix_tls_prepare_thread, NULL) == 0)
+            pthread_detach(thread);
+        else _webinix.tls_preparing = false;
+        #endif
+    }
+    if (wait) {
+        while (_webinix.tls_preparing)
+            _webinix_condition_wait(&_webinix.condition_tls, &_webinix.mutex_tls);
+    }
+    _webinix_mutex_unlock(&_webinix.mutex_tls);
+}
+#endif
+
+static bool _webinix_show_window(_webinix_window_t* win, struct mg_connection* client, const char* content, int type, size_t browser) {
+
+    #ifdef WEBUI_LOG
+    if (type == WEBUI_SHOW_HTML)
+        printf("[Core]\t\t_webinix_show_window(HTML, [%zu])\n", browser);
+    else if (type == WEBUI_SHOW_URL)
+        printf("[Core]\t\t_webinix_show_window(URL, [%zu])\n", browser);
+    else if (type == WEBUI_SHOW_FOLDER)
+        printf("[Core]\t\t_webinix_show_window(FOLDER, [%zu])\n", browser);
+    else
+        printf("[Core]\t\t_webinix_show_window(FILE, [%zu])\n", browser);
+    #endif
+
+    // Startup timeline
+    _webinix_mutex_lock(&win->mutex_show_timeline);
+    memset(&win->show_timeline, 0, sizeof(win->show_timeline));
+    _webinix_timer_start(&win->show_timer);
+    _webinix_mutex_unlock(&win->mutex_show_timeline);
+    win->show_failed = false;
+
+    #ifdef WEBUI_TLS
+    // TLS, the server thread waits for it
+    _webinix_tls_prepare(false);
+    #endif
+
+    // Initialization
+    _webinix_mutex_win_is_exit_now(win, WEBUI_MUTEX_SET_FALSE);
+    _webinix_free_mem((void*)win->html);
+    _webinix_free_mem((void*)win->url);
+    win->html = NULL;
+    win->url = NULL;
+
+    // Get network ports
+    win->url_prefix[0] = '\0';
+    if (_webinix.config.shared_server) {
+        // All windows share one port, each under its own path
+        _webinix_mutex_lock(&_webinix.mutex_server_start);
+        if (_webinix.shared_port == 0) {
+            if (win->custom_server_port > 0) _webinix.shared_port = win->custom_server_port;
+            else if (win->server_port > 0) _webinix.shared_port = win->server_port;
+            else _webinix.shared_port = _webinix_get_free_port();
+        }
+        else if (win->server_port > 0 && win->server_port != _webinix.shared_port) {
+            _webinix_free_port(win->server_port);
+        }
+        win->server_port = _webinix.shared_port;
+        _webinix_mutex_unlock(&_webinix.mutex_server_start);
+        WEBUI_SN_PRINTF_STATIC(win->url_prefix, sizeof(win->url_prefix), "/_webinix/%zu", win->num);
+    }
+    else if (win->custom_server_port > 0) win->server_port = win->custom_server_port;
+    else if (!win->server_running) {
+        // One bind, no port probing
+        if (!_webinix_listen_socket(win) && win->server_port == 0)
+            win->server_port = _webinix_get_free_port();
+    }
+    _webinix_show_phase(win, &win->show_timeline.port);
+
+    // Generate the server URL
+    win->url = (char*)_webinix_malloc(64); // [http][domain][port][prefix]
+    WEBUI_SN_PRINTF_DYN(win->url, 64, WEBUI_HTTP_PROTOCOL "localhost:%zu%s%s", win->server_port,
+        win->url_prefix, (win->url_prefix[0] != '\0' ? "/" : ""));
+
+    // Generate the window URL
+    char* window_url = NULL;
     if (type == WEBUI_SHOW_HTML) {
 
         const char* user_html = content;
@@ -7997,9 +10385,12 @@ static bool _webinix_show_window(_webinix_window_t* win, struct mg_connection* c
         // Show a window using a local folder
         win->is_embedded_html = false;
         win->html = NULL;
+        _webinix_free_mem((void*)folder_path);
 
-        // Set window URL
-        window_url = win->url;
+        // Set window URL (a copy, `window_url` is freed below)
+        size_t len = _webinix_strlen(win->url);
+        window_url = (char*)_webinix_malloc(len);
+        WEBUI_STR_COPY_DYN(window_url, len, win->url);
     }
     else {
         const char* user_file = content;
@@ -8012,8 +10403,8 @@ static bool _webinix_show_window(_webinix_window_t* win, struct mg_connection* c
         const char* file_url_encoded = _webinix_url_encode(user_file);
         size_t bf_len = (64 + _webinix_strlen(file_url_encoded));
         char* url_encoded = (char*)_webinix_malloc(bf_len); // [http][domain][port] [file_encoded]
-        WEBUI_SN_PRINTF_DYN(url_encoded, bf_len, WEBUI_HTTP_PROTOCOL "localhost:%zu/%s", 
-            win->server_port, file_url_encoded);
+        WEBUI_SN_PRINTF_DYN(url_encoded, bf_len, WEBUI_HTTP_PROTOCOL "localhost:%zu%s/%s", 
+            win->server_port, win->url_prefix, file_url_encoded);
         _webinix_free_mem((void*)file_url_encoded);
         _webinix_free_mem((void*)user_file);
 
@@ -8026,23 +10417,18 @@ static bool _webinix_show_window(_webinix_window_t* win, struct mg_connection* c
 
         // Start a new window
 
-        if (_webinix.ui) {
-            // Prioritize the server thread if we
-            // knows that there is UIs running.
-            
-            // New server thread
-            #ifdef _WIN32
-            HANDLE thread = CreateThread(NULL, 0, _webinix_server_thread, (void*)win, 0, NULL);
-            win->server_thread = thread;
-            if (thread != NULL)
-                CloseHandle(thread);
-            #else
-            pthread_t thread;
-            pthread_create(&thread, NULL,&_webinix_server_thread, (void*)win);
-            pthread_detach(thread);
-            win->server_thread = thread;
-            #endif
-        }
+        // New server thread, started first so it binds while
+        // the browser is detected, its profile created and
+        // the browser process spawned. Detached once the browser
+        // is running, joined if it fails.
+        #ifdef _WIN32
+        HANDLE thread = CreateThread(NULL, 0, _webinix_server_thread, (void*)win, 0, NULL);
+        win->server_thread = thread;
+        #else
+        pthread_t thread;
+        bool thread_created = (pthread_create(&thread, NULL,&_webinix_server_thread, (void*)win) == 0);
+        win->server_thread = thread;
+        #endif
 
         // New WebView
         bool runWebView = false;
@@ -8101,37 +10487,40 @@ static bool _webinix_show_window(_webinix_window_t* win, struct mg_connection* c
         }
 
         _webinix_free_mem((void*)window_url);
+        if (runWebView || runBrowser)
+            _webinix_show_phase(win, &win->show_timeline.browser);
         if (browser != NoBrowser) {
             if (!runWebView && !runBrowser) {
-                // Browser and WebView both failed
+                // Browser and WebView both failed. Stop the server
+                // and wait for its thread, which frees the port. The
+                // URL and HTML stay until the next show or destroy,
+                // as the server may still be serving them until then.
+                win->show_failed = true;
                 _webinix_mutex_win_is_exit_now(win, WEBUI_MUTEX_SET_TRUE);
-                _webinix_free_mem((void*)win->html);
-                _webinix_free_mem((void*)win->url);
-                _webinix_free_port(win->server_port);
-                win->server_port = 0;
+                #ifdef _WIN32
+                if (thread != NULL) {
+                    WaitForSingleObject(thread, INFINITE);
+                    CloseHandle(thread);
+                }
+                #else
+                if (thread_created)
+                    pthread_join(thread, NULL);
+                #endif
+                _webinix_show_phase(win, &win->show_timeline.total);
                 return false;
             }            
         }
-
-        if (!_webinix.ui) {
-
-            // Let the wait() knows that this app
-            // has atleast one window to wait for
-            _webinix.ui = true;
-
-            // New server thread
-            #ifdef _WIN32
-            HANDLE thread = CreateThread(NULL, 0, _webinix_server_thread, (void*)win, 0, NULL);
-            win->server_thread = thread;
-            if (thread != NULL)
-                CloseHandle(thread);
-            #else
-            pthread_t thread;
-            pthread_create(&thread, NULL,&_webinix_server_thread, (void*)win);
+        #ifdef _WIN32
+        if (thread != NULL)
+            CloseHandle(thread);
+        #else
+        if (thread_created)
             pthread_detach(thread);
-            win->server_thread = thread;
-            #endif
-        }
+        #endif
+
+        // Let the wait() knows that this app
+        // has atleast one window to wait for
+        _webinix.ui = true;
 
     } else {
 
@@ -8163,6 +10552,7 @@ static bool _webinix_show_window(_webinix_window_t* win, struct mg_connection* c
     }
 
     // Wait for window connection & token validation
+    bool status = true;
     if ((browser != NoBrowser) && _webinix.config.show_wait_connection) {
 
         #ifdef WEBUI_LOG
@@ -8230,12 +10620,25 @@ static bool _webinix_show_window(_webinix_window_t* win, struct mg_connection* c
             }
         }
 
-        // Return status of the window connection (not token validation)
-        return _webinix_mutex_is_connected(win, WEBUI_MUTEX_GET_STATUS);
+        // Status of the window connection (not token validation)
+        status = _webinix_mutex_is_connected(win, WEBUI_MUTEX_GET_STATUS);
     }
 
-    // The window is successfully launched.
-    return true;
+    _webinix_show_phase(win, &win->show_timeline.total);
+    #ifdef WEBUI_LOG
+    webinix_show_timeline_t timeline;
+    _webinix_mutex_lock(&win->mutex_show_timeline);
+    timeline = win->show_timeline;
+    _webinix_mutex_unlock(&win->mutex_show_timeline);
+    printf(
+        "[Core]\t\t_webinix_show_window() -> Timeline (us): TLS %zu, Port %zu, Server %zu, "
+        "Browser %zu, Connected %zu, Total %zu\n",
+        timeline.tls, timeline.port, timeline.server,
+        timeline.browser, timeline.connected, timeline.total
+    );
+    #endif
+
+    return status;
 }
 
 static void _webinix_window_event(
@@ -8331,11 +10734,20 @@ static void _webinix_send_client_ws(_webinix_window_t* win, struct mg_connection
         return;
 
     int ret = 0;
-    if (win->num > 0 && win->num < WEBUI_MAX_IDS) {
-        if (client != NULL) {
-            // Mutex
+    if (win->num > 0) {
+        if (_webinix_is_local_client(client)) {
+            // In-process WebView
+            #ifdef __linux__
+            ret = _webinix_wv_local_send(win, packet, packets_size);
+            #endif
+        }
+        else if (client != NULL) {
+            // A closed connection is freed once unregistered, which
+            // `_webinix_connection_remove()` does under `mutex_send` too
+            size_t registered_id = 0;
             _webinix_mutex_lock(&_webinix.mutex_send);
-            ret = mg_websocket_write(client, MG_WEBSOCKET_OPCODE_BINARY, packet, packets_size);
+            if (_webinix_connection_get_id(win, client, &registered_id))
+                ret = mg_websocket_write(client, MG_WEBSOCKET_OPCODE_BINARY, packet, packets_size);
             _webinix_mutex_unlock(&_webinix.mutex_send);
         }
     }
@@ -8364,12 +10776,34 @@ static void _webinix_free_port(size_t port) {
     printf("[Core]\t\t_webinix_free_port([%zu])\n", port);
     #endif
 
-    for (size_t i = 0; i < WEBUI_MAX_IDS; i++) {
-        if (_webinix.used_ports[i] == port) {
-            _webinix.used_ports[i] = 0;
-            break;
-        }
-    }
+    _webinix_port_mark(port, false);
+}
+
+static bool _webinix_port_mark(size_t port, bool used) {
+
+    // Returns false if the port was already in that state
+    if (port > 65535)
+        return false;
+    uint8_t bit = (uint8_t)(1 << (port % 8));
+    _webinix_mutex_lock(&_webinix.mutex_ports);
+    bool changed = (((_webinix.used_ports[port / 8] & bit) != 0) != used);
+    if (used)
+        _webinix.used_ports[port / 8] |= bit;
+    else
+        _webinix.used_ports[port / 8] &= (uint8_t)~bit;
+    _webinix_mutex_unlock(&_webinix.mutex_ports);
+    return changed;
+}
+
+static bool _webinix_port_marked(size_t port) {
+
+    // Port used by one of our windows
+    if (port > 65535)
+        return false;
+    _webinix_mutex_lock(&_webinix.mutex_ports);
+    bool marked = ((_webinix.used_ports[port / 8] & (1 << (port % 8))) != 0);
+    _webinix_mutex_unlock(&_webinix.mutex_ports);
+    return marked;
 }
 
 static size_t _webinix_get_free_port(void) {
@@ -8382,37 +10816,147 @@ static size_t _webinix_get_free_port(void) {
 
     for (size_t i = WEBUI_MIN_PORT; i <= WEBUI_MAX_PORT; i++) {
 
-        // Search [port] in [_webinix.used_ports]
-        bool found = false;
-        for (size_t j = 0; j < WEBUI_MAX_IDS; j++) {
-            if (_webinix.used_ports[j] == port) {
-                found = true;
-                break;
-            }
-        }
-
-        if (found)
+        if (_webinix_port_marked(port))
             // Port used by local window
             port = (rand() % (WEBUI_MAX_PORT + 1 - WEBUI_MIN_PORT)) + WEBUI_MIN_PORT;
         else {
             if (_webinix_port_is_used(port))
                 // Port used by an external app
                 port = (rand() % (WEBUI_MAX_PORT + 1 - WEBUI_MIN_PORT)) + WEBUI_MIN_PORT;
+            else if (_webinix_port_mark(port, true))
+                // Port is free, and no other window took it meanwhile
+                return port;
             else
-                // Port is free
-                break;
+                port = (rand() % (WEBUI_MAX_PORT + 1 - WEBUI_MIN_PORT)) + WEBUI_MIN_PORT;
         }
     }
 
     // Add
-    for (size_t i = 0; i < WEBUI_MAX_IDS; i++) {
-        if (_webinix.used_ports[i] == 0) {
-            _webinix.used_ports[i] = port;
+    _webinix_port_mark(port, true);
+
+    return port;
+}
+
+static bool _webinix_listen_socket(_webinix_window_t* win) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_listen_socket([%zu])\n", win->num);
+    #endif
+
+    // Bind and listen now, the server thread hands this socket over to
+    // civetweb (`listening_socket`). The port is known right away, for
+    // the window URL, and no other app can take it in between. Try the
+    // last port of this window first, to keep its URL, then port 0 to
+    // let the OS pick a free one.
+
+    _webinix_listen_socket_close(win);
+
+    // Winsock is started by `mg_init_library()` in `_webinix_init()`
+    #ifdef _WIN32
+    SOCKET sock = INVALID_SOCKET;
+    #else
+    int sock = -1;
+    #endif
+
+    // Civetweb does not call `listen()` on a socket it is given,
+    // so apply its `listen_backlog` option here
+    int backlog = WEBUI_LISTEN_BACKLOG;
+    _webinix_mutex_lock(&_webinix.mutex_server_start);
+    const char* backlog_opt = _webinix_server_option_get(win->server_options, "listen_backlog");
+    if (backlog_opt == NULL)
+        backlog_opt = _webinix_server_option_get(_webinix.default_server_options, "listen_backlog");
+    if (backlog_opt != NULL && atoi(backlog_opt) > 0)
+        backlog = atoi(backlog_opt);
+    _webinix_mutex_unlock(&_webinix.mutex_server_start);
+
+    struct sockaddr_in addr;
+    size_t ports[2] = {win->server_port, 0};
+    for (size_t i = (win->server_port > 0 ? 0 : 1); i < 2; i++) {
+        // Not inherited by the browser or runtime processes
+        #ifdef _WIN32
+        sock = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        if (sock == INVALID_SOCKET)
+            return false;
+        SetHandleInformation((HANDLE)sock, HANDLE_FLAG_INHERIT, 0);
+        #else
+        #ifdef SOCK_CLOEXEC
+        sock = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, IPPROTO_TCP);
+        #else
+        sock = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        if (sock >= 0)
+            fcntl(sock, F_SETFD, FD_CLOEXEC);
+        #endif
+        if (sock < 0)
+            return false;
+        // Same as civetweb, a closed connection in `TIME_WAIT` does not block the port
+        int on = 1;
+        setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, (const void*)&on, sizeof(on));
+        #endif
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(win->is_public ? INADDR_ANY : INADDR_LOOPBACK);
+        addr.sin_port = htons((unsigned short)ports[i]);
+        if (bind(sock, (struct sockaddr*)&addr, sizeof(addr)) == 0 && listen(sock, backlog) == 0)
             break;
-        }
+        #ifdef _WIN32
+        closesocket(sock);
+        sock = INVALID_SOCKET;
+        #else
+        close(sock);
+        sock = -1;
+        #endif
     }
+    #ifdef _WIN32
+    if (sock == INVALID_SOCKET)
+        return false;
+    #else
+    if (sock < 0)
+        return false;
+    #endif
 
-    return port;
+    // Read back the port
+    socklen_t addr_len = sizeof(addr);
+    if (getsockname(sock, (struct sockaddr*)&addr, &addr_len) != 0) {
+        #ifdef _WIN32
+        closesocket(sock);
+        #else
+        close(sock);
+        #endif
+        return false;
+    }
+    size_t port = (size_t)ntohs(addr.sin_port);
+    if (port != win->server_port) {
+        if (win->server_port > 0)
+            _webinix_free_port(win->server_port);
+        _webinix_port_mark(port, true);
+    }
+    win->server_port = port;
+    win->listen_socket = sock;
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_listen_socket() -> Port %zu\n", port);
+    #endif
+    return true;
+}
+
+static void _webinix_listen_socket_close(_webinix_window_t* win) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_listen_socket_close([%zu])\n", win->num);
+    #endif
+
+    // Civetweb has its own duplicate once started
+    #ifdef _WIN32
+    if (win->listen_socket != INVALID_SOCKET) {
+        closesocket(win->listen_socket);
+        win->listen_socket = INVALID_SOCKET;
+    }
+    #else
+    if (win->listen_socket >= 0) {
+        close(win->listen_socket);
+        win->listen_socket = -1;
+    }
+    #endif
 }
 
 static void _webinix_init(void) {
@@ -8433,6 +10977,8 @@ static void _webinix_init(void) {
     #endif
 
     // Initializing mutex
+    for (size_t i = 0; i < WEBUI_MEM_SHARDS; i++)
+        _webinix_mutex_init(&_webinix.mutex_mem[i]);
     _webinix_mutex_init(&_webinix.mutex_server_start);
     _webinix_mutex_init(&_webinix.mutex_send);
     _webinix_mutex_init(&_webinix.mutex_receive);
@@ -8444,7 +10990,20 @@ static void _webinix_init(void) {
     _webinix_mutex_init(&_webinix.mutex_http_handler);
     _webinix_mutex_init(&_webinix.mutex_client);
     _webinix_mutex_init(&_webinix.mutex_async_response);
-    _webinix_mutex_init(&_webinix.mutex_mem);
+    _webinix_mutex_init(&_webinix.mutex_async_legacy);
+    _webinix_mutex_init(&_webinix.mutex_runtime);
+    _webinix_mutex_init(&_webinix.mutex_path_cache);
+    _webinix_mutex_init(&_webinix.mutex_cluster);
+    _webinix_mutex_init(&_webinix.mutex_ports);
+    _webinix_mutex_init(&_webinix.mutex_tables);
+    _webinix_mutex_init(&_webinix.mutex_pool);
+    _webinix_mutex_init(&_webinix.mutex_sessions);
+    #ifdef WEBUI_TLS
+    _webinix_mutex_init(&_webinix.mutex_tls);
+    _webinix_condition_init(&_webinix.condition_tls);
+    #endif
+    _webinix_condition_init(&_webinix.condition_runtime);
+    _webinix.runtime_timeout = WEBUI_RUNTIME_TIMEOUT;
     _webinix_mutex_init(&_webinix.mutex_token);
     _webinix_condition_init(&_webinix.condition_wait);
 
@@ -8457,6 +11016,14 @@ static void _webinix_init(void) {
 
     // Initializing core
     _webinix.startup_timeout = WEBUI_DEF_TIMEOUT;
+    _webinix.mem_limit_message = WEBUI_MAX_BUF;
+    _webinix_wins_grow(WEBUI_MAX_IDS);
+    _webinix_clients_grow();
+    _webinix.sessions_head = WEBUI_SESSION_NONE;
+    _webinix.sessions_tail = WEBUI_SESSION_NONE;
+    _webinix.sessions_max = WEBUI_SESSIONS_MAX;
+    _webinix.sessions_idle = WEBUI_SESSION_IDLE;
+    _webinix_session_grow();
     _webinix.executable_path = _webinix_get_current_path();
     _webinix.default_server_root_path = (char*)_webinix_malloc(WEBUI_MAX_PATH);
 
@@ -8555,28 +11122,100 @@ static void _webinix_print_ascii(const char* data, size_t len) {
 
 // HTTP Server
 
-static void _webinix_http_send_header(
+static void _webinix_http_preload_links(_webinix_window_t* win, char* buffer, size_t len) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_http_preload_links([%zu])\n", win->num);
+    #endif
+
+    // The browser only discovers the bridge once the HTML is parsed,
+    // and the bridge script once `webinix.js` runs. Announce both,
+    // and the user critical assets, with the HTML response.
+    int c = WEBUI_SN_PRINTF_STATIC(buffer, len,
+        "Link: <%s/webinix.js>; rel=preload; as=script, "
+        "</webinix_bridge.js?v=%.16s>; rel=preload; as=script%s%s\r\n",
+        win->url_prefix, (WEBUI_BRIDGE_ETAG + 1),
+        (win->preload != NULL ? ", " : ""), (win->preload != NULL ? win->preload : "")
+    );
+    if (c < 0 || (size_t)c >= len)
+        buffer[0] = '\0';
+}
+
+static const char* _webinix_http_header_find(const char* headers, const char* name) {
+
+    // Value of the header `name` in a `\r\n` separated headers
+    // list, or NULL
+    size_t name_len = _webinix_strlen(name);
+    const char* line = headers;
+    while (line != NULL && *line != '\0') {
+        if (mg_strncasecmp(line, name, name_len) == 0 && line[name_len] == ':') {
+            const char* value = &line[name_len + 1];
+            while (*value == ' ')
+                value++;
+            return value;
+        }
+        line = strchr(line, '\n');
+        if (line != NULL)
+            line++;
+    }
+    return NULL;
+}
+
+static bool _webinix_http_cache_public(const char* value) {
+
+    // Whether a `Cache-Control` value has the `public` directive,
+    // anywhere in its comma separated list
+    while (value != NULL && *value != '\0' && *value != '\r' && *value != '\n') {
+        while (*value == ' ' || *value == '\t' || *value == ',')
+            value++;
+        size_t len = strcspn(value, ",\r\n");
+        size_t token_len = len;
+        while (token_len > 0 && (value[token_len - 1] == ' ' || value[token_len - 1] == '\t'))
+            token_len--;
+        if (token_len == 6 && mg_strncasecmp(value, "public", 6) == 0)
+            return true;
+        value += len;
+    }
+    return false;
+}
+
+static bool _webinix_http_send_header(
     _webinix_window_t* win, struct mg_connection* client,
-    const char* mime_type, size_t body_len, bool cache) {
+    int status, const char* mime_type, size_t body_len, int cache, const char* extra_headers) {
 
     #ifdef WEBUI_LOG
     printf("[Core]\t\t_webinix_http_send_header([%zu])\n", win->num);
+    printf("[Core]\t\t_webinix_http_send_header() -> status: [%d]\n", status);
     printf("[Core]\t\t_webinix_http_send_header() -> mime_type: [%s]\n", mime_type);
     printf("[Core]\t\t_webinix_http_send_header() -> body_len: [%zu]\n", body_len);
     printf("[Core]\t\t_webinix_http_send_header() -> cache: [%d]\n", cache);
     #endif
 
-    const char* no_cache = "no-cache, no-store, must-revalidate, private, max-age=0";
-    const char* with_cache = "public, max-age=31536000";
-    const char* cache_header = (cache ? with_cache : no_cache);
+    const char* cache_header = "Cache-Control: no-cache, no-store, must-revalidate, private, max-age=0\r\n";
+    bool cache_public = false;
+    if (cache == WEBUI_HTTP_CACHE) {
+        cache_header = "Cache-Control: public, max-age=31536000\r\n";
+        cache_public = true;
+    }
+    else if (cache == WEBUI_HTTP_REVALIDATE)
+        cache_header = "Cache-Control: no-cache\r\n";
+    else if (cache == WEBUI_HTTP_IMMUTABLE) {
+        cache_header = "Cache-Control: public, max-age=31536000, immutable\r\n";
+        cache_public = true;
+    }
+    else if (cache == WEBUI_HTTP_CUSTOM) {
+        cache_header = "";
+        cache_public = _webinix_http_cache_public(_webinix_http_header_find(extra_headers, "Cache-Control"));
+    }
 
-    // Cookies
-    bool set_cookies = false;
+    // Cookies, never on public responses, a shared cache
+    // could store them and hand them to other browsers
+    char set_cookies[WEBUI_COOKIES_BUF + 96] = {0};
     size_t new_client_id = 0;
-    if (_webinix.config.use_cookies) {
+    if (_webinix.config.use_cookies && !cache_public) {
         // Cookies config is enabled
         char cookies[WEBUI_COOKIES_BUF] = {0};
-        _webinix_get_cookies(client, cookies);
+        _webinix_get_cookies(win, client, cookies);
         bool client_found = false;
         if (!_webinix_is_empty(cookies)) {
             size_t client_id = 0;
@@ -8589,11 +11228,17 @@ static void _webinix_http_send_header(
             char new_auth_cookies[WEBUI_COOKIES_BUF];
             _webinix_generate_cookies(new_auth_cookies, WEBUI_COOKIES_LEN);
             if (_webinix_client_cookies_save(win, new_auth_cookies, &new_client_id)) {
-                set_cookies = true;
+                // [win number][_][cookies]
+                char name[32];
+                _webinix_cookies_name(win, name, sizeof(name));
+                WEBUI_SN_PRINTF_STATIC(set_cookies, sizeof(set_cookies),
+                    "Set-Cookie: %s=%zu_%s; Path=/; HttpOnly; SameSite=Strict\r\n",
+                    name, win->num, new_auth_cookies
+                );
                 _webinix.cookies_single_set[win->num] = true;
                 #ifdef WEBUI_LOG
-                printf("[Core]\t\t_webinix_http_send() -> New auth cookies [%s]\n",
-                    _webinix.cookies[new_client_id]
+                printf("[Core]\t\t_webinix_http_send() -> New auth cookies #%zu [%zu_%s]\n",
+                    new_client_id, win->num, new_auth_cookies
                 );
                 #endif
             }
@@ -8606,36 +11251,57 @@ static void _webinix_http_send_header(
         }
     }
 
-    // [header only]
-    char buffer[1024] = {0};
-    int to_send = 0;
-    if (set_cookies) {
-        // Header with auth cookies
-        to_send = WEBUI_SN_PRINTF_STATIC(buffer, sizeof(buffer),
-            "HTTP/1.1 200 OK\r\n"
-            "Set-Cookie: webinix_auth=%s; Path=/; HttpOnly; SameSite=Strict\r\n"
-            "Access-Control-Allow-Origin: *\r\n"
-            "Cache-Control: %s\r\n"
-            "Content-Type: %s\r\n"
-            "Content-Length: %zu\r\n"
-            "Connection: close\r\n\r\n",
-            _webinix.cookies[new_client_id],
-            cache_header, mime_type, body_len
-        );
+    // Content (a `304 Not Modified` has no content)
+    char content[256] = {0};
+    if (body_len == WEBUI_HTTP_UNKNOWN_LEN) {
+        WEBUI_SN_PRINTF_STATIC(content, sizeof(content), "Content-Type: %s\r\n", mime_type);
     }
-    else {
-        // Header without auth cookies
-        to_send = WEBUI_SN_PRINTF_STATIC(buffer, sizeof(buffer),
-            "HTTP/1.1 200 OK\r\n"
-            "Access-Control-Allow-Origin: *\r\n"
-            "Cache-Control: %s\r\n"
+    else if (status != 304) {
+        WEBUI_SN_PRINTF_STATIC(content, sizeof(content),
             "Content-Type: %s\r\n"
-            "Content-Length: %zu\r\n"
-            "Connection: close\r\n\r\n",
-            cache_header, mime_type, body_len
+            "Content-Length: %zu\r\n",
+            mime_type, body_len
         );
     }
 
+    // Preload links (HTML documents)
+    char link[WEBUI_PRELOAD_BUF + 128] = {0};
+    if (status == 200 && mime_type != NULL && strncmp(mime_type, "text/html", 9) == 0) {
+        _webinix_http_preload_links(win, link, sizeof(link));
+        // Early Hints, HTTP/1.0 clients don't expect informational responses
+        const struct mg_request_info* ri = mg_get_request_info(client);
+        if (_webinix.config.early_hints && !_webinix_is_empty(link) &&
+            ri->http_version != NULL && strcmp(ri->http_version, "1.1") == 0) {
+            char hints[sizeof(link) + 64] = {0};
+            int hints_len = WEBUI_SN_PRINTF_STATIC(hints, sizeof(hints),
+                "HTTP/1.1 103 Early Hints\r\n%s\r\n", link);
+            if (hints_len > 0 && (size_t)hints_len < sizeof(hints))
+                mg_write(client, hints, (size_t)hints_len);
+        }
+    }
+
+    // [header only]
+    char buffer[1024 + sizeof(link)] = {0};
+    int to_send = WEBUI_SN_PRINTF_STATIC(buffer, sizeof(buffer),
+        "HTTP/1.1 %d %s\r\n"
+        "%s"
+        "Access-Control-Allow-Origin: *\r\n"
+        "%s"
+        "%s"
+        "%s"
+        "%s"
+        "Connection: close\r\n\r\n",
+        status, mg_get_response_code_text(client, status),
+        set_cookies, cache_header, content, link,
+        (extra_headers != NULL ? extra_headers : "")
+    );
+    if (to_send < 0 || (size_t)to_send >= sizeof(buffer)) {
+        #ifdef WEBUI_LOG
+        printf("[Core]\t\t_webinix_http_send_header() -> Header too large\n");
+        #endif
+        return false;
+    }
+
     #ifdef WEBUI_LOG
     printf("---[ HTTP Header ]-----------------\n");
     printf("%s", buffer);
@@ -8643,149 +11309,1359 @@ static void _webinix_http_send_header(
     #endif
 
     // Send
-    mg_write(client, buffer, to_send);
+    return (mg_write(client, buffer, (size_t)to_send) == to_send);
 }
 
-static void _webinix_http_send_file(
-    _webinix_window_t* win, struct mg_connection* client,
-    const char* mime_type, const char* path, bool cache) {
+static bool _webinix_file_stat(const char* path, int64_t* size, time_t* mtime) {
 
     #ifdef WEBUI_LOG
-    printf("[Core]\t\t_webinix_http_send_file([%zu])\n", win->num);
+    printf("[Core]\t\t_webinix_file_stat([%s])\n", path);
     #endif
 
-    // Open the file
-    FILE* file = NULL;
-    WEBUI_FILE_OPEN(file, path, "rb");
-    if (!file) {
-        #ifdef WEBUI_LOG
-        printf("[Core]\t\t_webinix_http_send_file() -> Can't open file [%s]\n", path);
-        #endif
-        _webinix_http_send_error(client, webinix_html_res_not_available, 404);
-        return;
-    }
-
-    // Get file size
-    fseek(file, 0, SEEK_END);
-    size_t file_size = ftell(file);
-    fseek(file, 0, SEEK_SET);
-
-    // Send header
-    _webinix_http_send_header(win, client, mime_type, file_size, cache);
-
-    // Send body
-    mg_send_file_body(client, path);
+    #ifdef _WIN32
+    wchar_t* wfilePath;
+    if (!_webinix_str_to_wide(path, &wfilePath))
+        return false;
+    struct _stat64 st;
+    int res = _wstat64(wfilePath, &st);
+    _webinix_free_mem((void*)wfilePath);
+    if (res != 0 || (st.st_mode & _S_IFDIR))
+        return false;
+    #else
+    struct stat st;
+    if (stat(path, &st) != 0 || !S_ISREG(st.st_mode))
+        return false;
+    #endif
 
-    fclose(file);
+    *size = (int64_t)st.st_size;
+    *mtime = (time_t)st.st_mtime;
+    return true;
 }
 
-static void _webinix_http_send(
-    _webinix_window_t* win, struct mg_connection* client,
-    const char* mime_type, const char* body, size_t body_len, bool cache) {
+static void _webinix_http_date(time_t t, char* buffer, size_t len) {
 
-    #ifdef WEBUI_LOG
-    printf("[Core]\t\t_webinix_http_send([%zu])\n", win->num);
+    // RFC 7231 IMF-fixdate (e.g. `Sun, 06 Nov 1994 08:49:37 GMT`)
+    struct tm tm;
+    #ifdef _WIN32
+    gmtime_s(&tm, &t);
+    #else
+    gmtime_r(&t, &tm);
     #endif
-
-    // Send header
-    _webinix_http_send_header(win, client, mime_type, body_len, cache);
-
-    // Send body
-    mg_write(client, body, body_len);
+    strftime(buffer, len, "%a, %d %b %Y %H:%M:%S GMT", &tm);
 }
 
-static void _webinix_http_send_error(struct mg_connection* client, const char* body, int status) {
+static int _webinix_http_parse_range(const char* header, int64_t size, _webinix_range_t* ranges, int max) {
 
     #ifdef WEBUI_LOG
-    printf("[Core]\t\t_webinix_http_send_error()\n");
+    printf("[Core]\t\t_webinix_http_parse_range([%s])\n", header);
     #endif
 
-    // [header][body]
-    int to_send = 0;
-    size_t body_len = _webinix_strlen(body);
-    size_t buffer_len = (512 + body_len);
-    char* buffer = (char*)_webinix_malloc(buffer_len);
-    to_send = WEBUI_SN_PRINTF_DYN(buffer, buffer_len,
-        "HTTP/1.1 %d OK\r\n"
-        "Content-Type: text/html; charset=utf-8\r\n"
-        "Cache-Control: no-cache, no-store, must-revalidate, private, max-age=0\r\n"
-        "Pragma: no-cache\r\n"
-        "Expires: 0\r\n"
-        "Content-Length: %zu\r\n"
-        "Connection: close\r\n\r\n%s",
-        status, body_len, body
-    );
+    // Parse a `Range: bytes=0-99,200-,-50` header (RFC 7233).
+    // Return the number of satisfiable ranges, `0` if none of them
+    // is satisfiable (416), or `-1` if the header should be ignored
+    // and the full content sent instead (invalid, or too many ranges).
 
-    // Send
-    mg_write(client, buffer, to_send);
-    _webinix_free_mem((void*)buffer);
-}
+    if (strncmp(header, "bytes=", 6) != 0)
+        return -1;
+    const char* p = header + 6;
+    int count = 0;
+    int specs = 0;
 
-#ifdef WEBUI_LOG
-static int _webinix_http_log(const struct mg_connection* client, const char* message) {
+    while (*p != '\0') {
+
+        while (*p == ' ' || *p == '\t' || *p == ',')
+            p++;
+        if (*p == '\0')
+            break;
+        if (++specs > max)
+            return -1;
+
+        int64_t start = -1;
+        int64_t end = -1;
+        if (isdigit((unsigned char)*p)) {
+            start = 0;
+            while (isdigit((unsigned char)*p)) {
+                if (start > (INT64_MAX - 9) / 10)
+                    return -1;
+                start = (start * 10) + (*p++ - '0');
+            }
+        }
+        if (*p++ != '-')
+            return -1;
+        if (isdigit((unsigned char)*p)) {
+            end = 0;
+            while (isdigit((unsigned char)*p)) {
+                if (end > (INT64_MAX - 9) / 10)
+                    return -1;
+                end = (end * 10) + (*p++ - '0');
+            }
+        }
+        while (*p == ' ' || *p == '\t')
+            p++;
+        if (*p != ',' && *p != '\0')
+            return -1;
+
+        if (start < 0) {
+            // Suffix range `-N`: the last N bytes
+            if (end < 0)
+                return -1;
+            if (end == 0 || size == 0)
+                continue; // Not satisfiable
+            start = (end >= size ? 0 : size - end);
+            end = size - 1;
+        }
+        else {
+            if (end >= 0 && end < start)
+                return -1;
+            if (start >= size)
+                continue; // Not satisfiable
+            if (end < 0 || end >= size)
+                end = size - 1;
+        }
+
+        ranges[count].start = start;
+        ranges[count].end = end;
+        count++;
+    }
+
+    if (specs == 0)
+        return -1;
+    return count;
+}
+
+static void _webinix_http_send_file(
+    _webinix_window_t* win, struct mg_connection* client,
+    const char* mime_type, const char* path, int cache) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_http_send_file([%zu])\n", win->num);
+    #endif
+
+    // Get file size and modification time
+    int64_t file_size = 0;
+    time_t file_mtime = 0;
+    if (!_webinix_file_stat(path, &file_size, &file_mtime)) {
+        #ifdef WEBUI_LOG
+        printf("[Core]\t\t_webinix_http_send_file() -> Can't open file [%s]\n", path);
+        #endif
+        _webinix_http_send_error(client, webinix_html_res_not_available, 404);
+        return;
+    }
+
+    // Validators
+    char etag[64] = {0};
+    char last_modified[64] = {0};
+    WEBUI_SN_PRINTF_STATIC(etag, sizeof(etag), "\"%llx.%llx\"",
+        (unsigned long long)file_mtime, (unsigned long long)file_size);
+    _webinix_http_date(file_mtime, last_modified, sizeof(last_modified));
+
+    // Byte ranges
+    _webinix_range_t ranges[WEBUI_MAX_RANGES];
+    int ranges_count = -1;
+    const char* range = mg_get_header(client, "Range");
+    if (!_webinix_is_empty(range)) {
+        // `If-Range` makes the range conditional, if the validator does not
+        // match the current file, then the full content is sent instead
+        const char* if_range = mg_get_header(client, "If-Range");
+        if (_webinix_is_empty(if_range) ||
+            strcmp(if_range, (if_range[0] == '"' ? etag : last_modified)) == 0) {
+            ranges_count = _webinix_http_parse_range(range, file_size, ranges, WEBUI_MAX_RANGES);
+        }
+    }
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_http_send_file() -> Size [%lld], Ranges [%d]\n",
+        (long long)file_size, ranges_count);
+    #endif
+
+    char headers[512] = {0};
+
+    if (ranges_count == 0) {
+
+        // 416 - Range Not Satisfiable
+        WEBUI_SN_PRINTF_STATIC(headers, sizeof(headers),
+            "Accept-Ranges: bytes\r\n"
+            "Content-Range: bytes */%lld\r\n",
+            (long long)file_size
+        );
+        _webinix_http_send_header(win, client, 416, mime_type, 0, cache, headers);
+    }
+    else if (ranges_count == 1) {
+
+        // 206 - Partial Content (single range)
+        int64_t len = (ranges[0].end - ranges[0].start + 1);
+        WEBUI_SN_PRINTF_STATIC(headers, sizeof(headers),
+            "Accept-Ranges: bytes\r\n"
+            "Content-Range: bytes %lld-%lld/%lld\r\n"
+            "ETag: %s\r\n"
+            "Last-Modified: %s\r\n",
+            (long long)ranges[0].start, (long long)ranges[0].end,
+            (long long)file_size, etag, last_modified
+        );
+        _webinix_http_send_header(win, client, 206, mime_type, (size_t)len, cache, headers);
+        mg_send_file_body_range(client, path, ranges[0].start, len);
+    }
+    else if (ranges_count > 1) {
+
+        // 206 - Partial Content (multipart/byteranges)
+        // [--boundary][part header][part body] ... [--boundary--]
+        char part[256];
+        const char* part_fmt =
+            "\r\n--" WEBUI_RANGE_BOUNDARY "\r\n"
+            "Content-Type: %s\r\n"
+            "Content-Range: bytes %lld-%lld/%lld\r\n\r\n";
+        const char* last_boundary = "\r\n--" WEBUI_RANGE_BOUNDARY "--\r\n";
+        size_t body_len = _webinix_strlen(last_boundary);
+        for (int i = 0; i < ranges_count; i++) {
+            int part_len = WEBUI_SN_PRINTF_STATIC(part, sizeof(part), part_fmt, mime_type,
+                (long long)ranges[i].start, (long long)ranges[i].end, (long long)file_size);
+            body_len += (size_t)part_len + (size_t)(ranges[i].end - ranges[i].start + 1);
+        }
+        WEBUI_SN_PRINTF_STATIC(headers, sizeof(headers),
+            "Accept-Ranges: bytes\r\n"
+            "ETag: %s\r\n"
+            "Last-Modified: %s\r\n",
+            etag, last_modified
+        );
+        _webinix_http_send_header(win, client, 206,
+            "multipart/byteranges; boundary=" WEBUI_RANGE_BOUNDARY, body_len, cache, headers);
+        for (int i = 0; i < ranges_count; i++) {
+            int part_len = WEBUI_SN_PRINTF_STATIC(part, sizeof(part), part_fmt, mime_type,
+                (long long)ranges[i].start, (long long)ranges[i].end, (long long)file_size);
+            mg_write(client, part, (size_t)part_len);
+            mg_send_file_body_range(client, path, ranges[i].start, (ranges[i].end - ranges[i].start + 1));
+        }
+        mg_write(client, last_boundary, _webinix_strlen(last_boundary));
+    }
+    else {
+
+        // 200 - Full content
+        WEBUI_SN_PRINTF_STATIC(headers, sizeof(headers),
+            "Accept-Ranges: bytes\r\n"
+            "ETag: %s\r\n"
+            "Last-Modified: %s\r\n",
+            etag, last_modified
+        );
+        _webinix_http_send_header(win, client, 200, mime_type, (size_t)file_size, cache, headers);
+        mg_send_file_body_range(client, path, 0, file_size);
+    }
+}
+
+static void _webinix_http_send(
+    _webinix_window_t* win, struct mg_connection* client,
+    const char* mime_type, const char* body, size_t body_len, int cache) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_http_send([%zu])\n", win->num);
+    #endif
+
+    // Send header
+    _webinix_http_send_header(win, client, 200, mime_type, body_len, cache, NULL);
+
+    // Send body
+    mg_write(client, body, body_len);
+}
+
+static void _webinix_http_send_error(struct mg_connection* client, const char* body, int status) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_http_send_error()\n");
+    #endif
+
+    // [header][body]
+    int to_send = 0;
+    size_t body_len = _webinix_strlen(body);
+    size_t buffer_len = (512 + body_len);
+    char* buffer = (char*)_webinix_pool_get(buffer_len);
+    to_send = WEBUI_SN_PRINTF_DYN(buffer, buffer_len,
+        "HTTP/1.1 %d %s\r\n"
+        "Content-Type: text/html; charset=utf-8\r\n"
+        "Cache-Control: no-cache, no-store, must-revalidate, private, max-age=0\r\n"
+        "Pragma: no-cache\r\n"
+        "Expires: 0\r\n"
+        "Content-Length: %zu\r\n"
+        "Connection: close\r\n\r\n%s",
+        status, mg_get_response_code_text(client, status), body_len, body
+    );
+
+    // Send
+    mg_write(client, buffer, (size_t)to_send);
+    _webinix_pool_put((void*)buffer);
+}
+
+static void _webinix_http_send_bridge(_webinix_window_t* win, struct mg_connection* client) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_http_send_bridge([%zu])\n", win->num);
+    #endif
+
+    // The bridge is the same for all windows, and its URL is versioned,
+    // so browsers keep it cached between windows and runs.
+    const char* if_none_match = mg_get_header(client, "If-None-Match");
+    if (!_webinix_is_empty(if_none_match) && strstr(if_none_match, WEBUI_BRIDGE_ETAG) != NULL) {
+        _webinix_http_send_header(win, client, 304, "application/javascript", 0, WEBUI_HTTP_IMMUTABLE,
+            "ETag: " WEBUI_BRIDGE_ETAG "\r\n");
+        return;
+    }
+
+    // Precompressed when the client accepts gzip
+    const char* accept_encoding = mg_get_header(client, "Accept-Encoding");
+    if (!_webinix_is_empty(accept_encoding) && strstr(accept_encoding, "gzip") != NULL) {
+        _webinix_http_send_header(win, client, 200, "application/javascript",
+            sizeof(webinix_javascript_bridge_gz), WEBUI_HTTP_IMMUTABLE,
+            "ETag: " WEBUI_BRIDGE_ETAG "\r\n"
+            "Content-Encoding: gzip\r\n"
+            "Vary: Accept-Encoding\r\n");
+        mg_write(client, webinix_javascript_bridge_gz, sizeof(webinix_javascript_bridge_gz));
+    }
+    else {
+        // Without the null terminator
+        _webinix_http_send_header(win, client, 200, "application/javascript",
+            (sizeof(webinix_javascript_bridge) - 1), WEBUI_HTTP_IMMUTABLE,
+            "ETag: " WEBUI_BRIDGE_ETAG "\r\n"
+            "Vary: Accept-Encoding\r\n");
+        mg_write(client, webinix_javascript_bridge, (sizeof(webinix_javascript_bridge) - 1));
+    }
+}
+
+static const void* _webinix_map_file(const char* path, size_t* size) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_map_file([%s])\n", path);
+    #endif
+
+    *size = 0;
+
+    #ifdef _WIN32
+    wchar_t* wfilePath;
+    if (!_webinix_str_to_wide(path, &wfilePath))
+        return NULL;
+    HANDLE file = CreateFileW(wfilePath, GENERIC_READ, FILE_SHARE_READ, NULL,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    _webinix_free_mem((void*)wfilePath);
+    if (file == INVALID_HANDLE_VALUE)
+        return NULL;
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart < 1 ||
+        (unsigned long long)file_size.QuadPart > (unsigned long long)SIZE_MAX) {
+        CloseHandle(file);
+        return NULL;
+    }
+    HANDLE mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (mapping == NULL)
+        return NULL;
+    // The view keeps the mapping alive
+    const void* map = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (map == NULL)
+        return NULL;
+    *size = (size_t)file_size.QuadPart;
+    return map;
+    #else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return NULL;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size < 1) {
+        close(fd);
+        return NULL;
+    }
+    // The mapping stays valid after closing the file descriptor
+    void* map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+        return NULL;
+    *size = (size_t)st.st_size;
+    return map;
+    #endif
+}
+
+static void _webinix_unmap_file(const void* map, size_t size) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_unmap_file()\n");
+    #endif
+
+    if (map == NULL)
+        return;
+
+    #ifdef _WIN32
+    (void)size;
+    UnmapViewOfFile(map);
+    #else
+    munmap((void*)map, size);
+    #endif
+}
+
+static uint64_t _webinix_read_le(const unsigned char* p, size_t bytes) {
+
+    // Read an unaligned little-endian integer
+    uint64_t v = 0;
+    for (size_t i = 0; i < bytes; i++)
+        v |= ((uint64_t)p[i] << (8 * i));
+    return v;
+}
+
+static int _webinix_bundle_cmp(const void* a, const void* b) {
+    return strcmp(((const _webinix_bundle_asset_t*)a)->asset.path, ((const _webinix_bundle_asset_t*)b)->asset.path);
+}
+
+static int _webinix_bundle_cmp_offset(const void* a, const void* b) {
+
+    // By path, then by position in the archive mapping
+    int cmp = _webinix_bundle_cmp(a, b);
+    if (cmp != 0)
+        return cmp;
+    const unsigned char* data_a = ((const _webinix_bundle_asset_t*)a)->asset.data;
+    const unsigned char* data_b = ((const _webinix_bundle_asset_t*)b)->asset.data;
+    return (data_a < data_b ? -1 : (data_a > data_b ? 1 : 0));
+}
+
+static _webinix_bundle_t* _webinix_bundle_new(size_t count) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_bundle_new([%zu])\n", count);
+    #endif
+
+    _webinix_bundle_t* bundle = (_webinix_bundle_t*)_webinix_malloc(sizeof(_webinix_bundle_t));
+    bundle->assets = (_webinix_bundle_asset_t*)_webinix_malloc(count * sizeof(_webinix_bundle_asset_t));
+    bundle->count = count;
+    _webinix_mem_tag(bundle, WEBUI_MEM_ASSETS);
+    _webinix_mem_tag(bundle->assets, WEBUI_MEM_ASSETS);
+    return bundle;
+}
+
+static bool _webinix_bundle_index(_webinix_bundle_t* bundle) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_bundle_index([%zu])\n", bundle->count);
+    #endif
+
+    // Validate and complete assets once, so serving
+    // them later is a lookup and a write only.
+    size_t missing_etags = 0;
+    for (size_t i = 0; i < bundle->count; i++) {
+        webinix_asset_t* asset = &bundle->assets[i].asset;
+        if (asset->path == NULL || asset->path[0] != '/')
+            return false;
+        if (asset->data == NULL && asset->data_gzip == NULL)
+            return false;
+        if (_webinix_is_empty(asset->mime_type))
+            asset->mime_type = mg_get_builtin_mime_type(asset->path);
+        if (_webinix_is_empty(asset->etag))
+            missing_etags++;
+    }
+
+    // Compute missing ETags (FNV-1a 64-bit of the content)
+    if (missing_etags > 0) {
+        bundle->etags = (char*)_webinix_malloc(missing_etags * WEBUI_ETAG_BUF);
+        _webinix_mem_tag(bundle->etags, WEBUI_MEM_ASSETS);
+        char* etag = bundle->etags;
+        for (size_t i = 0; i < bundle->count; i++) {
+            webinix_asset_t* asset = &bundle->assets[i].asset;
+            if (!_webinix_is_empty(asset->etag))
+                continue;
+            const unsigned char* data = (asset->data != NULL ? asset->data : asset->data_gzip);
+            size_t len = (asset->data != NULL ? asset->length : asset->length_gzip);
+            uint64_t hash = 0xcbf29ce484222325ULL;
+            for (size_t b = 0; b < len; b++) {
+                hash ^= data[b];
+                hash *= 0x100000001b3ULL;
+            }
+            WEBUI_SN_PRINTF_STATIC(etag, WEBUI_ETAG_BUF, "\"%016llx\"", (unsigned long long)hash);
+            asset->etag = etag;
+            etag += WEBUI_ETAG_BUF;
+        }
+    }
+
+    // Sort by path for binary search
+    qsort(bundle->assets, bundle->count, sizeof(_webinix_bundle_asset_t), _webinix_bundle_cmp);
+    for (size_t i = 1; i < bundle->count; i++) {
+        if (strcmp(bundle->assets[i - 1].asset.path, bundle->assets[i].asset.path) == 0)
+            return false; // Duplicated path
+    }
+
+    return true;
+}
+
+static void _webinix_bundle_free(_webinix_bundle_t* bundle) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_bundle_free()\n");
+    #endif
+
+    if (bundle == NULL)
+        return;
+
+    _webinix_unmap_file(bundle->map, bundle->map_size);
+    _webinix_free_mem((void*)bundle->strings);
+    _webinix_free_mem((void*)bundle->etags);
+    _webinix_free_mem((void*)bundle->assets);
+    _webinix_free_mem((void*)bundle);
+}
+
+static void _webinix_bundle_set(_webinix_window_t* win, _webinix_bundle_t* bundle) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_bundle_set([%zu])\n", win->num);
+    #endif
+
+    // Swap bundles while no request is being served
+    _webinix_mutex_lock(&_webinix.mutex_http_handler);
+    _webinix_bundle_t* old = win->bundle;
+    win->bundle = bundle;
+    _webinix_mutex_unlock(&_webinix.mutex_http_handler);
+
+    _webinix_bundle_free(old);
+}
+
+static const _webinix_bundle_asset_t* _webinix_bundle_find(const _webinix_bundle_t* bundle, const char* path) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_bundle_find([%s])\n", path);
+    #endif
+
+    size_t low = 0;
+    size_t high = bundle->count;
+    while (low < high) {
+        size_t mid = low + ((high - low) / 2);
+        int cmp = strcmp(path, bundle->assets[mid].asset.path);
+        if (cmp == 0)
+            return &bundle->assets[mid];
+        if (cmp < 0)
+            high = mid;
+        else
+            low = mid + 1;
+    }
+    return NULL;
+}
+
+static bool _webinix_bundle_serve(_webinix_window_t* win, _webinix_bundle_t* bundle,
+    struct mg_connection* client, int* status) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_bundle_serve([%zu])\n", win->num);
+    #endif
+
+    const struct mg_request_info * ri = mg_get_request_info(client);
+    const char* url = _webinix_http_local_uri(win, ri);
+
+    // The embedded HTML has priority over the bundle
+    if (win->is_embedded_html && strcmp(url, "/") == 0)
+        return false;
+
+    const _webinix_bundle_asset_t* entry = _webinix_bundle_find(bundle, url);
+    if (entry == NULL) {
+
+        // [/folder] Looking for index file and redirect
+        const char* index_files[] = {"index.html", "index.htm"};
+        size_t url_len = _webinix_strlen(url);
+        const char* sep = ((url_len > 0 && url[url_len - 1] == '/') ? "" : "/");
+        char index_path[WEBUI_MAX_PATH];
+        for (size_t i = 0; i < (sizeof(index_files) / sizeof(index_files[0])); i++) {
+            WEBUI_SN_PRINTF_STATIC(index_path, sizeof(index_path), "%s%s%s", url, sep, index_files[i]);
+            if (_webinix_bundle_find(bundle, index_path) != NULL) {
+                // [Prefix][URL][/][Index Name], the browser stays in this window
+                char location[sizeof(win->url_prefix) + WEBUI_MAX_PATH];
+                WEBUI_SN_PRINTF_STATIC(location, sizeof(location), "%s%s", win->url_prefix, index_path);
+                #ifdef WEBUI_LOG
+                printf("[Core]\t\t_webinix_bundle_serve() -> 302 Redirecting to [%s]\n", location);
+                #endif
+                mg_send_http_redirect(client, location, 302);
+                *status = 302;
+                return true;
+            }
+        }
+
+        // Not in the bundle, let the caller look for it locally
+        return false;
+    }
+    const webinix_asset_t* asset = &entry->asset;
+
+    // 304 - Not Modified
+    char headers[256] = {0};
+    const char* if_none_match = mg_get_header(client, "If-None-Match");
+    if (!_webinix_is_empty(if_none_match) &&
+        (strstr(if_none_match, asset->etag) != NULL || strcmp(if_none_match, "*") == 0)) {
+        WEBUI_SN_PRINTF_STATIC(headers, sizeof(headers), "ETag: %s\r\n", asset->etag);
+        _webinix_http_send_header(win, client, 304, asset->mime_type, 0, WEBUI_HTTP_REVALIDATE, headers);
+        *status = 304;
+        return true;
+    }
+
+    // Ranges apply to the identity content only
+    const char* range = mg_get_header(client, "Range");
+    if (asset->data != NULL && !_webinix_is_empty(range)) {
+        const char* if_range = mg_get_header(client, "If-Range");
+        if (_webinix_is_empty(if_range) || strcmp(if_range, asset->etag) == 0) {
+            _webinix_range_t r;
+            int count = _webinix_http_parse_range(range, (int64_t)asset->length, &r, 1);
+            if (count == 0) {
+                // 416 - Range Not Satisfiable
+                WEBUI_SN_PRINTF_STATIC(headers, sizeof(headers),
+                    "Accept-Ranges: bytes\r\n"
+                    "Content-Range: bytes */%zu\r\n",
+                    asset->length
+                );
+                _webinix_http_send_header(win, client, 416, asset->mime_type, 0, WEBUI_HTTP_REVALIDATE, headers);
+                *status = 416;
+                return true;
+            }
+            else if (count == 1) {
+                // 206 - Partial Content
+                size_t len = (size_t)(r.end - r.start + 1);
+                WEBUI_SN_PRINTF_STATIC(headers, sizeof(headers),
+                    "Accept-Ranges: bytes\r\n"
+                    "Content-Range: bytes %lld-%lld/%zu\r\n"
+                    "ETag: %s\r\n",
+                    (long long)r.start, (long long)r.end, asset->length, asset->etag
+                );
+                _webinix_http_send_header(win, client, 206, asset->mime_type, len, WEBUI_HTTP_REVALIDATE, headers);
+                mg_write(client, asset->data + r.start, len);
+                *status = 206;
+                return true;
+            }
+        }
+    }
+
+    // Compressed content when the client accepts it
+    const char* accept_encoding = mg_get_header(client, "Accept-Encoding");
+    bool gzip = (asset->data_gzip != NULL && !_webinix_is_empty(accept_encoding) &&
+        strstr(accept_encoding, "gzip") != NULL);
+    if (asset->data == NULL && !gzip) {
+        // 406 - Only a compressed content is available
+        _webinix_http_send_error(client, webinix_html_res_not_available, 406);
+        *status = 406;
+        return true;
+    }
+
+    // 200 - Full content
+    WEBUI_SN_PRINTF_STATIC(headers, sizeof(headers),
+        "Accept-Ranges: bytes\r\n"
+        "ETag: %s\r\n"
+        "%s",
+        asset->etag,
+        (asset->data_gzip != NULL ? (gzip ? "Content-Encoding: gzip\r\nVary: Accept-Encoding\r\n" :
+            "Vary: Accept-Encoding\r\n") : "")
+    );
+    const unsigned char* body = (gzip ? asset->data_gzip : asset->data);
+    size_t body_len = (gzip ? asset->length_gzip : asset->length);
+    if (gzip && entry->gzip_raw) {
+        // [gzip header][raw deflate from the archive][CRC32][ISIZE]
+        const unsigned char gzip_header[10] = {0x1f, 0x8b, 0x08, 0, 0, 0, 0, 0, 0, 0xff};
+        unsigned char gzip_trailer[8];
+        for (size_t i = 0; i < 4; i++) {
+            gzip_trailer[i] = (unsigned char)(entry->gzip_crc32 >> (8 * i));
+            gzip_trailer[i + 4] = (unsigned char)((uint32_t)asset->length >> (8 * i));
+        }
+        _webinix_http_send_header(win, client, 200, asset->mime_type,
+            (sizeof(gzip_header) + body_len + sizeof(gzip_trailer)), WEBUI_HTTP_REVALIDATE, headers);
+        mg_write(client, gzip_header, sizeof(gzip_header));
+        mg_write(client, body, body_len);
+        mg_write(client, gzip_trailer, sizeof(gzip_trailer));
+    }
+    else {
+        _webinix_http_send_header(win, client, 200, asset->mime_type, body_len, WEBUI_HTTP_REVALIDATE, headers);
+        mg_write(client, body, body_len);
+    }
+    *status = 200;
+    return true;
+}
+
+static _webinix_bundle_t* _webinix_archive_load(const char* path) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_archive_load([%s])\n", path);
+    #endif
+
+    const char* extension = _webinix_get_extension(path);
+    bool zip = (strcmp(extension, "zip") == 0);
+    if (!zip && strcmp(extension, "tar") != 0)
+        return NULL;
+
+    size_t size = 0;
+    const unsigned char* map = (const unsigned char*)_webinix_map_file(path, &size);
+    if (map == NULL)
+        return NULL;
+
+    // The index only points into the mapping, entries
+    // are served from it without any copy.
+    _webinix_bundle_t* bundle = (_webinix_bundle_t*)_webinix_malloc(sizeof(_webinix_bundle_t));
+    _webinix_mem_tag(bundle, WEBUI_MEM_ASSETS);
+    bundle->map = map;
+    bundle->map_size = size;
+    bool loaded = (zip ? _webinix_archive_load_zip(bundle, map, size) :
+        _webinix_archive_load_tar(bundle, map, size));
+    if (!loaded || bundle->count < 1 || !_webinix_bundle_index(bundle)) {
+        #ifdef WEBUI_LOG
+        printf("[Core]\t\t_webinix_archive_load() -> Invalid archive\n");
+        #endif
+        _webinix_bundle_free(bundle);
+        return NULL;
+    }
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_archive_load() -> %zu files indexed\n", bundle->count);
+    #endif
+
+    return bundle;
+}
+
+static bool _webinix_archive_load_zip(_webinix_bundle_t* bundle, const unsigned char* map, size_t size) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_archive_load_zip()\n");
+    #endif
+
+    // End of central directory record, followed by a comment of up to 64 KB
+    if (size < 22)
+        return false;
+    size_t eocd = size - 22;
+    size_t eocd_min = (size > (22 + 0xFFFF) ? (size - 22 - 0xFFFF) : 0);
+    while (_webinix_read_le(map + eocd, 4) != 0x06054b50) {
+        if (eocd == eocd_min)
+            return false;
+        eocd--;
+    }
+    uint64_t entries = _webinix_read_le(map + eocd + 10, 2);
+    uint64_t cd_size = _webinix_read_le(map + eocd + 12, 4);
+    uint64_t cd_offset = _webinix_read_le(map + eocd + 16, 4);
+
+    // Zip64 end of central directory (locator is right before the record)
+    if ((entries == 0xFFFF || cd_size == 0xFFFFFFFF || cd_offset == 0xFFFFFFFF) && eocd >= 20 &&
+        _webinix_read_le(map + eocd - 20, 4) == 0x07064b50) {
+        uint64_t eocd64 = _webinix_read_le(map + eocd - 20 + 8, 8);
+        if (size < 56 || eocd64 > (size - 56) || _webinix_read_le(map + eocd64, 4) != 0x06064b50)
+            return false;
+        entries = _webinix_read_le(map + eocd64 + 32, 8);
+        cd_size = _webinix_read_le(map + eocd64 + 40, 8);
+        cd_offset = _webinix_read_le(map + eocd64 + 48, 8);
+    }
+    if (cd_offset > size || cd_size > (size - cd_offset) || entries > (cd_size / 46))
+        return false;
+
+    // Two passes, first count files and names size, then index them
+    size_t strings_len = 0;
+    size_t count = 0;
+    for (int pass = 0; pass < 2; pass++) {
+
+        if (pass == 1) {
+            if (count < 1)
+                return false;
+            bundle->assets = (_webinix_bundle_asset_t*)_webinix_malloc(count * sizeof(_webinix_bundle_asset_t));
+            bundle->strings = (char*)_webinix_malloc(strings_len);
+            _webinix_mem_tag(bundle->assets, WEBUI_MEM_ASSETS);
+            _webinix_mem_tag(bundle->strings, WEBUI_MEM_ASSETS);
+        }
+        char* strings = bundle->strings;
+        size_t index = 0;
+
+        const unsigned char* p = map + cd_offset;
+        const unsigned char* end = p + cd_size;
+        for (uint64_t i = 0; i < entries; i++) {
+
+            // Central directory file header
+            if ((size_t)(end - p) < 46 || _webinix_read_le(p, 4) != 0x02014b50)
+                return false;
+            uint32_t flags = (uint32_t)_webinix_read_le(p + 8, 2);
+            uint32_t method = (uint32_t)_webinix_read_le(p + 10, 2);
+            uint32_t crc32 = (uint32_t)_webinix_read_le(p + 16, 4);
+            uint64_t comp_size = _webinix_read_le(p + 20, 4);
+            uint64_t uncomp_size = _webinix_read_le(p + 24, 4);
+            size_t name_len = (size_t)_webinix_read_le(p + 28, 2);
+            size_t extra_len = (size_t)_webinix_read_le(p + 30, 2);
+            size_t comment_len = (size_t)_webinix_read_le(p + 32, 2);
+            uint64_t local_offset = _webinix_read_le(p + 42, 4);
+            const char* name = (const char*)(p + 46);
+            if ((size_t)(end - p) < (46 + name_len + extra_len + comment_len))
+                return false;
+            p += (46 + name_len + extra_len + comment_len);
+
+            // Files only, not encrypted, stored or deflated
+            if (name_len < 1 || name[name_len - 1] == '/' || (flags & 0x0001) ||
+                (method != 0 && method != 8) || comp_size == 0xFFFFFFFF ||
+                uncomp_size == 0xFFFFFFFF || local_offset == 0xFFFFFFFF)
+                continue;
+
+            if (pass == 0) {
+                // [/][Name][0] + [ETag]
+                strings_len += (1 + name_len + 1 + WEBUI_ETAG_BUF);
+                count++;
+                continue;
+            }
+
+            // Local file header, its name and extra field may differ from the central one
+            if (local_offset > (size - 30) || _webinix_read_le(map + local_offset, 4) != 0x04034b50)
+                return false;
+            uint64_t data_offset = local_offset + 30 +
+                _webinix_read_le(map + local_offset + 26, 2) + _webinix_read_le(map + local_offset + 28, 2);
+            if (data_offset > size || comp_size > (size - data_offset))
+                return false;
+            if (method == 0 && comp_size != uncomp_size)
+                return false; // Stored, both sizes are the data length
+
+            _webinix_bundle_asset_t* entry = &bundle->assets[index++];
+            strings[0] = '/';
+            memcpy(strings + 1, name, name_len);
+            strings[1 + name_len] = '\0';
+            entry->asset.path = strings;
+            strings += (1 + name_len + 1);
+            WEBUI_SN_PRINTF_STATIC(strings, WEBUI_ETAG_BUF, "\"%08x.%llx\"",
+                crc32, (unsigned long long)uncomp_size);
+            entry->asset.etag = strings;
+            strings += WEBUI_ETAG_BUF;
+            if (method == 0) {
+                // Stored
+                entry->asset.data = map + data_offset;
+                entry->asset.length = (size_t)comp_size;
+            }
+            else {
+                // Deflated, served as gzip (same deflate stream)
+                entry->asset.length = (size_t)uncomp_size;
+                entry->asset.data_gzip = map + data_offset;
+                entry->asset.length_gzip = (size_t)comp_size;
+                entry->gzip_raw = true;
+                entry->gzip_crc32 = crc32;
+            }
+        }
+        bundle->count = index;
+    }
+
+    return true;
+}
+
+static bool _webinix_archive_load_tar(_webinix_bundle_t* bundle, const unsigned char* map, size_t size) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_archive_load_tar()\n");
+    #endif
+
+    // Two passes, first count files and names size, then index them
+    size_t strings_len = 0;
+    size_t count = 0;
+    for (int pass = 0; pass < 2; pass++) {
+
+        if (pass == 1) {
+            if (count < 1)
+                return false;
+            bundle->assets = (_webinix_bundle_asset_t*)_webinix_malloc(count * sizeof(_webinix_bundle_asset_t));
+            bundle->strings = (char*)_webinix_malloc(strings_len);
+            _webinix_mem_tag(bundle->assets, WEBUI_MEM_ASSETS);
+            _webinix_mem_tag(bundle->strings, WEBUI_MEM_ASSETS);
+        }
+        char* strings = bundle->strings;
+        size_t index = 0;
+
+        // GNU long name (`L`) or PAX path (`x`) of the next entry
+        const char* long_name = NULL;
+        size_t long_name_len = 0;
+
+        size_t offset = 0;
+        while (offset + 512 <= size) {
+
+            const unsigned char* h = map + offset;
+            if (h[0] == '\0')
+                break; // End of archive
+
+            // Size (octal)
+            uint64_t file_size = 0;
+            for (size_t i = 124; i < 136 && h[i] >= '0' && h[i] <= '7'; i++)
+                file_size = (file_size << 3) | (uint64_t)(h[i] - '0');
+            uint64_t mtime = 0;
+            for (size_t i = 136; i < 148 && h[i] >= '0' && h[i] <= '7'; i++)
+                mtime = (mtime << 3) | (uint64_t)(h[i] - '0');
+            size_t data_offset = offset + 512;
+            if (file_size > (size - data_offset))
+                return false;
+            offset = data_offset + (size_t)((file_size + 511) & ~(uint64_t)511);
+            const char* data = (const char*)(map + data_offset);
+            char type = (char)h[156];
+
+            if (type == 'L') {
+                long_name = data;
+                long_name_len = strnlen(data, (size_t)file_size);
+                continue;
+            }
+            if (type == 'x') {
+                // PAX records `<len> <key>=<value>\n`
+                const char* r = data;
+                const char* r_end = data + file_size;
+                while (r < r_end) {
+                    size_t record_len = 0;
+                    const char* q = r;
+                    while (q < r_end && *q >= '0' && *q <= '9')
+                        record_len = (record_len * 10) + (size_t)(*q++ - '0');
+                    if (record_len < 1 || record_len > (size_t)(r_end - r))
+                        break;
+                    if (q + 6 < r + record_len && strncmp(q, " path=", 6) == 0 &&
+                        r[record_len - 1] == '\n') {
+                        long_name = q + 6;
+                        long_name_len = (size_t)((r + record_len - 1) - long_name);
+                    }
+                    r += record_len;
+                }
+                continue;
+            }
+            if (type != '0' && type != '\0') {
+                long_name = NULL; // Folders, links...
+                continue;
+            }
+
+            // [prefix/]name
+            const char* prefix = (const char*)(h + 345);
+            size_t prefix_len = (memcmp(h + 257, "ustar\0", 6) == 0 ? strnlen(prefix, 155) : 0);
+            const char* name = (const char*)h;
+            size_t name_len = strnlen(name, 100);
+            if (long_name != NULL) {
+                name = long_name;
+                name_len = long_name_len;
+                prefix_len = 0;
+                long_name = NULL;
+            }
+            if (prefix_len == 0 && name_len >= 2 && name[0] == '.' && name[1] == '/') {
+                name += 2;
+                name_len -= 2;
+            }
+            if (name_len < 1)
+                continue;
+
+            if (pass == 0) {
+                // [/][Prefix][/][Name][0] + [ETag]
+                strings_len += (1 + prefix_len + 1 + name_len + 1 + WEBUI_ETAG_BUF);
+                count++;
+                continue;
+            }
+
+            _webinix_bundle_asset_t* entry = &bundle->assets[index++];
+            char* path = strings;
+            *strings++ = '/';
+            if (prefix_len > 0) {
+                memcpy(strings, prefix, prefix_len);
+                strings += prefix_len;
+                *strings++ = '/';
+            }
+            memcpy(strings, name, name_len);
+            strings += name_len;
+            *strings++ = '\0';
+            entry->asset.path = path;
+            WEBUI_SN_PRINTF_STATIC(strings, WEBUI_ETAG_BUF, "\"%llx.%llx\"",
+                (unsigned long long)mtime, (unsigned long long)file_size);
+            entry->asset.etag = strings;
+            strings += WEBUI_ETAG_BUF;
+            entry->asset.data = (const unsigned char*)data;
+            entry->asset.length = (size_t)file_size;
+        }
+        bundle->count = index;
+    }
+
+    // Appended archives repeat paths, the last entry wins
+    qsort(bundle->assets, bundle->count, sizeof(_webinix_bundle_asset_t), _webinix_bundle_cmp_offset);
+    size_t unique = 0;
+    for (size_t i = 0; i < bundle->count; i++) {
+        if (i + 1 < bundle->count &&
+            strcmp(bundle->assets[i].asset.path, bundle->assets[i + 1].asset.path) == 0)
+            continue;
+        bundle->assets[unique++] = bundle->assets[i];
+    }
+    bundle->count = unique;
+
+    return true;
+}
+
+#ifdef WEBUI_LOG
+static int _webinix_http_log(const struct mg_connection* client, const char* message) {
     (void)client;
     printf("[Core]\t\t_webinix_http_log()\n");
     printf("[Core]\t\t_webinix_http_log() -> Log: %s.\n", message);
     return 1;
 }
-#endif
+#endif
+
+// static size_t _webinix_hash_djb2(const char* s) {
+//     // DJB2 Algorithm
+//     size_t hash = 5381;
+//     int c;
+//     while ((c = *s++)) {
+//         // hash * 33 + c
+//         hash = ((hash << 5) + hash) + c;
+//     }
+//     return hash;
+// }
+
+static void _webinix_generate_cookies(char* cookies, size_t length) {
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_generate_cookies()\n");
+    #endif
+    const char charset[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+    size_t charset_size = sizeof(charset) - 1;
+    for (size_t i = 0; i < length - 1; i++) {
+        uint32_t random_value = _webinix_generate_random_uint32();
+        int key = random_value % charset_size;
+        cookies[i] = charset[key];
+    }
+    cookies[length - 1] = '\0';
+}
+
+static bool _webinix_client_cookies_save(_webinix_window_t* win, const char* cookies, size_t* client_id) {
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_client_cookies_save()\n");
+    #endif
+    // [win number][_][cookies]
+    char win_cookies[WEBUI_COOKIES_BUF];
+    int len = WEBUI_SN_PRINTF_STATIC(win_cookies, sizeof(win_cookies), "%zu_%s", win->num, cookies);
+    if (len < 0 || (size_t)len >= sizeof(win_cookies))
+        return false;
+    if (!_webinix_client_cookies_add(win_cookies, client_id))
+        return false;
+    // Cluster, let the other workers accept this client too
+    if (_webinix.config.cluster) {
+        _webinix_cluster_publish(
+            WEBUI_CLUSTER_COOKIE, win->num, 0, win_cookies, _webinix_strlen(win_cookies)
+        );
+    }
+    return true;
+}
+
+static uint64_t _webinix_session_hash(const char* cookies) {
+
+    // FNV-1a
+    uint64_t hash = 14695981039346656037ULL;
+    while (*cookies) {
+        hash ^= (unsigned char)*cookies++;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+static size_t _webinix_session_find(const char* cookies, uint64_t hash) {
+
+    // Index position of `cookies`, or the empty position ending its
+    // probe sequence. Caller must hold `mutex_sessions`.
+    size_t mask = _webinix.sessions_index_size - 1;
+    size_t pos = (size_t)hash & mask;
+    for (;;) {
+        size_t entry = _webinix.sessions_index[pos];
+        if (entry == 0)
+            return pos;
+        if (_webinix.sessions_hash[entry - 1] == hash &&
+            strcmp(&_webinix.sessions[(entry - 1) * WEBUI_COOKIES_BUF], cookies) == 0)
+            return pos;
+        pos = (pos + 1) & mask;
+    }
+}
+
+static void _webinix_session_unindex(size_t pos) {
+
+    // Backward shift deletion, so no probe sequence is broken.
+    // Caller must hold `mutex_sessions`.
+    size_t mask = _webinix.sessions_index_size - 1;
+    size_t next = pos;
+    for (;;) {
+        next = (next + 1) & mask;
+        size_t entry = _webinix.sessions_index[next];
+        if (entry == 0)
+            break;
+        // Entries whose home is cyclically in (pos, next] stay
+        size_t home = (size_t)_webinix.sessions_hash[entry - 1] & mask;
+        bool stays = (pos <= next) ? (pos < home && home <= next) : (pos < home || home <= next);
+        if (!stays) {
+            _webinix.sessions_index[pos] = entry;
+            pos = next;
+        }
+    }
+    _webinix.sessions_index[pos] = 0;
+}
+
+static bool _webinix_session_grow(void) {
+
+    // Double the sessions table, and rebuild its index.
+    // Caller must hold `mutex_sessions`.
+    size_t old_capacity = _webinix.sessions_capacity;
+    size_t capacity = (old_capacity > 0 ? old_capacity * 2 : WEBUI_MAX_IDS);
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_session_grow() -> %zu sessions\n", capacity);
+    #endif
+
+    char* sessions = (char*)_webinix_table_grow(
+        _webinix.sessions, WEBUI_COOKIES_BUF, old_capacity, capacity);
+    uint64_t* sessions_hash = (uint64_t*)_webinix_table_grow(
+        _webinix.sessions_hash, sizeof(uint64_t), old_capacity, capacity);
+    uint64_t* sessions_seen = (uint64_t*)_webinix_table_grow(
+        _webinix.sessions_seen, sizeof(uint64_t), old_capacity, capacity);
+    size_t* sessions_conns = (size_t*)_webinix_table_grow(
+        _webinix.sessions_conns, sizeof(size_t), old_capacity, capacity);
+    size_t* sessions_prev = (size_t*)_webinix_table_grow(
+        _webinix.sessions_prev, sizeof(size_t), old_capacity, capacity);
+    size_t* sessions_next = (size_t*)_webinix_table_grow(
+        _webinix.sessions_next, sizeof(size_t), old_capacity, capacity);
+    size_t* sessions_free = (size_t*)_webinix_table_grow(
+        _webinix.sessions_free, sizeof(size_t), _webinix.sessions_free_count, capacity);
+    size_t* sessions_index = (size_t*)_webinix_table_grow(NULL, sizeof(size_t), 0, capacity * 2);
+    if (sessions == NULL || sessions_hash == NULL || sessions_seen == NULL || sessions_conns == NULL ||
+        sessions_prev == NULL || sessions_next == NULL || sessions_free == NULL || sessions_index == NULL) {
+        _webinix_free_mem((void*)sessions);
+        _webinix_free_mem((void*)sessions_hash);
+        _webinix_free_mem((void*)sessions_seen);
+        _webinix_free_mem((void*)sessions_conns);
+        _webinix_free_mem((void*)sessions_prev);
+        _webinix_free_mem((void*)sessions_next);
+        _webinix_free_mem((void*)sessions_free);
+        _webinix_free_mem((void*)sessions_index);
+        return false;
+    }
+    _webinix_mem_tag(sessions, WEBUI_MEM_COOKIES);
+    _webinix_mem_tag(sessions_hash, WEBUI_MEM_COOKIES);
+    _webinix_mem_tag(sessions_seen, WEBUI_MEM_COOKIES);
+    _webinix_mem_tag(sessions_conns, WEBUI_MEM_COOKIES);
+    _webinix_mem_tag(sessions_prev, WEBUI_MEM_COOKIES);
+    _webinix_mem_tag(sessions_next, WEBUI_MEM_COOKIES);
+    _webinix_mem_tag(sessions_free, WEBUI_MEM_COOKIES);
+    _webinix_mem_tag(sessions_index, WEBUI_MEM_COOKIES);
+
+    // Only read under `mutex_sessions`, no need to retire them
+    _webinix_free_mem((void*)_webinix.sessions);
+    _webinix_free_mem((void*)_webinix.sessions_hash);
+    _webinix_free_mem((void*)_webinix.sessions_seen);
+    _webinix_free_mem((void*)_webinix.sessions_conns);
+    _webinix_free_mem((void*)_webinix.sessions_prev);
+    _webinix_free_mem((void*)_webinix.sessions_next);
+    _webinix_free_mem((void*)_webinix.sessions_free);
+    _webinix_free_mem((void*)_webinix.sessions_index);
+
+    _webinix.sessions = sessions;
+    _webinix.sessions_hash = sessions_hash;
+    _webinix.sessions_seen = sessions_seen;
+    _webinix.sessions_conns = sessions_conns;
+    _webinix.sessions_prev = sessions_prev;
+    _webinix.sessions_next = sessions_next;
+    _webinix.sessions_free = sessions_free;
+    _webinix.sessions_index = sessions_index;
+    _webinix.sessions_index_size = capacity * 2;
+    _webinix.sessions_capacity = capacity;
+
+    for (size_t i = 0; i < _webinix.sessions_used; i++) {
+        const char* cookies = &_webinix.sessions[i * WEBUI_COOKIES_BUF];
+        if (cookies[0] != 0x00)
+            _webinix.sessions_index[_webinix_session_find(cookies, _webinix.sessions_hash[i])] = i + 1;
+    }
+    return true;
+}
+
+static uint64_t _webinix_session_now(void) {
+
+    // Seconds, monotonic so wall clock changes don't expire sessions
+    #ifdef _WIN32
+    return (uint64_t)(GetTickCount64() / 1000);
+    #else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec;
+    #endif
+}
+
+static void _webinix_session_touch(size_t id, uint64_t now) {
+
+    // Move a session to the front of the LRU list.
+    // Caller must hold `mutex_sessions`.
+    _webinix.sessions_seen[id] = now;
+    if (_webinix.sessions_head == id)
+        return;
+    size_t prev = _webinix.sessions_prev[id];
+    size_t next = _webinix.sessions_next[id];
+    if (prev != WEBUI_SESSION_NONE)
+        _webinix.sessions_next[prev] = next;
+    if (next != WEBUI_SESSION_NONE)
+        _webinix.sessions_prev[next] = prev;
+    if (_webinix.sessions_tail == id)
+        _webinix.sessions_tail = prev;
+    _webinix.sessions_prev[id] = WEBUI_SESSION_NONE;
+    _webinix.sessions_next[id] = _webinix.sessions_head;
+    if (_webinix.sessions_head != WEBUI_SESSION_NONE)
+        _webinix.sessions_prev[_webinix.sessions_head] = id;
+    _webinix.sessions_head = id;
+    if (_webinix.sessions_tail == WEBUI_SESSION_NONE)
+        _webinix.sessions_tail = id;
+}
+
+static void _webinix_session_remove(size_t id) {
+
+    // Caller must hold `mutex_sessions`
+    char* cookies = &_webinix.sessions[id * WEBUI_COOKIES_BUF];
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_session_remove() -> Session #%zu [%s]\n", id, cookies);
+    #endif
+
+    // Index
+    _webinix_session_unindex(_webinix_session_find(cookies, _webinix.sessions_hash[id]));
+
+    // LRU list
+    size_t prev = _webinix.sessions_prev[id];
+    size_t next = _webinix.sessions_next[id];
+    if (prev != WEBUI_SESSION_NONE)
+        _webinix.sessions_next[prev] = next;
+    else _webinix.sessions_head = next;
+    if (next != WEBUI_SESSION_NONE)
+        _webinix.sessions_prev[next] = prev;
+    else _webinix.sessions_tail = prev;
+
+    // The window can hand out a new single client cookies, unless
+    // a client is still connected to it
+    size_t num = (size_t)strtoul(cookies, NULL, 10);
+    _webinix_wins_view_t* view = _webinix_wins_view();
+    _webinix_window_t* win = _webinix_wins_get(num);
+    if (num < view->capacity && (win == NULL || !_webinix_mutex_is_connected(win, WEBUI_MUTEX_GET_STATUS)))
+        view->cookies_single_set[num] = false;
+
+    cookies[0] = 0x00;
+    _webinix.sessions_free[_webinix.sessions_free_count++] = id;
+    _webinix.sessions_stats.active--;
+}
+
+static void _webinix_session_expire(uint64_t now) {
+
+    // The LRU list tail is the least recently used session, so
+    // only expired sessions are visited. Connected ones are kept,
+    // and moved to the front. Caller must hold `mutex_sessions`.
+    if (_webinix.sessions_idle == 0)
+        return;
+    size_t visits = _webinix.sessions_stats.active;
+    while (visits-- > 0 && _webinix.sessions_tail != WEBUI_SESSION_NONE &&
+        now - _webinix.sessions_seen[_webinix.sessions_tail] >= (uint64_t)_webinix.sessions_idle) {
+        size_t id = _webinix.sessions_tail;
+        if (_webinix.sessions_conns[id] > 0) {
+            _webinix_session_touch(id, now);
+            continue;
+        }
+        _webinix_session_remove(id);
+        _webinix.sessions_stats.expired++;
+    }
+}
 
-// static size_t _webinix_hash_djb2(const char* s) {
-//     // DJB2 Algorithm
-//     size_t hash = 5381;
-//     int c;
-//     while ((c = *s++)) {
-//         // hash * 33 + c
-//         hash = ((hash << 5) + hash) + c;
-//     }
-//     return hash;
-// }
+static size_t _webinix_session_acquire(_webinix_window_t* win, struct mg_connection* client) {
 
-static void _webinix_generate_cookies(char* cookies, size_t length) {
-    #ifdef WEBUI_LOG
-    printf("[Core]\t\t_webinix_generate_cookies()\n");
-    #endif
-    const char charset[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
-    size_t charset_size = sizeof(charset) - 1;
-    for (size_t i = 0; i < length - 1; i++) {
-        uint32_t random_value = _webinix_generate_random_uint32();
-        int key = random_value % charset_size;
-        cookies[i] = charset[key];
+    // Pin the session of a new connection so it is not expired or
+    // evicted while connected. Returns the session + 1, `0` for none.
+    if (!_webinix.config.use_cookies || _webinix_is_local_client(client))
+        return 0;
+    char cookies[WEBUI_COOKIES_BUF] = {0};
+    _webinix_get_cookies(win, client, cookies);
+    if (_webinix_is_empty(cookies))
+        return 0;
+    uint64_t hash = _webinix_session_hash(cookies);
+    _webinix_mutex_lock(&_webinix.mutex_sessions);
+    size_t session = _webinix.sessions_index[_webinix_session_find(cookies, hash)];
+    if (session != 0) {
+        _webinix.sessions_conns[session - 1]++;
+        _webinix_session_touch(session - 1, _webinix_session_now());
     }
-    cookies[length - 1] = '\0';
+    _webinix_mutex_unlock(&_webinix.mutex_sessions);
+    return session;
 }
 
-static bool _webinix_client_cookies_save(_webinix_window_t* win, const char* cookies, size_t* client_id) {
+static void _webinix_session_release(size_t session) {
+
+    // Unpin a session from `_webinix_session_acquire()`, its idle
+    // timeout starts now
+    if (session == 0)
+        return;
+    _webinix_mutex_lock(&_webinix.mutex_sessions);
+    if (_webinix.sessions_conns[session - 1] > 0)
+        _webinix.sessions_conns[session - 1]--;
+    _webinix_session_touch(session - 1, _webinix_session_now());
+    _webinix_mutex_unlock(&_webinix.mutex_sessions);
+}
+
+static bool _webinix_client_cookies_add(const char* win_cookies, size_t* client_id) {
     #ifdef WEBUI_LOG
-    printf("[Core]\t\t_webinix_client_cookies_save()\n");
+    printf("[Core]\t\t_webinix_client_cookies_add()\n");
     #endif
-    // [win number][_][cookies]
-    char win_cookies[WEBUI_COOKIES_BUF];
-    WEBUI_SN_PRINTF_STATIC(win_cookies, sizeof(win_cookies), "%zu_%s", win->num, cookies);
-    for (size_t i = 0; i < WEBUI_MAX_IDS; i++) {
-        if (_webinix.cookies[i] == NULL) {
-            _webinix.cookies[i] = _webinix_str_dup(win_cookies);
-            *client_id = i;
-            return true;
+    if (_webinix_strlen(win_cookies) >= WEBUI_COOKIES_BUF)
+        return false;
+    uint64_t now = _webinix_session_now();
+    uint64_t hash = _webinix_session_hash(win_cookies);
+    _webinix_mutex_lock(&_webinix.mutex_sessions);
+    _webinix_session_expire(now);
+
+    // Already known
+    size_t pos = _webinix_session_find(win_cookies, hash);
+    if (_webinix.sessions_index[pos] != 0) {
+        *client_id = _webinix.sessions_index[pos] - 1;
+        _webinix_session_touch(*client_id, now);
+        _webinix_mutex_unlock(&_webinix.mutex_sessions);
+        return true;
+    }
+
+    // Full, evict the least recently used sessions that are not connected
+    size_t visits = _webinix.sessions_stats.active;
+    while (_webinix.sessions_stats.active >= _webinix.sessions_max && visits-- > 0 &&
+        _webinix.sessions_tail != WEBUI_SESSION_NONE) {
+        size_t id = _webinix.sessions_tail;
+        if (_webinix.sessions_conns[id] > 0) {
+            _webinix_session_touch(id, now);
+            continue;
         }
+        _webinix_session_remove(id);
+        _webinix.sessions_stats.evicted++;
     }
-    // List is full
-    return false;
+    if (_webinix.sessions_stats.active >= _webinix.sessions_max) {
+        // All sessions are connected
+        _webinix_mutex_unlock(&_webinix.mutex_sessions);
+        return false;
+    }
+
+    size_t id = 0;
+    if (_webinix.sessions_free_count > 0)
+        id = _webinix.sessions_free[--_webinix.sessions_free_count];
+    else {
+        if (_webinix.sessions_used == _webinix.sessions_capacity && !_webinix_session_grow()) {
+            // List is full
+            _webinix_mutex_unlock(&_webinix.mutex_sessions);
+            return false;
+        }
+        id = _webinix.sessions_used++;
+    }
+    WEBUI_STR_COPY_STATIC(&_webinix.sessions[id * WEBUI_COOKIES_BUF], WEBUI_COOKIES_BUF, win_cookies);
+    _webinix.sessions_hash[id] = hash;
+    _webinix.sessions_conns[id] = 0;
+    _webinix.sessions_index[_webinix_session_find(win_cookies, hash)] = id + 1;
+    _webinix.sessions_prev[id] = WEBUI_SESSION_NONE;
+    _webinix.sessions_next[id] = WEBUI_SESSION_NONE;
+    if (_webinix.sessions_head == WEBUI_SESSION_NONE) {
+        _webinix.sessions_head = id;
+        _webinix.sessions_tail = id;
+    }
+    _webinix_session_touch(id, now);
+    _webinix.sessions_stats.active++;
+    _webinix.sessions_stats.created++;
+    if (_webinix.sessions_stats.active > _webinix.sessions_stats.peak)
+        _webinix.sessions_stats.peak = _webinix.sessions_stats.active;
+    _webinix_mutex_unlock(&_webinix.mutex_sessions);
+    *client_id = id;
+    return true;
 }
 
 static bool _webinix_client_cookies_get_id(_webinix_window_t* win, const char* cookies, size_t* client_id) {
     #ifdef WEBUI_LOG
     printf("[Core]\t\t_webinix_client_cookies_get_id()\n");
     #endif
-    for (size_t i = 0; i < WEBUI_MAX_IDS; i++) {
-        if (_webinix.cookies[i] != NULL) {
-            if (strcmp(_webinix.cookies[i], cookies) == 0) {
-                *client_id = i;
-                return true;
-            }
-        }
+    if (_webinix_is_empty(cookies))
+        return false;
+    uint64_t now = _webinix_session_now();
+    uint64_t hash = _webinix_session_hash(cookies);
+    _webinix_mutex_lock(&_webinix.mutex_sessions);
+    _webinix_session_expire(now);
+    size_t pos = _webinix_session_find(cookies, hash);
+    if (_webinix.sessions_index[pos] != 0) {
+        *client_id = _webinix.sessions_index[pos] - 1;
+        _webinix_session_touch(*client_id, now);
+        _webinix_mutex_unlock(&_webinix.mutex_sessions);
+        return true;
     }
     // Not found
+    _webinix_mutex_unlock(&_webinix.mutex_sessions);
     return false;
 }
 
@@ -8796,66 +12672,170 @@ static size_t _webinix_client_get_id(_webinix_window_t* win, struct mg_connectio
     size_t client_id = 0;
     if (_webinix.config.use_cookies) {
         char cookies[WEBUI_COOKIES_BUF] = {0};
-        _webinix_get_cookies(client, cookies);
+        _webinix_get_cookies(win, client, cookies);
         _webinix_client_cookies_get_id(win, cookies, &client_id);
     }
     return client_id;
 }
 
-// static void _webinix_client_cookies_free_all(_webinix_window_t* win) {
-//     #ifdef WEBUI_LOG
-//     printf("[Core]\t\t_webinix_client_cookies_free_all()\n");
-//     #endif
-//     // [win number]
-//     char win_num[24];
-//     WEBUI_SN_PRINTF_STATIC(win_num, sizeof(win_num), "%zu_", win->num);
-//     size_t len = strlen(win_num);
-//     for (size_t i = 0; i < WEBUI_MAX_IDS; i++) {
-//         if (_webinix.cookies[i] != NULL) {
-//             // [{win_number}_{cookies}]
-//             if (strncmp(_webinix.cookies[i], win_num, len) == 0) {
-//                 _webinix_free_mem((void*)_webinix.cookies[i]);
-//                 _webinix.cookies[i] = NULL;
-//             }
-//         }
-//     }
-//     // Single
-//     _webinix.cookies_single_set[win->num] = false;
-// }
-
-// static void _webinix_client_cookies_free(_webinix_window_t* win, struct mg_connection* client) {
-//     #ifdef WEBUI_LOG
-//     printf("[Core]\t\t_webinix_client_cookies_free()\n");
-//     #endif
-//     char cookies[WEBUI_COOKIES_BUF] = {0};
-//     _webinix_get_cookies(client, cookies);
-//     if (cookies != NULL) {
-//         size_t client_id = 0;
-//         if (_webinix_client_cookies_get_id(win, cookies, &client_id)) {
-//             _webinix_free_mem((void*)_webinix.cookies[client_id]);
-//             _webinix.cookies[client_id] = NULL;
-//         }
-//     }
-// }
-
 static const char* _webinix_get_cookies_full(const struct mg_connection* client) {
     #ifdef WEBUI_LOG
     printf("[Core]\t\t_webinix_get_cookies_full()\n");
     #endif
+    if (_webinix_is_local_client(client))
+        return "";
     const char* header = mg_get_header(client, "Cookie");
     if (header != NULL)
         return header;
     return "";
 }
 
-static void _webinix_get_cookies(const struct mg_connection* client, char* buffer) {
+static void _webinix_cookies_name(_webinix_window_t* win, char* buffer, size_t len) {
+
+    // Windows of the shared server are on the same origin, so each
+    // one has its own auth cookies name, or they would overwrite
+    // each other's cookies
+    if (win->url_prefix[0] != '\0')
+        WEBUI_SN_PRINTF_STATIC(buffer, len, "webinix_auth_%zu", win->num);
+    else
+        WEBUI_STR_COPY_STATIC(buffer, len, "webinix_auth");
+}
+
+static void _webinix_get_cookies(_webinix_window_t* win, const struct mg_connection* client, char* buffer) {
     #ifdef WEBUI_LOG
     printf("[Core]\t\t_webinix_get_cookies()\n");
     #endif
+    if (_webinix_is_local_client(client))
+        return;
     const char* header = mg_get_header(client, "Cookie");
     if (!_webinix_is_empty(header)) {
-        mg_get_cookie(header, "webinix_auth", buffer, WEBUI_COOKIES_BUF);
+        char name[32];
+        _webinix_cookies_name(win, name, sizeof(name));
+        mg_get_cookie(header, name, buffer, WEBUI_COOKIES_BUF);
+    }
+}
+
+static void _webinix_path_entry_clear(_webinix_path_entry_t* entry) {
+    _webinix_free_mem((void*)entry->url);
+    _webinix_free_mem((void*)entry->full_path);
+    _webinix_free_mem((void*)entry->redirect);
+    memset(entry, 0, sizeof(_webinix_path_entry_t));
+}
+
+static void _webinix_path_cache_free(_webinix_window_t* win) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_path_cache_free([%zu])\n", win->num);
+    #endif
+
+    if (win->path_cache == NULL)
+        return;
+    for (size_t i = 0; i < WEBUI_PATH_CACHE_SIZE; i++)
+        _webinix_path_entry_clear(&win->path_cache[i]);
+    _webinix_free_mem((void*)win->path_cache);
+    win->path_cache = NULL;
+}
+
+static void _webinix_path_cache_invalidate(void) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_path_cache_invalidate()\n");
+    #endif
+
+    // Entries resolved before this point are stale
+    _webinix_mutex_lock(&_webinix.mutex_path_cache);
+    _webinix.path_cache_generation++;
+    _webinix_mutex_unlock(&_webinix.mutex_path_cache);
+}
+
+static const _webinix_path_entry_t* _webinix_path_resolve(_webinix_window_t* win, const char* url) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_path_resolve([%s])\n", url);
+    #endif
+
+    // Resolve a URL to a local file, an index file redirect, or
+    // nothing. Results are cached per window until the folder
+    // monitor sees a change, or `WEBUI_PATH_CACHE_TTL` elapses for
+    // changes it can't see (sub folders, monitor disabled).
+    // Caller must hold `mutex_http_handler`.
+
+    if (win->path_cache == NULL) {
+        win->path_cache = (_webinix_path_entry_t*)_webinix_malloc(
+            WEBUI_PATH_CACHE_SIZE * sizeof(_webinix_path_entry_t));
+        _webinix_mem_tag(win->path_cache, WEBUI_MEM_ASSETS);
+    }
+
+    _webinix_mutex_lock(&_webinix.mutex_path_cache);
+    size_t generation = _webinix.path_cache_generation;
+    _webinix_mutex_unlock(&_webinix.mutex_path_cache);
+
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    for (const char* p = url; *p; p++) {
+        hash ^= (unsigned char)*p;
+        hash *= 16777619u;
+    }
+    _webinix_path_entry_t* entry = &win->path_cache[hash % WEBUI_PATH_CACHE_SIZE];
+
+    if (entry->url != NULL && strcmp(entry->url, url) == 0 &&
+        entry->generation == generation &&
+        !_webinix_timer_is_end(&entry->timer, WEBUI_PATH_CACHE_TTL)) {
+        #ifdef WEBUI_LOG
+        printf("[Core]\t\t_webinix_path_resolve() -> Cached\n");
+        #endif
+        return entry;
+    }
+
+    // Miss, stale, or collision
+    _webinix_path_entry_clear(entry);
+    entry->url = _webinix_str_dup(url);
+    entry->generation = generation;
+    entry->kind = WEBUI_PATH_NOT_FOUND;
+    _webinix_timer_start(&entry->timer);
+
+    // [Path][Sep][file or folder]
+    char* full_path = _webinix_get_full_path(win, url);
+    int64_t file_size = 0;
+    time_t file_mtime = 0;
+
+    if (_webinix_file_stat(full_path, &file_size, &file_mtime)) {
+
+        // [/file]
+        const char* extension = _webinix_get_extension(url);
+        entry->kind = WEBUI_PATH_FILE;
+        entry->full_path = full_path;
+        entry->mime_type = mg_get_builtin_mime_type(url);
+        entry->script = (strcmp(extension, "js") == 0 || strcmp(extension, "ts") == 0);
+        return entry;
+    }
+
+    if (_webinix_folder_exist(full_path)) {
+
+        // [/folder], looking for an index file
+        const char* index_files[] = {"index.ts", "index.js", "index.html", "index.htm"};
+
+        // [Path][Sep][File Name]
+        size_t bf_len = (_webinix_strlen(full_path) + 1 + 24);
+        char* index_path = (char*)_webinix_malloc(bf_len);
+        for (size_t i = 0; i < (sizeof(index_files) / sizeof(index_files[0])); i++) {
+            WEBUI_SN_PRINTF_DYN(index_path, bf_len, "%s%s%s", full_path, os_sep, index_files[i]);
+            if (_webinix_file_stat(index_path, &file_size, &file_mtime)) {
+                // [Prefix][URL][/][Index Name]
+                size_t url_len = _webinix_strlen(url);
+                size_t redirect_len = (sizeof(win->url_prefix) + url_len + 1 + 24);
+                entry->redirect = (char*)_webinix_malloc(redirect_len);
+                WEBUI_SN_PRINTF_DYN(entry->redirect, redirect_len, "%s%s%s%s", win->url_prefix,
+                    url, ((url_len > 0 && url[url_len - 1] == '/') ? "" : "/"), index_files[i]);
+                entry->kind = WEBUI_PATH_REDIRECT;
+                break;
+            }
+        }
+        _webinix_free_mem((void*)index_path);
     }
+
+    _webinix_free_mem((void*)full_path);
+    return entry;
 }
 
 static int _webinix_http_handler(struct mg_connection* client, void * _win) {
@@ -8877,7 +12857,7 @@ static int _webinix_http_handler(struct mg_connection* client, void * _win) {
     // Initializing
     int http_status_code = 200;
     const struct mg_request_info * ri = mg_get_request_info(client);
-    const char* url = ri->local_uri;
+    const char* url = _webinix_http_local_uri(win, ri);
 
     if (strcmp(ri->request_method, "GET") == 0) {
 
@@ -8893,7 +12873,7 @@ static int _webinix_http_handler(struct mg_connection* client, void * _win) {
         if (_webinix.config.use_cookies) {
             // Cookies config is enabled
             char cookies[WEBUI_COOKIES_BUF] = {0};
-            _webinix_get_cookies(client, cookies);
+            _webinix_get_cookies(win, client, cookies);
             #ifdef WEBUI_LOG
             printf("[Core]\t\t_webinix_http_handler() -> Client cookies [%s]\n", cookies);
             #endif
@@ -8936,23 +12916,33 @@ static int _webinix_http_handler(struct mg_connection* client, void * _win) {
             printf("[Core]\t\t_webinix_http_handler() -> Webinix-Bridge\n");
             #endif
 
-            // Generate JavaScript bridge
-            const char* js = _webinix_generate_js_bridge(win, client);
+            // Generate JavaScript bridge configuration
+            char js[WEBUI_BRIDGE_CONFIG_BUF];
 
-            if (js != NULL) {
+            if (_webinix_generate_js_bridge(win, js, sizeof(js))) {
                 // Send 200
-                _webinix_http_send(win, client, "application/javascript", js, _webinix_strlen(js), false);
-                _webinix_free_mem((void*)js);
+                _webinix_http_send(win, client, "application/javascript", js, _webinix_strlen(js), WEBUI_HTTP_NO_CACHE);
             } else {
                 // Non-authorized request to `webinix.js`, like requesting twice
                 // Send 200 (Empty)
                 #ifdef WEBUI_LOG
                 printf("[Core]\t\t_webinix_http_handler() -> Non-authorized request to webinix.js\n");
                 #endif
-                _webinix_http_send(win, client, "application/javascript", "", 0, false);
+                _webinix_http_send(win, client, "application/javascript", "", 0, WEBUI_HTTP_NO_CACHE);
             }
         }
-        else if ((win->files_handler != NULL || (win->files_handler_window != NULL)) && (_webinix_external_file_handler(win, client, client_id) != 0)) {
+        else if (strcmp(url, "/webinix_bridge.js") == 0) {
+
+            // Webinix Bridge (static)
+
+            #ifdef WEBUI_LOG
+            printf("[Core]\t\t_webinix_http_handler() -> Webinix-Bridge (static)\n");
+            #endif
+
+            _webinix_http_send_bridge(win, client);
+        }
+        else if ((win->files_handler != NULL || win->files_handler_window != NULL || win->files_handler_stream != NULL) &&
+            (_webinix_external_file_handler(win, client, client_id) != 0)) {
 
             // File already handled by the custom external file handler
             // nothing to do now.
@@ -8960,6 +12950,20 @@ static int _webinix_http_handler(struct mg_connection* client, void * _win) {
             printf("[Core]\t\t_webinix_http_handler() -> Handled by custom external file handler\n");
             #endif
         }
+        else if (win->bundle != NULL && _webinix_bundle_serve(win, win->bundle, client, &http_status_code)) {
+
+            // File served from the asset bundle
+            #ifdef WEBUI_LOG
+            printf("[Core]\t\t_webinix_http_handler() -> Served from the asset bundle\n");
+            #endif
+        }
+        else if (win->archive != NULL && _webinix_bundle_serve(win, win->archive, client, &http_status_code)) {
+
+            // File served from the root folder archive
+            #ifdef WEBUI_LOG
+            printf("[Core]\t\t_webinix_http_handler() -> Served from the root folder archive\n");
+            #endif
+        }
         else if (strcmp(url, "/") == 0) {
 
             // [/]
@@ -8979,180 +12983,613 @@ static int _webinix_http_handler(struct mg_connection* client, void * _win) {
                 #endif
 
                 // Send 200
-                _webinix_http_send(win, client, "text/html", win->html, _webinix_strlen(win->html), false);
+                _webinix_http_send(win, client, "text/html", win->html, _webinix_strlen(win->html), WEBUI_HTTP_NO_CACHE);
             }
             else {
 
                 // Looking for index file and redirect
 
-                const char* index_files[] = {"index.ts", "index.js", "index.html", "index.htm"};
+                const _webinix_path_entry_t* entry = _webinix_path_resolve(win, url);
+                if (entry->kind == WEBUI_PATH_REDIRECT) {
+                    #ifdef WEBUI_LOG
+                    printf("[Core]\t\t_webinix_http_handler() -> 302 Redirecting to [%s]\n", entry->redirect);
+                    #endif
+                    mg_send_http_redirect(client, entry->redirect, 302);
+                    http_status_code = 302;
+                }
+                else {
 
-                // [Path][Sep][File Name]
-                size_t bf_len = (_webinix_strlen(win->server_root_path) + 1 + 24);
-                char* index_path = (char*)_webinix_malloc(bf_len);
-                for (size_t i = 0; i < (sizeof(index_files) / sizeof(index_files[0])); i++) {
-                    WEBUI_SN_PRINTF_DYN(index_path, bf_len, "%s%s%s",
-                        win->server_root_path, os_sep, index_files[i]
-                    );
-                    if (_webinix_file_exist(index_path)) {
-                        #ifdef WEBUI_LOG
-                        printf("[Core]\t\t_webinix_http_handler() -> 302 Redirecting to [%s]\n", index_files[i]);
-                        #endif
-                        mg_send_http_redirect(client, index_files[i], 302);
-                        _webinix_free_mem((void*)index_path);
-                        _webinix_mutex_unlock(&_webinix.mutex_http_handler);
-                        return 302;
-                    }
+                    // No index file is found in this folder
+                    _webinix_http_send_error(client, webinix_html_res_not_available, 404);
+                    http_status_code = 404;
+                }
+            }
+        }
+        else if (strcmp(url, "/favicon.ico") == 0 || strcmp(url, "/favicon.svg") == 0) {
+
+            // Favicon
+
+            const _webinix_path_entry_t* entry = NULL;
+            if (win->icon == NULL || win->icon_type == NULL)
+                entry = _webinix_path_resolve(win, url);
+
+            if (entry == NULL) {
+
+                // Custom user icon
+
+                // User icon 200
+                _webinix_http_send(win, client, win->icon_type, win->icon, _webinix_strlen(win->icon), WEBUI_HTTP_NO_CACHE);
+            }
+            else if (entry->kind == WEBUI_PATH_FILE) {
+
+                // Local icon file
+                _webinix_http_send_file(win, client, entry->mime_type, entry->full_path, WEBUI_HTTP_NO_CACHE);
+            }
+            else {
+
+                // Default embedded icon
+
+                if (strcmp(url, "/favicon.ico") == 0) {
+
+                    mg_send_http_redirect(client, "favicon.svg", 302);
+                    http_status_code = 302;
+                }
+                else {
+
+                    // Default icon 200
+                    _webinix_http_send(win, client, webinix_def_icon_type, webinix_def_icon, _webinix_strlen(webinix_def_icon), WEBUI_HTTP_NO_CACHE);
+                }
+            }
+        } else {
+
+            // [/file] or [/folder]
+
+            const _webinix_path_entry_t* entry = _webinix_path_resolve(win, url);
+
+            if (entry->kind == WEBUI_PATH_FILE) {
+
+                // [/file]
+
+                if (entry->script && win->runtime != None) {
+
+                    #ifdef WEBUI_LOG
+                    printf("[Core]\t\t_webinix_http_handler() -> Interpret local script file\n");
+                    #endif
+
+                    // Serve as a script file to be interpreted by
+                    // an external interpreter (Deno, Bun, Nodejs)
+                    http_status_code = _webinix_interpret_file(win, client, NULL, client_id);
+                }
+                else {
+
+                    #ifdef WEBUI_LOG
+                    printf("[Core]\t\t_webinix_http_handler() -> Local file\n");
+                    #endif
+
+                    // Serve as a normal text-based file
+                    _webinix_http_send_file(win, client, entry->mime_type, entry->full_path, WEBUI_HTTP_NO_CACHE);
                 }
+            }
+            else if (entry->kind == WEBUI_PATH_REDIRECT) {
+
+                // [/folder]
+
+                #ifdef WEBUI_LOG
+                printf("[Core]\t\t_webinix_http_handler() -> 302 Redirecting to [%s]\n", entry->redirect);
+                #endif
+                mg_send_http_redirect(client, entry->redirect, 302);
+                http_status_code = 302;
+            }
+            else {
+
+                // [invalid]
+
+                #ifdef WEBUI_LOG
+                printf("[Core]\t\t_webinix_http_handler() -> Not found\n");
+                #endif
 
-                // No index file is found in this folder
-                _webinix_free_mem((void*)index_path);
+                // No file, or folder with an index file, is found at this path
                 _webinix_http_send_error(client, webinix_html_res_not_available, 404);
                 http_status_code = 404;
             }
         }
-        else if (strcmp(url, "/favicon.ico") == 0 || strcmp(url, "/favicon.svg") == 0) {
+    } else {
 
-            // Favicon
+        #ifdef WEBUI_LOG
+        printf("[Core]\t\t_webinix_http_handler() -> Unknown request method [%s]\n", ri->request_method);
+        #endif
+    }
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_http_handler() -> HTTP Status Code: %d\n", http_status_code);
+    #endif
+
+    _webinix_mutex_unlock(&_webinix.mutex_http_handler);
+    return http_status_code;
+}
+
+static const char* _webinix_http_local_uri(_webinix_window_t* win, const struct mg_request_info* ri) {
+
+    // The request URL as the window sees it, `/_webinix/<num>/file`
+    // is `/file` of window `<num>` on the shared server
+    size_t prefix_len = _webinix_strlen(win->url_prefix);
+    if (prefix_len > 0 && strncmp(ri->local_uri, win->url_prefix, prefix_len) == 0)
+        return (ri->local_uri + prefix_len);
+    return ri->local_uri;
+}
+
+static int _webinix_http_prefix_handler(struct mg_connection* client, void * _win) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_http_prefix_handler()\n");
+    #endif
+
+    // Shared server: `/_webinix/<num>/file` is `/file` of window `<num>`
+
+    _webinix_window_t* win = _webinix_dereference_win_ptr(_win);
+    if (win == NULL)
+        return 500; // Internal Server Error
+
+    // The handler (and the file handlers) see the window URL,
+    // see `_webinix_http_local_uri()`
+    const struct mg_request_info* ri = mg_get_request_info(client);
+    const char* url = _webinix_http_local_uri(win, ri);
+    if (*url != '/') {
+        // `/_webinix/<num>` -> `/_webinix/<num>/`, so relative URLs work
+        char location[64] = {0};
+        WEBUI_SN_PRINTF_STATIC(location, sizeof(location), "%s/", win->url_prefix);
+        mg_send_http_redirect(client, location, 302);
+        return 302;
+    }
+
+    return _webinix_http_handler(client, _win);
+}
+
+static int _webinix_http_shared_handler(struct mg_connection* client, void * _win) {
+    (void)_win;
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_http_shared_handler()\n");
+    #endif
+
+    // Shared server: a request outside `/_webinix/<num>/`, like the
+    // bridge or an absolute asset URL, belongs to the window of the
+    // page that requested it. This is best effort, browsers can omit
+    // or trim the `Referer` (`Referrer-Policy`, privacy settings), and
+    // such a request gets a 404. Relative URLs always work.
+
+    _webinix_window_t* win = NULL;
+    const char* referer = mg_get_header(client, "Referer");
+    const char* prefix = (referer != NULL ? strstr(referer, "/_webinix/") : NULL);
+    if (prefix != NULL) {
+        char* end = NULL;
+        size_t num = (size_t)strtoul(prefix + 10, &end, 10);
+        if (end != NULL && (*end == '/' || *end == '\0') && num > 0)
+            win = _webinix_wins_get(num);
+    }
+
+    if (win == NULL || win->url_prefix[0] == '\0' || !win->server_running) {
+        #ifdef WEBUI_LOG
+        printf("[Core]\t\t_webinix_http_shared_handler() -> No window for this request\n");
+        #endif
+        _webinix_http_send_error(client, webinix_html_res_not_available, 404);
+        return 404;
+    }
+
+    return _webinix_http_handler(client, (void*)win);
+}
+
+static struct mg_context* _webinix_shared_server_join(_webinix_window_t* win,
+    const struct mg_callbacks* callbacks, const char** options) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_shared_server_join([%zu])\n", win->num);
+    #endif
+
+    // Caller must hold `mutex_server_start`. The first window starts
+    // the server, with its own options (port, public access).
+
+    if (_webinix.shared_ctx == NULL) {
+        _webinix.shared_ctx = mg_start(callbacks, 0, options);
+        if (_webinix.shared_ctx == NULL)
+            return NULL;
+        mg_set_request_handler(_webinix.shared_ctx, "/", _webinix_http_shared_handler, NULL);
+    }
+    _webinix.shared_windows++;
+
+    // [prefix] and [prefix][/_webinix_ws_connect]
+    char ws_uri[64] = {0};
+    WEBUI_SN_PRINTF_STATIC(ws_uri, sizeof(ws_uri), "%s/_webinix_ws_connect", win->url_prefix);
+    mg_set_request_handler(_webinix.shared_ctx, win->url_prefix, _webinix_http_prefix_handler, (void*)win);
+    mg_set_websocket_handler(
+        _webinix.shared_ctx, ws_uri, _webinix_ws_connect_handler, _webinix_ws_ready_handler,
+        _webinix_ws_data_handler, _webinix_ws_close_handler, (void*)win
+    );
+
+    return _webinix.shared_ctx;
+}
+
+static void _webinix_shared_server_leave(_webinix_window_t* win) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_shared_server_leave([%zu])\n", win->num);
+    #endif
+
+    struct mg_context* stop_ctx = NULL;
+    _webinix_mutex_lock(&_webinix.mutex_server_start);
+    if (_webinix.shared_ctx != NULL) {
+        char ws_uri[64] = {0};
+        WEBUI_SN_PRINTF_STATIC(ws_uri, sizeof(ws_uri), "%s/_webinix_ws_connect", win->url_prefix);
+        mg_set_request_handler(_webinix.shared_ctx, win->url_prefix, NULL, NULL);
+        mg_set_websocket_handler(_webinix.shared_ctx, ws_uri, NULL, NULL, NULL, NULL, NULL);
+        if (_webinix.shared_windows > 0)
+            _webinix.shared_windows--;
+        if (_webinix.shared_windows == 0) {
+            // Last window, stop the server
+            stop_ctx = _webinix.shared_ctx;
+            _webinix.shared_ctx = NULL;
+            _webinix_free_port(_webinix.shared_port);
+            _webinix.shared_port = 0;
+        }
+    }
+    _webinix_mutex_unlock(&_webinix.mutex_server_start);
 
-            if (win->icon != NULL && win->icon_type != NULL) {
+    if (stop_ctx != NULL)
+        mg_stop(stop_ctx);
+}
 
-                // Custom user icon
+#ifndef _WIN32
+static void _webinix_cluster_receive(const unsigned char* msg, size_t msg_len,
+    const struct sockaddr_un* from, socklen_t from_len) {
 
-                // User icon 200
-                _webinix_http_send(win, client, win->icon_type, win->icon, _webinix_strlen(win->icon), false);
-            }
-            else if (_webinix_file_exist_mg(win, client)) {
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_cluster_receive([%zu])\n", msg_len);
+    #endif
 
-                // Local icon file
-                http_status_code = _webinix_serve_file(win, client, client_id);
+    if (msg_len < WEBUI_CLUSTER_HEADER || msg[0] != WEBUI_SIGNATURE)
+        return;
+    uint32_t window = 0;
+    memcpy(&window, &msg[4], sizeof(window));
+    const char* data = (const char*)&msg[WEBUI_CLUSTER_HEADER];
+    size_t len = msg_len - WEBUI_CLUSTER_HEADER;
+
+    switch (msg[1]) {
+        case WEBUI_CLUSTER_SEND: {
+            // Packet published by another worker, send it to our clients
+            _webinix_window_t* win = _webinix_wins_get(window);
+            if (win != NULL)
+                _webinix_send_all_local(win, msg[2], data, len);
+            break;
+        }
+        case WEBUI_CLUSTER_COOKIE: {
+            // A client authenticated by another worker
+            _webinix_wins_view_t* view = _webinix_wins_view();
+            if (len == 0 || len >= WEBUI_COOKIES_BUF || window >= view->capacity)
+                break;
+            char win_cookies[WEBUI_COOKIES_BUF] = {0};
+            memcpy(win_cookies, data, len);
+            size_t client_id = 0;
+            _webinix_mutex_lock(&_webinix.mutex_http_handler);
+            _webinix_client_cookies_add(win_cookies, &client_id);
+            view->cookies_single_set[window] = true;
+            _webinix_mutex_unlock(&_webinix.mutex_http_handler);
+            break;
+        }
+        case WEBUI_CLUSTER_SYNC: {
+            // A new worker joined, send it all our auth cookies
+            unsigned char reply[WEBUI_CLUSTER_HEADER + WEBUI_COOKIES_BUF];
+            reply[0] = WEBUI_SIGNATURE;
+            reply[1] = WEBUI_CLUSTER_COOKIE;
+            reply[2] = 0;
+            reply[3] = 0;
+            _webinix_mutex_lock(&_webinix.mutex_sessions);
+            size_t id = _webinix.sessions_head;
+            while (id != WEBUI_SESSION_NONE) {
+                // [win number][_][cookies]
+                const char* cookies = &_webinix.sessions[id * WEBUI_COOKIES_BUF];
+                uint32_t num = (uint32_t)strtoul(cookies, NULL, 10);
+                size_t cookies_len = _webinix_strlen(cookies);
+                memcpy(&reply[4], &num, sizeof(num));
+                memcpy(&reply[WEBUI_CLUSTER_HEADER], cookies, cookies_len);
+                sendto(_webinix.cluster_fd, reply, WEBUI_CLUSTER_HEADER + cookies_len, MSG_DONTWAIT,
+                    (const struct sockaddr*)from, from_len);
+                id = _webinix.sessions_next[id];
             }
-            else {
+            _webinix_mutex_unlock(&_webinix.mutex_sessions);
+            break;
+        }
+    }
+}
 
-                // Default embedded icon
+static bool _webinix_cluster_secret(uint32_t* secret) {
 
-                if (strcmp(url, "/favicon.ico") == 0) {
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_cluster_secret()\n");
+    #endif
+
+    // A browser may load `webinix.js` from one worker and connect its
+    // WebSocket to another, so all workers must use the same tokens.
+    // The first worker creates the secret, the others read it.
+    char secret_path[WEBUI_MAX_PATH + 8]; // [dir]/secret
+    WEBUI_SN_PRINTF_STATIC(secret_path, sizeof(secret_path), "%s/secret", _webinix.cluster_dir);
+    int fd = open(secret_path, O_WRONLY | O_CREAT | O_EXCL, 0600);
+    if (fd >= 0) {
+        *secret = _webinix_generate_random_uint32();
+        bool written = (write(fd, secret, sizeof(*secret)) == (ssize_t)sizeof(*secret));
+        close(fd);
+        return written;
+    }
+    if (errno != EEXIST)
+        return false;
+    // The first worker may still be writing it
+    for (size_t i = 0; i < 100; i++) {
+        fd = open(secret_path, O_RDONLY);
+        if (fd >= 0) {
+            bool read_ok = (read(fd, secret, sizeof(*secret)) == (ssize_t)sizeof(*secret));
+            close(fd);
+            if (read_ok)
+                return true;
+        }
+        _webinix_sleep(10);
+    }
+    return false;
+}
 
-                    mg_send_http_redirect(client, "favicon.svg", 302);
-                    http_status_code = 302;
-                }
-                else {
+static void * _webinix_cluster_thread(void * arg) {
 
-                    // Default icon 200
-                    _webinix_http_send(win, client, webinix_def_icon_type, webinix_def_icon, _webinix_strlen(webinix_def_icon), false);
-                }
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_cluster_thread()\n");
+    #endif
+
+    (void)arg;
+    unsigned char* msg = (unsigned char*)_webinix_malloc(WEBUI_CLUSTER_HEADER + WEBUI_CLUSTER_BUF);
+    for (;;) {
+        struct sockaddr_un from;
+        struct iovec iov;
+        struct msghdr hdr;
+        #ifdef SCM_CREDENTIALS
+        union {
+            struct cmsghdr align;
+            char buf[CMSG_SPACE(sizeof(struct ucred))];
+        } control;
+        #endif
+        iov.iov_base = msg;
+        iov.iov_len = WEBUI_CLUSTER_HEADER + WEBUI_CLUSTER_BUF;
+        memset(&hdr, 0, sizeof(hdr));
+        hdr.msg_name = &from;
+        hdr.msg_namelen = sizeof(from);
+        hdr.msg_iov = &iov;
+        hdr.msg_iovlen = 1;
+        #ifdef SCM_CREDENTIALS
+        hdr.msg_control = control.buf;
+        hdr.msg_controllen = sizeof(control.buf);
+        #endif
+        ssize_t n = recvmsg(_webinix.cluster_fd, &hdr, 0);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+        #ifdef SCM_CREDENTIALS
+        // Only processes of our own user are workers, the kernel
+        // attaches the sender credentials to each datagram
+        bool trusted = false;
+        for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&hdr); cmsg != NULL; cmsg = CMSG_NXTHDR(&hdr, cmsg)) {
+            if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_CREDENTIALS) {
+                struct ucred cred;
+                memcpy(&cred, CMSG_DATA(cmsg), sizeof(cred));
+                trusted = (cred.uid == geteuid());
             }
-        } else {
-
-            // [/file] or [/folder]
+        }
+        if (!trusted) {
+            #ifdef WEBUI_LOG
+            printf("[Core]\t\t_webinix_cluster_thread() -> Message from another user, dropped\n");
+            #endif
+            continue;
+        }
+        #endif
+        if (n >= WEBUI_CLUSTER_HEADER && msg[1] == WEBUI_CLUSTER_STOP)
+            break;
+        _webinix_cluster_receive(msg, (size_t)n, &from, hdr.msg_namelen);
+    }
+    _webinix_free_mem((void*)msg);
+    return NULL;
+}
+#endif
 
-            // [Path][Sep][folder]
-            char* folder_path = _webinix_get_full_path(win, url);
+static bool _webinix_cluster_join(size_t port) {
 
-            if (_webinix_file_exist(folder_path)) {
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_cluster_join([%zu])\n", port);
+    #endif
 
-                // [/file]
+    #ifdef _WIN32
+    // No `SO_REUSEPORT`, each process needs its own port
+    (void)port;
+    return false;
+    #else
+    // Workers of the same port meet in `[run]/webinix-cluster-[port]/`,
+    // each one bound to its own datagram socket `[pid].sock`. There is
+    // no coordinator, a worker can join or leave at any time.
+    _webinix_mutex_lock(&_webinix.mutex_cluster);
+    if (_webinix.cluster_running) {
+        _webinix_mutex_unlock(&_webinix.mutex_cluster);
+        return true;
+    }
 
-                bool script = false;
-                if (win->runtime != None) {
-                    const char* extension = _webinix_get_extension(url);
-                    const char* index_extensions[] = {
-                        "js", "ts"
-                    };
-                    for (size_t i = 0; i < (sizeof(index_extensions) / sizeof(index_extensions[0])); i++) {
-                        if (strcmp(extension, index_extensions[i]) == 0) {
-                            script = true;
-                            break;
-                        }
-                    }
-                }
+    // The per-user runtime directory if any, the temp directory otherwise
+    const char* tmp = getenv("XDG_RUNTIME_DIR");
+    if (_webinix_is_empty(tmp))
+        tmp = getenv("TMPDIR");
+    if (_webinix_is_empty(tmp))
+        tmp = "/tmp";
+    int dir_len = snprintf(_webinix.cluster_dir, sizeof(_webinix.cluster_dir), "%s/webinix-cluster-%zu", tmp, port);
+    if (dir_len < 0 || (size_t)dir_len >= sizeof(_webinix.cluster_dir) ||
+        (mkdir(_webinix.cluster_dir, 0700) != 0 && errno != EEXIST)) {
+        _webinix_mutex_unlock(&_webinix.mutex_cluster);
+        return false;
+    }
 
-                if (script) {
+    // A directory that already exists must be ours and private,
+    // otherwise another user could read the secret or join the bus
+    struct stat st;
+    if (lstat(_webinix.cluster_dir, &st) != 0 || !S_ISDIR(st.st_mode) ||
+        st.st_uid != geteuid() || (st.st_mode & 0777) != 0700) {
+        #ifdef WEBUI_LOG
+        printf("[Core]\t\t_webinix_cluster_join() -> Unsafe bus directory [%s]\n", _webinix.cluster_dir);
+        #endif
+        _webinix_mutex_unlock(&_webinix.mutex_cluster);
+        return false;
+    }
 
-                    #ifdef WEBUI_LOG
-                    printf("[Core]\t\t_webinix_http_handler() -> Interpret local script file\n");
-                    #endif
+    memset(&_webinix.cluster_addr, 0, sizeof(_webinix.cluster_addr));
+    _webinix.cluster_addr.sun_family = AF_UNIX;
+    int path_len = snprintf(_webinix.cluster_addr.sun_path, sizeof(_webinix.cluster_addr.sun_path),
+        "%s/%ld.sock", _webinix.cluster_dir, (long)getpid());
+    if (path_len < 0 || (size_t)path_len >= sizeof(_webinix.cluster_addr.sun_path) ||
+        !_webinix_cluster_secret(&_webinix.cluster_secret)) {
+        _webinix_mutex_unlock(&_webinix.mutex_cluster);
+        return false;
+    }
 
-                    // Serve as a script file to be interpreted by
-                    // an external interpreter (Deno, Bun, Nodejs)
-                    http_status_code = _webinix_interpret_file(win, client, NULL, client_id);
-                }
-                else {
+    _webinix.cluster_fd = socket(AF_UNIX, SOCK_DGRAM, 0);
+    if (_webinix.cluster_fd < 0) {
+        _webinix_mutex_unlock(&_webinix.mutex_cluster);
+        return false;
+    }
+    fcntl(_webinix.cluster_fd, F_SETFD, FD_CLOEXEC);
+    #ifdef SCM_CREDENTIALS
+    int pass_cred = 1;
+    setsockopt(_webinix.cluster_fd, SOL_SOCKET, SO_PASSCRED, &pass_cred, sizeof(pass_cred));
+    #endif
+    unlink(_webinix.cluster_addr.sun_path);
+    if (bind(_webinix.cluster_fd, (const struct sockaddr*)&_webinix.cluster_addr,
+        sizeof(_webinix.cluster_addr)) != 0 ||
+        pthread_create(&_webinix.cluster_thread, NULL, &_webinix_cluster_thread, NULL) != 0) {
+        close(_webinix.cluster_fd);
+        unlink(_webinix.cluster_addr.sun_path);
+        _webinix_mutex_unlock(&_webinix.mutex_cluster);
+        return false;
+    }
+    _webinix.cluster_running = true;
+    _webinix_mutex_unlock(&_webinix.mutex_cluster);
 
-                    #ifdef WEBUI_LOG
-                    printf("[Core]\t\t_webinix_http_handler() -> Local file\n");
-                    #endif
+    // Get the clients already authenticated by the other workers
+    _webinix_cluster_publish(WEBUI_CLUSTER_SYNC, 0, 0, NULL, 0);
 
-                    // Serve as a normal text-based file
-                    http_status_code = _webinix_serve_file(win, client, client_id);
-                }
-            }
-            else if (_webinix_folder_exist(folder_path)) {
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_cluster_join() -> Bus [%s]\n", _webinix.cluster_addr.sun_path);
+    #endif
+    return true;
+    #endif
+}
 
-                // [/folder]
-                
-                // Looking for index file and redirect
+static void _webinix_cluster_leave(void) {
 
-                const char* index_files[] = {"index.ts", "index.js", "index.html", "index.htm"};
-
-                // [Path][Sep][File Name]
-                size_t bf_len = (_webinix_strlen(folder_path) + 1 + 24);
-                char* index_path = (char*)_webinix_malloc(bf_len);
-                for (size_t i = 0; i < (sizeof(index_files) / sizeof(index_files[0])); i++) {
-                    WEBUI_SN_PRINTF_DYN(index_path, bf_len, "%s%s%s", folder_path, os_sep, index_files[i]);
-                    if (_webinix_file_exist(index_path)) {
-                        // [URL][/][Index Name]
-                        size_t redirect_len = (_webinix_strlen(url) + 1 + 24);
-                        char* redirect_url = (char*)_webinix_malloc(bf_len);
-                        WEBUI_SN_PRINTF_DYN(redirect_url, redirect_len, "%s%s%s", url, "/", index_files[i]);
-                        #ifdef WEBUI_LOG
-                        printf("[Core]\t\t_webinix_http_handler() -> 302 Redirecting to [%s]\n", redirect_url);
-                        #endif
-                        mg_send_http_redirect(client, redirect_url, 302);
-                        _webinix_free_mem((void*)redirect_url);
-                        _webinix_free_mem((void*)folder_path);
-                        _webinix_free_mem((void*)index_path);
-                        _webinix_mutex_unlock(&_webinix.mutex_http_handler);
-                        return 302;
-                    }
-                }
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_cluster_leave()\n");
+    #endif
 
-                // No index file is found in this folder
-                _webinix_free_mem((void*)folder_path);
-                _webinix_free_mem((void*)index_path);
-                _webinix_http_send_error(client, webinix_html_res_not_available, 404);
-                http_status_code = 404;
+    #ifndef _WIN32
+    _webinix_mutex_lock(&_webinix.mutex_cluster);
+    if (!_webinix.cluster_running) {
+        _webinix_mutex_unlock(&_webinix.mutex_cluster);
+        return;
+    }
+    _webinix.cluster_running = false;
+
+    // Wake up the bus thread
+    unsigned char stop[WEBUI_CLUSTER_HEADER] = {WEBUI_SIGNATURE, WEBUI_CLUSTER_STOP};
+    sendto(_webinix.cluster_fd, stop, sizeof(stop), 0,
+        (const struct sockaddr*)&_webinix.cluster_addr, sizeof(_webinix.cluster_addr));
+    pthread_join(_webinix.cluster_thread, NULL);
+
+    close(_webinix.cluster_fd);
+    unlink(_webinix.cluster_addr.sun_path);
+
+    // Last worker, remove the bus
+    bool last = true;
+    DIR* dir = opendir(_webinix.cluster_dir);
+    if (dir != NULL) {
+        struct dirent* entry;
+        while ((entry = readdir(dir)) != NULL) {
+            if (strstr(entry->d_name, ".sock") != NULL) {
+                last = false;
+                break;
             }
-            else {
-
-                // [invalid]
-                
-                #ifdef WEBUI_LOG
-                printf("[Core]\t\t_webinix_http_handler() -> Not found\n");
-                #endif
+        }
+        closedir(dir);
+    }
+    if (last) {
+        char secret_path[WEBUI_MAX_PATH + 8];
+        WEBUI_SN_PRINTF_STATIC(secret_path, sizeof(secret_path), "%s/secret", _webinix.cluster_dir);
+        unlink(secret_path);
+        rmdir(_webinix.cluster_dir);
+    }
+    _webinix_mutex_unlock(&_webinix.mutex_cluster);
+    #endif
+}
 
-                // No file or folder is found at this path
-                _webinix_http_send_error(client, webinix_html_res_not_available, 404);
-                _webinix_free_mem((void*)folder_path);
-                http_status_code = 404;
-            }
+static void _webinix_cluster_publish(unsigned char type, size_t window, unsigned char cmd,
+    const char* data, size_t len) {
 
-            // Clear
-            _webinix_free_mem((void*)folder_path);
-        }
-    } else {
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_cluster_publish([%u], [%zu])\n", (unsigned)type, len);
+    #endif
 
+    #ifdef _WIN32
+    (void)type; (void)window; (void)cmd; (void)data; (void)len;
+    #else
+    if (!_webinix.cluster_running)
+        return;
+    if (len > WEBUI_CLUSTER_BUF) {
+        // Only this worker's clients get it
         #ifdef WEBUI_LOG
-        printf("[Core]\t\t_webinix_http_handler() -> Unknown request method [%s]\n", ri->request_method);
+        printf("[Core]\t\t_webinix_cluster_publish() -> Message too large, not relayed\n");
         #endif
+        return;
     }
 
-    #ifdef WEBUI_LOG
-    printf("[Core]\t\t_webinix_http_handler() -> HTTP Status Code: %d\n", http_status_code);
+    // [SIGNATURE][TYPE][CMD][0][WINDOW][Data]
+    unsigned char* msg = (unsigned char*)_webinix_malloc(WEBUI_CLUSTER_HEADER + len);
+    uint32_t num = (uint32_t)window;
+    msg[0] = WEBUI_SIGNATURE;
+    msg[1] = type;
+    msg[2] = cmd;
+    msg[3] = 0;
+    memcpy(&msg[4], &num, sizeof(num));
+    if (len > 0)
+        memcpy(&msg[WEBUI_CLUSTER_HEADER], data, len);
+
+    // Send to every other worker of this port
+    DIR* dir = opendir(_webinix.cluster_dir);
+    if (dir != NULL) {
+        const char* self = strrchr(_webinix.cluster_addr.sun_path, '/') + 1;
+        struct dirent* entry;
+        while ((entry = readdir(dir)) != NULL) {
+            if (strstr(entry->d_name, ".sock") == NULL || strcmp(entry->d_name, self) == 0)
+                continue;
+            struct sockaddr_un peer;
+            memset(&peer, 0, sizeof(peer));
+            peer.sun_family = AF_UNIX;
+            int path_len = snprintf(peer.sun_path, sizeof(peer.sun_path), "%s/%s",
+                _webinix.cluster_dir, entry->d_name);
+            if (path_len < 0 || (size_t)path_len >= sizeof(peer.sun_path))
+                continue;
+            if (sendto(_webinix.cluster_fd, msg, WEBUI_CLUSTER_HEADER + len, MSG_DONTWAIT,
+                (const struct sockaddr*)&peer, sizeof(peer)) < 0) {
+                // A worker that exited without leaving the bus
+                if (errno == ECONNREFUSED)
+                    unlink(peer.sun_path);
+                #ifdef WEBUI_LOG
+                printf("[Core]\t\t_webinix_cluster_publish() -> [%s] failed (%d)\n", entry->d_name, errno);
+                #endif
+            }
+        }
+        closedir(dir);
+    }
+    _webinix_free_mem((void*)msg);
     #endif
-
-    _webinix_mutex_unlock(&_webinix.mutex_http_handler);
-    return http_status_code;
 }
 
 static int _webinix_ws_connect_handler(const struct mg_connection* client, void * _win) {
@@ -9185,7 +13622,7 @@ static int _webinix_ws_connect_handler(const struct mg_connection* client, void
     if (_webinix.config.use_cookies) {
         // Cookies config is enabled
         char cookies[WEBUI_COOKIES_BUF] = {0};
-        _webinix_get_cookies(client, cookies);
+        _webinix_get_cookies(win, client, cookies);
         #ifdef WEBUI_LOG
         printf("[Core]\t\t_webinix_ws_connect_handler() -> Client cookies [%s]\n", cookies);
         #endif
@@ -9282,12 +13719,145 @@ static void _webinix_ws_close_handler(const struct mg_connection* client, void *
 
     // Dereference
     _webinix_window_t* win = _webinix_dereference_win_ptr(_win);
-    if (_webinix_mutex_app_is_exit_now(WEBUI_MUTEX_GET_STATUS) || win == NULL || !_webinix_mutex_is_connected(win, WEBUI_MUTEX_GET_STATUS))
+    if (win == NULL)
+        return;
+    if (_webinix_mutex_app_is_exit_now(WEBUI_MUTEX_GET_STATUS) || !_webinix_mutex_is_connected(win, WEBUI_MUTEX_GET_STATUS)) {
+        // No event, but the connection may be freed once this returns
+        _webinix_connection_remove(win, (struct mg_connection*)client);
         return;
+    }
 
     _webinix_receive(win, (struct mg_connection*)client, WEBUI_WS_CLOSE, NULL, 0);
 }
 
+static bool _webinix_server_option_set(char** options, const char* name, const char* value) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_server_option_set([%s])\n", name);
+    #endif
+
+    // Caller must hold `mutex_server_start`
+
+    if (_webinix_is_empty(name))
+        return false;
+
+    // Webinix manages the port and the root folder
+    if (strcmp(name, "listening_ports") == 0 || strcmp(name, "listening_socket") == 0 ||
+        strcmp(name, "document_root") == 0) {
+        #ifdef WEBUI_LOG
+        printf("[Core]\t\t_webinix_server_option_set() -> Option managed by Webinix\n");
+        #endif
+        return false;
+    }
+
+    // Must be a civetweb option
+    const struct mg_option* valid = mg_get_valid_options();
+    while (valid->name != NULL && strcmp(valid->name, name) != 0)
+        valid++;
+    if (valid->name == NULL) {
+        #ifdef WEBUI_LOG
+        printf("[Core]\t\t_webinix_server_option_set() -> Unknown option\n");
+        #endif
+        return false;
+    }
+    if (valid->type == MG_CONFIG_TYPE_NUMBER && !_webinix_is_empty(value)) {
+        for (const char* c = value; *c; c++) {
+            if (*c < '0' || *c > '9') {
+                #ifdef WEBUI_LOG
+                printf("[Core]\t\t_webinix_server_option_set() -> Not a number\n");
+                #endif
+                return false;
+            }
+        }
+    }
+
+    // Find the option, or a free slot
+    size_t i = 0;
+    while (i < WEBUI_MAX_SERVER_OPTS && options[i * 2] != NULL && strcmp(options[i * 2], name) != 0)
+        i++;
+
+    if (_webinix_is_empty(value)) {
+        // Remove, back to the Webinix (or civetweb) default
+        if (i < WEBUI_MAX_SERVER_OPTS && options[i * 2] != NULL) {
+            _webinix_free_mem((void*)options[i * 2]);
+            _webinix_free_mem((void*)options[i * 2 + 1]);
+            // Keep the list packed
+            for (; (i + 1) < WEBUI_MAX_SERVER_OPTS && options[(i + 1) * 2] != NULL; i++) {
+                options[i * 2] = options[(i + 1) * 2];
+                options[i * 2 + 1] = options[(i + 1) * 2 + 1];
+            }
+            options[i * 2] = NULL;
+            options[i * 2 + 1] = NULL;
+        }
+        return true;
+    }
+
+    if (i >= WEBUI_MAX_SERVER_OPTS) {
+        #ifdef WEBUI_LOG
+        printf("[Core]\t\t_webinix_server_option_set() -> Too many options\n");
+        #endif
+        return false;
+    }
+
+    size_t value_len = _webinix_strlen(value);
+    char* value_cpy = (char*)_webinix_malloc(value_len);
+    WEBUI_STR_COPY_DYN(value_cpy, value_len, value);
+    if (options[i * 2] == NULL) {
+        size_t name_len = _webinix_strlen(name);
+        char* name_cpy = (char*)_webinix_malloc(name_len);
+        WEBUI_STR_COPY_DYN(name_cpy, name_len, name);
+        options[i * 2] = name_cpy;
+    }
+    else _webinix_free_mem((void*)options[i * 2 + 1]);
+    options[i * 2 + 1] = value_cpy;
+    return true;
+}
+
+static const char* _webinix_server_option_get(char** options, const char* name) {
+
+    // Caller must hold `mutex_server_start`
+    for (size_t i = 0; i < WEBUI_MAX_SERVER_OPTS && options[i * 2] != NULL; i++) {
+        if (strcmp(options[i * 2], name) == 0)
+            return options[i * 2 + 1];
+    }
+    return NULL;
+}
+
+static void _webinix_server_options_free(char** options) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_server_options_free()\n");
+    #endif
+
+    for (size_t i = 0; i < (WEBUI_MAX_SERVER_OPTS * 2); i++) {
+        _webinix_free_mem((void*)options[i]);
+        options[i] = NULL;
+    }
+}
+
+static void _webinix_server_options_apply(const char** http_options, size_t count, char** options) {
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_server_options_apply()\n");
+    #endif
+
+    // Override the [name, value] pairs of a NULL-terminated civetweb
+    // options array of `count` slots, or append the new ones
+    for (size_t i = 0; i < WEBUI_MAX_SERVER_OPTS && options[i * 2] != NULL; i++) {
+        size_t j = 0;
+        while (http_options[j] != NULL && strcmp(http_options[j], options[i * 2]) != 0)
+            j += 2;
+        if (http_options[j] == NULL) {
+            if ((j + 3) >= count)
+                return;
+            http_options[j] = options[i * 2];
+            http_options[j + 2] = NULL;
+            http_options[j + 3] = NULL;
+        }
+        http_options[j + 1] = options[i * 2 + 1];
+    }
+}
+
 static WEBUI_THREAD_SERVER_START {
     #ifdef WEBUI_LOG
     printf("[Core]\t\t_webinix_server_thread()\n");
@@ -9338,10 +13908,27 @@ static WEBUI_THREAD_SERVER_START {
     WEBUI_SN_PRINTF_DYN(server_port, 64, "%s%zu", host, win->server_port);
     #endif
 
+    // Socket bound by `webinix_show()`, if any
+    char listen_socket[32] = {0};
+    #ifdef _WIN32
+    if (win->listen_socket != INVALID_SOCKET)
+        WEBUI_SN_PRINTF_STATIC(listen_socket, sizeof(listen_socket), "%llu",
+            (unsigned long long)win->listen_socket);
+    #else
+    if (win->listen_socket >= 0)
+        WEBUI_SN_PRINTF_STATIC(listen_socket, sizeof(listen_socket), "%d", win->listen_socket);
+    #endif
+
+    // Biggest client message, refused by the server as soon as the
+    // frame header announces it, before anything is allocated
+    char max_frame_size[32] = {0};
+    WEBUI_SN_PRINTF_STATIC(max_frame_size, sizeof(max_frame_size), "%zu", _webinix.mem_limit_message);
+
     // Server Options
-    const char* http_options[] = {
+    const char* http_options[64 + (WEBUI_MAX_SERVER_OPTS * 2 * 2)] = {
         // HTTP
         "listening_ports", server_port,
+        "listening_socket", listen_socket,
         "document_root", win->server_root_path,
         "access_control_allow_headers", "*",
         "access_control_allow_methods", "*",
@@ -9356,13 +13943,25 @@ static WEBUI_THREAD_SERVER_START {
         // WS
         "websocket_timeout_ms", "3600000",
         "enable_websocket_ping_pong", "yes",
+        "websocket_max_frame_size", max_frame_size,
+        #ifdef __linux__
+        "websocket_reactor_threads", (_webinix.config.ws_reactor ? WEBUI_WS_REACTORS : "0"),
+        #endif
+        // Cluster
+        "reuse_port", (_webinix.config.cluster ? "yes" : "no"),
         NULL, NULL
     };
 
+    // User overrides, all windows first
+    size_t http_options_count = (sizeof(http_options) / sizeof(http_options[0]));
+    _webinix_server_options_apply(http_options, http_options_count, _webinix.default_server_options);
+    _webinix_server_options_apply(http_options, http_options_count, win->server_options);
+
     // Server Settings
     struct mg_callbacks http_callbacks;
     struct mg_context * http_ctx = NULL;
     memset(&http_callbacks, 0, sizeof(http_callbacks));
+    http_callbacks.exit_thread = _webinix_http_exit_thread;
     #ifdef WEBUI_TLS
     http_callbacks.init_ssl = _webinix_tls_initialization;
     #endif
@@ -9370,16 +13969,44 @@ static WEBUI_THREAD_SERVER_START {
     http_callbacks.log_message = _webinix_http_log;
     #endif
 
+    // The root folder may have changed since the last run
+    _webinix_path_cache_free(win);
+
+    #ifdef WEBUI_TLS
+    // Self-signed certificate, generated while the browser starts
+    _webinix_tls_prepare(true);
+    _webinix_show_phase(win, &win->show_timeline.tls);
+    #endif
+
+    // Cluster bus, shared by all workers of this port
+    if (_webinix.config.cluster && !_webinix_cluster_join(win->server_port)) {
+        #ifdef WEBUI_LOG
+        printf("[Core]\t\t_webinix_server_thread([%zu]) -> Cluster bus not available\n", win->num);
+        #endif
+    }
+
     // Start Server
-    http_ctx = mg_start(&http_callbacks, 0, http_options);
-    mg_set_request_handler(http_ctx, "/", _webinix_http_handler, (void*)win);
+    bool shared = (win->url_prefix[0] != '\0');
+    if (shared) {
+        // Join the server shared by all windows
+        http_ctx = _webinix_shared_server_join(win, &http_callbacks, http_options);
+    }
+    else {
+        http_ctx = mg_start(&http_callbacks, 0, http_options);
+        mg_set_request_handler(http_ctx, "/", _webinix_http_handler, (void*)win);
+    }
+    _webinix_listen_socket_close(win);
 
     if (http_ctx) {
 
-        mg_set_websocket_handler(
-            http_ctx, "/_webinix_ws_connect", _webinix_ws_connect_handler, _webinix_ws_ready_handler,
-            _webinix_ws_data_handler, _webinix_ws_close_handler, (void*)win
-        );
+        _webinix_show_phase(win, &win->show_timeline.server);
+
+        if (!shared) {
+            mg_set_websocket_handler(
+                http_ctx, "/_webinix_ws_connect", _webinix_ws_connect_handler, _webinix_ws_ready_handler,
+                _webinix_ws_data_handler, _webinix_ws_close_handler, (void*)win
+            );
+        }
 
         // Mutex
         _webinix_mutex_unlock(&_webinix.mutex_server_start);
@@ -9418,7 +14045,7 @@ static WEBUI_THREAD_SERVER_START {
                     _webinix_timer_start(&timer_1);
                     for (;;) {
 
-                        _webinix_sleep(1);
+                        _webinix_server_wait(win, &timer_1, (_webinix.startup_timeout * 1000));
 
                         // Stop if we get exit signal
                         if (_webinix_mutex_app_is_exit_now(WEBUI_MUTEX_GET_STATUS) || _webinix_mutex_win_is_exit_now(win, WEBUI_MUTEX_GET_STATUS)) {
@@ -9464,7 +14091,7 @@ static WEBUI_THREAD_SERVER_START {
                                 }
 
                                 // Stop if window is connected
-                                _webinix_sleep(1);
+                                _webinix_server_wait(win, &timer_2, 5000);
                                 if (_webinix_mutex_is_connected(win, WEBUI_MUTEX_GET_STATUS))
                                     break;
 
@@ -9507,7 +14134,7 @@ static WEBUI_THREAD_SERVER_START {
 
                         // Wait forever for disconnection
 
-                        _webinix_sleep(1);
+                        _webinix_server_wait(win, NULL, 0);
 
                         // Exit signal
                         if (_webinix_mutex_app_is_exit_now(WEBUI_MUTEX_GET_STATUS) || _webinix_mutex_win_is_exit_now(win, WEBUI_MUTEX_GET_STATUS)) {
@@ -9552,7 +14179,7 @@ static WEBUI_THREAD_SERVER_START {
                                         }
 
                                         // Stop if window is re-connected
-                                        _webinix_sleep(1);
+                                        _webinix_server_wait(win, &timer_3, WEBUI_RELOAD_TIMEOUT);
                                         if (_webinix_mutex_is_connected(win, WEBUI_MUTEX_GET_STATUS))
                                             break;
 
@@ -9610,7 +14237,7 @@ static WEBUI_THREAD_SERVER_START {
 
             // Wait forever
             for (;;) {
-                _webinix_sleep(1);
+                _webinix_server_wait(win, NULL, 0);
                 if (_webinix_mutex_app_is_exit_now(WEBUI_MUTEX_GET_STATUS) || _webinix_mutex_win_is_exit_now(win, WEBUI_MUTEX_GET_STATUS))
                     break;
             }
@@ -9639,7 +14266,8 @@ static WEBUI_THREAD_SERVER_START {
 
     // Clean
     win->server_running = false;
-    _webinix_free_port(win->server_port);
+    if (!shared)
+        _webinix_free_port(win->server_port);
     win->server_port = 0;
     _webinix_free_mem((void*)server_port);
     // _webinix_client_cookies_free_all(win);
@@ -9660,10 +14288,16 @@ static WEBUI_THREAD_SERVER_START {
     // Stop server services
     // This should be at the
     // end as it may take time
-    mg_stop(http_ctx);
+    _webinix_file_request_cancel(win->num);
+    if (shared) {
+        if (http_ctx)
+            _webinix_shared_server_leave(win);
+    }
+    else mg_stop(http_ctx);
 
-    // Fire the mutex condition for wait()
-    if (_webinix.startup_timeout > 0 && _webinix.servers < 1) {
+    // Fire the mutex condition for wait(), unless the browser of
+    // this window failed to start and `webinix_show()` returns false
+    if (_webinix.startup_timeout > 0 && _webinix.servers < 1 && !win->show_failed) {
 
         // Stop all threads
         _webinix.ui = false;
@@ -9742,6 +14376,7 @@ static void _webinix_receive(_webinix_window_t* win, struct mg_connection* clien
             if (_webinix_connection_save(win, client, &connection_id)) {
                 // Update window connection status
                 _webinix_mutex_is_connected(win, WEBUI_MUTEX_SET_TRUE);
+                _webinix_show_phase(win, &win->show_timeline.connected);
                 #ifdef WEBUI_LOG
                 printf(
                     "[Core]\t\t_webinix_receive(%zu) -> Connection #%zu registered\n",
@@ -9797,7 +14432,17 @@ static void _webinix_receive(_webinix_window_t* win, struct mg_connection* clien
         if (((unsigned char*)data)[WEBUI_PROTOCOL_CMD] == WEBUI_CMD_MULTI) {
             if (len >= WEBUI_PROTOCOL_SIZE && ((unsigned char*)data)[WEBUI_PROTOCOL_SIGN] == WEBUI_SIGNATURE) {
                 size_t expect_len = (size_t) strtoul(&((const char*)data)[WEBUI_PROTOCOL_DATA], NULL, 10);
-                if (expect_len > 0 && expect_len <= WEBUI_MAX_BUF) {
+                if (expect_len > 0 && !_webinix_mem_allow(expect_len)) {
+                    #ifdef WEBUI_LOG
+                    printf(
+                        "[Core]\t\t_webinix_receive() -> Multi packet of %zu bytes is over the memory limits\n",
+                        expect_len
+                    );
+                    #endif
+                    _webinix_connection_remove(win, client);
+                    return;
+                }
+                if (expect_len > 0) {
                     #ifdef WEBUI_LOG
                     printf(
                         "[Core]\t\t_webinix_receive() -> Multi packet started, Expecting %zu bytes\n",
@@ -9805,6 +14450,7 @@ static void _webinix_receive(_webinix_window_t* win, struct mg_connection* clien
                     );
                     #endif
                     multi_buf = _webinix_malloc(expect_len);
+                    _webinix_mem_tag(multi_buf, WEBUI_MEM_PACKETS);
                     memcpy(multi_buf, data, len);
                     multi_receive = 0;
                     multi_expect = expect_len;
@@ -9813,11 +14459,19 @@ static void _webinix_receive(_webinix_window_t* win, struct mg_connection* clien
             }
             return;
         }
+        if (!_webinix_mem_allow(len)) {
+            #ifdef WEBUI_LOG
+            printf("[Core]\t\t_webinix_receive() -> Packet of %zu bytes is over the memory limits\n", len);
+            #endif
+            _webinix_connection_remove(win, client);
+            return;
+        }
     }
 
     // Generate args
     void * arg_ptr = NULL;
     size_t arg_len = 0;
+    _webinix_arena_t* arena = NULL;
     if (multi_packet) {
         #ifdef WEBUI_LOG
         printf("[Core]\t\t_webinix_receive() -> Processing multi packet\n");
@@ -9830,18 +14484,24 @@ static void _webinix_receive(_webinix_window_t* win, struct mg_connection* clien
         multi_expect = 0;
         multi_receive = 0;
         multi_buf = NULL;
+        arena = _webinix_arena_new(0);
     } else {
         arg_len = len;
         if (len > 0) {
             if (win->ws_block) {
                 // This event has data. And it will be processed
                 // in this current thread, no need to copy data
+                arena = _webinix_arena_new(0);
                 arg_ptr = data;
             }
             else {
                 // This event has data. And it will be processed
-                // in a new thread, we should copy data once
-                void * data_cpy = (void*)_webinix_malloc(len);
+                // in a new thread, we should copy data once, in
+                // the arena its events and response come from
+                arena = _webinix_arena_new(len);
+                void * data_cpy = _webinix_arena_alloc(arena, len);
+                if (data_cpy == NULL)
+                    data_cpy = (void*)_webinix_malloc(len);
                 memcpy((char*)data_cpy, data, len);
                 arg_ptr = data_cpy;
             }
@@ -9854,13 +14514,16 @@ static void _webinix_receive(_webinix_window_t* win, struct mg_connection* clien
     // Process
     if (win->ws_block) {
         // Process the packet in this current thread
-        _webinix_ws_process(win, client, connection_id, arg_ptr, arg_len, ++recvNum, event_type);
-        if (arg_ptr != data)
+        _webinix_ws_process(win, client, connection_id, arg_ptr, arg_len, ++recvNum, event_type, arena);
+        if (arg_ptr != data && !_webinix_arena_owns(arena, arg_ptr))
             _webinix_free_mem((void*)arg_ptr);
+        _webinix_arena_release(arena);
     }
     else {
         // Process the packet in a new thread
-        _webinix_recv_arg_t* arg = (_webinix_recv_arg_t* ) _webinix_malloc(sizeof(_webinix_recv_arg_t));
+        _webinix_recv_arg_t* arg = (_webinix_recv_arg_t* ) _webinix_arena_alloc(arena, sizeof(_webinix_recv_arg_t));
+        if (arg == NULL)
+            arg = (_webinix_recv_arg_t* ) _webinix_malloc(sizeof(_webinix_recv_arg_t));
         arg->win = win;
         arg->ptr = arg_ptr;
         arg->len = arg_len;
@@ -9868,6 +14531,7 @@ static void _webinix_receive(_webinix_window_t* win, struct mg_connection* clien
         arg->event_type = event_type;
         arg->client = client;
         arg->connection_id = connection_id;
+        arg->arena = arena;
         #ifdef _WIN32
         HANDLE thread = CreateThread(NULL, 0, _webinix_ws_process_thread, (void*)arg, 0, NULL);
         if (thread != NULL)
@@ -9880,39 +14544,182 @@ static void _webinix_receive(_webinix_window_t* win, struct mg_connection* clien
     }
 }
 
+static size_t _webinix_client_hash(const struct mg_connection* client) {
+
+    // Fibonacci hashing of the connection address
+    uint64_t hash = ((uint64_t)(uintptr_t)client >> 4) * 0x9E3779B97F4A7C15ULL;
+    return (size_t)(hash >> 32) & (_webinix.clients_index_size - 1);
+}
+
+static size_t _webinix_client_find(const struct mg_connection* client) {
+
+    // Index position of `client`, or the empty position ending its
+    // probe sequence. Caller must hold `mutex_client`.
+    size_t mask = _webinix.clients_index_size - 1;
+    size_t pos = _webinix_client_hash(client);
+    while (_webinix.clients_index[pos] != 0 &&
+        _webinix.clients[_webinix.clients_index[pos] - 1] != client)
+        pos = (pos + 1) & mask;
+    return pos;
+}
+
+static void _webinix_client_unindex(size_t pos) {
+
+    // Backward shift deletion, so no probe sequence is broken.
+    // Caller must hold `mutex_client`.
+    size_t mask = _webinix.clients_index_size - 1;
+    size_t next = pos;
+    for (;;) {
+        next = (next + 1) & mask;
+        size_t entry = _webinix.clients_index[next];
+        if (entry == 0)
+            break;
+        // Entries whose home is cyclically in (pos, next] stay
+        size_t home = _webinix_client_hash(_webinix.clients[entry - 1]);
+        bool stays = (pos <= next) ? (pos < home && home <= next) : (pos < home || home <= next);
+        if (!stays) {
+            _webinix.clients_index[pos] = entry;
+            pos = next;
+        }
+    }
+    _webinix.clients_index[pos] = 0;
+}
+
+static bool _webinix_clients_grow(void) {
+
+    // Double the clients table, and rebuild its index.
+    // Caller must hold `mutex_client`.
+    size_t old_capacity = _webinix.clients_capacity;
+    size_t capacity = (old_capacity > 0 ? old_capacity * 2 : WEBUI_MAX_IDS);
+
+    #ifdef WEBUI_LOG
+    printf("[Core]\t\t_webinix_clients_grow() -> %zu clients\n", capacity);
+    #endif
+
+    struct mg_connection** clients = (struct mg_connection**)_webinix_table_grow(
+        _webinix.clients, sizeof(struct mg_connection*), old_capacity, capacity);
+    size_t* clients_win_num = (size_t*)_webinix_table_grow(
+        _webinix.clients_win_num, sizeof(size_t), old_capacity, capacity);
+    size_t* clients_free = (size_t*)_webinix_table_grow(
+        _webinix.clients_free, sizeof(size_t), _webinix.clients_free_count, capacity);
+    size_t* clients_index = (size_t*)_webinix_table_grow(NULL, sizeof(size_t), 0, capacity * 2);
+    size_t* clients_session = (size_t*)_webinix_table_grow(
+        _webinix.clients_session, sizeof(size_t), old_capacity, capacity);
+    bool* clients_token_check = (bool*)_webinix_table_grow(NULL, sizeof(bool), 0, capacity);
+    _webinix_clients_view_t* view = (_webinix_clients_view_t*)_webinix_malloc(sizeof(_webinix_clients_view_t));
+    if (clients == NULL || clients_win_num == NULL || clients_free == NULL || clients_index == NULL ||
+        clients_session == NULL || clients_token_check == NULL || view == NULL) {
+        _webinix_free_mem((void*)clients);
+        _webinix_free_mem((void*)clients_win_num);
+        _webinix_free_mem((void*)clients_free);
+        _webinix_free_mem((void*)clients_index);
+        _webinix_free_mem((void*)clients_session);
+        _webinix_free_mem((void*)clients_token_check);
+        _webinix_free_mem((void*)view);
+        return false;
+    }
+
+    _webinix_mutex_lock(&_webinix.mutex_tables);
+    _webinix_table_retire((void*)_webinix.clients);
+    _webinix_table_retire((void*)_webinix.clients_win_num);
+    _webinix_table_retire((void*)_webinix.clients_token_check);
+    _webinix_table_retire((void*)_webinix.clients_view);
+    _webinix_mutex_unlock(&_webinix.mutex_tables);
+    // The index, sessions and free stack are only read under `mutex_client`
+    _webinix_free_mem((void*)_webinix.clients_index);
+    _webinix_free_mem((void*)_webinix.clients_session);
+    _webinix_free_mem((void*)_webinix.clients_free);
+
+    _webinix.clients = clients;
+    _webinix.clients_win_num = clients_win_num;
+    _webinix.clients_free = clients_free;
+    _webinix.clients_index = clients_index;
+    _webinix.clients_session = clients_session;
+    _webinix.clients_index_size = capacity * 2;
+    // Token checks are updated under `mutex_token` alone
+    _webinix_mutex_lock(&_webinix.mutex_token);
+    if (old_capacity > 0)
+        memcpy(clients_token_check, _webinix.clients_token_check, old_capacity * sizeof(bool));
+    _webinix.clients_token_check = clients_token_check;
+    _webinix_mutex_unlock(&_webinix.mutex_token);
+    _webinix.clients_capacity = capacity;
+    // Tables first, then the view that bounds them
+    view->capacity = capacity;
+    view->clients = clients;
+    view->win_num = clients_win_num;
+    WEBUI_ATOMIC_STORE_PTR(&_webinix.clients_view, view);
+
+    for (size_t i = 0; i < _webinix.clients_used; i++) {
+        if (_webinix.clients[i] != NULL)
+            _webinix.clients_index[_webinix_client_find(_webinix.clients[i])] = i + 1;
+    }
+    return true;
+}
+
+static size_t _webinix_clients_snapshot(const _webinix_clients_view_t** view) {
+
+    // The clients table and how many of its IDs were handed out,
+    // lock-free. Clients added meanwhile may be missed.
+    *view = (const _webinix_clients_view_t*)WEBUI_ATOMIC_LOAD_PTR(&_webinix.clients_view);
+    size_t used = (size_t)WEBUI_ATOMIC_ADD(&_webinix.clients_used, 0);
+    return (used < (*view)->capacity ? used : (*view)->capacity);
+}
+
 static bool _webinix_connection_save(_webinix_window_t* win, struct mg_connection* client, size_t* connection_id) {
     #ifdef WEBUI_LOG
     printf("[Core]\t\t_webinix_connection_save([%zu])\n", win->num);
     #endif
 
+    // Keep the client session while connected
+    size_t session = _webinix_session_acquire(win, client);
+
     // Save new ws client
     _webinix_mutex_lock(&_webinix.mutex_client);
-    for (size_t i = 0; i < WEBUI_MAX_IDS; i++) {
-        if (_webinix.clients[i] == NULL) {
-            #ifdef WEBUI_LOG
-            printf("[Core]\t\t_webinix_connection_save() -> Registering client #%zu \n", i);
-            #endif
-            // Save
-            if (win->single_client == NULL) {
-                win->single_client = client;
-                _webinix_mutex_is_single_client_token_valid(win, WEBUI_MUTEX_SET_FALSE);
-            }
-            _webinix.clients[i] = client;
-            _webinix.clients_win_num[i] = win->num;
-            _webinix_mutex_is_multi_client_token_valid(win, WEBUI_MUTEX_SET_FALSE, i);
-            win->clients_count++;
-            _webinix_mutex_unlock(&_webinix.mutex_client);
-            *connection_id = i;
-            return true;
+    size_t pos = _webinix_client_find(client);
+    if (_webinix.clients_index[pos] != 0) {
+        // Already registered
+        *connection_id = _webinix.clients_index[pos] - 1;
+        _webinix_mutex_unlock(&_webinix.mutex_client);
+        _webinix_session_release(session);
+        return true;
+    }
+    size_t i = 0;
+    if (_webinix.clients_free_count > 0)
+        i = _webinix.clients_free[--_webinix.clients_free_count];
+    else {
+        if (_webinix.clients_used == _webinix.clients_capacity) {
+            if (!_webinix_clients_grow()) {
+                // List is full
+                #ifdef WEBUI_LOG
+                printf("[Core]\t\t_webinix_connection_save() -> Clients list is full\n");
+                #endif
+                _webinix_mutex_unlock(&_webinix.mutex_client);
+                _webinix_session_release(session);
+                return false;
+            }
+            pos = _webinix_client_find(client);
         }
+        i = WEBUI_ATOMIC_ADD(&_webinix.clients_used, 1) - 1;
     }
-    
-    // List is full
+
     #ifdef WEBUI_LOG
-    printf("[Core]\t\t_webinix_connection_save() -> Clients list is full\n");
+    printf("[Core]\t\t_webinix_connection_save() -> Registering client #%zu \n", i);
     #endif
+    // Save
+    if (win->single_client == NULL) {
+        win->single_client = client;
+        _webinix_mutex_is_single_client_token_valid(win, WEBUI_MUTEX_SET_FALSE);
+    }
+    _webinix.clients[i] = client;
+    _webinix.clients_win_num[i] = win->num;
+    _webinix.clients_session[i] = session;
+    _webinix.clients_index[pos] = i + 1;
+    _webinix_mutex_is_multi_client_token_valid(win, WEBUI_MUTEX_SET_FALSE, i);
+    win->clients_count++;
     _webinix_mutex_unlock(&_webinix.mutex_client);
-    return false;
+    _webinix_server_notify(win);
+    *connection_id = i;
+    return true;
 }
 
 static void _webinix_connection_remove(_webinix_window_t* win, struct mg_connection* client) {
@@ -9920,35 +14727,46 @@ static void _webinix_connection_remove(_webinix_window_t* win, struct mg_connect
     printf("[Core]\t\t_webinix_connection_remove([%zu])\n", win->num);
     #endif
 
+    // No sender is writing to this connection once it is unregistered,
+    // as the WebSocket reactor frees it after the close handler
+    _webinix_mutex_lock(&_webinix.mutex_send);
     _webinix_mutex_lock(&_webinix.mutex_client);
 
     // Remove a ws client
-    for (size_t i = 0; i < WEBUI_MAX_IDS; i++) {
-        if (_webinix.clients[i] == client) {
-            #ifdef WEBUI_LOG
-            printf("[Core]\t\t_webinix_connection_remove() -> Removing client #%zu \n", i);
-            #endif
-            // Reset Token
-            if (!_webinix.config.multi_client) {
-                if (_webinix_mutex_is_multi_client_token_valid(win, WEBUI_MUTEX_GET_STATUS, i)) {
-                    win->token = 0;
-                }
+    size_t pos = _webinix_client_find(client);
+    if (_webinix.clients_index[pos] != 0) {
+        size_t i = _webinix.clients_index[pos] - 1;
+        #ifdef WEBUI_LOG
+        printf("[Core]\t\t_webinix_connection_remove() -> Removing client #%zu \n", i);
+        #endif
+        // Reset Token
+        if (!_webinix.config.multi_client) {
+            if (_webinix_mutex_is_multi_client_token_valid(win, WEBUI_MUTEX_GET_STATUS, i)) {
+                win->token = 0;
             }
-            // Clear
-            if (win->single_client == client) {
-                win->single_client = NULL;
-                _webinix_mutex_is_single_client_token_valid(win, WEBUI_MUTEX_SET_FALSE);
-            }
-            _webinix.clients[i] = NULL;
-            _webinix.clients_win_num[i] = 0;
-            _webinix_mutex_is_multi_client_token_valid(win, WEBUI_MUTEX_SET_FALSE, i);
-            if (win->clients_count > 0)
-                win->clients_count--;
-            // Close
-            _webinix_mutex_unlock(&_webinix.mutex_client);
-            mg_close_connection(client);
-            return;
         }
+        // Clear
+        if (win->single_client == client) {
+            win->single_client = NULL;
+            _webinix_mutex_is_single_client_token_valid(win, WEBUI_MUTEX_SET_FALSE);
+        }
+        _webinix_client_unindex(pos);
+        size_t session = _webinix.clients_session[i];
+        _webinix.clients[i] = NULL;
+        _webinix.clients_win_num[i] = 0;
+        _webinix.clients_session[i] = 0;
+        _webinix.clients_free[_webinix.clients_free_count++] = i;
+        _webinix_mutex_is_multi_client_token_valid(win, WEBUI_MUTEX_SET_FALSE, i);
+        if (win->clients_count > 0)
+            win->clients_count--;
+        // Close
+        _webinix_mutex_unlock(&_webinix.mutex_client);
+        _webinix_mutex_unlock(&_webinix.mutex_send);
+        _webinix_session_release(session);
+        _webinix_server_notify(win);
+        if (!_webinix_is_local_client(client))
+            mg_close_connection(client);
+        return;
     }
 
     // Client not found
@@ -9956,7 +14774,9 @@ static void _webinix_connection_remove(_webinix_window_t* win, struct mg_connect
     printf("[Core]\t\t_webinix_connection_remove() -> Client not found\n");
     #endif
     _webinix_mutex_unlock(&_webinix.mutex_client);
-    mg_close_connection(client);
+    _webinix_mutex_unlock(&_webinix.mutex_send);
+    if (!_webinix_is_local_client(client))
+        mg_close_connection(client);
 }
 
 static bool _webinix_connection_get_id(_webinix_window_t* win, struct mg_connection* client, size_t* connection_id) {
@@ -9966,12 +14786,11 @@ static bool _webinix_connection_get_id(_webinix_window_t* win, struct mg_connect
 
     // Find a ws client
     _webinix_mutex_lock(&_webinix.mutex_client);
-    for (size_t i = 0; i < WEBUI_MAX_IDS; i++) {
-        if (_webinix.clients[i] == client) {
-            *connection_id = i;
-            _webinix_mutex_unlock(&_webinix.mutex_client);
-            return true;
-        }
+    size_t pos = _webinix_client_find(client);
+    if (_webinix.clients_index[pos] != 0) {
+        *connection_id = _webinix.clients_index[pos] - 1;
+        _webinix_mutex_unlock(&_webinix.mutex_client);
+        return true;
     }
 
     // Client not found
@@ -9982,9 +14801,18 @@ static bool _webinix_connection_get_id(_webinix_window_t* win, struct mg_connect
     return false;
 }
 
+static bool _webinix_is_local_client(const struct mg_connection* client) {
+
+    // In-process WebView clients (`wv_in_process`) are not civetweb
+    // connections, but one address per window in `local_clients`
+    uintptr_t ptr = (uintptr_t)client;
+    uintptr_t start = (uintptr_t)_webinix.local_clients;
+    return (ptr >= start && ptr < (start + sizeof(_webinix.local_clients)));
+}
+
 static void _webinix_ws_process(
     _webinix_window_t* win, struct mg_connection* client, size_t connection_id, 
-    void* ptr, size_t len, size_t recvNum, int event_type) {
+    void* ptr, size_t len, size_t recvNum, int event_type, _webinix_arena_t* arena) {
     
     #ifdef WEBUI_LOG
     printf("[Core]\t\t_webinix_ws_process(%zu)\n", recvNum);
@@ -10108,7 +14936,7 @@ static void _webinix_ws_process(
 
                         // Event Info
                         webinix_event_inf_t* event_inf = NULL;
-                        size_t event_num = _webinix_new_event_inf(win, &event_inf);
+                        size_t event_num = _webinix_new_event_inf(win, &event_inf, arena);
                         event_inf->client = client;
                         event_inf->connection_id = connection_id;
 
@@ -10235,7 +15063,7 @@ static void _webinix_ws_process(
 
                             // Event Info
                             webinix_event_inf_t* event_inf = NULL;
-                            size_t event_num = _webinix_new_event_inf(win, &event_inf);
+                            size_t event_num = _webinix_new_event_inf(win, &event_inf, arena);
                             event_inf->client = client;
                             event_inf->connection_id = connection_id;
 
@@ -10285,7 +15113,7 @@ static void _webinix_ws_process(
 
                         // New event inf (Function Call)
                         webinix_event_inf_t* event_inf = NULL;
-                        size_t event_num = _webinix_new_event_inf(win, &event_inf);
+                        size_t event_num = _webinix_new_event_inf(win, &event_inf, arena);
 
                         // Loop trough args
                         size_t data_size_expected = 0;
@@ -10375,8 +15203,10 @@ static void _webinix_ws_process(
                             }
 
                             // Check the response
-                            if (_webinix_is_empty(event_inf->response))
+                            if (_webinix_is_empty(event_inf->response)) {
+                                _webinix_event_free_mem(event_inf, event_inf->response);
                                 event_inf->response = NULL;
+                            }
 
                             #ifdef WEBUI_LOG
                             printf(
@@ -10391,9 +15221,10 @@ static void _webinix_ws_process(
                             // [CallResponse]
 
                             // Send the packet
-                            _webinix_send_client(
+                            _webinix_send_client_arena(
                                 win, client, packet_id, WEBUI_CMD_CALL_FUNC,
-                                event_inf->response, _webinix_strlen(event_inf->response), false
+                                event_inf->response, _webinix_strlen(event_inf->response), false,
+                                event_inf->arena
                             );
 
                             // Free event
@@ -10420,10 +15251,10 @@ static void _webinix_ws_process(
                             _webinix_send_client(
                                 win, client, packet_id, WEBUI_CMD_CALL_FUNC, NULL, 0, false
                             );
-                        }
 
-                        // Free event
-                        _webinix_free_mem((void*)event_inf);
+                            // Free event
+                            _webinix_free_event_inf(win, event_num);
+                        }
                     } else if ((unsigned char)packet[WEBUI_PROTOCOL_CMD] == WEBUI_CMD_CHECK_TK) {
 
                         // Check Token Event
@@ -10504,7 +15335,7 @@ static void _webinix_ws_process(
 
                                 // Event Info
                                 webinix_event_inf_t* event_inf = NULL;
-                                size_t event_num = _webinix_new_event_inf(win, &event_inf);
+                                size_t event_num = _webinix_new_event_inf(win, &event_inf, arena);
                                 event_inf->client = client;
                                 event_inf->connection_id = connection_id;
 
@@ -10610,7 +15441,7 @@ static void _webinix_ws_process(
 
                 // Event Info
                 webinix_event_inf_t* event_inf = NULL;
-                size_t event_num = _webinix_new_event_inf(win, &event_inf);
+                size_t event_num = _webinix_new_event_inf(win, &event_inf, arena);
                 event_inf->client = client;
                 event_inf->connection_id = connection_id;
 
@@ -10644,7 +15475,7 @@ static void _webinix_ws_process(
 
                 // Event Info
                 webinix_event_inf_t* event_inf = NULL;
-                size_t event_num = _webinix_new_event_inf(win, &event_inf);
+                size_t event_num = _webinix_new_event_inf(win, &event_inf, arena);
                 event_inf->client = client;
                 event_inf->connection_id = connection_id;
 
@@ -10687,11 +15518,16 @@ static WEBUI_THREAD_RECEIVE {
     _webinix_recv_arg_t* arg = (_webinix_recv_arg_t* ) _arg;
 
     // Process
-    _webinix_ws_process(arg->win, arg->client, arg->connection_id, arg->ptr, arg->len, arg->recvNum, arg->event_type);
+    _webinix_ws_process(arg->win, arg->client, arg->connection_id, arg->ptr, arg->len, arg->recvNum, arg->event_type, arg->arena);
 
     // Free
-    _webinix_free_mem((void*)arg->ptr);
-    _webinix_free_mem((void*)arg);
+    _webinix_arena_t* arena = arg->arena;
+    if (!_webinix_arena_owns(arena, arg->ptr))
+        _webinix_free_mem((void*)arg->ptr);
+    if (!_webinix_arena_owns(arena, arg))
+        _webinix_free_mem((void*)arg);
+    _webinix_arena_release(arena);
+    _webinix_pool_flush();
 
     WEBUI_THREAD_RETURN
 }
@@ -10799,109 +15635,6 @@ static bool _webinix_socket_test_listen_win32(size_t port_num) {
     return true;
 }
 
-static int _webinix_system_win32_out(const char* cmd, char ** output, bool show) {
-
-    #ifdef WEBUI_LOG
-    printf("[Core]\t\t_webinix_system_win32_out()\n");
-    #endif
-
-        // Ini
-        *
-        output = NULL;
-    if (cmd == NULL)
-        return -1;
-
-    // Return
-    DWORD Return = 0;
-
-    // Flags
-    DWORD CreationFlags = CREATE_NO_WINDOW;
-    if (show)
-        CreationFlags = SW_SHOW;
-
-    SECURITY_ATTRIBUTES sa;
-    sa.nLength = sizeof(SECURITY_ATTRIBUTES);
-    sa.bInheritHandle = TRUE;
-    sa.lpSecurityDescriptor = NULL;
-    HANDLE stdout_read, stdout_write;
-    if (!CreatePipe(&stdout_read,&stdout_write,&sa, 0)) {
-        return -1;
-    }
-    if (!SetHandleInformation(stdout_read, HANDLE_FLAG_INHERIT, 0)) {
-        CloseHandle(stdout_read);
-        CloseHandle(stdout_write);
-        return -1;
-    }
-
-    STARTUPINFOA si;
-    ZeroMemory(&si, sizeof(STARTUPINFOA));
-    si.cb = sizeof(STARTUPINFOA);
-    si.dwFlags = STARTF_USESHOWWINDOW | STARTF_USESTDHANDLES;
-    si.wShowWindow = SW_HIDE;
-    si.hStdOutput = stdout_write;
-    si.hStdError = stdout_write;
-
-    PROCESS_INFORMATION pi;
-    ZeroMemory(&pi, sizeof(PROCESS_INFORMATION));
-
-    if (!CreateProcessA(
-            NULL, // No module name (use cmd line)
-            (LPSTR) cmd, // Command line
-            NULL, // Process handle not inheritable
-            NULL, // Thread handle not inheritable
-            TRUE, // Set handle inheritance to FALSE
-            CreationFlags, // Creation flags
-            NULL, // Use parent's environment block
-            NULL, // Use parent's starting directory
-            &
-            si, // Pointer to STARTUP INFO structure
-            &
-            pi
-        )) // Pointer to PROCESS_INFORMATION structure
-    {
-        CloseHandle(stdout_read);
-        CloseHandle(stdout_write);
-        return -1;
-    }
-    CloseHandle(stdout_write);
-
-    SetFocus(pi.hProcess);
-    WaitForSingleObject(pi.hProcess, INFINITE);
-    GetExitCodeProcess(pi.hProcess,&Return);
-
-    DWORD bytes_read;
-    char buffer[WEBUI_STDOUT_BUF];
-    size_t output_size = 0;
-
-    while(ReadFile(stdout_read, buffer, WEBUI_STDOUT_BUF,&bytes_read, NULL) && bytes_read > 0) {
-
-        char* new_output = realloc(*output, output_size + bytes_read + 1);
-        if (new_output == NULL) {
-            free(*output);
-            CloseHandle(stdout_read);
-            CloseHandle(pi.hProcess);
-            CloseHandle(pi.hThread);
-            return -1;
-        }
-
-        * output = new_output;
-        memcpy(*output + output_size, buffer, bytes_read);
-        output_size += bytes_read;
-    }
-
-    if (*output != NULL)
-        (*output)[output_size] = '\0';
-
-    CloseHandle(stdout_read);
-    CloseHandle(pi.hProcess);
-    CloseHandle(pi.hThread);
-
-    if (Return == 0)
-        return 0;
-    else
-        return -1;
-}
-
 /*
     static BOOL CALLBACK _webinix_enum_windows_proc_win32(HWND hwnd, LPARAM
     targetProcessId) {
@@ -11811,7 +16544,342 @@ BOOL WINAPI DllMain(HINSTANCE hinstDLL, DWORD fdwReason, LPVOID lpReserved) {
             if (win->webView) {
                 win->webView->open = false;
             }
+            // In-process connection
+            if (win->wv_in_process) {
+                struct mg_connection* client = (struct mg_connection*)&_webinix.local_clients[win->num];
+                size_t connection_id = 0;
+                if (_webinix_connection_get_id(win, client, &connection_id))
+                    _webinix_receive(win, client, WEBUI_WS_CLOSE, NULL, 0);
+            }
+        }
+    }
+
+    // -- In-process transport (`wv_in_process`) ----
+
+    static bool _webinix_wv_local_supported(void) {
+        return (
+            webkit_web_context_get_default && webkit_web_context_register_uri_scheme
+            && webkit_uri_scheme_request_get_uri && webkit_uri_scheme_request_finish && webkit_web_view_get_uri
+            && webkit_web_view_get_user_content_manager && webkit_user_content_manager_register_script_message_handler
+            && webkit_javascript_result_get_js_value && jsc_value_to_string
+            && (webkit_web_view_evaluate_javascript || webkit_web_view_run_javascript)
+            && g_memory_input_stream_new_from_data && g_object_unref && g_free
+        );
+    }
+
+    static void _webinix_wv_local_free(void* ptr) {
+        _webinix_free_mem(ptr);
+    }
+
+    static char* _webinix_wv_local_copy(const void* data, size_t len) {
+        char* buf = (char*)_webinix_malloc(len);
+        if (len > 0)
+            memcpy(buf, data, len);
+        return buf;
+    }
+
+    static char* _webinix_wv_local_read(const char* full_path, size_t* len) {
+
+        int64_t file_size = 0;
+        time_t file_mtime = 0;
+        if (!_webinix_file_stat(full_path, &file_size, &file_mtime))
+            return NULL;
+        FILE* file = fopen(full_path, "rb");
+        if (file == NULL)
+            return NULL;
+        char* buf = (char*)_webinix_malloc((size_t)file_size);
+        *len = fread(buf, 1, (size_t)file_size, file);
+        fclose(file);
+        return buf;
+    }
+
+    static bool _webinix_wv_local_path_safe(const char* path) {
+
+        // The decoded path is joined to the root folder, so no `..`
+        // segment may climb out of it (`/a/../../etc`, `/%2e%2e/`)
+        const char* segment = path;
+        while (segment != NULL) {
+            if (*segment == '/')
+                segment++;
+            size_t segment_len = strcspn(segment, "/");
+            if (segment_len == 2 && segment[0] == '.' && segment[1] == '.')
+                return false;
+            segment = (segment[segment_len] == '/' ? (segment + segment_len) : NULL);
+        }
+        return true;
+    }
+
+    static char* _webinix_wv_local_file(_webinix_window_t* win, const char* path, size_t* len, const char** mime) {
+
+        #ifdef WEBUI_LOG
+        printf("[Core]\t\t_webinix_wv_local_file([%s])\n", path);
+        #endif
+
+        // Same resources as `_webinix_http_handler()`, without the
+        // custom files handlers and runtimes (those windows use the
+        // server). Caller must hold `mutex_http_handler`.
+
+        *len = 0;
+        *mime = "text/html";
+
+        if (strcmp(path, "/webinix.js") == 0) {
+            // Webinix Bridge
+            win->wait = true;
+            char js[WEBUI_BRIDGE_CONFIG_BUF];
+            if (!_webinix_generate_js_bridge(win, js, sizeof(js)))
+                js[0] = 0x00;
+            *mime = "application/javascript";
+            *len = _webinix_strlen(js);
+            return _webinix_wv_local_copy(js, *len);
+        }
+        if (strcmp(path, "/webinix_bridge.js") == 0) {
+            // Webinix Bridge (static)
+            *mime = "application/javascript";
+            *len = (sizeof(webinix_javascript_bridge) - 1);
+            return _webinix_wv_local_copy(webinix_javascript_bridge, *len);
+        }
+
+        // Asset bundle, then root folder archive
+        _webinix_bundle_t* bundles[2] = {win->bundle, win->archive};
+        for (size_t b = 0; b < 2; b++) {
+            if (bundles[b] == NULL || (win->is_embedded_html && strcmp(path, "/") == 0))
+                continue;
+            const _webinix_bundle_asset_t* entry = _webinix_bundle_find(bundles[b], path);
+            if (entry == NULL) {
+                // [/folder] Index file
+                const char* index_files[] = {"index.html", "index.htm"};
+                size_t path_len = _webinix_strlen(path);
+                const char* sep = ((path_len > 0 && path[path_len - 1] == '/') ? "" : "/");
+                char index_path[WEBUI_MAX_PATH];
+                for (size_t i = 0; i < (sizeof(index_files) / sizeof(index_files[0])) && entry == NULL; i++) {
+                    WEBUI_SN_PRINTF_STATIC(index_path, sizeof(index_path), "%s%s%s", path, sep, index_files[i]);
+                    entry = _webinix_bundle_find(bundles[b], index_path);
+                }
+            }
+            // Compressed only entries need a browser that accepts gzip
+            if (entry != NULL && entry->asset.data != NULL) {
+                *mime = entry->asset.mime_type;
+                *len = entry->asset.length;
+                return _webinix_wv_local_copy(entry->asset.data, *len);
+            }
+        }
+
+        if (strcmp(path, "/") == 0 && win->is_embedded_html) {
+            // Main HTML
+            *len = _webinix_strlen(win->html);
+            return _webinix_wv_local_copy(win->html, *len);
+        }
+
+        const _webinix_path_entry_t* entry = _webinix_path_resolve(win, path);
+
+        if ((strcmp(path, "/favicon.ico") == 0 || strcmp(path, "/favicon.svg") == 0) &&
+            (entry->kind != WEBUI_PATH_FILE || (win->icon != NULL && win->icon_type != NULL))) {
+            // Custom user icon, or the default one
+            bool custom = (win->icon != NULL && win->icon_type != NULL);
+            *mime = (custom ? win->icon_type : webinix_def_icon_type);
+            *len = _webinix_strlen(custom ? win->icon : webinix_def_icon);
+            return _webinix_wv_local_copy((custom ? win->icon : webinix_def_icon), *len);
+        }
+
+        if (entry->kind == WEBUI_PATH_REDIRECT) {
+            // [/folder] Serve the index file in place, there is
+            // no redirect in a URI scheme response
+            char index[WEBUI_MAX_PATH];
+            WEBUI_SN_PRINTF_STATIC(index, sizeof(index), "%s", (entry->redirect + _webinix_strlen(win->url_prefix)));
+            entry = _webinix_path_resolve(win, index);
+        }
+
+        if (entry->kind == WEBUI_PATH_FILE) {
+            // [/file]
+            *mime = entry->mime_type;
+            return _webinix_wv_local_read(entry->full_path, len);
+        }
+
+        // [invalid]
+        return NULL;
+    }
+
+    static void _webinix_wv_local_request(void* request, void* arg) {
+        (void)arg;
+
+        // Called by WebKit (GTK thread) for each `webinix://<window number>/<path>`
+        const char* uri = webkit_uri_scheme_request_get_uri(request);
+
+        #ifdef WEBUI_LOG
+        printf("[Core]\t\t_webinix_wv_local_request([%s])\n", uri);
+        #endif
+
+        // Window number
+        size_t num = 0;
+        const char* p = (uri != NULL ? strstr(uri, "://") : NULL);
+        if (p != NULL)
+            num = (size_t)strtoul(p + 3, (char**)&p, 10);
+
+        // Path, without the query and the fragment
+        char path[WEBUI_MAX_PATH] = "/";
+        if (p != NULL && *p == '/') {
+            size_t path_len = strcspn(p, "?#");
+            if (mg_url_decode(p, (int)path_len, path, (int)sizeof(path), 0) < 1)
+                WEBUI_STR_COPY_STATIC(path, sizeof(path), "/");
+        }
+        bool path_safe = _webinix_wv_local_path_safe(path);
+
+        char* data = NULL;
+        size_t len = 0;
+        char mime[128] = {0};
+        _webinix_mutex_lock(&_webinix.mutex_http_handler);
+        _webinix_window_t* win = (num > 0 ? _webinix_wins_get(num) : NULL);
+        if (!_webinix_mutex_app_is_exit_now(WEBUI_MUTEX_GET_STATUS) && win != NULL && win->wv_in_process &&
+            path_safe) {
+            const char* type = NULL;
+            data = _webinix_wv_local_file(win, path, &len, &type);
+            WEBUI_SN_PRINTF_STATIC(mime, sizeof(mime), "%s", (type != NULL ? type : "application/octet-stream"));
+        }
+        _webinix_mutex_unlock(&_webinix.mutex_http_handler);
+
+        if (data == NULL) {
+            #ifdef WEBUI_LOG
+            printf("[Core]\t\t_webinix_wv_local_request() -> Not found\n");
+            #endif
+            len = _webinix_strlen(webinix_html_res_not_available);
+            data = _webinix_wv_local_copy(webinix_html_res_not_available, len);
+            WEBUI_STR_COPY_STATIC(mime, sizeof(mime), "text/html");
+        }
+
+        // The stream owns `data`
+        void* stream = g_memory_input_stream_new_from_data(data, (ssize_t)len, _webinix_wv_local_free);
+        webkit_uri_scheme_request_finish(request, stream, (int64_t)len, mime);
+        g_object_unref(stream);
+    }
+
+    // Script Message Event
+    static void _webinix_wv_event_message(void* manager, void* result, void* arg) {
+        (void)manager;
+
+        #ifdef WEBUI_LOG
+        printf("[Core]\t\t_webinix_wv_event_message()\n");
+        #endif
+
+        _webinix_window_t* win = _webinix_dereference_win_ptr(arg);
+        if (_webinix_mutex_app_is_exit_now(WEBUI_MUTEX_GET_STATUS) || win == NULL || win->webView == NULL)
+            return;
+
+        // Only the window's own pages talk to the backend, not a page
+        // the WebView navigated to (`https://...`)
+        char origin[64] = {0};
+        WEBUI_SN_PRINTF_STATIC(origin, sizeof(origin), WEBUI_WV_SCHEME "://%zu/", win->num);
+        const char* page = webkit_web_view_get_uri(win->webView->gtk_wv);
+        if (page == NULL || strncmp(page, origin, _webinix_strlen(origin)) != 0) {
+            #ifdef WEBUI_LOG
+            printf("[Core]\t\t_webinix_wv_event_message() -> Message from [%s] ignored\n", (page != NULL ? page : ""));
+            #endif
+            return;
+        }
+
+        char* message = jsc_value_to_string(webkit_javascript_result_get_js_value(result));
+        if (message == NULL)
+            return;
+
+        // The bridge posts `open`, `close`, or a base64 packet,
+        // the same events a WebSocket connection would have
+        struct mg_connection* client = (struct mg_connection*)&_webinix.local_clients[win->num];
+        size_t connection_id = 0;
+        bool registered = _webinix_connection_get_id(win, client, &connection_id);
+
+        if (strcmp(message, "open") == 0) {
+            // A reloaded page opens again without closing first
+            if (registered)
+                _webinix_receive(win, client, WEBUI_WS_CLOSE, NULL, 0);
+            _webinix_receive(win, client, WEBUI_WS_OPEN, NULL, 0);
+        }
+        else if (strcmp(message, "close") == 0) {
+            if (registered)
+                _webinix_receive(win, client, WEBUI_WS_CLOSE, NULL, 0);
+        }
+        else if (registered) {
+            size_t message_len = _webinix_strlen(message);
+            size_t len = (((message_len + 3) / 4) * 3);
+            unsigned char* packet = (unsigned char*)_webinix_pool_get(len);
+            if (mg_base64_decode(message, message_len, packet, &len) == -1 && len >= WEBUI_PROTOCOL_SIZE)
+                _webinix_receive(win, client, WEBUI_WS_DATA, packet, len);
+            _webinix_pool_put((void*)packet);
+        }
+
+        g_free(message);
+    }
+
+    // Followed by the script, in one pool buffer
+    typedef struct _webinix_wv_local_packet_t {
+        size_t num;
+        char* script;
+    } _webinix_wv_local_packet_t;
+
+    static int _webinix_wv_local_send_schedule(void* arg) {
+
+        // Fired by GTK, in order
+        _webinix_wv_local_packet_t* packet = (_webinix_wv_local_packet_t*)arg;
+        _webinix_window_t* win = _webinix.wins[packet->num];
+        if (win != NULL && win->webView != NULL && win->webView->open) {
+            if (webkit_web_view_evaluate_javascript)
+                webkit_web_view_evaluate_javascript(win->webView->gtk_wv, packet->script, -1, NULL, NULL, NULL, NULL, NULL);
+            else
+                webkit_web_view_run_javascript(win->webView->gtk_wv, packet->script, NULL, NULL, NULL);
+        }
+        _webinix_pool_put((void*)packet);
+        return 0;
+    }
+
+    static int _webinix_wv_local_send(_webinix_window_t* win, const char* packet, size_t len) {
+
+        #ifdef WEBUI_LOG
+        printf("[Core]\t\t_webinix_wv_local_send([%zu])\n", len);
+        #endif
+
+        // Any thread, GTK runs the script
+        // [__webinix_local_recv("][Base64 Packet]["); ]
+        const char* prefix = WEBUI_WV_RECV "(\"";
+        size_t prefix_len = _webinix_strlen(prefix);
+        size_t b64_len = ((((len + 2) / 3) * 4) + 1);
+        size_t script_len = prefix_len + b64_len + 4;
+        _webinix_wv_local_packet_t* arg = (_webinix_wv_local_packet_t*)_webinix_pool_get(
+            sizeof(_webinix_wv_local_packet_t) + script_len);
+        char* script = (char*)(arg + 1);
+        memcpy(script, prefix, prefix_len);
+        mg_base64_encode((const unsigned char*)packet, len, (script + prefix_len), &b64_len);
+        memcpy(script + prefix_len + (b64_len - 1), "\");", 4);
+
+        arg->num = win->num;
+        arg->script = script;
+        g_idle_add(_webinix_wv_local_send_schedule, (void*)arg);
+        return (int)len;
+    }
+
+    static void _webinix_wv_load_uri(_webinix_wv_linux_t* webView, const char* url) {
+
+        #ifdef WEBUI_LOG
+        printf("[Core]\t\t_webinix_wv_load_uri([%s])\n", url);
+        #endif
+
+        // In-process windows load their own server URLs
+        // as `webinix://<window number>/<path>`
+        _webinix_window_t* win = _webinix.wins[webView->num];
+        if (win != NULL && win->wv_in_process) {
+            char server[128] = {0};
+            WEBUI_SN_PRINTF_STATIC(server, sizeof(server), WEBUI_HTTP_PROTOCOL "localhost:%zu%s",
+                win->server_port, win->url_prefix);
+            size_t server_len = _webinix_strlen(server);
+            if (strncmp(url, server, server_len) == 0) {
+                const char* path = (url + server_len);
+                size_t local_len = (_webinix_strlen(path) + 64);
+                char* local = (char*)_webinix_malloc(local_len);
+                WEBUI_SN_PRINTF_DYN(local, local_len, WEBUI_WV_SCHEME "://%zu%s%s",
+                    win->num, (*path == '/' ? "" : "/"), path);
+                webkit_web_view_load_uri(webView->gtk_wv, local);
+                _webinix_free_mem((void*)local);
+                return;
+            }
         }
+        webkit_web_view_load_uri(webView->gtk_wv, url);
     }
 
     static bool _webinix_wv_set_size(_webinix_wv_linux_t* webView, int windowWidth, int windowHeight) {
@@ -11872,7 +16940,7 @@ BOOL WINAPI DllMain(HINSTANCE hinstDLL, DWORD fdwReason, LPVOID lpReserved) {
         #endif
         if (webView) {
             if (webView->gtk_win) {
-                webkit_web_view_load_uri(webView->gtk_wv, webView->url);
+                _webinix_wv_load_uri(webView, webView->url);
                 return true;
             }
         }
@@ -11955,13 +17023,28 @@ BOOL WINAPI DllMain(HINSTANCE hinstDLL, DWORD fdwReason, LPVOID lpReserved) {
         g_signal_connect_data(win->webView->gtk_win, "destroy", G_CALLBACK(
             _webinix_wv_event_closed), (void *)win, NULL, 0);
         
+        // In-process transport
+        if (win->wv_in_process) {
+            static bool scheme_registered = false;
+            if (!scheme_registered) {
+                // Once per (default) web context, before the first load
+                webkit_web_context_register_uri_scheme(webkit_web_context_get_default(),
+                    WEBUI_WV_SCHEME, _webinix_wv_local_request, NULL, NULL);
+                scheme_registered = true;
+            }
+            void* manager = webkit_web_view_get_user_content_manager(win->webView->gtk_wv);
+            webkit_user_content_manager_register_script_message_handler(manager, WEBUI_WV_SCHEME);
+            g_signal_connect_data(manager, "script-message-received::" WEBUI_WV_SCHEME, G_CALLBACK(
+                _webinix_wv_event_message), (void *)win, NULL, 0);
+        }
+
         // Linux GTK WebView Auto JS Inject
         if (_webinix.config.show_auto_js_inject) {
             // ...
         }
 
         // Show
-        webkit_web_view_load_uri(win->webView->gtk_wv, win->webView->url);
+        _webinix_wv_load_uri(win->webView, win->webView->url);
         gtk_widget_show_all(win->webView->gtk_win);
         win->webView->open = true;
 
@@ -12113,6 +17196,37 @@ BOOL WINAPI DllMain(HINSTANCE hinstDLL, DWORD fdwReason, LPVOID lpReserved) {
             webkit_web_view_get_title = (webkit_web_view_get_title_func)dlsym(
                 libwebkit, "webkit_web_view_get_title");
 
+            // WebView In-process Symbol Addresses (optional, JSC and GLib
+            // symbols are found through WebKit dependencies)
+            webkit_web_context_get_default = (webkit_web_context_get_default_func)dlsym(
+                libwebkit, "webkit_web_context_get_default");
+            webkit_web_context_register_uri_scheme = (webkit_web_context_register_uri_scheme_func)dlsym(
+                libwebkit, "webkit_web_context_register_uri_scheme");
+            webkit_uri_scheme_request_get_uri = (webkit_uri_scheme_request_get_uri_func)dlsym(
+                libwebkit, "webkit_uri_scheme_request_get_uri");
+            webkit_uri_scheme_request_finish = (webkit_uri_scheme_request_finish_func)dlsym(
+                libwebkit, "webkit_uri_scheme_request_finish");
+            webkit_web_view_get_uri = (webkit_web_view_get_uri_func)dlsym(
+                libwebkit, "webkit_web_view_get_uri");
+            webkit_web_view_get_user_content_manager = (webkit_web_view_get_user_content_manager_func)dlsym(
+                libwebkit, "webkit_web_view_get_user_content_manager");
+            webkit_user_content_manager_register_script_message_handler = (webkit_user_content_manager_register_script_message_handler_func)dlsym(
+                libwebkit, "webkit_user_content_manager_register_script_message_handler");
+            webkit_javascript_result_get_js_value = (webkit_javascript_result_get_js_value_func)dlsym(
+                libwebkit, "webkit_javascript_result_get_js_value");
+            webkit_web_view_run_javascript = (webkit_web_view_run_javascript_func)dlsym(
+                libwebkit, "webkit_web_view_run_javascript");
+            webkit_web_view_evaluate_javascript = (webkit_web_view_evaluate_javascript_func)dlsym(
+                libwebkit, "webkit_web_view_evaluate_javascript");
+            jsc_value_to_string = (jsc_value_to_string_func)dlsym(
+                libwebkit, "jsc_value_to_string");
+            g_memory_input_stream_new_from_data = (g_memory_input_stream_new_from_data_func)dlsym(
+                libwebkit, "g_memory_input_stream_new_from_data");
+            g_object_unref = (g_object_unref_func)dlsym(
+                libwebkit, "g_object_unref");
+            g_free = (g_free_func)dlsym(
+                libwebkit, "g_free");
+
             // Check GTK
             if (
                 // GTK v3
@@ -12183,11 +17297,24 @@ BOOL WINAPI DllMain(HINSTANCE hinstDLL, DWORD fdwReason, LPVOID lpReserved) {
             _webinix_webview_update(win);
         }
 
+        // In-process transport, windows with custom files
+        // handlers or a runtime need the server
+        win->wv_in_process = (
+            _webinix.config.wv_in_process && _webinix_wv_local_supported()
+            && win->files_handler == NULL && win->files_handler_window == NULL
+            && win->files_handler_stream == NULL && win->runtime == None
+            && win->num < WEBUI_MAX_IDS // One `local_clients` address per window
+        );
+        #ifdef WEBUI_LOG
+        printf("[Core]\t\t_webinix_wv_show() -> In-process transport [%d]\n", win->wv_in_process);
+        #endif
+
         // Copy URL
         char* url_copy = _webinix_str_dup(url);
 
         // Initializing the Linux WebView struct
         _webinix_wv_linux_t* webView = (_webinix_wv_linux_t*) _webinix_malloc(sizeof(_webinix_wv_linux_t));
+        webView->num = win->num;
         webView->url = url_copy;
         webView->width = (win->width > 0 ? win->width : WEBUI_DEF_WIDTH);
         webView->height = (win->height > 0 ? win->height : WEBUI_DEF_HEIGHT);
@@ -12582,8 +17709,9 @@ static WEBUI_THREAD_MONITOR {
 
     // Stop if a lower window already monitoring the same folder
     // Loop trough all windows
-    for (size_t i = 1; i < WEBUI_MAX_IDS; i++) {
-        if ((_webinix.wins[i] != NULL) && (_webinix.wins[i] != win) && (i < win->num)) {
+    _webinix_wins_view_t* view = _webinix_wins_view();
+    for (size_t i = 1; i < view->capacity; i++) {
+        if ((view->wins[i] != NULL) && (view->wins[i] != win) && (i < win->num)) {
             WEBUI_THREAD_RETURN
         }
     }
@@ -12620,13 +17748,10 @@ static WEBUI_THREAD_MONITOR {
                 #ifdef WEBUI_LOG
                 printf("[Core]\t\t[Thread .] _webinix_folder_monitor_thread() -> Folder updated\n");
                 #endif
+                // Drop cached URL resolutions before the reload
+                _webinix_path_cache_invalidate();
                 // Loop trough all connected clients in this window
-                for (size_t i = 0; i < WEBUI_MAX_IDS; i++) {
-                    if ((_webinix.clients[i] != NULL) && (_webinix.clients_win_num[i] == win->num) && 
-                        (_webinix_mutex_is_multi_client_token_valid(win, WEBUI_MUTEX_GET_STATUS, i))) {
-                        _webinix_send_client(win, _webinix.clients[i], 0, WEBUI_CMD_JS_QUICK, js, js_len, false);
-                    }
-                }
+                _webinix_send_all_clients(win, WEBUI_CMD_JS_QUICK, js, js_len);
             } else {
                 #ifdef WEBUI_LOG
                 printf("[Core]\t\t[Thread .] _webinix_folder_monitor_thread() -> Failed to read folder changes\n");
@@ -12672,13 +17797,10 @@ static WEBUI_THREAD_MONITOR {
                         #ifdef WEBUI_LOG
                         printf("[Core]\t\t[Thread .] _webinix_folder_monitor_thread() -> Folder updated\n");
                         #endif
+                        // Drop cached URL resolutions before the reload
+                        _webinix_path_cache_invalidate();
                         // Loop trough all connected clients in this window
-                        for (size_t i = 0; i < WEBUI_MAX_IDS; i++) {
-                            if ((_webinix.clients[i] != NULL) && (_webinix.clients_win_num[i] == win->num) && 
-                                (_webinix_mutex_is_multi_client_token_valid(win, WEBUI_MUTEX_GET_STATUS, i))) {
-                                _webinix_send_client(win, _webinix.clients[i], 0, WEBUI_CMD_JS_QUICK, js, js_len, false);
-                            }
-                        }
+                        _webinix_send_all_clients(win, WEBUI_CMD_JS_QUICK, js, js_len);
                     }
                 }
                 i += sizeof(struct inotify_event) + event->len;
@@ -12721,13 +17843,10 @@ static WEBUI_THREAD_MONITOR {
                     #ifdef WEBUI_LOG
                     printf("[Core]\t\t[Thread .] _webinix_folder_monitor_thread() -> Folder updated\n");
                     #endif
+                    // Drop cached URL resolutions before the reload
+                    _webinix_path_cache_invalidate();
                     // Loop trough all connected clients in this window
-                    for (size_t i = 0; i < WEBUI_MAX_IDS; i++) {
-                        if ((_webinix.clients[i] != NULL) && (_webinix.clients_win_num[i] == win->num) && 
-                            (_webinix_mutex_is_multi_client_token_valid(win, WEBUI_MUTEX_GET_STATUS, i))) {
-                            _webinix_send_client(win, _webinix.clients[i], 0, WEBUI_CMD_JS_QUICK, js, js_len, false);
-                        }
-                    }
+                    _webinix_send_all_clients(win, WEBUI_CMD_JS_QUICK, js, js_len);
                 }
             }
         }
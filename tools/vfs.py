@@ -0,0 +1,150 @@
+"""
+Webinix Asset Bundle Generator
+
+Embed a folder into a Webinix asset bundle, served with
+`webinix_set_asset_bundle()` or `webinix_set_asset_bundle_file()`.
+
+Assets are sorted by path, and each one has a precomputed MIME type,
+ETag and, when it is smaller, a gzip compressed variant.
+
+Usage:
+    python vfs.py <directory> <output.h>        C header (webinix_asset_t array)
+    python vfs.py <directory> <output.bundle>   Binary bundle file (memory-mapped)
+"""
+
+import gzip
+import hashlib
+import mimetypes
+import os
+import struct
+import sys
+
+# Bundle file format, keep in sync with `webinix_set_asset_bundle_file()`
+BUNDLE_MAGIC = b'WEBUIBN1'
+BUNDLE_HEADER = struct.Struct('<8sII')        # Magic, Count, Reserved
+BUNDLE_ENTRY = struct.Struct('<IIIIQQQQ')     # Path, MIME, ETag, Reserved, Data, Size, Gzip, Gzip Size
+
+MIME_TYPES = {
+    '.html': 'text/html',
+    '.htm': 'text/html',
+    '.css': 'text/css',
+    '.js': 'application/javascript',
+    '.mjs': 'application/javascript',
+    '.json': 'application/json',
+    '.map': 'application/json',
+    '.svg': 'image/svg+xml',
+    '.wasm': 'application/wasm',
+    '.woff': 'font/woff',
+    '.woff2': 'font/woff2',
+    '.ico': 'image/x-icon',
+}
+
+
+def collect_assets(directory):
+    assets = []
+    for root, _, filenames in os.walk(directory):
+        for filename in filenames:
+            filepath = os.path.join(root, filename)
+            path = '/' + os.path.relpath(filepath, directory).replace('\\', '/')
+            with open(filepath, 'rb') as f:
+                data = f.read()
+            ext = os.path.splitext(filename)[1].lower()
+            mime = MIME_TYPES.get(ext) or mimetypes.guess_type(filename)[0]
+            etag = '"' + hashlib.sha256(data).hexdigest()[:16] + '"'
+            compressed = gzip.compress(data, compresslevel=9, mtime=0)
+            if len(compressed) >= len(data):
+                compressed = None
+            assets.append((path, mime, etag, data, compressed))
+    # Same order as `strcmp()`
+    assets.sort(key=lambda a: a[0].encode('utf-8'))
+    return assets
+
+
+def c_string(s):
+    if s is None:
+        return 'NULL'
+    return '"' + s.replace('\\', '\\\\').replace('"', '\\"') + '"'
+
+
+def c_array(name, data, out):
+    out.write(f'static const unsigned char {name}[] = {{\n')
+    for i in range(0, len(data), 16):
+        out.write('    ' + ','.join(f'0x{b:02x}' for b in data[i:i + 16]) + ',\n')
+    out.write('};\n')
+
+
+def write_header(assets, output):
+    with open(output, 'w', newline='\n') as out:
+        out.write('// Generated by Webinix `tools/vfs.py`, do not edit.\n\n')
+        out.write('#ifndef WEBUI_ASSETS_H\n')
+        out.write('#define WEBUI_ASSETS_H\n\n')
+        out.write('#include "webinix.h"\n\n')
+        for i, (path, mime, etag, data, compressed) in enumerate(assets):
+            out.write(f'// {path}\n')
+            c_array(f'webinix_asset_{i}', data, out)
+            if compressed is not None:
+                c_array(f'webinix_asset_{i}_gz', compressed, out)
+            out.write('\n')
+        out.write('static const webinix_asset_t webinix_assets[] = {\n')
+        for i, (path, mime, etag, data, compressed) in enumerate(assets):
+            gz = f'webinix_asset_{i}_gz, {len(compressed)}' if compressed is not None else 'NULL, 0'
+            out.write(f'    {{{c_string(path)}, {c_string(mime)}, {c_string(etag)}, '
+                      f'webinix_asset_{i}, {len(data)}, {gz}}},\n')
+        out.write('};\n\n')
+        out.write('static const size_t webinix_assets_count = sizeof(webinix_assets) / sizeof(webinix_assets[0]);\n\n')
+        out.write('#endif // WEBUI_ASSETS_H\n')
+
+
+def write_bundle(assets, output):
+    # [Header][Entries][Strings][Data]
+    strings = bytearray()
+    strings_offset = BUNDLE_HEADER.size + (BUNDLE_ENTRY.size * len(assets))
+
+    def add_string(s):
+        if s is None:
+            return 0
+        offset = strings_offset + len(strings)
+        strings.extend(s.encode('utf-8') + b'\0')
+        return offset
+
+    names = [(add_string(p), add_string(m), add_string(e)) for p, m, e, _, _ in assets]
+
+    blobs = bytearray()
+    data_offset = strings_offset + len(strings)
+    data_offset += (-data_offset) % 8
+
+    def add_blob(b):
+        if b is None:
+            return 0, 0
+        blobs.extend(b'\0' * ((-len(blobs)) % 8))
+        offset = data_offset + len(blobs)
+        blobs.extend(b)
+        return offset, len(b)
+
+    entries = bytearray()
+    for (path_off, mime_off, etag_off), (_, _, _, data, compressed) in zip(names, assets):
+        data_off, data_len = add_blob(data)
+        gzip_off, gzip_len = add_blob(compressed)
+        entries += BUNDLE_ENTRY.pack(path_off, mime_off, etag_off, 0, data_off, data_len, gzip_off, gzip_len)
+
+    with open(output, 'wb') as out:
+        out.write(BUNDLE_HEADER.pack(BUNDLE_MAGIC, len(assets), 0))
+        out.write(entries)
+        out.write(strings)
+        out.write(b'\0' * (data_offset - strings_offset - len(strings)))
+        out.write(blobs)
+
+
+if __name__ == '__main__':
+    if len(sys.argv) != 3:
+        print(f'Usage: {sys.argv[0]} <directory> <output.h | output.bundle>')
+        sys.exit(1)
+
+    directory = sys.argv[1]
+    output = sys.argv[2]
+    assets = collect_assets(directory)
+    if output.endswith('.h'):
+        write_header(assets, output)
+    else:
+        write_bundle(assets, output)
+    print(f'Generated {output} from {directory} ({len(assets)} assets)')